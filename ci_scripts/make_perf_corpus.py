@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+# Generates the synthetic EPUBs we use for performance testing:
+#
+#   many-small-files.epub   lots of short chapters (spine/manifest churn)
+#   one-huge-file.epub      a single multi-megabyte chapter (editor paths)
+#   css-heavy.epub          many large stylesheets (CSS parse paths)
+#   image-heavy.epub        many binary resources (zip inflate/deflate paths)
+#
+# The books are deterministic for a given --scale so timings taken on
+# different days stay comparable.  Usage:
+#
+#   python3 ci_scripts/make_perf_corpus.py --output-dir perf_corpus [--scale 1.0]
+#
+# Open the results in Sigil (or drive it with a plugin) and time the
+# operation you care about: open, save, Find All, reports, etc.
+
+import argparse
+import base64
+import os
+import random
+import zipfile
+
+CONTAINER_XML = """<?xml version="1.0" encoding="UTF-8"?>
+<container version="1.0" xmlns="urn:oasis:names:tc:opendocument:xmlns:container">
+  <rootfiles>
+    <rootfile full-path="OEBPS/content.opf" media-type="application/oebps-package+xml"/>
+  </rootfiles>
+</container>
+"""
+
+# A valid 1x1 PNG; padded with incompressible bytes to reach target size.
+TINY_PNG = base64.b64decode(
+    "iVBORw0KGgoAAAANSUhEUgAAAAEAAAABCAYAAAAfFcSJAAAADUlEQVR42mNk"
+    "YPhfDwAChwGA60e6kgAAAABJRU5ErkJggg=="
+)
+
+WORDS = ("lorem ipsum dolor sit amet consectetur adipiscing elit sed do "
+         "eiusmod tempor incididunt ut labore et dolore magna aliqua").split()
+
+
+def chapter_text(rng, paragraphs):
+    parts = []
+    for p in range(paragraphs):
+        words = [rng.choice(WORDS) for _ in range(60)]
+        # sprinkle in markup so the books exercise tag-dense paths too
+        words[10] = "<i>%s</i>" % words[10]
+        words[30] = '<a href="#p%d">%s</a>' % (p, words[30])
+        parts.append('<p id="p%d">%s</p>' % (p, " ".join(words)))
+    return "\n".join(parts)
+
+
+def xhtml(title, body):
+    return ("<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+            "<!DOCTYPE html>\n"
+            "<html xmlns=\"http://www.w3.org/1999/xhtml\">\n"
+            "<head><title>%s</title></head>\n"
+            "<body>\n%s\n</body>\n</html>\n" % (title, body))
+
+
+def stylesheet(rng, rules):
+    lines = []
+    for i in range(rules):
+        lines.append(".c%d { margin: %dpx; color: #%06x; font-size: %d%%; }"
+                     % (i, i % 40, rng.getrandbits(24), 80 + (i % 60)))
+    return "\n".join(lines)
+
+
+def image_bytes(rng, size):
+    return TINY_PNG + bytes(rng.getrandbits(8) for _ in range(max(0, size - len(TINY_PNG))))
+
+
+class EpubWriter(object):
+
+    def __init__(self, path):
+        self.zf = zipfile.ZipFile(path, "w", zipfile.ZIP_DEFLATED)
+        self.zf.writestr("mimetype", "application/epub+zip", zipfile.ZIP_STORED)
+        self.zf.writestr("META-INF/container.xml", CONTAINER_XML)
+        self.manifest = []
+        self.spine = []
+
+    def add_text(self, href, media_type, content, in_spine=False):
+        self.zf.writestr("OEBPS/" + href, content)
+        item_id = href.replace("/", "_").replace(".", "_")
+        self.manifest.append('<item id="%s" href="%s" media-type="%s"/>'
+                             % (item_id, href, media_type))
+        if in_spine:
+            self.spine.append('<itemref idref="%s"/>' % item_id)
+
+    def add_binary(self, href, media_type, content):
+        self.zf.writestr("OEBPS/" + href, content)
+        item_id = href.replace("/", "_").replace(".", "_")
+        self.manifest.append('<item id="%s" href="%s" media-type="%s"/>'
+                             % (item_id, href, media_type))
+
+    def close(self, title):
+        opf = ("<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+               "<package version=\"3.0\" unique-identifier=\"id\" "
+               "xmlns=\"http://www.idpf.org/2007/opf\">\n"
+               "<metadata xmlns:dc=\"http://purl.org/dc/elements/1.1/\">\n"
+               "<dc:identifier id=\"id\">urn:uuid:%s</dc:identifier>\n"
+               "<dc:title>%s</dc:title>\n"
+               "<dc:language>en</dc:language>\n"
+               "<meta property=\"dcterms:modified\">2021-01-01T00:00:00Z</meta>\n"
+               "</metadata>\n<manifest>\n%s\n</manifest>\n<spine>\n%s\n</spine>\n"
+               "</package>\n"
+               % (title.lower().replace(" ", "-"), title,
+                  "\n".join(self.manifest), "\n".join(self.spine)))
+        self.zf.writestr("OEBPS/content.opf", opf)
+        self.zf.close()
+
+
+def many_small_files(path, scale):
+    rng = random.Random(1)
+    book = EpubWriter(path)
+    for i in range(int(800 * scale)):
+        book.add_text("Text/chapter%04d.xhtml" % i, "application/xhtml+xml",
+                      xhtml("Chapter %d" % i, chapter_text(rng, 6)), in_spine=True)
+    book.close("Many Small Files")
+
+
+def one_huge_file(path, scale):
+    rng = random.Random(2)
+    book = EpubWriter(path)
+    book.add_text("Text/book.xhtml", "application/xhtml+xml",
+                  xhtml("One Huge File", chapter_text(rng, int(6000 * scale))),
+                  in_spine=True)
+    book.close("One Huge File")
+
+
+def css_heavy(path, scale):
+    rng = random.Random(3)
+    book = EpubWriter(path)
+    for i in range(int(40 * scale)):
+        book.add_text("Styles/sheet%02d.css" % i, "text/css",
+                      stylesheet(rng, 2000))
+    book.add_text("Text/chapter.xhtml", "application/xhtml+xml",
+                  xhtml("CSS Heavy", chapter_text(rng, 20)), in_spine=True)
+    book.close("CSS Heavy")
+
+
+def image_heavy(path, scale):
+    rng = random.Random(4)
+    book = EpubWriter(path)
+    for i in range(int(300 * scale)):
+        book.add_binary("Images/image%03d.png" % i, "image/png",
+                        image_bytes(rng, 200 * 1024))
+    book.add_text("Text/chapter.xhtml", "application/xhtml+xml",
+                  xhtml("Image Heavy", chapter_text(rng, 20)), in_spine=True)
+    book.close("Image Heavy")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the synthetic perf corpus.")
+    parser.add_argument("--output-dir", default="perf_corpus")
+    parser.add_argument("--scale", type=float, default=1.0,
+                        help="multiplier on corpus sizes (default 1.0)")
+    args = parser.parse_args()
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    for name, builder in (("many-small-files.epub", many_small_files),
+                          ("one-huge-file.epub", one_huge_file),
+                          ("css-heavy.epub", css_heavy),
+                          ("image-heavy.epub", image_heavy)):
+        target = os.path.join(args.output_dir, name)
+        builder(target, args.scale)
+        print("wrote %s (%d bytes)" % (target, os.path.getsize(target)))
+
+
+if __name__ == "__main__":
+    main()
@@ -31,8 +31,10 @@
 #include "BookManipulation/CleanSource.h"
 #include "BookManipulation/FolderKeeper.h"
 #include "Parsers/GumboInterface.h"
+#include "Misc/FutureWaiter.h"
 #include "Misc/TempFolder.h"
 #include "Misc/Utility.h"
+#include "Misc/ValidationResult.h"
 #include "Misc/HTMLSpellCheck.h"
 #include "Misc/HTMLSpellCheckML.h"
 #include "Misc/Landmarks.h"
@@ -40,7 +42,9 @@
 #include "ResourceObjects/NCXResource.h"
 #include "ResourceObjects/OPFResource.h"
 #include "ResourceObjects/MiscTextResource.h"
+#include "ResourceObjects/TextResource.h"
 #include "sigil_constants.h"
+#include "sigil_exception.h"
 #include "SourceUpdates/AnchorUpdates.h"
 #include "SourceUpdates/PerformHTMLUpdates.h"
 #include "SourceUpdates/UniversalUpdates.h"
@@ -610,7 +614,7 @@ HTMLResource *Book::CreateSectionBreakOriginalResource(const QString &content, H
 }
 
 
-void Book::CreateNewSections(const QStringList &new_sections, HTMLResource *original_resource)
+void Book::CreateNewSections(QStringList &new_sections, HTMLResource *original_resource)
 {
     const QString originating_bookpath = original_resource->GetRelativePath();
     int original_position = GetOPF()->GetReadingOrder(original_resource);
@@ -638,7 +642,9 @@ void Book::CreateNewSections(const QStringList &new_sections, HTMLResource *orig
         next_reading_order = original_position + 1;
     }
 
-    for (int i = 0; i < new_sections.count(); ++i) {
+    int num_sections = new_sections.count();
+
+    for (int i = 0; i < num_sections; ++i) {
         int reading_order = next_reading_order + i;
         NewSection sectionInfo;
         sectionInfo.source = new_sections.at(i);
@@ -653,6 +659,11 @@ void Book::CreateNewSections(const QStringList &new_sections, HTMLResource *orig
                 this,
                 &Book::CreateOneNewSection,
                 sectionInfo));
+        // Drop our reference to this section's text right away.  The
+        // worker's copy is the only remaining owner, so the memory is
+        // returned as each section finishes instead of the whole split
+        // being held alive until the end.
+        new_sections[i].clear();
     }
 
     sync.waitForFinished();
@@ -670,7 +681,7 @@ void Book::CreateNewSections(const QStringList &new_sections, HTMLResource *orig
     } else {
         // Insert the new files at the correct positions in the list
         // The new files need to be inserted in order from first to last
-        for (int i = 0; i < new_sections.count(); ++i) {
+        for (int i = 0; i < num_sections; ++i) {
             int reading_order = next_reading_order + i;
 
             if (futures.at(i).result().reading_order == reading_order) {
@@ -752,7 +763,25 @@ QHash <QString, QList<XhtmlDoc::XMLElement>> Book::GetLinkElements()
 {
     QHash<QString, QList<XhtmlDoc::XMLElement>> links_in_html;
     const QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture<std::tuple<QString, QList<XhtmlDoc::XMLElement>>> future = QtConcurrent::mapped(html_resources, GetLinkElementsInHTMLFileMapped);
+
+    // Replay the last scan of every file whose content hash is
+    // unchanged (the hash is memoized against the content revision,
+    // so this is a hash probe per clean file) and reparse the rest.
+    QList<HTMLResource *> stale_resources;
+    QHash<QString, QByteArray> hashes;
+    foreach(HTMLResource * html_resource, html_resources) {
+        QString bookpath = html_resource->GetRelativePath();
+        QByteArray hash = html_resource->GetContentHash();
+        hashes[bookpath] = hash;
+        QPair<QByteArray, QList<XhtmlDoc::XMLElement>> cached = m_LinkElementsCache.value(bookpath);
+        if (!hash.isEmpty() && cached.first == hash) {
+            links_in_html[bookpath] = cached.second;
+        } else {
+            stale_resources.append(html_resource);
+        }
+    }
+
+    QFuture<std::tuple<QString, QList<XhtmlDoc::XMLElement>>> future = QtConcurrent::mapped(stale_resources, GetLinkElementsInHTMLFileMapped);
 
     for (int i = 0; i < future.results().count(); i++) {
         QString bookpath;
@@ -760,6 +789,7 @@ QHash <QString, QList<XhtmlDoc::XMLElement>> Book::GetLinkElements()
         std::tie(bookpath, links) = future.resultAt(i);
         // Each target entry has a list of filenames that contain it
         links_in_html[bookpath] = links;
+        m_LinkElementsCache[bookpath] = qMakePair(hashes.value(bookpath), links);
     }
 
     return links_in_html;
@@ -811,7 +841,23 @@ QHash<QString, QStringList> Book::GetIdsInHTMLFiles()
 {
     QHash<QString, QStringList> ids_in_html;
     const QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture<std::tuple<QString, QStringList>> future = QtConcurrent::mapped(html_resources, GetIdsInHTMLFileMapped);
+
+    // Same per file cache discipline as GetLinkElements().
+    QList<HTMLResource *> stale_resources;
+    QHash<QString, QByteArray> hashes;
+    foreach(HTMLResource * html_resource, html_resources) {
+        QString bookpath = html_resource->GetRelativePath();
+        QByteArray hash = html_resource->GetContentHash();
+        hashes[bookpath] = hash;
+        QPair<QByteArray, QStringList> cached = m_IdsInHTMLCache.value(bookpath);
+        if (!hash.isEmpty() && cached.first == hash) {
+            ids_in_html[bookpath] = cached.second;
+        } else {
+            stale_resources.append(html_resource);
+        }
+    }
+
+    QFuture<std::tuple<QString, QStringList>> future = QtConcurrent::mapped(stale_resources, GetIdsInHTMLFileMapped);
 
     for (int i = 0; i < future.results().count(); i++) {
         QString bookpath;
@@ -819,6 +865,7 @@ QHash<QString, QStringList> Book::GetIdsInHTMLFiles()
         std::tie(bookpath, ids) = future.resultAt(i);
         // Each target entry has a list of filenames that contain it
         ids_in_html[bookpath] = ids;
+        m_IdsInHTMLCache[bookpath] = qMakePair(hashes.value(bookpath), ids);
     }
 
     return ids_in_html;
@@ -888,76 +935,58 @@ QStringList Book::GetClassesInHTMLFile(HTMLResource *html_resource)
     return XhtmlDoc::GetAllDescendantClasses(html_resource->GetText());
 }
 
-QHash<QString, QStringList> Book::GetImagesInHTMLFiles()
+QHash<QString, Book::HTMLReportFacts> Book::GetHTMLReportFacts()
 {
-    QHash<QString, QStringList> images_in_html;
+    QHash<QString, HTMLReportFacts> facts_in_html;
     const QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture<std::tuple<QString, QStringList>> future = QtConcurrent::mapped(html_resources, GetImagesInHTMLFileMapped);
+    QFuture<std::tuple<QString, HTMLReportFacts>> future = QtConcurrent::mapped(html_resources, GetReportFactsInHTMLFileMapped);
 
     for (int i = 0; i < future.results().count(); i++) {
         QString bookpath;
-        QStringList image_files;
-        std::tie(bookpath, image_files) = future.resultAt(i);
-        images_in_html[bookpath] = image_files;
+        HTMLReportFacts facts;
+        std::tie(bookpath, facts) = future.resultAt(i);
+        facts_in_html[bookpath] = facts;
     }
-    return images_in_html;
-}
-
-QHash< QString, std::pair<int,int> > Book::GetSpellWordCountsInHTMLFiles()
-{
-    QHash< QString, std::pair<int,int> > words_in_html;
-    const QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture<std::tuple<QString, std::pair<int,int> > > future = QtConcurrent::mapped(html_resources, GetWordCountsInHTMLFileMapped);
-    for (int i = 0; i < future.results().count(); i++) {
-        QString bookpath;
-        std::pair<int, int> word_counts;
-        std::tie(bookpath, word_counts) = future.resultAt(i);
-        words_in_html[bookpath] = word_counts;
-    }
-    return words_in_html;
+    return facts_in_html;
 }
 
 
-std::tuple<QString, std::pair<int,int> > Book::GetWordCountsInHTMLFileMapped(HTMLResource *html_resource)
+std::tuple<QString, Book::HTMLReportFacts> Book::GetReportFactsInHTMLFileMapped(HTMLResource *html_resource)
 {
     QString html_bookpath = html_resource->GetRelativePath();
-    std::pair<int,int> counts;
-    counts.first = HTMLSpellCheck::CountAllWords(html_resource->GetText());
-    counts.second = HTMLSpellCheck::CountMisspelledWords(html_resource->GetText());
-    return std::make_tuple(html_bookpath, counts);
-}
-
-
-QHash<QString, QStringList> Book::GetVideoInHTMLFiles()
-{
-    QHash<QString, QStringList> video_in_html;
-    const QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture<std::tuple<QString, QStringList>> future = QtConcurrent::mapped(html_resources, GetVideoInHTMLFileMapped);
+    QString startdir = html_resource->GetFolder();
+    // Fetch the text once and feed it to every extraction; the media
+    // scans all share the cached Gumbo tree for this source.
+    QString text = html_resource->GetText();
+    HTMLReportFacts facts;
 
-    for (int i = 0; i < future.results().count(); i++) {
-        QString bookpath;
-        QStringList video_files;
-        std::tie(bookpath, video_files) = future.resultAt(i);
-        video_in_html[bookpath] = video_files;
+    foreach(QString ahref, XhtmlDoc::GetAllMediaPathsFromMediaChildren(text, GIMAGE_TAGS)) {
+        if (ahref.indexOf(":") == -1) {
+            facts.image_bookpaths << Utility::buildBookPath(ahref, startdir);
+        }
     }
-    return video_in_html;
-}
-
-QHash<QString, QStringList> Book::GetAudioInHTMLFiles()
-{
-    QHash<QString, QStringList> audio_in_html;
-    const QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture<std::tuple<QString, QStringList>> future = QtConcurrent::mapped(html_resources, GetAudioInHTMLFileMapped);
-
-    for (int i = 0; i < future.results().count(); i++) {
-        QString bookpath;
-        QStringList audio_files;
-        std::tie(bookpath, audio_files) = future.resultAt(i);
-        audio_in_html[bookpath] = audio_files;
+    foreach(QString ahref, XhtmlDoc::GetAllMediaPathsFromMediaChildren(text, GVIDEO_TAGS)) {
+        if (ahref.indexOf(":") == -1) {
+            facts.video_bookpaths << Utility::buildBookPath(ahref, startdir);
+        }
     }
-    return audio_in_html;
+    foreach(QString ahref, XhtmlDoc::GetAllMediaPathsFromMediaChildren(text, GAUDIO_TAGS)) {
+        if (ahref.indexOf(":") == -1) {
+            facts.audio_bookpaths << Utility::buildBookPath(ahref, startdir);
+        }
+    }
+    foreach(QString ahref, XhtmlDoc::GetLinkedStylesheets(text)) {
+        if (ahref.indexOf(":") == -1) {
+            std::pair<QString, QString> parts = Utility::parseRelativeHREF(ahref);
+            facts.stylesheet_bookpaths << Utility::buildBookPath(parts.first, startdir);
+        }
+    }
+    facts.word_counts.first = HTMLSpellCheck::CountAllWords(text);
+    facts.word_counts.second = HTMLSpellCheck::CountMisspelledWords(text);
+    return std::make_tuple(html_bookpath, facts);
 }
 
+
 QHash<QString, QStringList> Book::GetHTMLFilesUsingMedia()
 {
     QHash<QString, QStringList> html_files;
@@ -1054,49 +1083,127 @@ std::tuple<QString, QStringList> Book::GetAudioInHTMLFileMapped(HTMLResource *ht
     return std::make_tuple(html_bookpath, audio_bookpaths);
 }
 
+// Runs on pool threads over snapshot entries, so no resource locks and
+// no racing GUI edits; the version never influences the check.
+static std::pair<QString, XhtmlDoc::WellFormedError> SnapshotEntryWellFormedMap(const BookSnapshot::Entry &entry)
+{
+    return std::make_pair(entry.bookpath, XhtmlDoc::WellFormedErrorForSource(entry.text));
+}
+
 bool Book::CheckHTMLFilesForWellFormedness(const QList<HTMLResource*> html_resources)
 {
-    bool wellformed = true;
-    QFuture< std::pair<HTMLResource*, bool> > well_future;
-    well_future = QtConcurrent::mapped(html_resources, ResourceWellFormedMap);
-    for (int i = 0; i < well_future.results().count(); i++) {
-        std::pair<HTMLResource*, bool> res = well_future.resultAt(i);
-        wellformed = wellformed && res.second;
+    QSet<QString> wanted;
+    foreach(HTMLResource *html_resource, html_resources) {
+        wanted.insert(html_resource->GetRelativePath());
+    }
+
+    QSharedPointer<BookSnapshot> snapshot = TakeSnapshot();
+    QList<BookSnapshot::Entry> entries;
+    foreach(const BookSnapshot::Entry &entry, snapshot->GetTypeEntries(Resource::HTMLResourceType)) {
+        if (wanted.contains(entry.bookpath)) {
+            entries.append(entry);
+        }
+    }
+
+    QList<std::pair<QString, XhtmlDoc::WellFormedError>> results =
+        FutureWaiter::Results(QtConcurrent::mapped(entries, SnapshotEntryWellFormedMap));
+    for (int i = 0; i < results.count(); i++) {
+        if (results.at(i).second.line != -1) {
+            return false;
+        }
     }
-    return wellformed;
+    return true;
 }
 
 QList<HTMLResource *> Book::GetNonWellFormedHTMLFiles()
 {
     QList<HTMLResource *> malformed_resources;
-    QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture< std::pair<HTMLResource*, bool> > well_future;
-    well_future = QtConcurrent::mapped(html_resources, ResourceWellFormedMap);
-    for (int i = 0; i < well_future.results().count(); i++) {
-        std::pair<HTMLResource*, bool> res = well_future.resultAt(i);
-        if (!res.second) malformed_resources << res.first;
+    QSharedPointer<BookSnapshot> snapshot = TakeSnapshot();
+    QList<std::pair<QString, XhtmlDoc::WellFormedError>> results =
+        FutureWaiter::Results(QtConcurrent::mapped(snapshot->GetTypeEntries(Resource::HTMLResourceType),
+                                                   SnapshotEntryWellFormedMap));
+
+    for (int i = 0; i < results.count(); i++) {
+        if (results.at(i).second.line == -1) {
+            continue;
+        }
+        try {
+            Resource *resource = m_Mainfolder->GetResourceByBookPath(results.at(i).first);
+            HTMLResource *html_resource = qobject_cast<HTMLResource *>(resource);
+            if (html_resource) {
+                malformed_resources << html_resource;
+            }
+        } catch (ResourceDoesNotExist&) {
+            // deleted while the workers ran; nothing left to mend
+        }
     }
     return malformed_resources;
 }
 
-std::pair<HTMLResource*, bool> Book::ResourceWellFormedMap(HTMLResource * html_resource) {
-    std::pair<HTMLResource*, bool> res;
-    res.first = html_resource;
-    XhtmlDoc::WellFormedError error = XhtmlDoc::WellFormedErrorForSource(html_resource->GetText(),
-                                                                         html_resource->GetEpubVersion());
-    res.second = (error.line == -1);
-    return res;
+QList<ValidationResult> Book::CheckForWellFormedErrors()
+{
+    QList<ValidationResult> errors;
+    QSharedPointer<BookSnapshot> snapshot = TakeSnapshot();
+    QList<std::pair<QString, XhtmlDoc::WellFormedError>> results =
+        FutureWaiter::Results(QtConcurrent::mapped(snapshot->GetTypeEntries(Resource::HTMLResourceType),
+                                                   SnapshotEntryWellFormedMap));
+
+    for (int i = 0; i < results.count(); i++) {
+        const XhtmlDoc::WellFormedError &error = results.at(i).second;
+        if (error.line != -1) {
+            errors.append(ValidationResult(ValidationResult::ResType_Error,
+                                           results.at(i).first,
+                                           error.line,
+                                           error.message));
+        }
+    }
+    return errors;
+}
+
+QSharedPointer<BookSnapshot> Book::TakeSnapshot()
+{
+    QSharedPointer<BookSnapshot> snapshot(new BookSnapshot());
+    {
+        OPFResource *opf = GetOPF();
+        QReadLocker locker(&opf->GetLock());
+        snapshot->m_PrimaryLanguage = opf->GetPrimaryBookLanguage();
+    }
+    snapshot->m_PrimaryLanguage.replace('_', '-');
+
+    foreach(Resource *resource, m_Mainfolder->GetResourceList()) {
+        TextResource *text_resource = qobject_cast<TextResource *>(resource);
+
+        if (!text_resource) {
+            continue;
+        }
+
+        BookSnapshot::Entry entry;
+        entry.bookpath = resource->GetRelativePath();
+        entry.type = resource->Type();
+        {
+            // QString is implicitly shared, so capturing the text is a
+            // reference count bump, not a copy - a real copy only
+            // happens if this resource is edited while the snapshot
+            // is alive
+            QReadLocker locker(&resource->GetLock());
+            entry.text = text_resource->GetText();
+        }
+        snapshot->m_Index.insert(entry.bookpath, snapshot->m_Entries.count());
+        snapshot->m_Entries.append(entry);
+    }
+    return snapshot;
 }
 
 QSet<QString> Book::GetWordsInHTMLFiles()
 {
     QStringList all_words;
-    QString default_lang = GetConstOPF()->GetPrimaryBookLanguage();
-    default_lang.replace('_','-');
-    const QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture<QStringList> future = QtConcurrent::mapped(html_resources, std::bind(GetWordsInHTMLFileMapped,
-                                                                                 std::placeholders::_1,
-                                                                                 default_lang));
+    // workers read only the snapshot's shared strings, never the live
+    // resources, so edits during the scan cannot race it
+    QSharedPointer<BookSnapshot> snapshot = TakeSnapshot();
+    QFuture<QStringList> future = QtConcurrent::mapped(snapshot->GetTypeEntries(Resource::HTMLResourceType),
+                                                       std::bind(GetWordsInSnapshotEntryMapped,
+                                                                 std::placeholders::_1,
+                                                                 snapshot->GetPrimaryBookLanguage()));
 
     for (int i = 0; i < future.results().count(); i++) {
         QStringList result = future.resultAt(i);
@@ -1106,23 +1213,22 @@ QSet<QString> Book::GetWordsInHTMLFiles()
     return all_words.toSet();  // Qt 5.15:  QSet<QString>(all_words.begin(), all_words.end());
 }
 
-QStringList Book::GetWordsInHTMLFileMapped(HTMLResource *html_resource, const QString& default_lang)
+QStringList Book::GetWordsInSnapshotEntryMapped(const BookSnapshot::Entry &entry, const QString& default_lang)
 {
-    
-    return HTMLSpellCheckML::GetAllWords(html_resource->GetText(), default_lang);
-    // return HTMLSpellCheck::GetAllWords(html_resource->GetText());
+    return HTMLSpellCheckML::GetAllWords(entry.text, default_lang);
+    // return HTMLSpellCheck::GetAllWords(entry.text);
 }
 
 QHash<QString, int> Book::GetUniqueWordsInHTMLFiles()
 {
-    QString default_lang = GetConstOPF()->GetPrimaryBookLanguage();
-    default_lang.replace('_','-');
-
     QHash<QString, int> all_words;
-    const QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture<QStringList> future = QtConcurrent::mapped(html_resources, std::bind(GetWordsInHTMLFileMapped,
-                                                                                 std::placeholders::_1,
-                                                                                 default_lang));
+    // this runs on the Spellcheck Editor's background thread, so the
+    // snapshot also keeps its workers off the live resources entirely
+    QSharedPointer<BookSnapshot> snapshot = TakeSnapshot();
+    QFuture<QStringList> future = QtConcurrent::mapped(snapshot->GetTypeEntries(Resource::HTMLResourceType),
+                                                       std::bind(GetWordsInSnapshotEntryMapped,
+                                                                 std::placeholders::_1,
+                                                                 snapshot->GetPrimaryBookLanguage()));
 
     for (int i = 0; i < future.results().count(); i++) {
         QStringList result = future.resultAt(i);
@@ -1138,36 +1244,6 @@ QHash<QString, int> Book::GetUniqueWordsInHTMLFiles()
     return all_words;
 }
 
-QHash<QString, QStringList> Book::GetStylesheetsInHTMLFiles()
-{
-    QHash<QString, QStringList> links_in_html;
-    const QList<HTMLResource *> html_resources = m_Mainfolder->GetResourceTypeList<HTMLResource>(false);
-    QFuture<std::tuple<QString, QStringList>> future = QtConcurrent::mapped(html_resources, GetStylesheetsInHTMLFileMapped);
-
-    for (int i = 0; i < future.results().count(); i++) {
-        QString bookpath;
-        QStringList links;
-        std::tie(bookpath, links) = future.resultAt(i);
-        links_in_html[bookpath] = links;
-    }
-    return links_in_html;
-}
-
-std::tuple<QString, QStringList> Book::GetStylesheetsInHTMLFileMapped(HTMLResource *html_resource)
-{
-    QString html_bookpath = html_resource->GetRelativePath();
-    QString startdir = html_resource->GetFolder();
-    QStringList link_hrefs = XhtmlDoc::GetLinkedStylesheets(html_resource->GetText());
-    QStringList link_bookpaths;
-    foreach(QString ahref, link_hrefs) {
-        if (ahref.indexOf(":") == -1) {
-            std::pair<QString, QString> parts = Utility::parseRelativeHREF(ahref);
-            link_bookpaths << Utility::buildBookPath(parts.first, startdir);
-        }
-    }
-    return std::make_tuple(html_bookpath, link_bookpaths);
-}
-
 QStringList Book::GetStylesheetsInHTMLFile(HTMLResource *html_resource)
 {
     // convert encoded links relative to a html resource to their book paths
@@ -1344,6 +1420,9 @@ void Book::SaveAllResourcesToDisk()
     m_Mainfolder->SuspendWatchingResources();
     QtConcurrent::blockingMap(resources, SaveOneResourceToDisk);
     m_Mainfolder->ResumeWatchingResources();
+    // Everything is clean and freshly on disk, so this is the safest
+    // moment to push cold text buffers back out of memory.
+    m_Mainfolder->UnloadColdTextResources();
 }
 
 
@@ -1451,6 +1530,53 @@ QHash<QString, QStringList> Book::GetIDsInAllFiles(const QList<HTMLResource *> &
     return ID_map;
 }
 
+// QtConcurrent::blockingMapped wants a unary callable, so this
+// functor carries the selector to each worker
+struct QueryOneFileMapper {
+    typedef QList<Book::QueryResult> result_type;
+
+    QString selector;
+
+    QueryOneFileMapper(const QString &aselector) : selector(aselector) {}
+
+    QList<Book::QueryResult> operator()(HTMLResource *html_resource) const
+    {
+        Q_ASSERT(html_resource);
+        QReadLocker locker(&html_resource->GetLock());
+        GumboInterface gi = GumboInterface(html_resource->GetText(), html_resource->GetEpubVersion());
+        // share one tree per unchanged file across queries and callers
+        gi.parse_cached();
+        QList<Book::QueryResult> results;
+        QString bookpath = html_resource->GetRelativePath();
+        foreach(GumboNode * node, gi.findnodes(selector)) {
+            if (node->type != GUMBO_NODE_ELEMENT) {
+                continue;
+            }
+            Book::QueryResult result;
+            result.bookpath = bookpath;
+            result.line = node->v.element.start_pos.line;
+            result.column = node->v.element.start_pos.column;
+            result.start_tag = QString::fromUtf8(node->v.element.original_tag.data,
+                                                 node->v.element.original_tag.length);
+            results.append(result);
+        }
+        return results;
+    }
+};
+
+
+QList<Book::QueryResult> Book::QueryAllFiles(const QString &selector, const QList<HTMLResource *> &html_resources)
+{
+    const QList<QList<QueryResult>> &results_in_files =
+        QtConcurrent::blockingMapped(html_resources, QueryOneFileMapper(selector));
+    QList<QueryResult> results;
+    for (int i = 0; i < results_in_files.count(); ++i) {
+        results.append(results_in_files.at(i));
+    }
+    return results;
+}
+
+
 void Book::SaveOneResourceToDisk(Resource *resource)
 {
     resource->SaveToDisk(true);
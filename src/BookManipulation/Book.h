@@ -26,8 +26,10 @@
 
 #include <QHash>
 #include <QObject>
+#include <QSharedPointer>
 #include <QUrl>
 #include <QPair>
+#include "BookManipulation/BookSnapshot.h"
 #include "ResourceObjects/OPFParser.h"
 #include "BookManipulation/XhtmlDoc.h"
 #include "ResourceObjects/Resource.h"
@@ -40,6 +42,7 @@ class NCXResource;
 class OPFResource;
 class MiscTextResource;
 class Resource;
+class ValidationResult;
 
 /**
  * Represents the book loaded in the current MainWindow instance
@@ -198,11 +201,14 @@ public:
      * The only reason why we have an overload instead of just one function
      * with a default argument is because then Apple GCC 4.2 flakes out here.
      *
-     * @param new_sections The contents of the new sections.
+     * @param new_sections The contents of the new sections.  The list is
+     * consumed: each section's text is released as soon as it has been
+     * handed to a worker, so splitting a very large file does not hold
+     * every section in memory for the whole operation.
      * @param originating_resource The original HTML section that sections
      * will be created after.
      */
-    void CreateNewSections(const QStringList &new_sections,
+    void CreateNewSections(QStringList &new_sections,
                            HTMLResource *originalResource);
 
     /**
@@ -227,19 +233,38 @@ public:
 
     QStringList GetClassesInHTMLFile(HTMLResource* html_resource);
 
+    /**
+     * Captures every text resource's current text plus the OPF's
+     * primary language into an immutable snapshot.  Each resource is
+     * read-locked only for the instant its implicitly shared text is
+     * captured, after which workers read the snapshot from any thread
+     * without locks and without racing GUI edits.
+     */
+    QSharedPointer<BookSnapshot> TakeSnapshot();
+
     QSet<QString> GetWordsInHTMLFiles();
-    static QStringList GetWordsInHTMLFileMapped(HTMLResource *html_resource, const QString &default_lang);
+    static QStringList GetWordsInSnapshotEntryMapped(const BookSnapshot::Entry &entry, const QString &default_lang);
 
     QHash<QString, int> GetUniqueWordsInHTMLFiles();
 
-    QHash<QString, QStringList> GetStylesheetsInHTMLFiles();
-    static std::tuple<QString, QStringList> GetStylesheetsInHTMLFileMapped(HTMLResource *html_resource);
     QStringList GetStylesheetsInHTMLFile(HTMLResource *html_resource);
 
-    QHash<QString, QStringList> GetImagesInHTMLFiles();
-    QHash<QString, QStringList> GetVideoInHTMLFiles();
-    QHash<QString, QStringList> GetAudioInHTMLFiles();
-    QHash< QString, std::pair<int,int> > GetSpellWordCountsInHTMLFiles();
+    /**
+     * All of the per-file facts the HTML files report needs, gathered
+     * in one traversal of each file instead of one full-book pass per
+     * report column.
+     */
+    struct HTMLReportFacts {
+        QStringList image_bookpaths;
+        QStringList video_bookpaths;
+        QStringList audio_bookpaths;
+        QStringList stylesheet_bookpaths;
+        // all words, misspelled words
+        std::pair<int, int> word_counts;
+    };
+    QHash<QString, HTMLReportFacts> GetHTMLReportFacts();
+    static std::tuple<QString, HTMLReportFacts> GetReportFactsInHTMLFileMapped(HTMLResource *html_resource);
+
     QHash<QString, QStringList> GetHTMLFilesUsingMedia();
     QHash<QString, QStringList> GetHTMLFilesUsingImages();
 
@@ -247,12 +272,17 @@ public:
     static std::tuple<QString, QStringList> GetImagesInHTMLFileMapped(HTMLResource *html_resource);
     static std::tuple<QString, QStringList> GetVideoInHTMLFileMapped(HTMLResource *html_resource);
     static std::tuple<QString, QStringList> GetAudioInHTMLFileMapped(HTMLResource *html_resource);
-    static std::tuple<QString, std::pair<int,int> > GetWordCountsInHTMLFileMapped(HTMLResource *html_resource);
-    
+
 
     bool CheckHTMLFilesForWellFormedness(const QList<HTMLResource*> html_resources);
     QList<HTMLResource *> GetNonWellFormedHTMLFiles();
-    static std::pair<HTMLResource*, bool> ResourceWellFormedMap(HTMLResource * html_resource);
+
+    /**
+     * Checks every HTML file for well-formedness in parallel over a
+     * snapshot and returns one error per broken file, ready for the
+     * Validation Results pane.
+     */
+    QList<ValidationResult> CheckForWellFormedErrors();
 
     QHash<QString, int> CountAllLinksInHTML();
 
@@ -329,6 +359,25 @@ public:
      */
     static QHash<QString, QStringList> GetIDsInAllFiles(const QList<HTMLResource *> &html_resources);
 
+    /**
+     * One selector match somewhere in the book: the bookpath of the
+     * file it was found in, the match's position in that file's
+     * source, and the element's original start tag.
+     */
+    struct QueryResult {
+        QString bookpath;
+        int     line;
+        int     column;
+        QString start_tag;
+    };
+
+    /**
+     * Runs one CSS selector over the supplied HTMLResources using
+     * QtConcurrent, one parse per file via the shared tree cache,
+     * and merges the matches in the order the resources were given.
+     */
+    static QList<QueryResult> QueryAllFiles(const QString &selector, const QList<HTMLResource *> &html_resources);
+
 public slots:
 
     /**
@@ -445,6 +494,14 @@ private:
      */
     bool m_IsModified;
 
+    /**
+     * Per file caches for the links report: each file's last link and
+     * id scan keyed by its content hash, so reopening Reports only
+     * reparses the files edited since. @see GetLinkElements().
+     */
+    QHash<QString, QPair<QByteArray, QList<XhtmlDoc::XMLElement>>> m_LinkElementsCache;
+    QHash<QString, QPair<QByteArray, QStringList>> m_IdsInHTMLCache;
+
 };
 
 #endif // BOOK_H
@@ -53,15 +53,21 @@ QList<BookReports::StyleData *> BookReports::GetHTMLClassUsage(QSharedPointer<Bo
     QList<HTMLResource *> html_resources = book->GetFolderKeeper()->GetResourceTypeList<HTMLResource>(false);
     QList<CSSResource *> css_resources = book->GetFolderKeeper()->GetResourceTypeList<CSSResource>(false);
 
-    // Parse each css file once and store its parser object
-    QHash<QString, CSSInfo * > css_parsers;
+    // Parse each css file once, all stylesheets in parallel
+    QStringList css_filenames;
+    QList<QString> css_texts;
     foreach(CSSResource * css_resource, css_resources) {
         QString css_filename = css_resource->GetRelativePath();
-        if (!css_parsers.contains(css_filename)) {
-            CSSInfo * cp = new CSSInfo(css_resource->GetText()); 
-            css_parsers[css_filename] = cp;
+        if (!css_filenames.contains(css_filename)) {
+            css_filenames << css_filename;
+            css_texts << css_resource->GetText();
         }
     }
+    QList<CSSInfo *> parsed_css = CSSInfo::parseBatch(css_texts);
+    QHash<QString, CSSInfo * > css_parsers;
+    for (int i = 0; i < css_filenames.count(); i++) {
+        css_parsers[css_filenames.at(i)] = parsed_css.at(i);
+    }
 
     QList<BookReports::StyleData*> html_classes_usage;
 
@@ -149,27 +155,33 @@ QList<BookReports::StyleData *> BookReports::GetAllCSSSelectorsUsed(QSharedPoint
 
     QList<CSSResource *> css_resources = book->GetFolderKeeper()->GetResourceTypeList<CSSResource>(false);
 
-    // Parse each css file once and store its parser object
-    QHash<QString, CSSInfo * > css_parsers;
+    // Parse each css file once, all stylesheets in parallel
+    QStringList css_filenames;
+    QList<QString> css_texts;
     foreach(CSSResource * css_resource, css_resources) {
         QString css_filename = css_resource->GetRelativePath();
-        if (!css_parsers.contains(css_filename)) {
-            CSSInfo * cp = new CSSInfo(css_resource->GetText());
-            css_parsers[css_filename] = cp;
+        if (!css_filenames.contains(css_filename)) {
+            css_filenames << css_filename;
+            css_texts << css_resource->GetText();
         }
     }
+    QList<CSSInfo *> parsed_css = CSSInfo::parseBatch(css_texts);
+    QHash<QString, CSSInfo * > css_parsers;
+    for (int i = 0; i < css_filenames.count(); i++) {
+        css_parsers[css_filenames.at(i)] = parsed_css.at(i);
+    }
 
     QList<HTMLResource *> html_resources = book->GetFolderKeeper()->GetResourceTypeList<HTMLResource>(false);
 
-    QFuture< QList< std::pair<QString,QString> > > usage_future;
+    QFuture< BookReports::FileSelectorUsage > usage_future;
     usage_future = QtConcurrent::mapped(html_resources,
                                         std::bind(AllSelectorsUsedInHTMLFileMapped,
                                                   std::placeholders::_1, css_parsers));
 
     int num_futures = usage_future.results().count();
     for (int i = 0; i < num_futures; ++i) {
-        for (int j = 0; j < usage_future.resultAt(i).count(); j++) {
-            std::pair<QString, QString> res = usage_future.resultAt(i).at(j);
+        for (int j = 0; j < usage_future.resultAt(i).used.count(); j++) {
+            std::pair<QString, QString> res = usage_future.resultAt(i).used.at(j);
             if (!selectors_used.contains(res.first, res.second)) {
                 selectors_used.insert(res.first, res.second);
             }
@@ -196,23 +208,23 @@ QList<BookReports::StyleData *> BookReports::GetAllCSSSelectorsUsed(QSharedPoint
             }
         }
     }
-    // Now build up the list of StyleData in html internal style tags
-    foreach(HTMLResource* hresource, html_resources) {
-        HTMLStyleInfo hp(hresource->GetText());
-        if (hp.hasStyles()) {
-            QList<CSSInfo::CSSSelector *> selectors = hp.getAllSelectors();
-            foreach(CSSInfo::CSSSelector * selector, selectors) {
-                BookReports::StyleData* sd = new BookReports::StyleData();
-                sd->css_filename = hresource->GetRelativePath();
-                sd->css_selector_text = selector->text;
-                sd->css_selector_position = selector->pos;
-                QString key = hresource->GetRelativePath() + USEP + QString::number(selector->pos) + USEP + selector->text;
-                QList<QString> htmlfiles = selectors_used.values(key);
-                if (!htmlfiles.isEmpty()) {
-                    sd->html_filename = htmlfiles.at(0);
-                }
-                css_selector_usage.append(sd);
+    // Now build up the list of StyleData in html internal style tags.
+    // The workers already parsed every file's style tags, so use the
+    // selector lists they returned instead of reparsing each file here.
+    for (int i = 0; i < num_futures; ++i) {
+        BookReports::FileSelectorUsage usage = usage_future.resultAt(i);
+        for (int j = 0; j < usage.internal_selectors.count(); j++) {
+            std::pair<QString, int> selector = usage.internal_selectors.at(j);
+            BookReports::StyleData* sd = new BookReports::StyleData();
+            sd->css_filename = usage.html_filename;
+            sd->css_selector_text = selector.first;
+            sd->css_selector_position = selector.second;
+            QString key = usage.html_filename + USEP + QString::number(selector.second) + USEP + selector.first;
+            QList<QString> htmlfiles = selectors_used.values(key);
+            if (!htmlfiles.isEmpty()) {
+                sd->html_filename = htmlfiles.at(0);
             }
+            css_selector_usage.append(sd);
         }
     }
 
@@ -227,10 +239,12 @@ QList<BookReports::StyleData *> BookReports::GetAllCSSSelectorsUsed(QSharedPoint
 }
 
 
-QList< std::pair<QString,QString> > BookReports::AllSelectorsUsedInHTMLFileMapped(HTMLResource* html_resource,
+BookReports::FileSelectorUsage BookReports::AllSelectorsUsedInHTMLFileMapped(HTMLResource* html_resource,
                                                                           const QHash<QString, CSSInfo *> &css_parsers)
 {
-    QList< std::pair<QString, QString> > selectors_used;
+    BookReports::FileSelectorUsage usage;
+    usage.html_filename = html_resource->GetRelativePath();
+    QList< std::pair<QString, QString> > &selectors_used = usage.used;
 
     QStringList linked_stylesheets = html_resource->GetLinkedStylesheets();
     
@@ -266,6 +280,9 @@ QList< std::pair<QString,QString> > BookReports::AllSelectorsUsedInHTMLFileMappe
     if (hp.hasStyles()) {
         QList<CSSInfo::CSSSelector *> selectors = hp.getAllSelectors();
         foreach(CSSInfo::CSSSelector * selector, selectors) {
+            // record the selector itself so the caller can list this
+            // file's internal styles without parsing it again
+            usage.internal_selectors.append(std::make_pair(selector->text, selector->pos));
             CSelection c = gi.find(selector->text);
             // if Query selector parse error occurs to be most safe
             // assume this selector is used in this file
@@ -279,5 +296,5 @@ QList< std::pair<QString,QString> > BookReports::AllSelectorsUsedInHTMLFileMappe
             }
         }
     }
-    return selectors_used;
+    return usage;
 }
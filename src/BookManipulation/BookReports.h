@@ -58,7 +58,16 @@ public:
     static QList<BookReports::StyleData *> GetAllCSSSelectorsUsed(QSharedPointer<Book> book,
                                                                   bool show_progress = false);
 
-    static QList< std::pair<QString,QString> > AllSelectorsUsedInHTMLFileMapped(HTMLResource* html_resource,
+    // What one worker reports for one html file: which selectors it
+    // uses, plus the selectors of its own internal style tags so the
+    // file never needs a second parse to list them
+    struct FileSelectorUsage {
+        QList< std::pair<QString,QString> > used;
+        QString html_filename;
+        QList< std::pair<QString,int> > internal_selectors;
+    };
+
+    static FileSelectorUsage AllSelectorsUsedInHTMLFileMapped(HTMLResource* html_resource,
                                                                             const QHash<QString, CSSInfo*> &css_parsers);
 
 
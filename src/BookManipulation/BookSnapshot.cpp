@@ -0,0 +1,66 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include "BookManipulation/BookSnapshot.h"
+
+BookSnapshot::BookSnapshot()
+{
+}
+
+
+QList<BookSnapshot::Entry> BookSnapshot::GetEntries() const
+{
+    return m_Entries;
+}
+
+
+QList<BookSnapshot::Entry> BookSnapshot::GetTypeEntries(Resource::ResourceType type) const
+{
+    QList<Entry> entries;
+    foreach(const Entry &entry, m_Entries) {
+        if (entry.type == type) {
+            entries.append(entry);
+        }
+    }
+    return entries;
+}
+
+
+bool BookSnapshot::Contains(const QString &bookpath) const
+{
+    return m_Index.contains(bookpath);
+}
+
+
+QString BookSnapshot::GetText(const QString &bookpath) const
+{
+    int pos = m_Index.value(bookpath, -1);
+    if (pos < 0) {
+        return QString();
+    }
+    return m_Entries.at(pos).text;
+}
+
+
+QString BookSnapshot::GetPrimaryBookLanguage() const
+{
+    return m_PrimaryLanguage;
+}
@@ -0,0 +1,97 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef BOOKSNAPSHOT_H
+#define BOOKSNAPSHOT_H
+
+#include <QtCore/QHash>
+#include <QtCore/QList>
+#include <QtCore/QString>
+
+#include "ResourceObjects/Resource.h"
+
+/**
+ * An immutable capture of every text resource in the book at one
+ * moment, created by Book::TakeSnapshot().
+ *
+ * Each entry holds the resource's book path, type and text.  The texts
+ * are implicitly shared QStrings, so taking a snapshot costs one
+ * reference count bump per resource - real copies only happen for the
+ * files the user edits while the snapshot is alive.  Once built, a
+ * snapshot is read-only and touches no live resources, so worker pools
+ * (word scans, reports, export passes) can read it from any number of
+ * threads without taking resource locks and without racing GUI edits.
+ */
+class BookSnapshot
+{
+public:
+
+    /**
+     * One captured resource: where it lives, what it is, and its text
+     * at the moment the snapshot was taken.
+     */
+    struct Entry {
+        QString bookpath;
+        Resource::ResourceType type;
+        QString text;
+    };
+
+    /**
+     * Every captured entry, in the order the FolderKeeper listed them.
+     */
+    QList<Entry> GetEntries() const;
+
+    /**
+     * The captured entries of one resource type.
+     */
+    QList<Entry> GetTypeEntries(Resource::ResourceType type) const;
+
+    bool Contains(const QString &bookpath) const;
+
+    /**
+     * The captured text of the resource at the given book path, or a
+     * null string when the snapshot holds no such resource.
+     */
+    QString GetText(const QString &bookpath) const;
+
+    /**
+     * The primary book language the OPF declared when the snapshot was
+     * taken, already normalized to hyphenated form.
+     */
+    QString GetPrimaryBookLanguage() const;
+
+private:
+
+    // Only Book builds snapshots; see Book::TakeSnapshot().
+    friend class Book;
+
+    BookSnapshot();
+
+    QList<Entry> m_Entries;
+
+    // bookpath to position in m_Entries
+    QHash<QString, int> m_Index;
+
+    QString m_PrimaryLanguage;
+};
+
+#endif // BOOKSNAPSHOT_H
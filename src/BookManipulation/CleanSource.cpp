@@ -22,9 +22,13 @@
 
 #include "EmbedPython/EmbeddedPython.h"
 
+#include <functional>
+
 #include <QtCore/QString>
 #include <QtCore/QStringList>
+#include <QtCore/QThread>
 #include <QtCore/QWriteLocker>
+#include <QtConcurrent/QtConcurrent>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QProgressDialog>
 #include <QRegularExpression>
@@ -33,6 +37,7 @@
 #include "BookManipulation/CleanSource.h"
 #include "BookManipulation/XhtmlDoc.h"
 #include "Parsers/GumboInterface.h"
+#include "Parsers/TagLister.h"
 #include "Misc/SettingsStore.h"
 #include "sigil_constants.h"
 #include "sigil_exception.h"
@@ -59,6 +64,98 @@ QString CleanSource::Mend(const QString &source, const QString &version)
 }
 
 
+// Repairs only the top level body block holding the first
+// well-formedness error.  A full Mend re-serializes the entire
+// document, so one stray tag churns every line of the file; here the
+// broken block is extracted with TagLister, repaired on its own inside
+// a copy of the original header, and spliced back so the untouched
+// text is preserved byte-for-byte.  Every step that cannot pin the
+// region down falls back to a full Mend, and the spliced result is
+// verified to be well-formed before it is accepted.
+QString CleanSource::MendScoped(const QString &source, const QString &version)
+{
+    XhtmlDoc::WellFormedError error = XhtmlDoc::WellFormedErrorForSource(source, version);
+    if (error.line == -1) {
+        return source;
+    }
+
+    // Convert the reported line/column to a character offset
+    int offset = 0;
+    for (int line = 1; line < error.line; line++) {
+        offset = source.indexOf(QChar('\n'), offset);
+        if (offset == -1) {
+            return Mend(source, version);
+        }
+        offset++;
+    }
+    offset = offset + qMax(error.column - 1, 0);
+    if (offset >= source.length()) {
+        return Mend(source, version);
+    }
+
+    TagLister lister(source);
+    int body_open = lister.findBodyOpenTag();
+    int body_close = lister.findBodyCloseTag();
+    if ((body_open < 0) || (body_close <= body_open)) {
+        return Mend(source, version);
+    }
+    const TagLister::TagInfo &body_tag = lister.at(body_open);
+    int body_contents_start = body_tag.pos + body_tag.len;
+    int body_contents_end = lister.at(body_close).pos;
+    if ((offset < body_contents_start) || (offset >= body_contents_end)) {
+        // Error in the header (or in the body tags themselves)
+        return Mend(source, version);
+    }
+
+    // Find the top level block enclosing the error.  Tags that open a
+    // direct child of body carry the body path plus their own name;
+    // single tags and comments carry just the body path.
+    QString body_path = body_tag.tpath;
+    int block_start = body_contents_start;
+    int block_end = body_contents_end;
+    for (int i = body_open + 1; i < body_close; i++) {
+        const TagLister::TagInfo &tag = lister.at(i);
+        bool starts_block = ((tag.ttype == "begin") && (tag.tpath == body_path + "." + tag.tname)) ||
+                            ((tag.ttype != "begin") && (tag.ttype != "end") && (tag.tpath == body_path));
+        if (!starts_block) {
+            continue;
+        }
+        if (tag.pos <= offset) {
+            block_start = tag.pos;
+        } else {
+            block_end = tag.pos;
+            break;
+        }
+    }
+
+    // Repair the block alone inside a copy of the original header so
+    // gumbo sees the right doctype and namespaces
+    QString ndoc = source.left(body_contents_start) +
+                   source.mid(block_start, block_end - block_start) +
+                   "</body>\n</html>\n";
+    GumboInterface gi = GumboInterface(PreprocessSpecialCases(ndoc), version);
+    QString repaired = gi.repair();
+
+    // Pull the repaired block back out of the mini document
+    TagLister rlister(repaired);
+    int rbody_open = rlister.findBodyOpenTag();
+    int rbody_close = rlister.findBodyCloseTag();
+    if ((rbody_open < 0) || (rbody_close <= rbody_open)) {
+        return Mend(source, version);
+    }
+    int rcontents_start = rlister.at(rbody_open).pos + rlister.at(rbody_open).len;
+    int rcontents_end = rlister.at(rbody_close).pos;
+    QString repaired_block = CharToEntity(repaired.mid(rcontents_start, rcontents_end - rcontents_start), version);
+
+    QString newsource = source.left(block_start) + repaired_block + source.mid(block_end);
+    // The splice is only a win if it actually fixed the document
+    if (!XhtmlDoc::IsDataWellFormed(newsource, version)) {
+        return Mend(source, version);
+    }
+    return newsource;
+}
+
+
 // Mend and Prettify XHTML
 QString CleanSource::MendPrettify(const QString &source, const QString &version)
 {
@@ -100,7 +197,7 @@ QString CleanSource::ToValidXHTML(const QString &source, const QString &version)
 {
     QString newsource = source;
     if (!XhtmlDoc::IsDataWellFormed(source)) {
-        newsource = Mend(source, version);
+        newsource = MendScoped(source, version);
     }
     return newsource;
 }
@@ -286,23 +383,49 @@ QString CleanSource::CharToEntity(const QString &source, const QString &version)
 }
 
 
+// Runs on a worker thread for each HTML file during ReformatAll.
+// Returns 1 if the file was actually changed.
+static int ReformatOneHTMLFile(HTMLResource *resource, QString(clean_func)(const QString &source, const QString &version))
+{
+    QWriteLocker locker(&resource->GetLock());
+    QString source = resource->GetText();
+    QString version = resource->GetEpubVersion();
+    QString newsource = clean_func(source, version);
+    if (newsource == source) {
+        return 0;
+    }
+    resource->SetText(newsource);
+    return 1;
+}
+
+
 bool CleanSource::ReformatAll(QList <HTMLResource *> resources, QString(clean_func)(const QString &source, const QString &version))
 {
-    QProgressDialog progress(QObject::tr("Cleaning..."), 0, 0, resources.count(), Utility::GetMainWindow());
+    QProgressDialog progress(QObject::tr("Cleaning..."), QObject::tr("Cancel"), 0, resources.count(), Utility::GetMainWindow());
     progress.setMinimumDuration(PROGRESS_BAR_MINIMUM_DURATION);
-    int progress_value = 0;
-    progress.setValue(progress_value);
-    bool book_modified = false;
-    foreach(HTMLResource * resource, resources) {
-        progress.setValue(progress_value++);
+    progress.setValue(0);
+
+    // Cleaning each file is independent, so spread the files across the
+    // thread pool.  This is safe because each worker holds the resource's
+    // write lock and SetText defers the QTextDocument update to the GUI
+    // thread - the same pattern UniversalUpdates relies on, and Mend /
+    // MendPrettify already run on worker threads during those updates.
+    QFuture<int> future = QtConcurrent::mapped(resources, std::bind(ReformatOneHTMLFile, std::placeholders::_1, clean_func));
+    while (!future.isFinished()) {
+        progress.setValue(future.progressValue());
         qApp->processEvents();
-        QWriteLocker locker(&resource->GetLock());
-        QString source = resource->GetText();
-        QString version = resource->GetEpubVersion();
-        QString newsource = clean_func(source, version);
-        if (newsource != source) {
+        if (progress.wasCanceled()) {
+            // files already handed to workers still finish cleanly,
+            // files not yet started keep their old text
+            future.cancel();
+        }
+        QThread::msleep(10);
+    }
+
+    bool book_modified = false;
+    for (int i = 0; i < future.resultCount(); i++) {
+        if (future.resultAt(i)) {
             book_modified = true;
-            resource->SetText(newsource);
         }
     }
     return book_modified;
@@ -35,9 +35,15 @@ class CleanSource
 {
 
 public:
-    // Performs minimal mending to provided book XHTML code 
+    // Performs minimal mending to provided book XHTML code
     static QString Mend(const QString &source, const QString &version);
 
+    // Like Mend but re-serializes only the top level body block
+    // holding the first well-formedness error, leaving the rest of
+    // the source byte-for-byte untouched; falls back to a full Mend
+    // whenever the broken region cannot be pinned down
+    static QString MendScoped(const QString &source, const QString &version);
+
     // Convert to valid XHTML with Mending
     static QString ToValidXHTML(const QString &source, const QString &version );
 
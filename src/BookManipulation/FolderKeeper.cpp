@@ -20,12 +20,14 @@
 **
 *************************************************************************/
 
+#include <QtCore/QDateTime>
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QString>
 #include <QtCore/QThread>
 #include <QtCore/QTime>
+#include <QtConcurrent/QtConcurrent>
 #include <QtWidgets/QApplication>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
@@ -42,6 +44,7 @@
 #include "Misc/OpenExternally.h"
 #include "Misc/SettingsStore.h"
 #include "Misc/MediaTypes.h"
+#include "Misc/Tracer.h"
 
 
 static const QStringList groupA = QStringList() << "Text"<<"Styles"<<"Images"<<"Fonts"<<"Audio"<<"Video"<<"Misc" << "opf" << "ncx";
@@ -55,6 +58,12 @@ static const QStringList groupB = QStringList() << "Text"<<"Styles"<<"Images"<<"
 // through untouched.
 const QRegularExpression FILE_EXCEPTIONS("META-INF");
 
+// How long after the last change event the batch of changed files is
+// processed, and how long a missing file may stay pending before its
+// change is treated as a removal.
+static const int FILE_CHANGED_SETTLE_DELAY = 300;
+static const int FILE_CHANGED_GRACE_PERIOD = 1000;
+
 
 static const QString CONTAINER_XML       = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
         "<container version=\"1.0\" xmlns=\"urn:oasis:names:tc:opendocument:xmlns:container\">\n"
@@ -69,11 +78,17 @@ FolderKeeper::FolderKeeper(QObject *parent)
     m_OPF(NULL),
     m_NCX(NULL),
     m_FSWatcher(new QFileSystemWatcher()),
-    m_FullPathToMainFolder(m_TempFolder.GetPath())
+    m_FullPathToMainFolder(m_TempFolder.GetPath()),
+    m_ShortPathUpdatesSuspended(false),
+    m_ShortPathNamesDirty(false),
+    m_OPFUpdatesSuspended(false)
 {
     CreateGroupToFoldersMap();
     connect(m_FSWatcher, SIGNAL(fileChanged(const QString &)),
             this,        SLOT(ResourceFileChanged(const QString &)), Qt::DirectConnection);
+    m_FileChangedTimer.setInterval(FILE_CHANGED_SETTLE_DELAY);
+    m_FileChangedTimer.setSingleShot(true);
+    connect(&m_FileChangedTimer, SIGNAL(timeout()), this, SLOT(ProcessChangedFiles()));
 }
 
 
@@ -131,6 +146,7 @@ Resource *FolderKeeper::AddContentFileToFolder(const QString &fullfilepath,
                                                const QString &bookpath,
                                                const QString &folderpath)
 {
+    SIGIL_TRACE_SCOPE("FolderKeeper::AddContentFileToFolder");
     if (!QFileInfo(fullfilepath).exists()) {
         throw(FileDoesNotExist(fullfilepath.toStdString()));
     }
@@ -233,6 +249,7 @@ Resource *FolderKeeper::AddContentFileToFolder(const QString &fullfilepath,
             book_path = new_file_path.right(new_file_path.length() - m_FullPathToMainFolder.length() - 1);
         }
         m_Path2Resource[ book_path ] = resource;
+        AddToFilenameIndex(book_path);
         resource->SetEpubVersion(m_OPF->GetEpubVersion());
         resource->SetMediaType(mt);
         resource->SetShortPathName(filename);
@@ -256,7 +273,17 @@ Resource *FolderKeeper::AddContentFileToFolder(const QString &fullfilepath,
             this,     SLOT(ResourceMoved(const Resource *, QString)), Qt::DirectConnection);
 
     if (update_opf) {
-        emit ResourceAdded(resource);
+        bool deferred = false;
+        {
+            QMutexLocker locker(&m_AccessMutex);
+            if (m_OPFUpdatesSuspended) {
+                m_PendingOPFAdditions.append(resource);
+                deferred = true;
+            }
+        }
+        if (!deferred) {
+            emit ResourceAdded(resource);
+        }
     }
 
     return resource;
@@ -277,9 +304,9 @@ int FolderKeeper::GetHighestReadingOrder() const
 
 QString FolderKeeper::GetUniqueFilenameVersion(const QString &filename) const
 {
-    const QStringList &filenames = GetAllFilenames();
-
-    if (!filenames.contains(filename, Qt::CaseInsensitive)) {
+    // the filename index gives a cheap case insensitive existence check,
+    // so the common no-clash case does not walk every resource
+    if (!m_Filename2Paths.contains(filename.toLower())) {
         return filename;
     }
 
@@ -287,6 +314,29 @@ QString FolderKeeper::GetUniqueFilenameVersion(const QString &filename) const
     // So for "Section0001.xhtml", it is "Section"
     QString name_prefix = QFileInfo(filename).baseName().remove(QRegularExpression("\\d+$"));
     QString extension   = QFileInfo(filename).completeSuffix();
+    const int conversion_base = 10;
+    const QString suffix_key = name_prefix.toLower() + "|" + extension.toLower();
+
+    // Bulk creation (Split at Markers) resolves the same prefix over
+    // and over, so the next free number is remembered per prefix and
+    // the scan below runs once, not once per created file.
+    if (m_NextSuffixIndex.contains(suffix_key)) {
+        QPair<int, int> &next = m_NextSuffixIndex[suffix_key];
+        QString candidate = name_prefix + QString("%1").arg(next.first,
+                            next.second,
+                            conversion_base,
+                            QChar('0')) +
+                            (!extension.isEmpty() ? ("." + extension) : QString());
+
+        if (!m_Filename2Paths.contains(candidate.toLower())) {
+            next.first++;
+            return candidate;
+        }
+
+        // the counter went stale - rebuild it from the scan below
+        m_NextSuffixIndex.remove(suffix_key);
+    }
+
     // Used to search for the filename number suffixes.
     QString search_string = QRegularExpression::escape(name_prefix).prepend("^") +
                             "(\\d*)" +
@@ -297,7 +347,9 @@ QString FolderKeeper::GetUniqueFilenameVersion(const QString &filename) const
     filename_search.setPatternOptions(QRegularExpression::CaseInsensitiveOption);
     int max_num_length = -1;
     int max_num = -1;
-    foreach(QString existing_file, filenames) {
+    // the index keys are the distinct lowercased filenames, which is
+    // exactly what the suffix scan needs - no resource walk required
+    foreach(const QString &existing_file, m_Filename2Paths.keys()) {
         QRegularExpressionMatch match = filename_search.match(existing_file);
         if (!match.hasMatch()) {
             continue;
@@ -305,7 +357,7 @@ QString FolderKeeper::GetUniqueFilenameVersion(const QString &filename) const
 
         bool conversion_successful = false;
         int number_suffix = match.captured(1).toInt(&conversion_successful);
-        
+
         if (conversion_successful && number_suffix > max_num) {
             max_num = number_suffix;
             max_num_length = match.capturedLength(1);
@@ -317,7 +369,7 @@ QString FolderKeeper::GetUniqueFilenameVersion(const QString &filename) const
         max_num_length = 4;
     }
 
-    const int conversion_base = 10;
+    m_NextSuffixIndex[suffix_key] = qMakePair(max_num + 2, max_num_length);
     QString new_name = name_prefix + QString("%1").arg(max_num + 1,
                        max_num_length,
                        conversion_base,
@@ -362,21 +414,36 @@ Resource *FolderKeeper::GetResourceByIdentifier(const QString &identifier) const
 // uses a case insensitive match since can be used on case insensitive file systems
 QString FolderKeeper::GetBookPathByPathEnd(const QString& path_end) const
 {
-    foreach(Resource *resource, m_Resources.values()) {
-        QString bookpath = resource->GetRelativePath();
+    // the index maps lowercased filenames to candidate book paths, so
+    // only resources whose full file name matches are ever examined
+    QString filename = path_end.split('/').last().toLower();
+    foreach(const QString &bookpath, m_Filename2Paths.value(filename)) {
         if (bookpath.endsWith(path_end, Qt::CaseInsensitive)) {
-            // make sure full file names match too
-            QString filename = bookpath.split('/').last();
-            QString othername = path_end.split('/').last();
-            if (filename.compare(othername, Qt::CaseInsensitive) == 0) {
-                return bookpath ;
-            }
+            return bookpath;
         }
     }
     return "";
 }
 
 
+void FolderKeeper::AddToFilenameIndex(const QString &bookpath)
+{
+    m_Filename2Paths[bookpath.split('/').last().toLower()].append(bookpath);
+}
+
+
+void FolderKeeper::RemoveFromFilenameIndex(const QString &bookpath)
+{
+    QString filename = bookpath.split('/').last().toLower();
+    if (m_Filename2Paths.contains(filename)) {
+        m_Filename2Paths[filename].removeAll(bookpath);
+        if (m_Filename2Paths[filename].isEmpty()) {
+            m_Filename2Paths.remove(filename);
+        }
+    }
+}
+
+
 // a Book path is the path from the m_MainFolder to that file O(1) as a hash
 Resource *FolderKeeper::GetResourceByBookPath(const QString &bookpath) const
 {
@@ -418,6 +485,7 @@ OPFResource*FolderKeeper::AddOPFToFolder(const QString &version, const QString &
     m_OPF->SetShortPathName(OPFBookPath.split('/').last());
     m_Resources[ m_OPF->GetIdentifier() ] = m_OPF;
     m_Path2Resource[ m_OPF->GetRelativePath() ] = m_OPF;
+    AddToFilenameIndex(m_OPF->GetRelativePath());
 
     connect(m_OPF, SIGNAL(Deleted(const Resource *)), this, SLOT(RemoveResource(const Resource *)));
     // For ResourceAdded, the connection has to be DirectConnection,
@@ -469,6 +537,7 @@ NCXResource*FolderKeeper::AddNCXToFolder(const QString &version,
     m_NCX->SetMainID(m_OPF->GetMainIdentifierValue());
     m_Resources[ m_NCX->GetIdentifier() ] = m_NCX;
     m_Path2Resource[ m_NCX->GetRelativePath() ] = m_NCX;
+    AddToFilenameIndex(m_NCX->GetRelativePath());
     connect(m_NCX, SIGNAL(Deleted(const Resource *)), this, SLOT(RemoveResource(const Resource *)));
     connect(m_NCX, SIGNAL(Renamed(const Resource *, QString)),
             this,     SLOT(ResourceRenamed(const Resource *, QString)), Qt::DirectConnection);
@@ -529,6 +598,9 @@ void FolderKeeper::BulkRemoveResources(const QList<Resource *>resources)
     foreach(Resource * resource, resources) {
         m_Resources.remove(resource->GetIdentifier());
         m_Path2Resource.remove(resource->GetRelativePath());
+        RemoveFromFilenameIndex(resource->GetRelativePath());
+        // it may never have reached the OPF yet
+        m_PendingOPFAdditions.removeAll(resource);
 
         if (m_FSWatcher->files().contains(resource->GetFullPath())) {
             m_FSWatcher->removePath(resource->GetFullPath());
@@ -545,6 +617,9 @@ void FolderKeeper::RemoveResource(const Resource *resource)
     qDebug() << "In FolderKeeper RemoveResource";
     m_Resources.remove(resource->GetIdentifier());
     m_Path2Resource.remove(resource->GetRelativePath());
+    RemoveFromFilenameIndex(resource->GetRelativePath());
+    // it may never have reached the OPF yet
+    m_PendingOPFAdditions.removeAll(resource);
 
     if (m_FSWatcher->files().contains(resource->GetFullPath())) {
         m_FSWatcher->removePath(resource->GetFullPath());
@@ -562,10 +637,16 @@ void FolderKeeper::ResourceRenamed(const Resource *resource, const QString &old_
     Resource * res = m_Path2Resource[book_path];
     m_Path2Resource.remove(book_path);
     m_Path2Resource[resource->GetRelativePath()] = res;
+    RemoveFromFilenameIndex(book_path);
+    AddToFilenameIndex(resource->GetRelativePath());
     if (resource != m_OPF) {
         m_OPF->ResourceRenamed(resource, old_full_path);
     }
-    updateShortPathNames();
+    if (m_ShortPathUpdatesSuspended) {
+        m_ShortPathNamesDirty = true;
+    } else {
+        updateShortPathNames();
+    }
 }
 
 void FolderKeeper::ResourceMoved(const Resource *resource, const QString &old_full_path)
@@ -576,22 +657,52 @@ void FolderKeeper::ResourceMoved(const Resource *resource, const QString &old_fu
     Resource * res = m_Path2Resource[book_path];
     m_Path2Resource.remove(book_path);
     m_Path2Resource[resource->GetRelativePath()] = res;
+    RemoveFromFilenameIndex(book_path);
+    AddToFilenameIndex(resource->GetRelativePath());
     m_OPF->ResourceMoved(resource, old_full_path);
-    updateShortPathNames();
+    if (m_ShortPathUpdatesSuspended) {
+        m_ShortPathNamesDirty = true;
+    } else {
+        updateShortPathNames();
+    }
 }
 
-void FolderKeeper::ResourceFileChanged(const QString &path) const
+void FolderKeeper::ResourceFileChanged(const QString &path)
 {
-    // The file may have been deleted prior to writing a new version - give it a chance to write.
-    QTime wake_time = QTime::currentTime().addMSecs(1000);
-
-    while (!QFile::exists(path) && QTime::currentTime() < wake_time) {
-        QCoreApplication::processEvents(QEventLoop::AllEvents, 100);
+    // External tools often rewrite many files back to back, and a
+    // single rewrite can fire several change events for one file.
+    // Collect the paths and let one deferred pass handle the whole
+    // batch, instead of stalling in here once per event.
+    if (!m_ChangedFilesPending.contains(path)) {
+        m_ChangedFilesPending.insert(path, QDateTime::currentMSecsSinceEpoch());
     }
 
-    // The signal is also received after resource files are removed / renamed,
-    // but it can be safely ignored because QFileSystemWatcher automatically stops watching them.
-    if (QFile::exists(path)) {
+    m_FileChangedTimer.start();
+}
+
+void FolderKeeper::ProcessChangedFiles()
+{
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+
+    foreach(QString path, m_ChangedFilesPending.keys()) {
+        if (!QFile::exists(path)) {
+            // The file may have been deleted just ahead of writing its
+            // replacement - leave it pending so a later pass picks the
+            // new version up, but only for so long. A file still gone
+            // after the grace period was removed or renamed, which can
+            // be safely ignored because QFileSystemWatcher
+            // automatically stops watching it.
+            if (now - m_ChangedFilesPending[path] > FILE_CHANGED_GRACE_PERIOD) {
+                m_ChangedFilesPending.remove(path);
+            } else {
+                m_FileChangedTimer.start();
+            }
+
+            continue;
+        }
+
+        m_ChangedFilesPending.remove(path);
+
         // Some editors write the updated contents to a temporary file
         // and then atomically move it over the watched file.
         // In this case QFileSystemWatcher loses track of the file, so we have to add it again.
@@ -602,7 +713,7 @@ void FolderKeeper::ResourceFileChanged(const QString &path) const
         foreach(Resource *resource, m_Resources.values()) {
             if (resource->GetFullPath() == path) {
                 resource->FileChangedOnDisk();
-                return;
+                break;
             }
         }
     }
@@ -642,6 +753,39 @@ void FolderKeeper::ResumeWatchingResources()
     }
 }
 
+void FolderKeeper::SuspendOPFUpdates()
+{
+    QMutexLocker locker(&m_AccessMutex);
+    m_OPFUpdatesSuspended = true;
+}
+
+void FolderKeeper::ResumeOPFUpdates()
+{
+    QList<const Resource *> pending;
+    {
+        QMutexLocker locker(&m_AccessMutex);
+        m_OPFUpdatesSuspended = false;
+        pending = m_PendingOPFAdditions;
+        m_PendingOPFAdditions.clear();
+    }
+    if (!pending.isEmpty()) {
+        m_OPF->BulkAddResources(pending);
+    }
+}
+
+void FolderKeeper::SuspendShortPathUpdates()
+{
+    m_ShortPathUpdatesSuspended = true;
+}
+
+void FolderKeeper::ResumeShortPathUpdates()
+{
+    m_ShortPathUpdatesSuspended = false;
+    if (m_ShortPathNamesDirty) {
+        updateShortPathNames();
+    }
+}
+
 
 // Note all paths do NOT end with "/"
 void FolderKeeper::CreateStdGroupToFoldersMap()
@@ -704,17 +848,23 @@ void FolderKeeper::SetFoldersForGroup(const QString &group, const QStringList &f
 
 QString FolderKeeper::buildShortName(const QString &bookpath, int lvl)
 {
-    QStringList pieces = bookpath.split('/');
+    return buildShortName(bookpath.split('/'), bookpath, lvl);
+}
+
+
+QString FolderKeeper::buildShortName(const QStringList &pieces, const QString &bookpath, int lvl)
+{
     if (lvl == 1) return pieces.last();
     int n =  pieces.length();
     if (lvl >= n) return "^" + bookpath;
-    for (int i=lvl; i < n; i++) pieces.removeFirst();
-    return pieces.join('/');
+    // the short name is the last lvl path segments joined back up
+    return pieces.mid(n - lvl).join('/');
 }
 
 
 void FolderKeeper::updateShortPathNames()
 {
+    m_ShortPathNamesDirty = false;
     QStringList bookpaths = GetAllBookPaths();
 
     QHash<QString,QString>BookToSPN;
@@ -722,10 +872,17 @@ void FolderKeeper::updateShortPathNames()
     QSet<QString> DupSet;
     int lvl = 1;
 
+    // split each book path once up front; the duplicate resolution
+    // loop below rebuilds short names from the same pieces per level
+    QHash<QString, QStringList> BookToPieces;
+    foreach(QString bkpath, bookpaths) {
+        BookToPieces[bkpath] = bkpath.split('/');
+    }
+
     // assign filenames as initial short names and create set of duplicate
     // filenames to make unique
     foreach(QString bkpath, bookpaths) {
-        QString aname = buildShortName(bkpath, lvl);
+        QString aname = buildShortName(BookToPieces.value(bkpath), bkpath, lvl);
         BookToSPN[bkpath] = aname;
         if (NameToBooks.contains(aname)) {
             DupSet.insert(aname);
@@ -745,7 +902,7 @@ void FolderKeeper::updateShortPathNames()
             QStringList bklst = NameToBooks[aname];
             NameToBooks.remove(aname);
             foreach(QString bkpath, bklst) {
-                QString newname = buildShortName(bkpath, lvl);
+                QString newname = buildShortName(BookToPieces.value(bkpath), bkpath, lvl);
                 BookToSPN[bkpath] = newname;
                 if (NameToBooks.contains(newname)) {
                     DupSet.insert(newname);
@@ -773,26 +930,28 @@ void FolderKeeper::SetGroupFolders(const QStringList &bookpaths, const QStringLi
 {
     QHash< QString, QStringList > group_folder;
     QHash< QString, QList<int> > group_count;
-    QStringList mediatypes = mtypes;
 
-    // walk bookpaths and mtypes to determine folders
-    // actually being used according to the opf
+    // walk bookpaths and mtypes to determine folders actually being
+    // used according to the opf - one pass, with a per-group hash from
+    // folder to its slot in the lists, so a folder full of files does
+    // not get a list scan per file.  The lists still record folders in
+    // first-seen order, which is what keeps count ties stable.
+    QHash< QString, QHash<QString, int> > folder_pos;
     int i = 0;
     foreach(QString bookpath, bookpaths) {
         QString mtype = mtypes.at(i);
         QString group = MediaTypes::instance()->GetGroupFromMediaType(mtype, "other");
-        QStringList folderlst = group_folder.value(group,QStringList());
-        QList<int> countlst = group_count.value(group, QList<int>());
         QString sdir = Utility::startingDir(bookpath);
-        if (!folderlst.contains(sdir)) {
-            folderlst << sdir;
-            countlst << 1;
+        QHash<QString, int> &pos = folder_pos[group];
+        if (pos.contains(sdir)) {
+            QList<int> &countlst = group_count[group];
+            int p = pos.value(sdir);
+            countlst.replace(p, countlst.at(p) + 1);
         } else {
-            int pos = folderlst.indexOf(sdir);
-            countlst.replace(pos, countlst.at(pos) + 1);
+            pos.insert(sdir, group_folder[group].count());
+            group_folder[group] << sdir;
+            group_count[group] << 1;
         }
-        group_folder[group] = folderlst;
-        group_count[group] = countlst;
         i++;
     }
 
@@ -839,8 +998,12 @@ void FolderKeeper::SetGroupFolders(const QStringList &bookpaths, const QStringLi
         }
     }
 
-    // update m_GrpToFold with result
-    m_GrpToFold.clear();
+    // update m_GrpToFold with result; rename and move flows refresh on
+    // every structural change, and most of those leave the folder map
+    // exactly as it was
+    if (group_folder == m_GrpToFold) {
+        return;
+    }
     m_GrpToFold = group_folder;
 }
 
@@ -858,13 +1021,104 @@ void FolderKeeper::RefreshGroupFolders()
 }
 
 
+static void InitialLoadOneTextResource(TextResource *text_resource)
+{
+    text_resource->InitialLoad();
+}
+
+
 void FolderKeeper::PerformInitialLoads()
 {
     QList<Resource *> resources = GetResourceList();
+    QList<TextResource *> text_resources;
     foreach(Resource * resource, resources) {
         TextResource * text_resource = qobject_cast<TextResource*>(resource);
         if (text_resource) {
-            text_resource->InitialLoad();
+            text_resources.append(text_resource);
+        }
+    }
+    // Load in the global thread pool so disk reads and utf-8 decode
+    // overlap across cores instead of serializing on the GUI thread.
+    // InitialLoad takes the resource's write lock and SetText defers
+    // the QTextDocument update back to the GUI thread when called
+    // from a worker, so this is safe off the main thread.
+    QtConcurrent::blockingMap(text_resources, InitialLoadOneTextResource);
+}
+
+
+// Approximate budget for text kept resident across all text resources.
+// Several large books open at once each get their own FolderKeeper, so
+// this bounds each book separately.
+static const qint64 MAX_RESIDENT_TEXT_BYTES = 256 * 1024 * 1024;
+
+static bool LessRecentlyAccessed(TextResource *resource1, TextResource *resource2)
+{
+    return resource1->LastAccessTime() < resource2->LastAccessTime();
+}
+
+
+void FolderKeeper::UnloadColdTextResources()
+{
+    SIGIL_TRACE_SCOPE("FolderKeeper::UnloadColdTextResources");
+    QList<TextResource *> text_resources = GetResourceTypeList<TextResource>();
+    qint64 total = 0;
+    foreach(TextResource * text_resource, text_resources) {
+        total += text_resource->ResidentTextSize();
+    }
+
+    if (total <= MAX_RESIDENT_TEXT_BYTES) {
+        return;
+    }
+
+    std::sort(text_resources.begin(), text_resources.end(), LessRecentlyAccessed);
+    foreach(TextResource * text_resource, text_resources) {
+        if (total <= MAX_RESIDENT_TEXT_BYTES) {
+            break;
         }
+
+        qint64 size = text_resource->ResidentTextSize();
+
+        if (text_resource->UnloadText()) {
+            total -= size;
+        }
+    }
+}
+
+
+QString FolderKeeper::GetMemoryReport() const
+{
+    // group the resident bytes by concrete resource type so the report
+    // shows where the memory actually lives (html vs css vs misc text)
+    QHash<QString, qint64>  bytes_by_type;
+    QHash<QString, int>     loaded_by_type;
+    QHash<QString, int>     unloaded_by_type;
+    qint64 total = 0;
+
+    foreach(TextResource * text_resource, GetResourceTypeList<TextResource>()) {
+        QString type = text_resource->metaObject()->className();
+        qint64 size = text_resource->ResidentTextSize();
+        if (size > 0) {
+            bytes_by_type[type] += size;
+            loaded_by_type[type] += 1;
+            total += size;
+        } else {
+            unloaded_by_type[type] += 1;
+        }
+    }
+
+    QStringList report;
+    QStringList types = (QStringList() << bytes_by_type.keys() << unloaded_by_type.keys());
+    types.removeDuplicates();
+    types.sort();
+    foreach(QString type, types) {
+        report << QString("%1: %2 KB resident in %3 resources, %4 unloaded")
+                  .arg(type)
+                  .arg(bytes_by_type.value(type) / 1024)
+                  .arg(loaded_by_type.value(type))
+                  .arg(unloaded_by_type.value(type));
     }
+    report << QString("total resident text: %1 KB of %2 KB budget")
+              .arg(total / 1024)
+              .arg(MAX_RESIDENT_TEXT_BYTES / 1024);
+    return report.join('\n');
 }
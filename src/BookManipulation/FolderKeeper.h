@@ -29,6 +29,8 @@
 #include <QtCore/QHash>
 #include <QtCore/QList>
 #include <QtCore/QMutex>
+#include <QtCore/QPair>
+#include <QtCore/QTimer>
 #include <QFileSystemWatcher>
 
 // These have to be included directly because
@@ -159,7 +161,7 @@ public:
     // @throws ResourceDoesNotExist if bookpath is not found.
     Resource *GetResourceByBookPath(const QString &bookpath) const;
 
-    // this is O(n) but no filesystem is queried
+    // this is O(1) via the filename index, no filesystem is queried
     QString GetBookPathByPathEnd(const QString& path_end) const;
     
 
@@ -210,8 +212,43 @@ public:
 
     void updateShortPathNames();
 
+    /**
+     * During bulk rename/move operations we need to suspend/resume the
+     * short path name recomputation, otherwise every single rename pays
+     * for a full pass over all resources.  Resume performs one combined
+     * recomputation if any rename happened while suspended.
+     */
+    void SuspendShortPathUpdates();
+    void ResumeShortPathUpdates();
+
+    /**
+     * Brackets a bulk add of many content files.  While suspended,
+     * AddContentFileToFolder queues its OPF notifications instead of
+     * emitting them, and Resume pushes all queued additions into the
+     * OPF manifest/spine in one pass.
+     */
+    void SuspendOPFUpdates();
+    void ResumeOPFUpdates();
+
     void PerformInitialLoads();
 
+    /**
+     * Unloads the text of cold, clean text resources back to their
+     * disk backed lazy state whenever the total resident text exceeds
+     * the budget, least recently accessed first. Resources whose
+     * document a tab owns, or whose text is not known to be on disk,
+     * are left alone.
+     */
+    void UnloadColdTextResources();
+
+    /**
+     * A human readable accounting of the text bytes this book keeps
+     * resident, grouped by resource type, together with the budget
+     * UnloadColdTextResources() enforces. Used by the memory usage
+     * report in the Tools menu.
+     */
+    QString GetMemoryReport() const;
+
     void RefreshGroupFolders();
 
     void SetGroupFolders(const QStringList &bookpaths, const QStringList &mtypes, bool update_only = false);
@@ -268,8 +305,15 @@ private slots:
 
     /**
      * Called by the FSWatcher when a watched file has changed on disk.
+     * Only queues the path; the actual handling is batched.
+     */
+    void ResourceFileChanged(const QString &path);
+
+    /**
+     * Processes the queued file change events in one pass, once the
+     * events have stopped arriving for a short while.
      */
-    void ResourceFileChanged(const QString &path) const;
+    void ProcessChangedFiles();
 
 private:
 
@@ -279,6 +323,14 @@ private:
 
     QString buildShortName(const QString &bookpath, int lvl);
 
+    // batch variant used by updateShortPathNames: the book path is
+    // split once by the caller and the pieces reused across levels
+    QString buildShortName(const QStringList &pieces, const QString &bookpath, int lvl);
+
+    // keep the filename index in step with m_Path2Resource
+    void AddToFilenameIndex(const QString &bookpath);
+    void RemoveFromFilenameIndex(const QString &bookpath);
+
     /**
      * Dereferences two pointers and compares the values with "<".
      *
@@ -318,6 +370,22 @@ private:
 
     QHash<QString, Resource *> m_Path2Resource;
 
+    /**
+     * Secondary index of lowercased filename to the book paths that
+     * end with it, so path-end lookups during link resolution do not
+     * scan every resource.
+     */
+    QHash<QString, QStringList> m_Filename2Paths;
+
+    /**
+     * Remembers the next free numeric suffix (and its zero padding
+     * width) per name prefix and extension, so bulk creation of
+     * numbered files resolves each clash without rescanning every
+     * filename. Values may go stale after deletes or renames; the
+     * filename index is always consulted before a name is handed out.
+     */
+    mutable QHash<QString, QPair<int, int>> m_NextSuffixIndex;
+
     /**
      * Ensures thread-safe access to the m_Resources hash.
      */
@@ -334,8 +402,29 @@ private:
     QFileSystemWatcher *m_FSWatcher;
     QStringList m_SuspendedWatchedFiles;
 
+    /**
+     * Changed paths waiting for the batched reload pass, mapped to
+     * when their first pending change event arrived.
+     */
+    QHash<QString, qint64> m_ChangedFilesPending;
+
+    /**
+     * Coalesces bursts of file change events into one handling pass.
+     */
+    QTimer m_FileChangedTimer;
+
     QString m_FullPathToMainFolder;
 
+    bool m_ShortPathUpdatesSuspended;
+    bool m_ShortPathNamesDirty;
+
+    /**
+     * Resources added while OPF updates are suspended, waiting to be
+     * pushed to the OPF in one batch. @see SuspendOPFUpdates().
+     */
+    bool m_OPFUpdatesSuspended;
+    QList<const Resource *> m_PendingOPFAdditions;
+
     QHash<QString, QStringList> m_GrpToFold;
     QHash<QString, QStringList> m_StdGrpToFold;
 };
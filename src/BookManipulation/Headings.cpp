@@ -50,11 +50,56 @@ const QString SIGIL_NOT_IN_TOC_CLASS = "sigil_not_in_toc";
 const QString OLD_SIGIL_NOT_IN_TOC_CLASS = "sigilNotInTOC";
 
 
+// The headings extracted from one file, keyed by a hash of the text
+// they were extracted from.  Hashing the text is far cheaper than the
+// Gumbo parse, so reopening the TOC dialogs only re-walks the files
+// that were actually edited in between.  The cached list holds every
+// heading regardless of its not-in-toc class; the include filter is
+// applied on the way out.
+struct HeadingCacheEntry {
+    QByteArray source_hash;
+    QList<Headings::Heading> headings;
+};
+
+static QMutex heading_cache_mutex;
+static QHash<const HTMLResource *, HeadingCacheEntry> heading_cache;
+
+static QList<Headings::Heading> FilterUnwantedHeadings(const QList<Headings::Heading> &headings,
+        bool include_unwanted_headings)
+{
+    if (include_unwanted_headings) {
+        return headings;
+    }
+    QList<Headings::Heading> wanted;
+    foreach(const Headings::Heading &heading, headings) {
+        if (heading.include_in_toc) {
+            wanted.append(heading);
+        }
+    }
+    return wanted;
+}
+
+
 // Returns a list of headings from the provided XHTML source;
 // the list is flat, the headings are *not* in a hierarchy tree
 QList<Headings::Heading> Headings::GetHeadingList(QList<HTMLResource *> html_resources,
         bool include_unwanted_headings)
 {
+    // Drop cache entries for resources that no longer exist so the
+    // cache stays bounded by the size of the book.
+    {
+        QMutexLocker locker(&heading_cache_mutex);
+        QSet<const HTMLResource *> current;
+        foreach(HTMLResource * html_resource, html_resources) {
+            current.insert(html_resource);
+        }
+        foreach(const HTMLResource * key, heading_cache.keys()) {
+            if (!current.contains(key)) {
+                heading_cache.remove(key);
+            }
+        }
+    }
+
     QList<Headings::Heading> heading_list;
     QList<QList<Headings::Heading>> per_file_headings =
                                      QtConcurrent::blockingMapped(html_resources,
@@ -74,6 +119,15 @@ QList<Headings::Heading> Headings::GetHeadingListForOneFile(HTMLResource *html_r
     Q_ASSERT(html_resource);
     QString source = html_resource->GetText();
     QString version = html_resource->GetEpubVersion();
+    QByteArray source_hash = QCryptographicHash::hash(QByteArray(reinterpret_cast<const char *>(source.utf16()), source.length() * 2),
+                             QCryptographicHash::Md5);
+    {
+        QMutexLocker locker(&heading_cache_mutex);
+        HeadingCacheEntry entry = heading_cache.value(html_resource);
+        if (entry.source_hash == source_hash) {
+            return FilterUnwantedHeadings(entry.headings, include_unwanted_headings);
+        }
+    }
     GumboInterface gi = GumboInterface(source, version);
     gi.parse();
 
@@ -132,12 +186,17 @@ QList<Headings::Heading> Headings::GetHeadingListForOneFile(HTMLResource *html_r
         heading.at_file_start = (i == 0) && ((node_line - body_line) < ALLOWED_HEADING_DISTANCE);
         heading.is_changed     = false;
 
-        if (heading.include_in_toc || include_unwanted_headings) {
-            headings.append(heading);
-        }
+        headings.append(heading);
+    }
+
+    {
+        QMutexLocker locker(&heading_cache_mutex);
+        HeadingCacheEntry &entry = heading_cache[html_resource];
+        entry.source_hash = source_hash;
+        entry.headings = headings;
     }
 
-    return headings;
+    return FilterUnwantedHeadings(headings, include_unwanted_headings);
 }
 
 
@@ -1,6 +1,6 @@
 /************************************************************************
 **
-**  Copyright (C) 2015-2021 Kevin B. Hendricks Stratford, ON, Canada 
+**  Copyright (C) 2015-2021 Kevin B. Hendricks Stratford, ON, Canada
 **  Copyright (C) 2012      John Schember <john@nachtimwald.com>
 **  Copyright (C) 2012      Dave Heiland
 **
@@ -22,6 +22,7 @@
 *************************************************************************/
 
 #include <memory>
+#include <utility>
 
 #include <QtCore/QtCore>
 #include <QtConcurrent/QtConcurrent>
@@ -41,30 +42,93 @@
 const QString SIGIL_INDEX_CLASS = "sigil_index_marker";
 const QString SIGIL_INDEX_ID_PREFIX = "sigil_index_id_";
 
-bool Index::BuildIndex(QList<HTMLResource *> html_resources)
+// One Create Index scan result for a single file.  The recorded
+// (index entry, id) pairs let a later run replay this file's
+// contribution to IndexEntries without reparsing it, as long as
+// neither its text nor the index patterns have changed since.
+struct IndexFileCache {
+    QByteArray key;
+    QList<std::pair<QString, QString>> entries;
+};
+
+static QHash<QString, IndexFileCache> s_FileCaches;
+
+// What one worker hands back for one file - the entries found (or
+// replayed from cache) get merged into IndexEntries in spine order
+// after every file has been scanned.
+struct IndexFileScan {
+    QString bookpath;
+    QByteArray key;
+    QList<std::pair<QString, QString>> entries;
+    bool from_cache;
+};
+
+// Hash of the file text combined with the current index patterns - a
+// change to either one invalidates the cached scan of that file.
+static QByteArray IndexCacheKey(const QString &source, const QByteArray &patterns_digest)
 {
-    IndexEntries::instance()->Clear();
-    // Display progress dialog
-    QProgressDialog progress(QObject::tr("Creating Index..."), QObject::tr("Cancel"), 0, html_resources.count(), QApplication::activeWindow());
-    progress.setMinimumDuration(0);
-    int progress_value = 0;
-    progress.setValue(progress_value);
-    qApp->processEvents();
-    // Must do sequentially in order to keep sections in order
-    foreach(HTMLResource * html_resource, html_resources) {
-        // Set progress value and ensure dialog has time to display when doing extensive updates
-        if (progress.wasCanceled()) {
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    hash.addData(source.toUtf8());
+    hash.addData(patterns_digest);
+    return hash.result();
+}
+
+static bool CreateIndexEntry(const QString text,
+                             QString index_id_value,
+                             bool is_custom_index_entry,
+                             QString custom_index_value,
+                             const QList<Index::CompiledEntry> &compiled_entries,
+                             const QRegularExpression &prefilter,
+                             QList<std::pair<QString, QString>> &recorded_entries)
+{
+    bool created_index = false;
+    QList<Index::CompiledEntry> entries;
+
+    if (is_custom_index_entry) {
+        Index::CompiledEntry custom_entry;
+        // need to escape text to prevent it being interpreted
+        // as a QRegularExpression special character
+        custom_entry.pattern = QRegularExpression::escape(text);
+        custom_entry.regex = QRegularExpression(custom_entry.pattern);
+        custom_entry.index_entry = custom_index_value;
+        entries.append(custom_entry);
+    } else {
+        // A node whose text matches no pattern at all is the common
+        // case, and one scan of the combined alternation dismisses it
+        // without trying every entry individually.  An empty prefilter
+        // pattern matches everything so falling back to no prefilter
+        // just means every entry is tried.
+        if (!text.contains(prefilter)) {
             return false;
         }
+        entries = compiled_entries;
+    }
 
-        progress.setValue(progress_value++);
-        qApp->processEvents();
-        AddIndexIDsOneFile(html_resource);
+    foreach(const Index::CompiledEntry &entry, entries) {
+        if (text.contains(entry.regex)) {
+            created_index = true;
+            QString index_entry = entry.index_entry;
+            QString entry_name;
+            if (index_entry.isEmpty()) {
+                // If no index text, use the pattern
+                entry_name = entry.pattern;
+            } else if (index_entry.endsWith("/")) {
+                // If index text is a category then append the pattern
+                entry_name = index_entry + entry.pattern;
+            } else {
+                // Use the given index text
+                entry_name = index_entry;
+            }
+            recorded_entries.append(std::make_pair(entry_name, index_id_value));
+        }
     }
-    return true;
+    return created_index;
 }
 
-void Index::AddIndexIDsOneFile(HTMLResource *html_resource)
+static void AddIndexIDsOneFile(HTMLResource *html_resource,
+                               const QList<Index::CompiledEntry> &compiled_entries,
+                               const QRegularExpression &prefilter,
+                               QList<std::pair<QString, QString>> &recorded_entries)
 {
     QWriteLocker locker(&html_resource->GetLock());
     QString source = html_resource->GetText();
@@ -101,7 +165,7 @@ void Index::AddIndexIDsOneFile(HTMLResource *html_resource)
 
             if (class_names.split(" ").contains(SIGIL_INDEX_CLASS)) {
                 is_custom_index_entry = true;
-                
+
                 GumboAttribute* titleattr = gumbo_get_attribute(&node->v.element.attributes, "title");
                 if (titleattr) {
                     QString title = QString::fromUtf8(titleattr->value);
@@ -116,13 +180,13 @@ void Index::AddIndexIDsOneFile(HTMLResource *html_resource)
         // Use the existing id if there is one, else add one if node contains index item
         attr = gumbo_get_attribute(&node->v.element.attributes, "id");
         if (attr) {
-            CreateIndexEntry(text_node_text, html_resource, index_id_value, is_custom_index_entry, custom_index_value);
+            CreateIndexEntry(text_node_text, index_id_value, is_custom_index_entry, custom_index_value, compiled_entries, prefilter, recorded_entries);
         } else {
             index_id_value = SIGIL_INDEX_ID_PREFIX + QString::number(index_id_number);
 
-            if (CreateIndexEntry(text_node_text, html_resource, index_id_value, is_custom_index_entry, custom_index_value)) {
+            if (CreateIndexEntry(text_node_text, index_id_value, is_custom_index_entry, custom_index_value, compiled_entries, prefilter, recorded_entries)) {
                 GumboElement* element = &node->v.element;
-                gumbo_element_set_attribute(element, "id", index_id_value.toUtf8().constData()); 
+                gumbo_element_set_attribute(element, "id", index_id_value.toUtf8().constData());
                 resource_updated = true;
                 index_id_number++;
             }
@@ -134,45 +198,123 @@ void Index::AddIndexIDsOneFile(HTMLResource *html_resource)
     }
 }
 
+// Scans (or replays the cached scan of) a single file.  Safe on worker
+// threads: it serializes through the per-resource locks the same way
+// the universal update workers do, the file cache is only read while
+// scans are in flight, and the results get merged back on the GUI
+// thread once every file is done.
+struct ScanOneHTMLFileMapped {
+    typedef IndexFileScan result_type;
 
-bool Index::CreateIndexEntry(const QString text, HTMLResource *html_resource, QString index_id_value, bool is_custom_index_entry, QString custom_index_value)
-{
-    bool created_index = false;
-    QList<IndexEditorModel::indexEntry *> entries;
+    QList<Index::CompiledEntry> compiled_entries;
+    QRegularExpression prefilter;
+    QByteArray patterns_digest;
 
-    if (is_custom_index_entry) {
-        IndexEditorModel::indexEntry *custom_entry = new IndexEditorModel::indexEntry();
-        // need to escape text to prevent it being interpreted 
-        // as a QRegularExpression special character
-        custom_entry->pattern = QRegularExpression::escape(text);
-        custom_entry->index_entry = custom_index_value;
-        entries.append(custom_entry);
-    } else {
-        entries = IndexEditorModel::instance()->GetEntries();
+    IndexFileScan operator()(HTMLResource *html_resource) const {
+        IndexFileScan scan;
+        scan.bookpath = html_resource->GetRelativePath();
+        scan.from_cache = false;
+        {
+            QReadLocker locker(&html_resource->GetLock());
+            scan.key = IndexCacheKey(html_resource->GetText(), patterns_digest);
+        }
+        IndexFileCache cache = s_FileCaches.value(scan.bookpath);
+        if (cache.key == scan.key && !scan.key.isEmpty()) {
+            // Unchanged since its last scan - just replay its entries.
+            scan.entries = cache.entries;
+            scan.from_cache = true;
+            return scan;
+        }
+
+        AddIndexIDsOneFile(html_resource, compiled_entries, prefilter, scan.entries);
+        // Key the cache on the text as it stands after the scan (ids
+        // may have been added or renumbered), because that is the text
+        // the next run will see.  Rescanning already-scanned text is a
+        // fixed point, so the recorded entries stay valid.
+        {
+            QReadLocker locker(&html_resource->GetLock());
+            scan.key = IndexCacheKey(html_resource->GetText(), patterns_digest);
+        }
+        return scan;
     }
+};
+
+bool Index::BuildIndex(QList<HTMLResource *> html_resources)
+{
+    IndexEntries::instance()->Clear();
 
-    foreach(IndexEditorModel::indexEntry * entry, entries) {
-        QString index_pattern = entry->pattern;
-        if (index_pattern.isEmpty()) {
+    // Compile every index pattern exactly once for the whole run and
+    // combine them into a single alternation used as a prefilter, so
+    // the per-node cost stops scaling with the size of the entry list.
+    // The model is only safe to touch here on the GUI thread, so the
+    // workers get a snapshot of the compiled entries.
+    ScanOneHTMLFileMapped scanner;
+    QStringList alternates;
+    QCryptographicHash digest(QCryptographicHash::Md5);
+    foreach(IndexEditorModel::indexEntry * entry, IndexEditorModel::instance()->GetEntries()) {
+        digest.addData(entry->pattern.toUtf8());
+        digest.addData("\x1f", 1);
+        digest.addData(entry->index_entry.toUtf8());
+        digest.addData("\x1e", 1);
+
+        if (entry->pattern.isEmpty()) {
             continue;
         }
 
-        QRegularExpression index_regex(index_pattern);
+        Index::CompiledEntry centry;
+        centry.pattern = entry->pattern;
+        centry.index_entry = entry->index_entry;
+        centry.regex = QRegularExpression(entry->pattern);
+        scanner.compiled_entries.append(centry);
+        alternates.append("(?:" + entry->pattern + ")");
+    }
+    scanner.patterns_digest = digest.result();
 
-        if (text.contains(index_regex)) {
-            created_index = true;
-            QString index_entry = entry->index_entry;
-            if (index_entry.isEmpty()) {
-                // If no index text, use the pattern
-                IndexEntries::instance()->AddOneEntry(index_pattern, html_resource->GetRelativePath(), index_id_value);
-            } else if (entry->index_entry.endsWith("/")) {
-                // If index text is a category then append the pattern
-                IndexEntries::instance()->AddOneEntry(index_entry + index_pattern, html_resource->GetRelativePath(), index_id_value);
-            } else {
-                // Use the given index text
-                IndexEntries::instance()->AddOneEntry(index_entry, html_resource->GetRelativePath(), index_id_value);
-            }
+    if (!alternates.isEmpty()) {
+        QRegularExpression combined(alternates.join("|"));
+        // Pathological patterns can make the combined alternation fail
+        // to compile - then there is simply no prefilter and every
+        // entry is still tried individually.
+        if (combined.isValid()) {
+            scanner.prefilter = combined;
         }
     }
-    return created_index;
+
+    QFuture<IndexFileScan> future = QtConcurrent::mapped(html_resources, scanner);
+
+    // Display progress dialog
+    QProgressDialog progress(QObject::tr("Creating Index..."), QObject::tr("Cancel"), 0, html_resources.count(), QApplication::activeWindow());
+    progress.setMinimumDuration(0);
+    progress.setValue(0);
+    qApp->processEvents();
+
+    while (future.isRunning()) {
+        if (progress.wasCanceled()) {
+            future.cancel();
+            future.waitForFinished();
+            return false;
+        }
+
+        progress.setValue(future.progressValue());
+        qApp->processEvents(QEventLoop::ExcludeUserInputEvents, 100);
+    }
+    future.waitForFinished();
+    progress.setValue(html_resources.count());
+
+    // Merge the per-file results back in spine order so the links
+    // under each index entry keep their reading order, no matter in
+    // what order the workers finished the files.
+    for (int i = 0; i < future.resultCount(); i++) {
+        IndexFileScan scan = future.resultAt(i);
+        for (int j = 0; j < scan.entries.count(); j++) {
+            IndexEntries::instance()->AddOneEntry(scan.entries.at(j).first, scan.bookpath, scan.entries.at(j).second);
+        }
+        if (!scan.from_cache) {
+            IndexFileCache cache;
+            cache.key = scan.key;
+            cache.entries = scan.entries;
+            s_FileCaches[scan.bookpath] = cache;
+        }
+    }
+    return true;
 }
@@ -1,6 +1,6 @@
 /************************************************************************
 **
-**  Copyright (C) 2015-2020 Kevin B. Hendricks Stratford, ON, Canada 
+**  Copyright (C) 2015-2020 Kevin B. Hendricks Stratford, ON, Canada
 **  Copyright (C) 2012      John Schember <john@nachtimwald.com>
 **  Copyright (C) 2012      Dave Heiland
 **
@@ -25,6 +25,10 @@
 #ifndef INDEX_H
 #define INDEX_H
 
+#include <QtCore/QList>
+#include <QtCore/QString>
+#include <QRegularExpression>
+
 class HTMLResource;
 
 /**
@@ -38,10 +42,13 @@ class Index
 public:
     static bool BuildIndex(QList<HTMLResource *> html_resources);
 
-private:
-    static void AddIndexIDsOneFile(HTMLResource *html_resource);
-
-    static bool CreateIndexEntry(const QString text, HTMLResource *html_resource, QString index_id_name, bool is_custom_index_entry, QString custom_index_name);
+    // One index pattern compiled exactly once per Create Index run
+    // and shared by every file scan, instead of recompiled per node
+    struct CompiledEntry {
+        QRegularExpression regex;
+        QString pattern;
+        QString index_entry;
+    };
 };
 
 #endif // INDEX_H
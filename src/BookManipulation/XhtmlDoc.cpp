@@ -23,8 +23,10 @@
 
 #include <memory>
 #include <string>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QHash>
 #include <QtCore/QList>
+#include <QtCore/QMutex>
 #include <QtCore/QString>
 #include <QtCore/QXmlStreamReader>
 // #include <QtWebKitWidgets/QWebFrame>
@@ -187,6 +189,7 @@ QList<QString> XhtmlDoc::GetAllDescendantClasses(const QString & source)
 {
     QString version = "any_version";
     GumboInterface gi = GumboInterface(source, version);
+    gi.parse_cached();
     QList<GumboNode*> nodes = gi.get_all_nodes_with_attribute(QString("class"));
     QStringList classes;
     foreach(GumboNode * node, nodes) {
@@ -207,6 +210,7 @@ QList<QString> XhtmlDoc::GetAllDescendantStyleUrls(const QString & source)
 {
     QString version = "any_version";
     GumboInterface gi = GumboInterface(source, version);
+    gi.parse_cached();
     QList<GumboNode*> nodes = gi.get_all_nodes_with_attribute(QString("style"));
     QStringList styles;
     foreach(GumboNode * node, nodes) {
@@ -228,6 +232,7 @@ QList<QString> XhtmlDoc::GetAllDescendantIDs(const QString & source)
 {
     QString version = "any_version";
     GumboInterface gi = GumboInterface(source, version);
+    gi.parse_cached();
     QList<GumboNode*> nodes = gi.get_all_nodes_with_attribute(QString("id"));
     nodes.append(gi.get_all_nodes_with_attribute(QString("name")));
     QStringList IDs;
@@ -254,6 +259,7 @@ QList<QString> XhtmlDoc::GetAllDescendantHrefs(const QString & source)
 {
     QString version = "any_version";
     GumboInterface gi = GumboInterface(source, version);
+    gi.parse_cached();
     QList<GumboNode*> nodes = gi.get_all_nodes_with_attribute(QString("href"));
     QStringList hrefs;
     foreach(GumboNode * node, nodes) {
@@ -269,6 +275,7 @@ QList<QString> XhtmlDoc::GetAllDescendantHrefs(const QString & source)
 XhtmlDoc::WellFormedError XhtmlDoc::GumboWellFormedErrorForSource(const QString &source, QString version)
 {
     GumboInterface gi = GumboInterface(source, version);
+    gi.parse_cached();
     QList<GumboWellFormedError> results = gi.error_check();
     if (!results.isEmpty()) {
         XhtmlDoc::WellFormedError error;
@@ -281,7 +288,17 @@ XhtmlDoc::WellFormedError XhtmlDoc::GumboWellFormedErrorForSource(const QString
 }
 
 
-XhtmlDoc::WellFormedError XhtmlDoc::WellFormedErrorForSource(const QString &source, QString version)
+// Memo of recent well formed verdicts keyed by content hash.  The same
+// text gets re-checked several times during one save or mend cycle, and
+// over and over while a user works on a big broken file; the verdict is
+// tiny, so remembering it makes every repeat free.
+static const int MAX_CACHED_VERDICTS = 50;
+static QHash<QByteArray, XhtmlDoc::WellFormedError> wf_cache;
+static QList<QByteArray> wf_cache_order;
+static QMutex wf_cache_mutex;
+
+// the actual check, uncached
+static XhtmlDoc::WellFormedError CheckSourceWellFormed(const QString &source)
 {
     QXmlStreamReader reader(source);
     int ndoctypes = 0;
@@ -337,6 +354,38 @@ XhtmlDoc::WellFormedError XhtmlDoc::WellFormedErrorForSource(const QString &sour
     return XhtmlDoc::WellFormedError();
 }
 
+
+XhtmlDoc::WellFormedError XhtmlDoc::WellFormedErrorForSource(const QString &source, QString version)
+{
+    Q_UNUSED(version);
+
+    // the check itself never looks at the version, so the hash is the key
+    QByteArray key = QCryptographicHash::hash(
+        QByteArray::fromRawData(reinterpret_cast<const char*>(source.constData()),
+                                source.size() * int(sizeof(QChar))),
+        QCryptographicHash::Sha1);
+    {
+        QMutexLocker locker(&wf_cache_mutex);
+        if (wf_cache.contains(key)) {
+            wf_cache_order.removeOne(key);
+            wf_cache_order << key;
+            return wf_cache.value(key);
+        }
+    }
+
+    XhtmlDoc::WellFormedError error = CheckSourceWellFormed(source);
+
+    QMutexLocker locker(&wf_cache_mutex);
+    if (!wf_cache.contains(key)) {
+        wf_cache.insert(key, error);
+        wf_cache_order << key;
+        while (wf_cache_order.size() > MAX_CACHED_VERDICTS) {
+            wf_cache.remove(wf_cache_order.takeFirst());
+        }
+    }
+    return error;
+}
+
 bool XhtmlDoc::IsDataWellFormed(const QString &data, QString version)
 {
   XhtmlDoc::WellFormedError error = XhtmlDoc::WellFormedErrorForSource(data, version);
@@ -596,6 +645,7 @@ QStringList XhtmlDoc::GetHrefSrcPaths(const QString &source)
 {
     QStringList destination_paths;
     GumboInterface gi = GumboInterface(source, "any_version");
+    gi.parse_cached();
     foreach(QString apath, gi.get_all_values_for_attribute("src")) {
         destination_paths << apath;
     }
@@ -621,6 +671,7 @@ QStringList XhtmlDoc::GetPathsToStyleFiles(const QString &source)
 {
     QString version = "any_version";
     GumboInterface gi = GumboInterface(source, version);
+    gi.parse_cached();
     QStringList style_paths;
     QList<GumboNode*> nodes = gi.get_all_nodes_with_tag(GUMBO_TAG_LINK);
     for (int i = 0; i < nodes.count(); ++i) {
@@ -678,6 +729,7 @@ QStringList XhtmlDoc::GetAllMediaPathsFromMediaChildren(const QString & source,
 {
     QString version = "any_version";
     GumboInterface gi = GumboInterface(source, version);
+    gi.parse_cached();
     QStringList media_paths;
     QList<GumboNode*> nodes = gi.get_all_nodes_with_tags(tags);
     for (int i = 0; i < nodes.count(); ++i) {
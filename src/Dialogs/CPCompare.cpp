@@ -169,6 +169,11 @@ void CPCompare::handle_mod_request()
 {
     QStringList pathlist = m_mlist->get_selections();
     PythonRoutines pr;
+    // collect the text files first so the whole selection is diffed
+    // in a single round trip to the embedded interpreter
+    QStringList text_paths;
+    QStringList leftpaths;
+    QStringList rightpaths;
     foreach(QString apath, pathlist) {
         QString leftpath = m_cpdir + "/" + apath;
         QString rightpath = m_bookroot + "/" + apath;
@@ -176,17 +181,9 @@ void CPCompare::handle_mod_request()
         QFileInfo lfi(leftpath);
         QString ext = fi.suffix().toLower();
         if (TEXT_EXTENSIONS.contains(ext)) {
-
-            QApplication::setOverrideCursor(Qt::WaitCursor);
-            QFuture<QList<DiffRecord::DiffRec>> bfuture =
-                QtConcurrent::run(&pr, &PythonRoutines::GenerateParsedNDiffInPython, leftpath, rightpath);
-            bfuture.waitForFinished();
-            QList<DiffRecord::DiffRec> diffinfo = bfuture.result();
-            QApplication::restoreOverrideCursor();
-
-            ChgViewer* cv = new ChgViewer(diffinfo, tr("Checkpoint:") + " " + apath, tr("Current:") + " " + apath, this);
-            cv->show();
-            cv->raise();
+            text_paths << apath;
+            leftpaths << leftpath;
+            rightpaths << rightpath;
         } else {
             QMessageBox * msgbox = new QMessageBox(this);
             msgbox->setIcon(QMessageBox::Information);
@@ -200,6 +197,24 @@ void CPCompare::handle_mod_request()
             msgbox->raise();
         }
     }
+
+    if (text_paths.isEmpty()) {
+        return;
+    }
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    QFuture<QList<QList<DiffRecord::DiffRec>>> bfuture =
+        QtConcurrent::run(&pr, &PythonRoutines::GenerateParsedNDiffsInPython, leftpaths, rightpaths);
+    bfuture.waitForFinished();
+    QList<QList<DiffRecord::DiffRec>> diffsets = bfuture.result();
+    QApplication::restoreOverrideCursor();
+
+    for (int i = 0; i < diffsets.count(); i++) {
+        QString apath = text_paths.at(i);
+        ChgViewer* cv = new ChgViewer(diffsets.at(i), tr("Checkpoint:") + " " + apath, tr("Current:") + " " + apath, this);
+        cv->show();
+        cv->raise();
+    }
 }
 
 void CPCompare::handle_cleanup()
@@ -33,6 +33,7 @@
 #include <QKeyEvent>
 #include <QApplication>
 #include <QDateTime>
+#include <QTimer>
 #include <QDebug>
 
 #include "Widgets/TextView.h"
@@ -51,6 +52,11 @@ static const QString _grayColor         = "#dddddd";
 static const QString _greenColor        = "#c9fcd6";
 static const QString _darkgreenColor    = "#50c96e";
 
+// diff records realized into the viewers per pass through the event
+// loop; large enough to fill the first screen many times over, small
+// enough that each pass finishes quickly
+static const int DIFF_CHUNK_SIZE = 2000;
+
 
 ChgViewer::ChgViewer(const QList<DiffRecord::DiffRec>& diffinfo, 
                      const QString&file1, const QString& file2, QWidget *parent)
@@ -59,7 +65,11 @@ ChgViewer::ChgViewer(const QList<DiffRecord::DiffRec>& diffinfo,
       m_view2(new TextView(this)),
       m_lbl1(new QLabel(file1, this)),
       m_lbl2(new QLabel(file2, this)),
-      m_nav(new Navigator(this))
+      m_nav(new Navigator(this)),
+      m_pos(0),
+      m_blockno(0),
+      m_leftlineno(1),
+      m_rightlineno(1)
 {
     setAttribute(Qt::WA_DeleteOnClose,true);
     // handle the layout manually
@@ -109,36 +119,53 @@ void ChgViewer::insert_with_background(QTextCursor& tc, const QString& sval, con
 
 void ChgViewer::LoadViewers(const QList<DiffRecord::DiffRec>& diffinfo)
 {
-    QTextCursor tc1 = m_view1->textCursor();
-    tc1.movePosition(QTextCursor::Start, QTextCursor::MoveAnchor,1);
-    m_view1->setTextCursor(tc1);
+    m_diffinfo = diffinfo;
+    m_tc1 = m_view1->textCursor();
+    m_tc1.movePosition(QTextCursor::Start, QTextCursor::MoveAnchor,1);
+    m_view1->setTextCursor(m_tc1);
+    m_tc2 = m_view2->textCursor();
+    m_tc2.movePosition(QTextCursor::Start, QTextCursor::MoveAnchor,1);
+    m_view2->setTextCursor(m_tc2);
+    // realize the first chunk right away so the top of the diff shows
+    // immediately; the rest streams in from the event loop
+    load_next_chunk();
+}
+
+void ChgViewer::load_next_chunk()
+{
+    int end = qMin(m_pos + DIFF_CHUNK_SIZE, m_diffinfo.count());
+    QTextCursor& tc1 = m_tc1;
+    QTextCursor& tc2 = m_tc2;
     tc1.beginEditBlock();
-    QTextCursor tc2 = m_view2->textCursor();
-    tc2.movePosition(QTextCursor::Start, QTextCursor::MoveAnchor,1);
-    m_view2->setTextCursor(tc2);
     tc2.beginEditBlock();
-    int blockno = 0;
-    int leftlineno = 1;
-    int rightlineno = 1;
     QString pad = "" + _PAD;
+    // runs of unchanged lines are collected here and inserted in one
+    // call since a per-line insertText is a time killer on big files
+    QString samerun;
     // codes: 0 = Similar, 1 = RightOnly, 2 = LeftOnly, 3 = Changed
-    foreach(DiffRecord::DiffRec diff, diffinfo) {
+    for (int dpos = m_pos; dpos < end; dpos++) {
+        const DiffRecord::DiffRec& diff = m_diffinfo.at(dpos);
         if (diff.code == "0") { // similar
-            tc1.insertText(diff.line + "\n");
-            tc2.insertText(diff.line + "\n");
-        } else if (diff.code == "1") { // rightonly
-            m_changelst << blockno;
+            samerun.append(diff.line);
+            samerun.append('\n');
+        } else if (!samerun.isEmpty()) {
+            tc1.insertText(samerun);
+            tc2.insertText(samerun);
+            samerun.clear();
+        }
+        if (diff.code == "1") { // rightonly
+            m_changelst << m_blockno;
             int n = diff.line.length();
             insert_with_background(tc1, pad.repeated(n) + "\n", _grayColor);
             insert_with_background(tc2, diff.line + "\n", _greenColor);
         } else if (diff.code == "2") { // leftonly
-            m_changelst << blockno;
+            m_changelst << m_blockno;
             int n = diff.line.length();
             insert_with_background(tc1, diff.line + "\n", _redColor);
             insert_with_background(tc2, pad.repeated(n) + "\n", _grayColor);
 
         } else if (diff.code == "3") { // changed
-            m_changelst << blockno;
+            m_changelst << m_blockno;
             int l1 = diff.line.length();
             int l2 = diff.newline.length();
             int n = std::max(l1, l2);
@@ -218,29 +245,42 @@ void ChgViewer::LoadViewers(const QList<DiffRecord::DiffRec>& diffinfo)
             tc2.insertText(pad.repeated(n-l2) + "\n");
         }
 
-        blockno++;
+        m_blockno++;
         // map out block to line numbers
         if (diff.code == "2") { // leftonly
-            m_leftno << QString::number(leftlineno);
+            m_leftno << QString::number(m_leftlineno);
             m_rightno << "";
-            leftlineno++;
+            m_leftlineno++;
         } else if (diff.code == "1") { // rightonly
-            m_rightno << QString::number(rightlineno);
+            m_rightno << QString::number(m_rightlineno);
             m_leftno << "";
-            rightlineno++;
+            m_rightlineno++;
         } else { // 
-            m_leftno << QString::number(leftlineno);
-            m_rightno << QString::number(rightlineno);
-            leftlineno++;
-            rightlineno++;
+            m_leftno << QString::number(m_leftlineno);
+            m_rightno << QString::number(m_rightlineno);
+            m_leftlineno++;
+            m_rightlineno++;
         } 
     }
+    if (!samerun.isEmpty()) {
+        tc1.insertText(samerun);
+        tc2.insertText(samerun);
+    }
     tc1.endEditBlock();
     tc2.endEditBlock();
     m_view1->setBlockMap(m_leftno);
     m_view2->setBlockMap(m_rightno);
 
-    synchronize_viewers();
+    if (m_pos == 0) {
+        // first chunk - park both viewers at the top
+        synchronize_viewers();
+    }
+    m_pos = end;
+    if (m_pos < m_diffinfo.count()) {
+        QTimer::singleShot(0, this, SLOT(load_next_chunk()));
+    } else {
+        m_diffinfo.clear();
+    }
 }
 
 void ChgViewer::cross_link_scrollbars(bool link)
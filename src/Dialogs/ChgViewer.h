@@ -27,12 +27,12 @@
 #include <QList>
 #include <QLabel>
 #include <QDialog>
+#include <QTextCursor>
 
 #include "EmbedPython/DiffRec.h"
 
 class Navigator;
 class TextView;
-class QTextCursor;
 
 class ChgViewer : public QDialog
 
@@ -56,6 +56,14 @@ public slots:
     void next_change(int dir);
     void do_search(bool reverse=false);
 
+private slots:
+    /**
+     * Realizes the next run of diff records into the two viewers and
+     * reschedules itself from the event loop until all are loaded, so
+     * the top of a large diff is visible and navigable immediately.
+     */
+    void load_next_chunk();
+
 protected:
     void cross_link_scrollbars(bool link=true);
     void synchronize_viewers();
@@ -79,5 +87,13 @@ private:
     QStringList    m_rightno;
     QList<int>     m_changelst;
 
+    // incremental load state, see load_next_chunk()
+    QList<DiffRecord::DiffRec> m_diffinfo;
+    QTextCursor    m_tc1;
+    QTextCursor    m_tc2;
+    int            m_pos;
+    int            m_blockno;
+    int            m_leftlineno;
+    int            m_rightlineno;
 };
 #endif
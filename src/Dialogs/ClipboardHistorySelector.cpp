@@ -39,12 +39,14 @@
 static const QString SETTINGS_GROUP = "clipboard_history";
 static const QString KEY_SELECTORS = "0123456789abcdefghij";
 const int MAX_DISPLAY_LENGTH = 500;
+// Payloads above this many characters are stored compressed
+const int COMPRESS_THRESHOLD = 4096;
+// Upper bound on what the whole history may keep resident
+const qint64 MAX_HISTORY_STORED_BYTES = 1 * 1024 * 1024;
 
 ClipboardHistorySelector::ClipboardHistorySelector(QWidget *parent)
     :
     QDialog(parent),
-    m_ClipboardHistoryItems(new QStringList()),
-    m_PreviousClipboardHistoryItems(new QStringList()),
     m_savedHistory(false)
 {
     ui.setupUi(this);
@@ -53,17 +55,54 @@ ClipboardHistorySelector::ClipboardHistorySelector(QWidget *parent)
     ConnectSignalsToSlots();
 }
 
+ClipboardHistorySelector::ClipboardEntry ClipboardHistorySelector::MakeEntry(const QString &text)
+{
+    ClipboardEntry entry;
+    entry.length = text.length();
+
+    if (text.length() > COMPRESS_THRESHOLD) {
+        entry.compressed = qCompress(text.toUtf8());
+    } else {
+        entry.text = text;
+    }
+
+    return entry;
+}
+
+QString ClipboardHistorySelector::EntryText(const ClipboardEntry &entry)
+{
+    if (!entry.compressed.isEmpty()) {
+        return QString::fromUtf8(qUncompress(entry.compressed));
+    }
+
+    return entry.text;
+}
+
+qint64 ClipboardHistorySelector::EntryStoredSize(const ClipboardEntry &entry)
+{
+    if (!entry.compressed.isEmpty()) {
+        return entry.compressed.size();
+    }
+
+    return static_cast<qint64>(entry.text.length()) * sizeof(QChar);
+}
+
 void ClipboardHistorySelector::showEvent(QShowEvent *event)
 {
     // Make a copy of the clipboard history in case user clicks Cancel
-    m_PreviousClipboardHistoryItems->clear();
-    for (int i=0; i < m_ClipboardHistoryItems->count(); i++) {
-        m_PreviousClipboardHistoryItems->append(m_ClipboardHistoryItems->at(i));
-    }
+    m_PreviousClipboardHistoryItems = m_ClipboardHistoryItems;
     SetupClipboardHistoryTable();
     ui.clipboardItemsTable->setFocus();
 }
 
+void ClipboardHistorySelector::hideEvent(QHideEvent *event)
+{
+    // The table rows hold expanded copies of the payloads; drop them
+    // so a hidden selector keeps only the compact history around
+    ui.clipboardItemsTable->setRowCount(0);
+    QDialog::hideEvent(event);
+}
+
 void ClipboardHistorySelector::ApplicationActivated()
 {
     // Turned on when Sigil is activated
@@ -82,16 +121,17 @@ void ClipboardHistorySelector::ApplicationDeactivated()
 
 void ClipboardHistorySelector::LoadClipboardHistory(const QStringList &clipboardHistoryItems)
 {
-    m_ClipboardHistoryItems->append(clipboardHistoryItems);
+    foreach(const QString &text, clipboardHistoryItems) {
+        m_ClipboardHistoryItems.append(MakeEntry(text));
+    }
 }
 
 QStringList ClipboardHistorySelector::GetClipboardHistory(int limit) const
 {
     QStringList clipboardHistoryItems;
-    clipboardHistoryItems.append(*m_ClipboardHistoryItems);
     // Reduce the history to comply with user limits
-    while (clipboardHistoryItems.size() > limit) {
-        clipboardHistoryItems.removeLast();
+    for (int i = 0; i < m_ClipboardHistoryItems.count() && i < limit; i++) {
+        clipboardHistoryItems.append(EntryText(m_ClipboardHistoryItems.at(i)));
     }
     return clipboardHistoryItems;
 }
@@ -103,8 +143,8 @@ void ClipboardHistorySelector::SaveClipboardState()
 
 void ClipboardHistorySelector::RestoreClipboardState()
 {
-    if (m_ClipboardHistoryItems->count() > 0) {
-        QApplication::clipboard()->setText(m_ClipboardHistoryItems->at(0));
+    if (m_ClipboardHistoryItems.count() > 0) {
+        QApplication::clipboard()->setText(EntryText(m_ClipboardHistoryItems.at(0)));
     }
 
     connect(QApplication::clipboard(), SIGNAL(dataChanged()), this, SLOT(ClipboardChanged()));
@@ -113,16 +153,19 @@ void ClipboardHistorySelector::RestoreClipboardState()
 void ClipboardHistorySelector::SetupClipboardHistoryTable()
 {
     ui.clipboardItemsTable->setRowCount(0);
-    ui.clipboardItemsTable->setRowCount(m_ClipboardHistoryItems->count());
+    ui.clipboardItemsTable->setRowCount(m_ClipboardHistoryItems.count());
 
-    for (int row = 0; row < m_ClipboardHistoryItems->count(); row++) {
+    for (int row = 0; row < m_ClipboardHistoryItems.count(); row++) {
         QTableWidgetItem *selector = new QTableWidgetItem();
         // Keyboard shortcuts are 1-9 then 0 then a-j
         selector->setText(KEY_SELECTORS.at(row));
         selector->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
         ui.clipboardItemsTable->setItem(row, 0, selector);
 
-        QString text = m_ClipboardHistoryItems->at(row);
+        // compressed payloads are expanded here, the first time the
+        // text is really needed for display
+        const QString full_text = EntryText(m_ClipboardHistoryItems.at(row));
+        QString text = full_text;
         // In case the user has an enormous amount of data restrict what is displayed.
         if (text.length() > MAX_DISPLAY_LENGTH) {
             text.truncate(MAX_DISPLAY_LENGTH);
@@ -148,7 +191,7 @@ void ClipboardHistorySelector::SetupClipboardHistoryTable()
         QTableWidgetItem *clip = new QTableWidgetItem();
         clip->setText(display_text);
         clip->setFlags(Qt::ItemIsSelectable | Qt::ItemIsEnabled);
-        clip->setData(Qt::UserRole, QVariant(m_ClipboardHistoryItems->at(row)));
+        clip->setData(Qt::UserRole, QVariant(full_text));
         clip->setToolTip(text);
         ui.clipboardItemsTable->setItem(row, 1, clip);
     }
@@ -156,7 +199,7 @@ void ClipboardHistorySelector::SetupClipboardHistoryTable()
     ui.clipboardItemsTable->setColumnWidth(0, 20);
     ui.clipboardItemsTable->resizeRowsToContents();
 
-    if (m_ClipboardHistoryItems->count() > 0) {
+    if (m_ClipboardHistoryItems.count() > 0) {
         ui.clipboardItemsTable->selectRow(0);
     }
 }
@@ -208,15 +251,35 @@ void ClipboardHistorySelector::ClipboardChanged()
     }
 #endif
 
-    int existing_index = m_ClipboardHistoryItems->indexOf(text);
+    // the length check rejects almost every entry before any
+    // compressed payload has to be expanded for comparison
+    int existing_index = -1;
+    for (int i = 0; i < m_ClipboardHistoryItems.count(); i++) {
+        const ClipboardEntry &entry = m_ClipboardHistoryItems.at(i);
+        if (entry.length == text.length() && EntryText(entry) == text) {
+            existing_index = i;
+            break;
+        }
+    }
 
     if (existing_index > 0) {
-        m_ClipboardHistoryItems->move(existing_index, 0);
+        m_ClipboardHistoryItems.move(existing_index, 0);
     } else if (existing_index < 0) {
-        m_ClipboardHistoryItems->insert(0, text);
+        m_ClipboardHistoryItems.insert(0, MakeEntry(text));
 
-        while (m_ClipboardHistoryItems->size() > CLIPBOARD_HISTORY_MAX) {
-            m_ClipboardHistoryItems->removeLast();
+        while (m_ClipboardHistoryItems.size() > CLIPBOARD_HISTORY_MAX) {
+            m_ClipboardHistoryItems.removeLast();
+        }
+
+        // keep the total resident size bounded as well, always
+        // retaining at least the newest entry
+        qint64 stored = 0;
+        foreach(const ClipboardEntry &entry, m_ClipboardHistoryItems) {
+            stored += EntryStoredSize(entry);
+        }
+        while (stored > MAX_HISTORY_STORED_BYTES && m_ClipboardHistoryItems.size() > 1) {
+            stored -= EntryStoredSize(m_ClipboardHistoryItems.last());
+            m_ClipboardHistoryItems.removeLast();
         }
     }
 }
@@ -256,7 +319,7 @@ bool ClipboardHistorySelector::eventFilter(QObject *obj, QEvent *event)
                 int current_row = ui.clipboardItemsTable->currentRow();
 
                 if (current_row >= 0) {
-                    m_ClipboardHistoryItems->removeAt(current_row);
+                    m_ClipboardHistoryItems.removeAt(current_row);
                     SetupClipboardHistoryTable();
 
                     if (current_row >= ui.clipboardItemsTable->rowCount()) {
@@ -324,10 +387,7 @@ void ClipboardHistorySelector::reject()
 {
     if (!m_savedHistory) {
         // As user is cancelling, reject any deletions they have done to the history
-        m_ClipboardHistoryItems->clear();
-        for (int i=0; i < m_PreviousClipboardHistoryItems->count(); i++) {
-            m_ClipboardHistoryItems->append(m_PreviousClipboardHistoryItems->at(i));
-        }
+        m_ClipboardHistoryItems = m_PreviousClipboardHistoryItems;
     }
     m_savedHistory = false;
     WriteSettings();
@@ -28,6 +28,8 @@
 
 #include <QClipboard>
 #include <QMimeData>
+#include <QtCore/QByteArray>
+#include <QtCore/QList>
 #include <QtWidgets/QDialog>
 
 #include "Misc/SettingsStore.h"
@@ -60,6 +62,7 @@ protected:
 
 protected slots:
     void showEvent(QShowEvent *event);
+    void hideEvent(QHideEvent *event);
     void accept();
     void reject();
 
@@ -74,6 +77,21 @@ private slots:
 #endif
 
 private:
+    /**
+     * One history entry. Large payloads are kept zlib-compressed and
+     * only expanded when their text is actually needed: building the
+     * selector table, pasting, or saving the session history.
+     */
+    struct ClipboardEntry {
+        QString    text;        // plain text for small payloads
+        QByteArray compressed;  // qCompress'ed utf-8 for large ones
+        int        length;      // character count of the payload
+    };
+
+    static ClipboardEntry MakeEntry(const QString &text);
+    static QString EntryText(const ClipboardEntry &entry);
+    static qint64 EntryStoredSize(const ClipboardEntry &entry);
+
     void SetupClipboardHistoryTable();
 
 #if (QT_VERSION < QT_VERSION_CHECK(5,12,2))
@@ -86,8 +104,8 @@ private:
     void ExtendUI();
     void ConnectSignalsToSlots();
 
-    QStringList *m_ClipboardHistoryItems;
-    QStringList *m_PreviousClipboardHistoryItems;
+    QList<ClipboardEntry> m_ClipboardHistoryItems;
+    QList<ClipboardEntry> m_PreviousClipboardHistoryItems;
 
     const QMimeData *m_lastclip;
 
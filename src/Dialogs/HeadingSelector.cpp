@@ -188,6 +188,14 @@ void HeadingSelector::ModelItemFilter(QStandardItem *item)
         return;
     }
 
+    // When every heading is on display a checkbox toggle changes no
+    // tree structure, so patch the heading and counts in place and
+    // skip the whole reselect and re-expand cycle.
+    if (ui.cbTOCItemsOnly->checkState() != Qt::Checked) {
+        UpdateHeadingInclusion(item);
+        return;
+    }
+
     // Get the absolute row of the index in the table for later re-selection
     QModelIndex current_index = item->index().sibling(item->index().row(), 0);
     int row = GetAbsoluteRowForIndex(current_index);
@@ -869,7 +877,50 @@ void HeadingSelector::SetAllHeadingInclusion(int upToLevel)
         SetOneHeadingInclusion(m_Headings[ i ], upToLevel);
     }
 
-    RefreshTOCModelDisplay();
+    if (ui.cbTOCItemsOnly->checkState() == Qt::Checked) {
+        // excluded headings leave the display, so the tree really
+        // does have to be rebuilt
+        RefreshTOCModelDisplay();
+        return;
+    }
+
+    // Every heading is already in the model - only the checkboxes
+    // change, so update them in place instead of rebuilding and
+    // re-expanding the whole tree.  The itemChanged connection is
+    // dropped while doing so since the headings are already updated.
+    disconnect(&m_TableOfContents, SIGNAL(itemChanged(QStandardItem *)),
+               this,               SLOT(ModelItemFilter(QStandardItem *)));
+    SyncInclusionCheckStates(m_TableOfContents.invisibleRootItem());
+    connect(&m_TableOfContents, SIGNAL(itemChanged(QStandardItem *)),
+            this,               SLOT(ModelItemFilter(QStandardItem *)));
+    RefreshCounts();
+}
+
+void HeadingSelector::SyncInclusionCheckStates(QStandardItem *item)
+{
+    // Recursively call itself on the item's children
+    for (int i = 0; i < item->rowCount(); i++) {
+        SyncInclusionCheckStates(item->child(i));
+    }
+
+    // The root item is always present
+    if (item == m_TableOfContents.invisibleRootItem()) {
+        return;
+    }
+
+    Headings::Heading *heading = GetItemHeading(item);
+
+    if (!heading) {
+        return;
+    }
+
+    QStandardItem *item_parent = GetActualItemParent(item);
+    QStandardItem *check_item = item_parent->child(item->row(), 2);
+    Qt::CheckState wanted_state = heading->include_in_toc ? Qt::Checked : Qt::Unchecked;
+
+    if (check_item->checkState() != wanted_state) {
+        check_item->setCheckState(wanted_state);
+    }
 }
 
 
@@ -187,6 +187,11 @@ private:
     void RefreshCounts();
     void DisplayCounts();
 
+    // Walks the existing tree and makes every "include in TOC"
+    // checkbox match its heading, so mass inclusion changes need
+    // no model rebuild when every heading is being displayed.
+    void SyncInclusionCheckStates(QStandardItem *item);
+
 
     ///////////////////////////////
     // PRIVATE MEMBER VARIABLES
@@ -29,6 +29,7 @@
 #include <QDate>
 #include <QShortcut>
 #include <QInputDialog>
+#include <QtConcurrent>
 #include <QDebug>
 
 #include "Dialogs/TreeModel.h"
@@ -52,7 +53,8 @@ MetaEditor::MetaEditor(QWidget *parent)
   : QDialog(parent),
     m_mainWindow(qobject_cast<MainWindow *>(parent)),
     m_RemoveRow(new QShortcut(QKeySequence(Qt::ControlModifier + Qt::Key_Delete),this, 0, 0, Qt::WidgetWithChildrenShortcut)),
-    m_cbDelegate(new MetaEditorItemDelegate())
+    m_cbDelegate(new MetaEditorItemDelegate()),
+    m_MetadataWatcher(new QFutureWatcher<MetadataPieces>(this))
 {
     setupUi(this);
 
@@ -78,12 +80,57 @@ MetaEditor::MetaEditor(QWidget *parent)
     // pass choice sets to Delegate
     m_cbDelegate->setChoices(m_Choices);
     
+    // keep the editing controls dark until the metadata
+    // extraction has finished and a model actually exists
+    addMetaButton->setEnabled(false);
+    addPropButton->setEnabled(false);
+    delButton->setEnabled(false);
+    tbMoveUp->setEnabled(false);
+    tbMoveDown->setEnabled(false);
+    m_RemoveRow->setEnabled(false);
+    buttonBox->button(QDialogButtonBox::Ok)->setEnabled(false);
+
+    // extracting the metadata from the opf means a round trip
+    // through the embedded python interpreter which can take a
+    // noticeable amount of time on metadata heavy books, so do
+    // it on a worker thread and let the dialog come up at once
+    connect(m_MetadataWatcher, SIGNAL(finished()), this, SLOT(MetadataLoaded()));
+    PythonRoutines pr;
+    m_MetadataWatcher->setFuture(QtConcurrent::run(pr, &PythonRoutines::GetMetadataInPython,
+                                                   m_opfdata, m_version));
+
+    if (!isVisible()) {
+        ReadSettings();
+    }
+
+    connect(delButton, SIGNAL(clicked()), this, SLOT(removeRow()));
+    connect(tbMoveUp, SIGNAL(clicked()), this, SLOT(moveRowUp()));
+    connect(tbMoveDown, SIGNAL(clicked()), this, SLOT(moveRowDown()));
+    connect(m_RemoveRow, SIGNAL(activated()), this, SLOT(removeRow()));
+
+    if (m_version.startsWith('3')) {
+        connect(addMetaButton, SIGNAL(clicked()), this, SLOT(selectElement()));
+        connect(addPropButton, SIGNAL(clicked()), this, SLOT(selectProperty()));
+    } else {
+        connect(addMetaButton, SIGNAL(clicked()), this, SLOT(selectE2Element()));
+        connect(addPropButton, SIGNAL(clicked()), this, SLOT(selectE2Property()));
+    }
+
+    connect(buttonBox, SIGNAL(accepted()), this, SLOT(saveData()));
+    connect(buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
+}
+
+
+void MetaEditor::MetadataLoaded()
+{
+    MetadataPieces mdp = m_MetadataWatcher->result();
+
     QStringList headers;
     headers << tr("Name") << tr("Value");
 
     // takes metadata from opf and translates it to human readable form
     // but stores original code as tooltips
-    QString data = GetOPFMetadata();
+    QString data = GetOPFMetadata(mdp);
 
     TreeModel *model = new TreeModel(headers, data);
     view->setModel(model);
@@ -94,36 +141,24 @@ MetaEditor::MetaEditor(QWidget *parent)
             view->setColumnWidth(column,300);
         }
     }
-    
+
     // need to assign delegate for values stored in column 1 only
     // Delegate is used to add custom combobox pulldowns and textedit
     // to specific metadata items stored in the tree
     view->setItemDelegateForColumn(1, m_cbDelegate);
-    
-    if (!isVisible()) {
-        ReadSettings();
-    }
 
+    // setModel creates the selection model so only connect to it now
     connect(view->selectionModel(),
             SIGNAL(selectionChanged(const QItemSelection &,
                                     const QItemSelection &)),
             this, SLOT(updateActions()));
 
-    connect(delButton, SIGNAL(clicked()), this, SLOT(removeRow()));
-    connect(tbMoveUp, SIGNAL(clicked()), this, SLOT(moveRowUp()));
-    connect(tbMoveDown, SIGNAL(clicked()), this, SLOT(moveRowDown()));
-    connect(m_RemoveRow, SIGNAL(activated()), this, SLOT(removeRow()));
-
-    if (m_version.startsWith('3')) {
-        connect(addMetaButton, SIGNAL(clicked()), this, SLOT(selectElement()));
-        connect(addPropButton, SIGNAL(clicked()), this, SLOT(selectProperty()));
-    } else {
-        connect(addMetaButton, SIGNAL(clicked()), this, SLOT(selectE2Element()));
-        connect(addPropButton, SIGNAL(clicked()), this, SLOT(selectE2Property()));
-    }
-
-    connect(buttonBox, SIGNAL(accepted()), this, SLOT(saveData()));
-    connect(buttonBox, SIGNAL(rejected()), this, SLOT(reject()));
+    addMetaButton->setEnabled(true);
+    addPropButton->setEnabled(true);
+    tbMoveUp->setEnabled(true);
+    tbMoveDown->setEnabled(true);
+    m_RemoveRow->setEnabled(true);
+    buttonBox->button(QDialogButtonBox::Ok)->setEnabled(true);
 
     updateActions();
 }
@@ -239,9 +274,7 @@ void MetaEditor::loadE2Choices()
 }
 
 
-QString MetaEditor::GetOPFMetadata() {
-    PythonRoutines pr;
-    MetadataPieces mdp = pr.GetMetadataInPython(m_opfdata, m_version);
+QString MetaEditor::GetOPFMetadata(const MetadataPieces& mdp) {
     QString adata = mdp.data;
     m_otherxml = mdp.otherxml;
     m_metatag = mdp.metatag;
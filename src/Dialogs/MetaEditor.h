@@ -26,7 +26,9 @@
 #include <QDialog>
 #include <QModelIndex>
 #include <QHash>
+#include <QtCore/QFutureWatcher>
 #include "Misc/DescriptiveInfo.h"
+#include "EmbedPython/PythonRoutines.h"
 
 #include "ui_MetaEditor.h"
 
@@ -77,6 +79,10 @@ private slots:
     void selectE2Element();
     void selectE2Property();
 
+    // Builds and installs the tree model once the worker
+    // thread has finished extracting the opf metadata
+    void MetadataLoaded();
+
  private:
     void loadMetadataElements();
     void loadMetadataProperties();
@@ -94,7 +100,7 @@ private slots:
     
     void ReadSettings();
 
-    QString GetOPFMetadata();
+    QString GetOPFMetadata(const MetadataPieces& mdp);
     QString SetNewOPFMetadata(QString& data);
 
     QHash<QString, DescriptiveInfo> m_ElementInfo;
@@ -111,6 +117,7 @@ private slots:
     MainWindow * m_mainWindow;
     QShortcut * m_RemoveRow;
     MetaEditorItemDelegate * m_cbDelegate;
+    QFutureWatcher<MetadataPieces> * m_MetadataWatcher;
     QSharedPointer<Book> m_book;
     QString m_version;
     QString m_opfdata;
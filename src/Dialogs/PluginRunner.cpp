@@ -64,7 +64,8 @@ PluginRunner::PluginRunner(TabManager *tabMgr, QWidget *parent)
       m_algorithm(""),
       m_result("failed"),
       m_xhtml_net_change(0),
-      m_ready(false)
+      m_ready(false),
+      m_automate(false)
 
 {
     // get book manipulation objects
@@ -110,7 +111,7 @@ QStringList PluginRunner::SupportedEngines()
     return engines;
 }
 
-int PluginRunner::exec(const QString &name)
+int PluginRunner::exec(const QString &name, bool automate)
 {
     QHash <QString, QStringList> plugininfo;
     PluginDB *pdb = PluginDB::instance();
@@ -119,6 +120,7 @@ int PluginRunner::exec(const QString &name)
     QString launcher_root;
 
     m_ready = false;
+    m_automate = automate;
 
     plugin = pdb->get_plugin(name);
     if (plugin == NULL) {
@@ -189,15 +191,17 @@ int PluginRunner::exec(const QString &name)
 
 
     // autostart
-    if (plugin->get_autostart() == "true") {
+    // an automate run always starts right away - no stage in an
+    // automation list should sit waiting for a click or a timer
+    if (m_automate || plugin->get_autostart() == "true") {
         ui.startButton->setVisible(false);
-        if (m_pluginAutoClose == "true") {
+        if (m_automate || m_pluginAutoClose == "true") {
             ui.showButton->setEnabled(true);
             ui.showButton->setVisible(true);
             ui.textEdit->setVisible(false);
             resize(500, 100);
         }
-        QTimer::singleShot(300, ui.startButton, SLOT(click()));
+        QTimer::singleShot(m_automate ? 0 : 300, ui.startButton, SLOT(click()));
     }
     return QDialog::exec();
 }
@@ -451,12 +455,20 @@ void PluginRunner::pluginFinished(int exitcode, QProcess::ExitStatus exitstatus)
 
     ui.statusLbl->setText(tr("Status: finished"));
 
+    // under automate even a failed stage must not sit waiting for a
+    // click; Automate() reads getResult() and shows the log afterwards
     if (!processResultXML()) {
         ui.textEdit->append(m_pluginOutput);
+        if (m_automate) {
+            accept();
+        }
         return;
     }
     if (m_result != "success") {
         ui.statusLbl->setText(tr("Status: failed"));
+        if (m_automate) {
+            accept();
+        }
         return;
     }
 
@@ -464,6 +476,9 @@ void PluginRunner::pluginFinished(int exitcode, QProcess::ExitStatus exitstatus)
     if (!checkIsWellFormed()) {
         ui.statusLbl->setText(tr("Status: No Changes Made"));
         m_result = "failed";
+        if (m_automate) {
+            accept();
+        }
         return;
     }
 
@@ -474,6 +489,9 @@ void PluginRunner::pluginFinished(int exitcode, QProcess::ExitStatus exitstatus)
             Utility::DisplayStdErrorDialog(tr("Error: Plugin Tried to Remove the Last XHTML file .. aborting changes"));
             ui.statusLbl->setText(tr("Status: No Changes Made"));
             m_result = "failed";
+            if (m_automate) {
+                accept();
+            }
             return;
         }
     }
@@ -546,7 +564,7 @@ void PluginRunner::pluginFinished(int exitcode, QProcess::ExitStatus exitstatus)
     // results too. We really should check that everything else a
     // plugin can set is really empty before calling accept because
     // it could have actual info the user needs to see in the dialog.
-    if ((m_pluginType == "validation") || (m_pluginAutoClose == "true")) {
+    if ((m_pluginType == "validation") || (m_pluginAutoClose == "true") || m_automate) {
         accept();
         return;
     }
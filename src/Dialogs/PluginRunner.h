@@ -78,7 +78,9 @@ public:
     int getValidationErrorCount() { return m_validationResults.count(); }
                        
 public slots:
-    int exec(const QString &name);
+    // automate runs start the plugin immediately and close the dialog
+    // when done so automation lists need no clicks between stages
+    int exec(const QString &name, bool automate = false);
     void reject();
 
 private slots:
@@ -137,6 +139,8 @@ private:
 
     bool m_ready;
 
+    bool m_automate;
+
     static const QString SEP;
     static const QString OPFFILEINFO;
     static const QString NCXFILEINFO;
@@ -30,6 +30,7 @@
 #include <QFileInfo>
 #include <QStandardPaths>
 
+#include "Misc/LargeBookPolicy.h"
 #include "Misc/Utility.h"
 #include "sigil_constants.h"
 
@@ -60,6 +61,18 @@ PreferencesWidget::ResultActions GeneralSettingsWidget::saveSettings()
         new_clean_on_level |= CLEANON_SAVE;
     }
 
+    int new_largebook_on_level = 0;
+
+    if (ui.LargeBookSkipWFCheck->isChecked()) {
+        new_largebook_on_level |= LARGEBOOK_SKIP_WF_CHECK;
+    }
+    if (ui.LargeBookSlowPreview->isChecked()) {
+        new_largebook_on_level |= LARGEBOOK_SLOW_PREVIEW;
+    }
+    if (ui.LargeBookNoTagHighlight->isChecked()) {
+        new_largebook_on_level |= LARGEBOOK_NO_TAG_HIGHLIGHT;
+    }
+
     QString css_epub2_spec = "css21";
 
     if (ui.Epub2css20->isChecked()) {
@@ -103,6 +116,9 @@ PreferencesWidget::ResultActions GeneralSettingsWidget::saveSettings()
 
     SettingsStore settings;
     settings.setCleanOn(new_clean_on_level);
+    settings.setLargeBookOn(new_largebook_on_level);
+    // keep the policy's cached copy current for the open book
+    LargeBookPolicy::instance()->SetKnobs(new_largebook_on_level);
     settings.setDefaultVersion(new_epub_version);
     settings.setCssEpub2ValidationSpec(css_epub2_spec);
     settings.setCssEpub3ValidationSpec(css_epub3_spec);
@@ -136,6 +152,10 @@ void GeneralSettingsWidget::readSettings()
     int cleanOn = settings.cleanOn();
     ui.MendOnOpen->setChecked(cleanOn & CLEANON_OPEN);
     ui.MendOnSave->setChecked(cleanOn & CLEANON_SAVE);
+    int largeBookOn = settings.largeBookOn();
+    ui.LargeBookSkipWFCheck->setChecked(largeBookOn & LARGEBOOK_SKIP_WF_CHECK);
+    ui.LargeBookSlowPreview->setChecked(largeBookOn & LARGEBOOK_SLOW_PREVIEW);
+    ui.LargeBookNoTagHighlight->setChecked(largeBookOn & LARGEBOOK_NO_TAG_HIGHLIGHT);
     int remoteOn = settings.remoteOn();
     ui.AllowRemote->setChecked(remoteOn);
     int javascriptOn = settings.javascriptOn();
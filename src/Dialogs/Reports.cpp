@@ -21,9 +21,10 @@
 **
 *************************************************************************/
 #include <QtWidgets/QScrollArea>
-#include <QtWidgets/QProgressDialog>
+#include <QCryptographicHash>
 // #include <QDebug>
 
+#include "BookManipulation/FolderKeeper.h"
 #include "Dialogs/Reports.h"
 #include "Misc/SettingsStore.h"
 #include "Parsers/CSSInfo.h"
@@ -36,13 +37,15 @@
 #include "ReportsWidgets/StylesInCSSFilesWidget.h"
 #include "ReportsWidgets/CharactersInHTMLFilesWidget.h"
 
-static const QStringList REPORT_TYPES = QStringList() << "AllFiles"
-                                                      << "HTMLFiles" 
-                                                      << "Links"
+// report type for each page of the stack, in the order the constructor
+// appends the widgets
+static const QStringList WIDGET_ORDER = QStringList() << "AllFiles"
+                                                      << "HTMLFiles"
                                                       << "ImageFiles"
                                                       << "CSSFiles"
                                                       << "ClassesInHTMLFiles"
                                                       << "StylesInCSSFiles"
+                                                      << "Links"
                                                       << "CharactersInHTMLFiles";
 
 static const QString SETTINGS_GROUP = "reports_dialog";
@@ -119,22 +122,49 @@ Reports::~Reports()
 
 void Reports::CreateReports(QSharedPointer<Book> book)
 {
-    // qDebug() << "Setting Up Progress Dialog";
-    // Display progress dialog
-    QProgressDialog progress(QObject::tr("Creating reports..."), 0, 0, REPORT_TYPES.count(), NULL);
-    int progress_value = 0;
-    progress.setMinimumDuration(0);
-    progress.setValue(progress_value);
-
-    foreach(QString report_type, REPORT_TYPES) {
-        progress.setValue(++progress_value);
-        qApp->processEvents();
-        // qDebug() << "Creating Report: " << report_type;
-        CreateReport(book, report_type);
-    }
-    progress.setValue(REPORT_TYPES.count());
-    qApp->processEvents();
+    // Each report is built lazily the first time its tab is shown, so
+    // opening the dialog only pays for the report actually on screen.
+    // Tabs already built against this exact book state are kept as is.
+    m_Book = book;
+    m_BookSignature = BookSignature(book);
+    CreateCurrentReport();
+}
+
+
+void Reports::CreateCurrentReport()
+{
+    if (m_Book.isNull()) {
+        return;
+    }
+
+    int index = ui.pWidget->currentIndex();
+
+    if ((index < 0) || (index >= WIDGET_ORDER.count())) {
+        return;
+    }
 
+    QString report_type = WIDGET_ORDER.at(index);
+
+    if (m_ReportSignature.value(report_type) == m_BookSignature) {
+        // already built from the book as it is right now
+        return;
+    }
+
+    QApplication::setOverrideCursor(Qt::WaitCursor);
+    CreateReport(m_Book, report_type);
+    m_ReportSignature[report_type] = m_BookSignature;
+    QApplication::restoreOverrideCursor();
+}
+
+
+QString Reports::BookSignature(QSharedPointer<Book> book) const
+{
+    QCryptographicHash signature(QCryptographicHash::Md5);
+    foreach(Resource *resource, book->GetFolderKeeper()->GetResourceList()) {
+        signature.addData(resource->GetRelativePath().toUtf8());
+        signature.addData(QByteArray::number(resource->GetContentRevision()));
+    }
+    return QString(signature.result().toHex());
 }
 
 
@@ -179,6 +209,7 @@ void Reports::selectPWidget(QListWidgetItem *current, QListWidgetItem *previous)
     Q_UNUSED(previous)
     int index = ui.availableWidgets->row(current);
     ui.pWidget->setCurrentIndex(index);
+    CreateCurrentReport();
 }
 
 void Reports::saveSettings()
@@ -49,6 +49,13 @@ public:
     void CreateReports(QSharedPointer<Book> book);
     void CreateReport(QSharedPointer<Book> book, const QString report_type );
 
+    /**
+     * Build the report for the currently visible tab if it is missing
+     * or was built against an older state of the book.  Every other
+     * tab stays empty until the user actually selects it.
+     */
+    void CreateCurrentReport();
+
 signals:
     void Refresh();
     void OpenFileRequest(QString, int, int);
@@ -72,6 +79,14 @@ private slots:
 private:
     void readSettings();
 
+    /**
+     * A single value covering every resource's bookpath and content
+     * revision.  Any add, delete, rename or edit anywhere in the book
+     * changes it, so a tab whose stored signature still matches can
+     * keep its previously built report.
+     */
+    QString BookSignature(QSharedPointer<Book> book) const;
+
     /**
      * Adds the given items to the dialog.
      *
@@ -94,6 +109,10 @@ private:
     ReportsWidget *m_StylesInCSSFilesWidget;
     ReportsWidget *m_CharactersInHTMLFilesWidget;
 
+    QSharedPointer<Book> m_Book;
+    QString m_BookSignature;
+    QHash<QString, QString> m_ReportSignature;
+
     Ui::Reports ui;
 };
 
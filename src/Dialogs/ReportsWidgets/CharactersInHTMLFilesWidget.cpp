@@ -23,6 +23,7 @@
 
 #include <QtCore/QFile>
 #include <QtCore/QHashIterator>
+#include <QtConcurrent/QtConcurrent>
 #include <QtWidgets/QFileDialog>
 #include <QtGui/QFont>
 #include <QtWidgets/QPushButton>
@@ -32,7 +33,6 @@
 #include "sigil_exception.h"
 #include "BookManipulation/FolderKeeper.h"
 #include "Dialogs/ReportsWidgets/CharactersInHTMLFilesWidget.h"
-#include "Misc/NumericItem.h"
 #include "Misc/SettingsStore.h"
 #include "Misc/Utility.h"
 #include "Misc/XMLEntities.h"
@@ -42,9 +42,26 @@
 static const QString SETTINGS_GROUP = "reports";
 static const QString DEFAULT_REPORT_FILE = "CharactersInHTMLFilesReport.csv";
 
+// Extracts the body text of one HTML file.
+// Files are processed in parallel by GetDisplayedCharacters.
+struct GetBodyTextInHTMLFileMapped {
+
+    typedef QString result_type;
+
+    QString operator()(HTMLResource *resource) const
+    {
+        QReadLocker locker(&resource->GetLock());
+        QString replaced_html = resource->GetText();
+        replaced_html = replaced_html.replace("<html>", "<html xmlns=\"http://www.w3.org/1999/xhtml\">");
+        QString version = "any_version";
+        GumboInterface gi = GumboInterface(replaced_html, version);
+        return gi.get_body_text();
+    }
+};
+
 CharactersInHTMLFilesWidget::CharactersInHTMLFilesWidget()
     :
-    m_ItemModel(new QStandardItemModel),
+    m_ReportModel(new ReportTableModel),
     m_LastDirSaved(QString()),
     m_LastFileSaved(QString()),
     m_PageLoaded(false)
@@ -55,7 +72,7 @@ CharactersInHTMLFilesWidget::CharactersInHTMLFilesWidget()
 
 CharactersInHTMLFilesWidget::~CharactersInHTMLFilesWidget()
 {
-    delete m_ItemModel;
+    delete m_ReportModel;
 }
 
 void CharactersInHTMLFilesWidget::CreateReport(QSharedPointer<Book> book)
@@ -73,16 +90,15 @@ void CharactersInHTMLFilesWidget::CreateReport(QSharedPointer<Book> book)
 
 void CharactersInHTMLFilesWidget::SetupTable()
 {
-    m_ItemModel->clear();
     QStringList header;
     header.append(tr("Character"));
     header.append(tr("Decimal"));
     header.append(tr("Hexadecimal"));
     header.append(tr("Entity Name"));
     header.append(tr("Entity Description"));
-    m_ItemModel->setHorizontalHeaderLabels(header);
+    m_ReportModel->setHeaders(header);
     ui.fileTree->setSelectionBehavior(QAbstractItemView::SelectRows);
-    ui.fileTree->setModel(m_ItemModel);
+    ui.fileTree->setModel(m_ReportModel);
     ui.fileTree->header()->setSortIndicatorShown(true);
     ui.fileTree->header()->setToolTip(
         tr("<p>This is a list of the characters used in all HTML files.<p>")
@@ -99,50 +115,43 @@ void CharactersInHTMLFilesWidget::AddTableData()
     }
     ui.Characters->setText(all_characters);
 
+    QVector<ReportTableModel::Row> rows;
+    rows.reserve(characters.count());
+
     foreach (QChar c, characters) {
         // Write the table entries
-        QList<QStandardItem *> rowItems;
-        // Character
-        QStandardItem *item = new QStandardItem();
-        item->setText(QString(c));
-        rowItems << item;
-        // Decimal number
-        item = new QStandardItem();
+        ReportTableModel::Row row;
         ushort char_number = c.unicode();
-        item->setText(QString::number(char_number));
-        rowItems << item;
-        // Hex number
-        item = new QStandardItem();
+        // Character
+        row << ReportTableModel::Cell(QString(c));
+        // Decimal number, sorted by value rather than as text
+        ReportTableModel::Cell decimal_cell(QString::number(char_number));
+        decimal_cell.sort_key = char_number;
+        row << decimal_cell;
+        // Hex number, also sorted by value
         QString hexadecimal;
         hexadecimal.setNum(char_number,16);
-        item->setText(hexadecimal.toUpper());
-        rowItems << item;
+        ReportTableModel::Cell hex_cell(hexadecimal.toUpper());
+        hex_cell.sort_key = char_number;
+        row << hex_cell;
         // Name
-        item = new QStandardItem();
-        item->setText(XMLEntities::instance()->GetEntityName(char_number));
-        rowItems << item;
+        row << ReportTableModel::Cell(XMLEntities::instance()->GetEntityName(char_number));
         // Description
-        item = new QStandardItem();
-        item->setText(XMLEntities::instance()->GetEntityDescription(char_number));
-        rowItems << item;
-
-        for (int i = 0; i < rowItems.count(); i++) {
-            rowItems[i]->setEditable(false);
-        }
-
-        m_ItemModel->appendRow(rowItems);
+        row << ReportTableModel::Cell(XMLEntities::instance()->GetEntityDescription(char_number));
+        rows << row;
     }
+
+    // one model reset instead of one row insertion per character
+    m_ReportModel->setRows(rows);
 }
 
 QList <QChar> CharactersInHTMLFilesWidget::GetDisplayedCharacters(QList<HTMLResource *> resources)
 {
+    // parsing every file to get its body text dominates this report,
+    // so spread the files across the thread pool
+    QList<QString> body_texts = QtConcurrent::blockingMapped(resources, GetBodyTextInHTMLFileMapped());
     QString all_characters;
-    foreach (HTMLResource *resource, resources) {
-        QString replaced_html = resource->GetText();
-        replaced_html = replaced_html.replace("<html>", "<html xmlns=\"http://www.w3.org/1999/xhtml\">");
-        QString version = "any_version";
-        GumboInterface gi = GumboInterface(replaced_html, version);
-        QString text = gi.get_body_text();
+    foreach (const QString &text, body_texts) {
         all_characters.append(text);
     }
 
@@ -162,17 +171,18 @@ QList <QChar> CharactersInHTMLFilesWidget::GetDisplayedCharacters(QList<HTMLReso
 void CharactersInHTMLFilesWidget::FilterEditTextChangedSlot(const QString &text)
 {
     const QString lowercaseText = text.toLower();
-    QStandardItem *root_item = m_ItemModel->invisibleRootItem();
     QModelIndex parent_index;
     // Hide rows that don't contain the filter text
     int first_visible_row = -1;
 
-    for (int row = 0; row < root_item->rowCount(); row++) {
-        if (text.isEmpty() || root_item->child(row, 0)->text().toLower().contains(lowercaseText) ||
-            root_item->child(row, 1)->text().toLower().contains(lowercaseText) ||
-            root_item->child(row, 2)->text().toLower().contains(lowercaseText) ||
-            root_item->child(row, 3)->text().toLower().contains(lowercaseText) ||
-            root_item->child(row, 4)->text().toLower().contains(lowercaseText)) {
+    for (int row = 0; row < m_ReportModel->rowCount(); row++) {
+        bool matches = text.isEmpty();
+
+        for (int col = 0; !matches && col < m_ReportModel->columnCount(); col++) {
+            matches = m_ReportModel->data(m_ReportModel->index(row, col)).toString().toLower().contains(lowercaseText);
+        }
+
+        if (matches) {
             ui.fileTree->setRowHidden(row, parent_index, false);
 
             if (first_visible_row == -1) {
@@ -185,7 +195,7 @@ void CharactersInHTMLFilesWidget::FilterEditTextChangedSlot(const QString &text)
 
     if (!text.isEmpty() && first_visible_row != -1) {
         // Select the first non-hidden row
-        ui.fileTree->setCurrentIndex(root_item->child(first_visible_row, 0)->index());
+        ui.fileTree->setCurrentIndex(m_ReportModel->index(first_visible_row, 0));
     } else {
         // Clear current and selection, which clears preview image
         ui.fileTree->setCurrentIndex(QModelIndex());
@@ -195,7 +205,7 @@ void CharactersInHTMLFilesWidget::FilterEditTextChangedSlot(const QString &text)
 void CharactersInHTMLFilesWidget::DoubleClick()
 {
     QModelIndex index = ui.fileTree->selectionModel()->selectedRows(0).first();
-    QString text = m_ItemModel->itemFromIndex(index)->text();
+    QString text = m_ReportModel->data(index).toString();
     emit FindText(text);
 }
 
@@ -206,25 +216,15 @@ void CharactersInHTMLFilesWidget::Save()
 
     // Get headings
     for (int col = 0; col < ui.fileTree->header()->count(); col++) {
-        QStandardItem *item = m_ItemModel->horizontalHeaderItem(col);
-        QString text = "";
-        if (item) {
-            text = item->text();
-        }
-        heading_row << text;
+        heading_row << m_ReportModel->headerData(col, Qt::Horizontal).toString();
     }
     report_info << Utility::createCSVLine(heading_row);
 
     // Get data from table
-    for (int row = 0; row < m_ItemModel->rowCount(); row++) {
+    for (int row = 0; row < m_ReportModel->rowCount(); row++) {
         QStringList data_row;
         for (int col = 0; col < ui.fileTree->header()->count(); col++) {
-            QStandardItem *item = m_ItemModel->item(row, col);
-            QString text = "";
-            if (item) {
-                text = item->text();
-            }
-            data_row << text;
+            data_row << m_ReportModel->data(m_ReportModel->index(row, col)).toString();
         }
         report_info << Utility::createCSVLine(data_row);
     }
@@ -27,12 +27,12 @@
 
 #include <QtCore/QHash>
 #include <QtWidgets/QDialog>
-#include <QtGui/QStandardItemModel>
 #include <QtCore/QSharedPointer>
 
 #include "ResourceObjects/Resource.h"
 #include "BookManipulation/Book.h"
 #include "BookManipulation/BookReports.h"
+#include "Dialogs/ReportsWidgets/ReportTableModel.h"
 #include "Dialogs/ReportsWidgets/ReportsWidget.h"
 
 #include "ui_ReportsCharactersInHTMLFilesWidget.h"
@@ -73,7 +73,7 @@ private:
 
     QSharedPointer<Book> m_Book;
 
-    QStandardItemModel *m_ItemModel;
+    ReportTableModel *m_ReportModel;
 
     QString m_LastDirSaved;
     QString m_LastFileSaved;
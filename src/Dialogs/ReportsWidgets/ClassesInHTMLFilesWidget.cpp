@@ -33,7 +33,6 @@
 #include "BookManipulation/FolderKeeper.h"
 #include "Dialogs/ReportsWidgets/ClassesInHTMLFilesWidget.h"
 #include "Parsers/CSSInfo.h"
-#include "Misc/NumericItem.h"
 #include "Misc/SettingsStore.h"
 #include "Misc/Utility.h"
 #include "ResourceObjects/HTMLResource.h"
@@ -44,7 +43,7 @@ static const QString DEFAULT_REPORT_FILE = "StyleClassesInHTMLFilesReport.csv";
 
 ClassesInHTMLFilesWidget::ClassesInHTMLFilesWidget()
     :
-    m_ItemModel(new QStandardItemModel),
+    m_ReportModel(new ReportTableModel),
     m_LastDirSaved(QString()),
     m_LastFileSaved(QString())
 {
@@ -54,7 +53,7 @@ ClassesInHTMLFilesWidget::ClassesInHTMLFilesWidget()
 
 ClassesInHTMLFilesWidget::~ClassesInHTMLFilesWidget()
 {
-    delete m_ItemModel;
+    delete m_ReportModel;
 }
 
 void ClassesInHTMLFilesWidget::CreateReport(QSharedPointer<Book> book)
@@ -78,16 +77,15 @@ void ClassesInHTMLFilesWidget::CreateReport(QSharedPointer<Book> book)
 
 void ClassesInHTMLFilesWidget::SetupTable()
 {
-    m_ItemModel->clear();
     QStringList header;
     header.append(tr("HTML File"));
     header.append(tr("Element"));
     header.append(tr("Class"));
     header.append(tr("Matched Selector"));
     header.append(tr("Found In"));
-    m_ItemModel->setHorizontalHeaderLabels(header);
+    m_ReportModel->setHeaders(header);
     ui.fileTree->setSelectionBehavior(QAbstractItemView::SelectRows);
-    ui.fileTree->setModel(m_ItemModel);
+    ui.fileTree->setModel(m_ReportModel);
     ui.fileTree->header()->setSortIndicatorShown(true);
     ui.fileTree->header()->setToolTip(
         tr("<p>This is a list of the style classes used in all HTML files and whether or not the style matched a selector in a linked stylesheet.<p>") %
@@ -98,6 +96,9 @@ void ClassesInHTMLFilesWidget::SetupTable()
 
 void ClassesInHTMLFilesWidget::AddTableData(const QList<BookReports::StyleData *> html_classes_usage)
 {
+    QVector<ReportTableModel::Row> rows;
+    rows.reserve(html_classes_usage.count());
+
     foreach(BookReports::StyleData *class_usage, html_classes_usage) {
         // Skip custom Sigil classes that are only used as markers not styles
         if (class_usage->html_class_name == SIGIL_NOT_IN_TOC_CLASS ||
@@ -107,60 +108,53 @@ void ClassesInHTMLFilesWidget::AddTableData(const QList<BookReports::StyleData *
         }
 
         // Write the table entries
-        QList<QStandardItem *> rowItems;
+        ReportTableModel::Row row;
         // File name
-        QStandardItem *filename_item = new QStandardItem();
         QString bookpath = class_usage->html_filename;
         QString shortname = bookpath.split('/').last();
         try {
             Resource * res = m_Book->GetFolderKeeper()->GetResourceByBookPath(bookpath);
             shortname = res->ShortPathName();
         } catch (ResourceDoesNotExist&) {
-        } 
-        filename_item->setText(shortname);
-        filename_item->setData(bookpath);
-        rowItems << filename_item;
+        }
+        ReportTableModel::Cell filename_cell(shortname);
+        filename_cell.user_data = bookpath;
+        row << filename_cell;
         // Element name
-        QStandardItem *element_name_item = new QStandardItem();
-        element_name_item->setText(class_usage->html_element_name);
-        rowItems << element_name_item;
+        row << ReportTableModel::Cell(class_usage->html_element_name);
         // Class name
-        QStandardItem *class_name_item = new QStandardItem();
-        class_name_item->setText(class_usage->html_class_name);
-        rowItems << class_name_item;
+        row << ReportTableModel::Cell(class_usage->html_class_name);
         // Selector
-        QStandardItem *selector_text_item = new QStandardItem();
-        selector_text_item->setText(class_usage->css_selector_text);
-        rowItems << selector_text_item;
+        row << ReportTableModel::Cell(class_usage->css_selector_text);
         // Found in
-        QStandardItem *found_in_item = new QStandardItem();
         QString css_short_filename = class_usage->css_filename;
         css_short_filename = css_short_filename.right(css_short_filename.length() - css_short_filename.lastIndexOf('/') - 1);
-        found_in_item->setText(css_short_filename);
-        found_in_item->setToolTip(class_usage->css_filename);
-        rowItems << found_in_item;
-
-        for (int i = 0; i < rowItems.count(); i++) {
-            rowItems[i]->setEditable(false);
-        }
-
-        m_ItemModel->appendRow(rowItems);
+        ReportTableModel::Cell found_in_cell(css_short_filename);
+        found_in_cell.tooltip = class_usage->css_filename;
+        row << found_in_cell;
+        rows << row;
     }
+
+    // one model reset instead of one row insertion per class use
+    m_ReportModel->setRows(rows);
 }
 
 void ClassesInHTMLFilesWidget::FilterEditTextChangedSlot(const QString &text)
 {
     const QString lowercaseText = text.toLower();
-    QStandardItem *root_item = m_ItemModel->invisibleRootItem();
     QModelIndex parent_index;
     // Hide rows that don't contain the filter text
     int first_visible_row = -1;
 
-    for (int row = 0; row < root_item->rowCount(); row++) {
-        if (text.isEmpty() || root_item->child(row, 0)->text().toLower().contains(lowercaseText) ||
-            root_item->child(row, 1)->text().toLower().contains(lowercaseText) ||
-            root_item->child(row, 2)->text().toLower().contains(lowercaseText) ||
-            root_item->child(row, 3)->text().toLower().contains(lowercaseText)) {
+    for (int row = 0; row < m_ReportModel->rowCount(); row++) {
+        bool matches = text.isEmpty();
+
+        // the "Found In" column is deliberately not searched
+        for (int col = 0; !matches && col < 4; col++) {
+            matches = m_ReportModel->data(m_ReportModel->index(row, col)).toString().toLower().contains(lowercaseText);
+        }
+
+        if (matches) {
             ui.fileTree->setRowHidden(row, parent_index, false);
 
             if (first_visible_row == -1) {
@@ -173,7 +167,7 @@ void ClassesInHTMLFilesWidget::FilterEditTextChangedSlot(const QString &text)
 
     if (!text.isEmpty() && first_visible_row != -1) {
         // Select the first non-hidden row
-        ui.fileTree->setCurrentIndex(root_item->child(first_visible_row, 0)->index());
+        ui.fileTree->setCurrentIndex(m_ReportModel->index(first_visible_row, 0));
     } else {
         // Clear current and selection, which clears preview image
         ui.fileTree->setCurrentIndex(QModelIndex());
@@ -183,7 +177,7 @@ void ClassesInHTMLFilesWidget::FilterEditTextChangedSlot(const QString &text)
 void ClassesInHTMLFilesWidget::DoubleClick()
 {
     QModelIndex index = ui.fileTree->selectionModel()->selectedRows(0).first();
-    QString bookpath = m_ItemModel->itemFromIndex(index)->data().toString();
+    QString bookpath = m_ReportModel->data(index, ReportTableModel::UserDataRole).toString();
     emit OpenFileRequest(bookpath, 1, -1);
 }
 
@@ -194,25 +188,15 @@ void ClassesInHTMLFilesWidget::Save()
 
     // Get headings
     for (int col = 0; col < ui.fileTree->header()->count(); col++) {
-        QStandardItem *item = m_ItemModel->horizontalHeaderItem(col);
-        QString text = "";
-        if (item) {
-            text = item->text();
-        }
-        heading_row << text;
+        heading_row << m_ReportModel->headerData(col, Qt::Horizontal).toString();
     }
     report_info << Utility::createCSVLine(heading_row);
 
     // Get data from table
-    for (int row = 0; row < m_ItemModel->rowCount(); row++) {
+    for (int row = 0; row < m_ReportModel->rowCount(); row++) {
         QStringList data_row;
         for (int col = 0; col < ui.fileTree->header()->count(); col++) {
-            QStandardItem *item = m_ItemModel->item(row, col);
-            QString text = "";
-            if (item) {
-                text = item->text();
-            }
-            data_row << text;
+            data_row << m_ReportModel->data(m_ReportModel->index(row, col)).toString();
         }
         report_info << Utility::createCSVLine(data_row);
     }
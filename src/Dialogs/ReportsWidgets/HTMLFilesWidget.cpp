@@ -94,15 +94,13 @@ void HTMLFilesWidget::SetupTable(int sort_column, Qt::SortOrder sort_order)
     int total_audio = 0;
     int total_stylesheets = 0;
     int total_wellformed = 0;
-    QHash<QString, QStringList> stylesheet_names_hash = m_Book->GetStylesheetsInHTMLFiles();
-    QHash<QString, QStringList> image_names_hash = m_Book->GetImagesInHTMLFiles();
-    QHash<QString, QStringList> video_names_hash = m_Book->GetVideoInHTMLFiles();
-    QHash<QString, QStringList> audio_names_hash = m_Book->GetAudioInHTMLFiles();
-    QHash<QString, std::pair<int, int> > word_count_hash = m_Book->GetSpellWordCountsInHTMLFiles();
+    // One parallel pass over the book collects every column's facts
+    QHash<QString, Book::HTMLReportFacts> facts_hash = m_Book->GetHTMLReportFacts();
     foreach(HTMLResource *html_resource, m_HTMLResources) {
         QString filepath = html_resource->GetRelativePath();
         QString path = html_resource->GetFullPath();
         QString filename = html_resource->ShortPathName();
+        Book::HTMLReportFacts facts = facts_hash[filepath];
         QList<QStandardItem *> rowItems;
         // Filename
         QStandardItem *name_item = new QStandardItem();
@@ -119,7 +117,7 @@ void HTMLFilesWidget::SetupTable(int sort_column, Qt::SortOrder sort_order)
         size_item->setTextAlignment(Qt::AlignRight);
         rowItems << size_item;
         // All words
-        std::pair<int, int> counts = word_count_hash[filepath];
+        std::pair<int, int> counts = facts.word_counts;
         total_all_words += counts.first;
         NumericItem *words_item = new NumericItem();
         words_item->setText(QString::number(counts.first));
@@ -133,7 +131,7 @@ void HTMLFilesWidget::SetupTable(int sort_column, Qt::SortOrder sort_order)
         rowItems << misspelled_item;
         // Images
         NumericItem *image_item = new NumericItem();
-        QStringList image_names = image_names_hash[filepath];
+        QStringList image_names = facts.image_bookpaths;
         total_images += image_names.count();
         image_item->setText(QString::number(image_names.count()));
         image_item->setTextAlignment(Qt::AlignRight);
@@ -143,7 +141,7 @@ void HTMLFilesWidget::SetupTable(int sort_column, Qt::SortOrder sort_order)
         rowItems << image_item;
         // Video
         NumericItem *video_item = new NumericItem();
-        QStringList video_names = video_names_hash[filepath];
+        QStringList video_names = facts.video_bookpaths;
         total_video += video_names.count();
         video_item->setText(QString::number(video_names.count()));
         video_item->setTextAlignment(Qt::AlignRight);
@@ -153,7 +151,7 @@ void HTMLFilesWidget::SetupTable(int sort_column, Qt::SortOrder sort_order)
         rowItems << video_item;
         // Audio
         NumericItem *audio_item = new NumericItem();
-        QStringList audio_names = audio_names_hash[filepath];
+        QStringList audio_names = facts.audio_bookpaths;
         total_audio += audio_names.count();
         audio_item->setText(QString::number(audio_names.count()));
         audio_item->setTextAlignment(Qt::AlignRight);
@@ -163,7 +161,7 @@ void HTMLFilesWidget::SetupTable(int sort_column, Qt::SortOrder sort_order)
         rowItems << audio_item;
         // Linked Stylesheets
         NumericItem *stylesheet_item = new NumericItem();
-        QStringList stylesheet_names = stylesheet_names_hash[filepath];
+        QStringList stylesheet_names = facts.stylesheet_bookpaths;
         total_stylesheets += stylesheet_names.count();
         stylesheet_item->setText(QString::number(stylesheet_names.count()));
         stylesheet_item->setTextAlignment(Qt::AlignRight);
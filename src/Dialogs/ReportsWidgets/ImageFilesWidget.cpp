@@ -30,6 +30,7 @@
 #include "sigil_exception.h"
 #include "BookManipulation/FolderKeeper.h"
 #include "Dialogs/ReportsWidgets/ImageFilesWidget.h"
+#include "Misc/ImageCache.h"
 #include "Misc/NumericItem.h"
 #include "Misc/SettingsStore.h"
 #include "Misc/Utility.h"
@@ -106,10 +107,21 @@ void ImageFilesWidget::SetupTable(int sort_column, Qt::SortOrder sort_order)
     double total_size = 0;
     int total_links = 0;
     QHash<QString, QStringList> image_html_files_hash = m_Book->GetHTMLFilesUsingImages();
+
+    // Decode the thumbnails in parallel off the GUI thread first; the
+    // row building loop below then pulls them straight from the cache
+    if (m_ThumbnailSize) {
+        QStringList image_paths;
+        foreach(Resource * resource, m_AllImageResources) {
+            image_paths << resource->GetFullPath();
+        }
+        ImageCache::instance()->PrimeThumbnails(image_paths, m_ThumbnailSize);
+    }
+
     foreach(Resource * resource, m_AllImageResources) {
         QString filepath = resource->GetRelativePath();
         QString path = resource->GetFullPath();
-        QImage image(path);
+        QImage image = ImageCache::instance()->GetImage(path);
         QList<QStandardItem *> rowItems;
         // Filename
         QStandardItem *name_item = new QStandardItem();
@@ -155,12 +167,7 @@ void ImageFilesWidget::SetupTable(int sort_column, Qt::SortOrder sort_order)
 
         // Thumbnail
         if (m_ThumbnailSize) {
-            QPixmap pixmap(resource->GetFullPath());
-
-            if (pixmap.height() > m_ThumbnailSize || pixmap.width() > m_ThumbnailSize) {
-                pixmap = pixmap.scaled(QSize(m_ThumbnailSize, m_ThumbnailSize), Qt::KeepAspectRatio);
-            }
-
+            QPixmap pixmap = QPixmap::fromImage(ImageCache::instance()->GetThumbnail(path, m_ThumbnailSize));
             QStandardItem *icon_item = new QStandardItem();
             icon_item->setIcon(QIcon(pixmap));
             rowItems << icon_item;
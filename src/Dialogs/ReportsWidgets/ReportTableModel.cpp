@@ -0,0 +1,125 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include <algorithm>
+
+#include "Dialogs/ReportsWidgets/ReportTableModel.h"
+
+ReportTableModel::ReportTableModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+}
+
+void ReportTableModel::setHeaders(const QStringList &headers)
+{
+    beginResetModel();
+    m_Headers = headers;
+    m_Rows.clear();
+    endResetModel();
+}
+
+void ReportTableModel::setRows(const QVector<Row> &rows)
+{
+    beginResetModel();
+    m_Rows = rows;
+    endResetModel();
+}
+
+int ReportTableModel::rowCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_Rows.count();
+}
+
+int ReportTableModel::columnCount(const QModelIndex &parent) const
+{
+    if (parent.isValid()) {
+        return 0;
+    }
+    return m_Headers.count();
+}
+
+QVariant ReportTableModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || (index.row() >= m_Rows.count())) {
+        return QVariant();
+    }
+
+    const Row &row = m_Rows.at(index.row());
+
+    if (index.column() >= row.count()) {
+        return QVariant();
+    }
+
+    const Cell &cell = row.at(index.column());
+
+    if (role == Qt::DisplayRole) {
+        return cell.text;
+    }
+    if (role == Qt::ToolTipRole && !cell.tooltip.isEmpty()) {
+        return cell.tooltip;
+    }
+    if (role == UserDataRole) {
+        return cell.user_data;
+    }
+    return QVariant();
+}
+
+QVariant ReportTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if ((orientation == Qt::Horizontal) && (role == Qt::DisplayRole) && (section < m_Headers.count())) {
+        return m_Headers.at(section);
+    }
+    return QVariant();
+}
+
+Qt::ItemFlags ReportTableModel::flags(const QModelIndex &index) const
+{
+    Q_UNUSED(index)
+    return Qt::ItemIsEnabled | Qt::ItemIsSelectable;
+}
+
+void ReportTableModel::sort(int column, Qt::SortOrder order)
+{
+    if ((column < 0) || (column >= m_Headers.count())) {
+        return;
+    }
+
+    emit layoutAboutToBeChanged();
+
+    std::stable_sort(m_Rows.begin(), m_Rows.end(),
+        [column, order](const Row &ra, const Row &rb) {
+            // swapping the operands keeps the comparison a strict weak
+            // ordering for the descending case
+            const Row &a = (order == Qt::AscendingOrder) ? ra : rb;
+            const Row &b = (order == Qt::AscendingOrder) ? rb : ra;
+            const Cell &ca = a.at(column);
+            const Cell &cb = b.at(column);
+            if (ca.sort_key.isValid() && cb.sort_key.isValid()) {
+                return ca.sort_key.toDouble() < cb.sort_key.toDouble();
+            }
+            return ca.text < cb.text;
+        });
+
+    emit layoutChanged();
+}
@@ -0,0 +1,89 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef REPORTTABLEMODEL_H
+#define REPORTTABLEMODEL_H
+
+#include <QtCore/QAbstractTableModel>
+#include <QtCore/QStringList>
+#include <QtCore/QVariant>
+#include <QtCore/QVector>
+
+/**
+ * A flat read-only table model for the report widgets.
+ *
+ * The report widgets used to build a QStandardItemModel item by item,
+ * which allocates five QStandardItems per row and becomes very slow on
+ * the tens of thousands of rows a character or class audit can produce.
+ * This model holds the finished rows in one vector, so populating it is
+ * a single reset and sorting is a stable sort over the vector instead
+ * of item juggling inside the view.
+ */
+class ReportTableModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+
+    // matches the role QStandardItem::setData() uses with no
+    // explicit role, so existing callers keep reading it unchanged
+    enum { UserDataRole = Qt::UserRole + 1 };
+
+    struct Cell {
+        Cell() {}
+        Cell(const QString &atext) : text(atext) {}
+        QString text;
+        QVariant sort_key;  // compared instead of text when valid (numeric columns)
+        QVariant user_data; // served for UserDataRole (e.g. a bookpath)
+        QString tooltip;
+    };
+
+    typedef QVector<Cell> Row;
+
+    ReportTableModel(QObject *parent = 0);
+
+    void setHeaders(const QStringList &headers);
+
+    /**
+     * Replaces the table contents in a single model reset.
+     */
+    void setRows(const QVector<Row> &rows);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+    Qt::ItemFlags flags(const QModelIndex &index) const;
+
+    /**
+     * Stable sort, so sorting by several columns in sequence behaves
+     * like a multi-key sort just as it did with QStandardItemModel.
+     */
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder);
+
+private:
+
+    QStringList m_Headers;
+    QVector<Row> m_Rows;
+};
+
+#endif // REPORTTABLEMODEL_H
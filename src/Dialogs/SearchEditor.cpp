@@ -50,8 +50,10 @@ SearchEditor::SearchEditor(QWidget *parent)
     ui.LoadSearch->setDefault(true);
     SetupSearchEditorTree();
     CreateContextMenuActions();
+    m_FilterTimer.setSingleShot(true);
+    m_FilterTimer.setInterval(150);
     ConnectSignalsSlots();
-    ExpandAll();
+    RestoreExpansionState();
 }
 
 
@@ -771,6 +773,15 @@ bool SearchEditor::FilterEntries(const QString &text, QStandardItem *item)
 
 void SearchEditor::FilterEditTextChangedSlot(const QString &text)
 {
+    Q_UNUSED(text);
+    // Restarting the timer coalesces a burst of keystrokes into one
+    // filter pass over the whole tree once the user pauses
+    m_FilterTimer.start();
+}
+
+void SearchEditor::ApplyFilter()
+{
+    QString text = ui.FilterText->text();
     FilterEntries(text);
     ui.SearchEditorTree->expandAll();
     ui.SearchEditorTree->selectionModel()->clear();
@@ -857,9 +868,55 @@ void SearchEditor::WriteSettings()
     settings.endArray();
     // Last folder open
     settings.setValue("last_folder_open", m_LastFolderOpen);
+    // Which groups the user keeps collapsed, restored on the next
+    // construction so they are never eagerly laid out
+    QStringList collapsed;
+    CollectCollapsedGroups(m_SearchEditorModel->invisibleRootItem(), collapsed);
+    settings.setValue("collapsed_groups", collapsed);
     settings.endGroup();
 }
 
+void SearchEditor::RestoreExpansionState()
+{
+    SettingsStore settings;
+    settings.beginGroup(SETTINGS_GROUP);
+    QStringList collapsed = settings.value("collapsed_groups").toStringList();
+    settings.endGroup();
+
+    if (collapsed.isEmpty()) {
+        ui.SearchEditorTree->expandAll();
+        return;
+    }
+
+    ExpandAllExcept(m_SearchEditorModel->invisibleRootItem(), collapsed);
+}
+
+void SearchEditor::ExpandAllExcept(QStandardItem *item, const QStringList &collapsed)
+{
+    if (item != m_SearchEditorModel->invisibleRootItem() && m_SearchEditorModel->ItemIsGroup(item)) {
+        if (!collapsed.contains(m_SearchEditorModel->GetFullName(item))) {
+            ui.SearchEditorTree->expand(item->index());
+        }
+    }
+
+    for (int row = 0; row < item->rowCount(); row++) {
+        ExpandAllExcept(item->child(row, 0), collapsed);
+    }
+}
+
+void SearchEditor::CollectCollapsedGroups(QStandardItem *item, QStringList &collapsed)
+{
+    if (item != m_SearchEditorModel->invisibleRootItem() && m_SearchEditorModel->ItemIsGroup(item)) {
+        if (!ui.SearchEditorTree->isExpanded(item->index())) {
+            collapsed.append(m_SearchEditorModel->GetFullName(item));
+        }
+    }
+
+    for (int row = 0; row < item->rowCount(); row++) {
+        CollectCollapsedGroups(item->child(row, 0), collapsed);
+    }
+}
+
 void SearchEditor::CreateContextMenuActions()
 {
     m_AddEntry  =   new QAction(tr("Add Entry"),          this);
@@ -1188,6 +1245,7 @@ void SearchEditor::MoveHorizontal(bool move_left)
 void SearchEditor::ConnectSignalsSlots()
 {
     connect(ui.FilterText,      SIGNAL(textChanged(QString)), this, SLOT(FilterEditTextChangedSlot(QString)));
+    connect(&m_FilterTimer,     SIGNAL(timeout()),            this, SLOT(ApplyFilter()));
     connect(ui.LoadSearch,      SIGNAL(clicked()),            this, SLOT(LoadFindReplace()));
     connect(ui.Find,            SIGNAL(clicked()),            this, SLOT(Find()));
     connect(ui.ReplaceCurrent,  SIGNAL(clicked()),            this, SLOT(ReplaceCurrent()));
@@ -31,6 +31,7 @@
 #include <QtWidgets/QAction>
 #include <QtWidgets/QMenu>
 #include <QPointer>
+#include <QTimer>
 
 #include "Misc/SettingsStore.h"
 #include "MiscEditors/SearchEditorModel.h"
@@ -117,6 +118,9 @@ private slots:
 
     void FilterEditTextChangedSlot(const QString &text);
 
+    // Runs the actual filter pass once the user pauses typing
+    void ApplyFilter();
+
     void OpenContextMenu(const QPoint &point);
 
     void SettingsFileModelUpdated();
@@ -150,6 +154,12 @@ private:
     bool FilterEntries(const QString &text, QStandardItem *item = NULL);
     bool SelectFirstVisibleNonGroup(QStandardItem *item);
 
+    // Reopen the tree the way the user last left it, so groups that
+    // were kept collapsed are not eagerly laid out at construction
+    void RestoreExpansionState();
+    void ExpandAllExcept(QStandardItem *item, const QStringList &collapsed);
+    void CollectCollapsedGroups(QStandardItem *item, QStringList &collapsed);
+
     bool ReadSettings();
     void WriteSettings();
 
@@ -189,6 +199,10 @@ private:
 
     SearchEditorItemDelegate * m_CntrlDelegate;
 
+    // Coalesces filter keystrokes so the full tree walk runs once
+    // per pause in typing instead of once per character
+    QTimer m_FilterTimer;
+
     Ui::SearchEditor ui;
 };
 
@@ -26,12 +26,15 @@
 #include <QtCore/QFileInfo>
 #include <QEventLoop>
 #include <QImage>
+#include <QImageReader>
 #include <QPixmap>
+#include <QtConcurrent/QtConcurrent>
 #include <QtWidgets/QLayout>
 #include <QtWebEngineWidgets/QWebEngineView>
 #include <QtWebEngineWidgets/QWebEngineSettings>
 
 #include "MainUI/MainWindow.h"
+#include "Misc/ImageCache.h"
 #include "Misc/SettingsStore.h"
 #include "sigil_constants.h"
 #include "ViewEditors/SimplePage.h"
@@ -125,6 +128,8 @@ SelectFiles::SelectFiles(QString title, QList<Resource *> media_resources, QStri
 
 SelectFiles::~SelectFiles()
 {
+    // Let any in-flight detail decode run out before the dialog goes away
+    m_ImageDetailsWatcher.waitForFinished();
     WriteSettings();
 }
 
@@ -174,6 +179,19 @@ void SelectFiles::SetImages()
     ui.imageTree->setSortingEnabled(true);
     int row = 0;
 
+    // Decode the thumbnails in parallel off the GUI thread first, so
+    // the row building loop finds them already in the cache
+    if (m_ThumbnailSize && m_ImageItem->isSelected()) {
+        QStringList image_paths;
+        foreach(Resource *resource, m_MediaResources) {
+            Resource::ResourceType type = resource->Type();
+            if (type == Resource::ImageResourceType || type == Resource::SVGResourceType) {
+                image_paths << resource->GetFullPath();
+            }
+        }
+        ImageCache::instance()->PrimeThumbnails(image_paths, m_ThumbnailSize);
+    }
+
     foreach(Resource *resource, m_MediaResources) {
         // Don't show resources not matching the selected type
         Resource::ResourceType type = resource->Type();
@@ -195,11 +213,7 @@ void SelectFiles::SetImages()
 
         // Do not show thumbnail if file is not an image
         if ((type == Resource::ImageResourceType || type == Resource::SVGResourceType) && m_ThumbnailSize) {
-              QPixmap pixmap(resource->GetFullPath());
-
-            if (pixmap.height() > m_ThumbnailSize || pixmap.width() > m_ThumbnailSize) {
-                pixmap = pixmap.scaled(QSize(m_ThumbnailSize, m_ThumbnailSize), Qt::KeepAspectRatio);
-            }
+            QPixmap pixmap = QPixmap::fromImage(ImageCache::instance()->GetThumbnail(resource->GetFullPath(), m_ThumbnailSize));
             QStandardItem *icon_item = new QStandardItem();
             icon_item->setIcon(QIcon(pixmap));
             icon_item->setEditable(false);
@@ -320,21 +334,20 @@ void SelectFiles::SetPreviewImage()
     // Images
     if (resource_type == Resource::ImageResourceType || resource_type == Resource::SVGResourceType) {
 
-        // Define detailed information label
-        const QImage img(path);
-        const QUrl imgUrl = QUrl::fromLocalFile(path);
-        QString colors_shades = img.isGrayscale() ? tr("shades") : tr("colors");
-        QString grayscale_color = img.isGrayscale() ? tr("Grayscale") : tr("Color");
-        QString colorsInfo = "";
-
-        if (img.depth() == 32) {
-            colorsInfo = QString(" %1bpp").arg(img.bitPlaneCount());
-        } else if (img.depth() > 0) {
-            colorsInfo = QString(" %1bpp (%2 %3)").arg(img.bitPlaneCount()).arg(img.colorCount()).arg(colors_shades);
+        // The image header already has the dimensions; the color
+        // details need the pixels, so those come in from a background
+        // decode instead of stalling the dialog on a large cover.
+        QImageReader reader(path);
+        QSize natural_size = reader.size();
+
+        if (natural_size.isValid()) {
+            details = QString("%1x%2px | %3 KB").arg(natural_size.width()).arg(natural_size.height()).arg(fsize);
+        } else {
+            details = QString("%1 KB").arg(fsize);
         }
 
-        details = QString("%2x%3px | %4 KB | %5%6").arg(img.width()).arg(img.height())
-                  .arg(fsize).arg(grayscale_color).arg(colorsInfo);
+        m_ImageDetailsPath = path;
+        m_ImageDetailsWatcher.setFuture(QtConcurrent::run(this, &SelectFiles::BuildImageDetails, path, fsize));
 
         // MainWindow::clearMemoryCaches();
         const QUrl resourceUrl = QUrl::fromLocalFile(path);
@@ -388,7 +401,39 @@ void SelectFiles::SetPreviewImage()
     m_PreviewReady = true;
 }
 
-void SelectFiles::PreviewLoadComplete(bool okay) 
+QString SelectFiles::BuildImageDetails(const QString &path, const QString &fsize)
+{
+    // Runs on a worker thread: the grayscale test reads every pixel,
+    // which is far too slow for the GUI thread on large images.
+    const QImage img = ImageCache::instance()->GetImage(path);
+    QString colors_shades = img.isGrayscale() ? tr("shades") : tr("colors");
+    QString grayscale_color = img.isGrayscale() ? tr("Grayscale") : tr("Color");
+    QString colorsInfo = "";
+
+    if (img.depth() == 32) {
+        colorsInfo = QString(" %1bpp").arg(img.bitPlaneCount());
+    } else if (img.depth() > 0) {
+        colorsInfo = QString(" %1bpp (%2 %3)").arg(img.bitPlaneCount()).arg(img.colorCount()).arg(colors_shades);
+    }
+
+    return QString("%2x%3px | %4 KB | %5%6").arg(img.width()).arg(img.height())
+           .arg(fsize).arg(grayscale_color).arg(colorsInfo);
+}
+
+void SelectFiles::ImageDetailsReady()
+{
+    // The selection may have moved on while the decode was running;
+    // only the details for the image still on display are applied.
+    QStandardItem *item = GetLastSelectedImageItem();
+
+    if (!item || item->data(Qt::UserRole + 1).toString() != m_ImageDetailsPath) {
+        return;
+    }
+
+    ui.Details->setText(m_ImageDetailsWatcher.result());
+}
+
+void SelectFiles::PreviewLoadComplete(bool okay)
 {
     if (!okay) {
         m_WebView->stop();
@@ -519,4 +564,5 @@ void SelectFiles::connectSignalsSlots()
     connect(ui.FileTypes,       SIGNAL(itemSelectionChanged()), this, SLOT(SetImages()));
     connect(m_WebView,          SIGNAL(loadFinished(bool)), this, SLOT(PreviewLoadComplete(bool)));
     connect(ui.splitter,    SIGNAL(splitterMoved(int, int)), this, SLOT(SplitterMoved(int, int)));
+    connect(&m_ImageDetailsWatcher, SIGNAL(finished()), this, SLOT(ImageDetailsReady()));
 }
@@ -25,6 +25,7 @@
 #ifndef SELECTFILES_H
 #define SELECTFILES_H
 
+#include <QtCore/QFutureWatcher>
 #include <QtWidgets/QDialog>
 #include <QtGui/QStandardItemModel>
 
@@ -84,6 +85,12 @@ private slots:
 
     void SplitterMoved(int pos, int index);
 
+    /**
+     * Applies the detail line built by the background decode, as long
+     * as the image it describes is still the one being previewed.
+     */
+    void ImageDetailsReady();
+
 private:
     bool IsPreviewLoaded();
     
@@ -92,6 +99,13 @@ private:
 
     void SetPreviewImage();
 
+    /**
+     * Builds the detail line (dimensions, size, color depth) for an
+     * image.  Meant to run on a worker thread; it decodes the full
+     * image through the shared cache.
+     */
+    QString BuildImageDetails(const QString &path, const QString &fsize);
+
     QList<Resource *> m_MediaResources;
 
     QStandardItemModel *m_SelectFilesModel;
@@ -116,6 +130,17 @@ private:
 
     QWebEngineView *m_WebView;
 
+    /**
+     * Delivers the detail line of the image being previewed once the
+     * background decode finishes.
+     */
+    QFutureWatcher<QString> m_ImageDetailsWatcher;
+
+    /**
+     * The path the currently running (or last) detail build is for.
+     */
+    QString m_ImageDetailsPath;
+
     Ui::SelectFiles ui;
 };
 
@@ -23,6 +23,7 @@
 
 #include <QtCore/QHashIterator>
 #include <QtCore/QSignalMapper>
+#include <QtConcurrent/QtConcurrent>
 #include <QtGui/QContextMenuEvent>
 #include <QtWidgets/QMessageBox>
 #include <QtWidgets/QPushButton>
@@ -45,6 +46,16 @@ static const QString SORT_COLUMN = "sort_column";
 static const QString SORT_ORDER = "sort_order";
 static const QString FILE_EXTENSION = "ini";
 
+// How many rows are added to the word list before letting the dialog repaint.
+static const int WORD_CHUNK_SIZE = 256;
+
+// Runs on a worker thread; the shared pointer keeps the book alive
+// even if it is swapped out while the scan is still running.
+static QHash<QString, int> GatherUniqueWords(QSharedPointer<Book> book)
+{
+    return book->GetUniqueWordsInHTMLFiles();
+}
+
 SpellcheckEditor::SpellcheckEditor(QWidget *parent)
     :
     QDialog(parent),
@@ -53,6 +64,9 @@ SpellcheckEditor::SpellcheckEditor(QWidget *parent)
     m_ContextMenu(new QMenu(this)),
     m_MultipleSelection(false),
     m_SelectRow(-1),
+    m_RefreshInProgress(false),
+    m_PendingSortColumn(1),
+    m_PendingSortOrder(Qt::AscendingOrder),
     m_FilterSC(new QShortcut(QKeySequence(tr("f", "Filter")), this)),
     m_ShowAllSC(new QShortcut(QKeySequence(tr("s", "ShowAllWords")), this)),
     m_NoCaseSC(new QShortcut(QKeySequence(tr("c", "Case-InsensitiveSort")), this)),
@@ -259,12 +273,17 @@ void SpellcheckEditor::CreateModel(int sort_column, Qt::SortOrder sort_order)
     m_SpellcheckEditorModel->setHorizontalHeaderLabels(header);
     ui.SpellcheckEditorTree->header()->setSectionResizeMode(0, QHeaderView::Stretch);
 
-    QHash<QString, int> unique_words = m_Book->GetUniqueWordsInHTMLFiles();
+    // Gathered in the background by Refresh() before this runs
+    const QHash<QString, int> &unique_words = m_UniqueWords;
 
     int total_misspelled_words = 0;
+    int rows_added = 0;
     SpellCheck *sc = SpellCheck::instance();
     Language *lp = Language::instance();
 
+    // Resolve all the verdicts in one batch up front
+    QHash<QString, bool> verdicts = sc->spellBatch(unique_words.keys());
+
     QHashIterator<QString, int> i(unique_words);
     while (i.hasNext()) {
         i.next();
@@ -273,7 +292,7 @@ void SpellcheckEditor::CreateModel(int sort_column, Qt::SortOrder sort_order)
         QString lang = lp->GetLanguageName(code, code);
         QString word = HTMLSpellCheckML::textOf(lcword);
         int count = unique_words.value(lcword);
-        bool misspelled = !sc->spell(lcword);
+        bool misspelled = !verdicts.value(lcword, true);
         if (misspelled) {
             total_misspelled_words++;
         }
@@ -313,6 +332,12 @@ void SpellcheckEditor::CreateModel(int sort_column, Qt::SortOrder sort_order)
         row_items << misspelled_item ;
 
         m_SpellcheckEditorModel->invisibleRootItem()->appendRow(row_items);
+        rows_added++;
+
+        // Let the first words show while the rest of a big list fills in
+        if ((rows_added % WORD_CHUNK_SIZE) == 0) {
+            qApp->processEvents(QEventLoop::ExcludeUserInputEvents);
+        }
     }
 
     ui.SpellcheckEditorTree->resizeColumnToContents(0);
@@ -334,10 +359,29 @@ void SpellcheckEditor::CreateModel(int sort_column, Qt::SortOrder sort_order)
 
 void SpellcheckEditor::Refresh(int sort_column, Qt::SortOrder sort_order)
 {
-    QApplication::setOverrideCursor(Qt::WaitCursor);
+    if (!m_Book) {
+        return;
+    }
+
+    // Gathering the unique words reads every HTML file, which is far
+    // too slow for the GUI thread on a big book. The scan runs in the
+    // background and RefreshDone() builds the model from its result;
+    // a refresh requested while one is running simply replaces it.
+    if (!m_RefreshInProgress) {
+        QApplication::setOverrideCursor(Qt::WaitCursor);
+        m_RefreshInProgress = true;
+    }
 
     WriteSettings();
-    CreateModel(sort_column, sort_order);
+    m_PendingSortColumn = sort_column;
+    m_PendingSortOrder = sort_order;
+    m_UniqueWordsWatcher.setFuture(QtConcurrent::run(GatherUniqueWords, m_Book));
+}
+
+void SpellcheckEditor::RefreshDone()
+{
+    m_UniqueWords = m_UniqueWordsWatcher.result();
+    CreateModel(m_PendingSortColumn, m_PendingSortOrder);
     UpdateDictionaries();
 
     ReadSettings();
@@ -348,6 +392,7 @@ void SpellcheckEditor::Refresh(int sort_column, Qt::SortOrder sort_order)
     SelectRow(m_SelectRow);
     UpdateSuggestions();
 
+    m_RefreshInProgress = false;
     QApplication::restoreOverrideCursor();
 }
 
@@ -636,4 +681,5 @@ void SpellcheckEditor::ConnectSignalsSlots()
     connect(m_NoCaseSC, SIGNAL(activated()), this, SLOT(toggleCaseInsensitiveSort()));
     connect(m_RefreshSC, SIGNAL(activated()), this, SLOT(Refresh()));
 
+    connect(&m_UniqueWordsWatcher, SIGNAL(finished()), this, SLOT(RefreshDone()));
 }
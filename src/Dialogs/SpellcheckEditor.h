@@ -30,6 +30,7 @@
 #include <QtWidgets/QAction>
 #include <QtWidgets/QMenu>
 #include <QShortcut>
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QSharedPointer>
 #include <QPointer>
 
@@ -91,6 +92,11 @@ private slots:
 
     void Sort(int logicalindex, Qt::SortOrder order);
 
+    /**
+     * Builds the model once the background word scan has finished.
+     */
+    void RefreshDone();
+
 private:
     void CreateModel(int logicalindex, Qt::SortOrder order);
     void UpdateDictionaries();
@@ -128,6 +134,28 @@ private:
 
     int m_SelectRow;
 
+    /**
+     * Set while a background word scan and the model rebuild from it
+     * are pending, so overlapping refreshes keep one wait cursor.
+     */
+    bool m_RefreshInProgress;
+
+    /**
+     * The sort requested by the refresh currently in flight.
+     */
+    int m_PendingSortColumn;
+    Qt::SortOrder m_PendingSortOrder;
+
+    /**
+     * Delivers the unique word counts gathered off the GUI thread.
+     */
+    QFutureWatcher<QHash<QString, int> > m_UniqueWordsWatcher;
+
+    /**
+     * The last gathered unique word counts; CreateModel() reads these.
+     */
+    QHash<QString, int> m_UniqueWords;
+
     QShortcut * m_FilterSC;
     QShortcut * m_ShowAllSC;
     QShortcut * m_NoCaseSC;
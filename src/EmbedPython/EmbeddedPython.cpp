@@ -23,6 +23,7 @@
 #include "EmbedPython/EmbeddedPython.h"
 #include <QString>
 #include <QByteArray>
+#include <QHash>
 #include <QList>
 #include <QStringList>
 #include <QVariant>
@@ -163,6 +164,7 @@
 
 
 QMutex EmbeddedPython::m_mutex;
+QHash<QString, PyObject *> EmbeddedPython::m_modules;
 
 EmbeddedPython* EmbeddedPython::m_instance = 0;
 int EmbeddedPython::m_pyobjmetaid = 0;
@@ -249,6 +251,10 @@ EmbeddedPython::~EmbeddedPython()
     m_pyobjmetaid = 0;
     m_listintmetaid = 0;
     PyEval_RestoreThread(m_threadstate);
+    foreach(PyObject *module, m_modules) {
+        Py_XDECREF(module);
+    }
+    m_modules.clear();
     Py_Finalize();
 }
 
@@ -307,6 +313,43 @@ bool EmbeddedPython::addToPythonSysPath(const QString &mpath)
     return success;
 }
 
+// import the given modules now so that the first real call on them
+// does not stall on the import machinery; a module that fails to
+// import here will be retried (and reported) when it is actually used
+void EmbeddedPython::preloadModules(const QStringList &module_names)
+{
+    EmbeddedPython::m_mutex.lock();
+    PyGILState_STATE gstate = PyGILState_Ensure();
+    foreach(QString mname, module_names) {
+        if (getCachedModule(mname) == NULL) {
+            PyErr_Clear();
+        }
+    }
+    PyGILState_Release(gstate);
+    EmbeddedPython::m_mutex.unlock();
+}
+
+// look up a module handle, importing and caching it on first use
+// the cache keeps the sole strong reference until Py_Finalize
+// must only be called with the mutex and the GIL held
+PyObject* EmbeddedPython::getCachedModule(const QString &mname)
+{
+    PyObject *module = m_modules.value(mname, NULL);
+    if (module != NULL) {
+        return module;
+    }
+    PyObject *moduleName = PyUnicode_FromString(mname.toUtf8().constData());
+    if (moduleName == NULL) {
+        return NULL;
+    }
+    module = PyImport_Import(moduleName);
+    Py_XDECREF(moduleName);
+    if (module != NULL) {
+        m_modules.insert(mname, module);
+    }
+    return module;
+}
+
 // run interpreter without initiating/locking/unlocking GIL 
 // in a single thread at a time
 QVariant EmbeddedPython::runInPython(const QString &mname, 
@@ -319,20 +362,15 @@ QVariant EmbeddedPython::runInPython(const QString &mname,
     EmbeddedPython::m_mutex.lock();
     PyGILState_STATE gstate = PyGILState_Ensure();
     QVariant  res        = QVariant(QString());
-    PyObject *moduleName = NULL;
     PyObject *module     = NULL;
     PyObject *func       = NULL;
     PyObject *pyargs     = NULL;
     PyObject *pyres      = NULL;
     int       idx        = 0;
 
-    moduleName = PyUnicode_FromString(mname.toUtf8().constData());
-    if (moduleName == NULL) {
-        *rv = -1;
-        goto cleanup;
-    }
-
-    module = PyImport_Import(moduleName);
+    // borrow the module handle from the cache so back-to-back calls
+    // skip the import machinery after the first use
+    module = getCachedModule(mname);
     if (module == NULL) {
         *rv = -2;
         goto cleanup;
@@ -375,8 +413,6 @@ cleanup:
     Py_XDECREF(pyres);
     Py_XDECREF(pyargs);
     Py_XDECREF(func);
-    Py_XDECREF(module);
-    Py_XDECREF(moduleName);
 
     PyGILState_Release(gstate);
     EmbeddedPython::m_mutex.unlock();
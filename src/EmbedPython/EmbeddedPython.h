@@ -26,7 +26,9 @@
 
 #include <Python.h>
 #include <QCoreApplication>
+#include <QHash>
 #include <QString>
+#include <QStringList>
 #include <QVariant>
 #include <QMutex>
 #include "EmbedPython/PyObjectPtr.h"
@@ -48,6 +50,8 @@ public:
 
     bool addToPythonSysPath(const QString& modulepath);
 
+    void preloadModules(const QStringList &module_names);
+
     QVariant runInPython(const QString &module_name,
                          const QString &function_name,
                          const QVariantList &args,
@@ -66,6 +70,8 @@ private:
 
     EmbeddedPython();
 
+    PyObject *getCachedModule(const QString &mname);
+
     QVariant PyObjectToQVariant(PyObject *po, bool ret_python_object = false);
 
     PyObject *QVariantToPyObject(const QVariant &v);
@@ -74,6 +80,7 @@ private:
                                     bool useMsgBox = true);
 
     static QMutex m_mutex;
+    static QHash<QString, PyObject *> m_modules;
     static EmbeddedPython *m_instance;
     static int m_pyobjmetaid;
     static PyThreadState *m_threadstate;
@@ -23,9 +23,25 @@
 #include <QString>
 #include <QList>
 #include <QVariant>
+#include <QCryptographicHash>
+#include <QMutex>
+#include <QMutexLocker>
 
 #include "EmbedPython/PythonRoutines.h"
 
+namespace {
+
+// Parsing the metadata out of the opf is a pure function of the opf
+// text and the epub version, and the MetaEditor reopens it against the
+// same opf many times in one session.  Remember the last parse so those
+// reopens do not cross the C++/Python boundary again.  One slot is
+// enough: any opf edit changes the key and simply replaces it.
+QMutex metadata_cache_mutex;
+QByteArray cached_metadata_key;
+MetadataPieces cached_metadata_pieces;
+
+}
+
 
 QString PythonRoutines::GenerateNcxInPython(const QString &navdata, const QString &navbkpath, 
                                             const QString &ncxdir, const QString &doctitle, 
@@ -58,9 +74,21 @@ QString PythonRoutines::GenerateNcxInPython(const QString &navdata, const QStrin
 MetadataPieces PythonRoutines::GetMetadataInPython(const QString& opfdata, const QString& version) 
 {
     int rv = 0;
+    bool ok = true;
     QString traceback;
     MetadataPieces mdp;
 
+    QCryptographicHash keyhash(QCryptographicHash::Md5);
+    keyhash.addData(version.toUtf8());
+    keyhash.addData(opfdata.toUtf8());
+    QByteArray key = keyhash.result();
+    {
+        QMutexLocker locker(&metadata_cache_mutex);
+        if (key == cached_metadata_key) {
+            return cached_metadata_pieces;
+        }
+    }
+
     QString module = "metaproc2";
     if (version.startsWith('3')) module = "metaproc3";
     QList<QVariant> args;
@@ -68,33 +96,44 @@ MetadataPieces PythonRoutines::GetMetadataInPython(const QString& opfdata, const
     EmbeddedPython* epp = EmbeddedPython::instance();
     QVariant res = epp->runInPython(module, QString("process_metadata"), args, &rv, traceback, true);
     if (rv) {
+        ok = false;
         fprintf(stderr, "process_meta error %d traceback %s\n",rv, traceback.toStdString().c_str());
     }
     PyObjectPtr mpo = PyObjectPtr(res);
     args.clear();
     res = epp->callPyObjMethod(mpo, QString("get_recognized_metadata"), args, &rv, traceback);
     if (rv) {
+        ok = false;
         fprintf(stderr, "get_recognized_metadata error %d traceback %s\n",rv, traceback.toStdString().c_str());
     }
     mdp.data = res.toString();
     args.clear();
     res = epp->callPyObjMethod(mpo, QString("get_other_meta_xml"), args, &rv, traceback);
     if (rv) {
+        ok = false;
         fprintf(stderr, "get_other_meta_xml error %d traceback %s\n",rv, traceback.toStdString().c_str());
     }
     mdp.otherxml = res.toString();
     args.clear();
     res = epp->callPyObjMethod(mpo, QString("get_id_list"), args, &rv, traceback);
     if (rv) {
+        ok = false;
         fprintf(stderr, "get_id_list error %d traceback %s\n",rv, traceback.toStdString().c_str());
     }
     mdp.idlist = res.toStringList();
     args.clear();
     res = epp->callPyObjMethod(mpo, QString("get_metadata_tag"), args, &rv, traceback);
     if (rv) {
+        ok = false;
         fprintf(stderr, "get_metadata_tag error %d traceback %s\n",rv, traceback.toStdString().c_str());
     }
     mdp.metatag = res.toString();
+
+    if (ok) {
+        QMutexLocker locker(&metadata_cache_mutex);
+        cached_metadata_key = key;
+        cached_metadata_pieces = mdp;
+    }
     return mdp;
 }
 
@@ -313,6 +352,44 @@ QList<DiffRecord::DiffRec> PythonRoutines::GenerateParsedNDiffInPython(const QSt
 }
 
 
+QList<QList<DiffRecord::DiffRec>> PythonRoutines::GenerateParsedNDiffsInPython(const QStringList& leftpaths,
+                                                                               const QStringList& rightpaths)
+{
+    QList<QList<DiffRecord::DiffRec>> results;
+    int rv = -1;
+    QString error_traceback;
+    QList<QVariant> args;
+    args.append(QVariant(leftpaths));
+    args.append(QVariant(rightpaths));
+
+    EmbeddedPython * epython  = EmbeddedPython::instance();
+
+    QVariant res = epython->runInPython( QString("repomanager"),
+                                         QString("generate_parsed_ndiffs"),
+                                         args,
+                                         &rv,
+                                         error_traceback);
+    if (rv == 0) {
+        foreach(QVariant dv, res.toList()) {
+            QList<DiffRecord::DiffRec> diffinfo;
+            QVariantList vlist = dv.toList();
+            foreach(QVariant qv, vlist) {
+                QStringList fields = qv.toStringList();
+                DiffRecord::DiffRec dr;
+                dr.code = fields.at(0);
+                dr.line = fields.at(1);
+                dr.newline = fields.at(2);
+                dr.leftchanges = fields.at(3);
+                dr.rightchanges = fields.at(4);
+                diffinfo << dr;
+            }
+            results << diffinfo;
+        }
+    }
+    return results;
+}
+
+
 
 QString PythonRoutines::GenerateUnifiedDiffInPython(const QString& path1, const QString& path2)
 {
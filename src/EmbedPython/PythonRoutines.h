@@ -79,6 +79,11 @@ public:
 
     QList<DiffRecord::DiffRec> GenerateParsedNDiffInPython(const QString& path1, const QString& path2);
 
+    // diffs path pairs in a single embedded interpreter call,
+    // returning one diff record list per pair in input order
+    QList<QList<DiffRecord::DiffRec>> GenerateParsedNDiffsInPython(const QStringList& leftpaths,
+                                                                   const QStringList& rightpaths);
+
     QString GenerateUnifiedDiffInPython(const QString& path1, const QString& path2);
 
     QString CopyTagToDestDirInPython(const QString& localRepo,
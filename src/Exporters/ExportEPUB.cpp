@@ -24,6 +24,7 @@
 #define NOMINMAX
 #endif
 
+#include <functional>
 #include <string>
 #include <string.h>
 
@@ -39,15 +40,18 @@
 #include <QtCore/QFileInfo>
 #include <QtCore/QTemporaryFile>
 #include <QtCore/QTextStream>
+#include <QtConcurrent/QtConcurrent>
 
 #include "BookManipulation/CleanSource.h"
 #include "BookManipulation/FolderKeeper.h"
 #include "BookManipulation/XhtmlDoc.h"
 #include "Exporters/EncryptionXmlWriter.h"
 #include "Exporters/ExportEPUB.h"
+#include "Misc/FutureWaiter.h"
 #include "Misc/Utility.h"
 #include "Misc/TempFolder.h"
 #include "Misc/FontObfuscation.h"
+#include "Misc/Tracer.h"
 #include "ResourceObjects/FontResource.h"
 #include "sigil_constants.h"
 #include "sigil_exception.h"
@@ -64,6 +68,129 @@ static const QString METAINF_FOLDER_SUFFIX = "/META-INF";
 
 static const char * EPUB_MIME_DATA = "application/epub+zip";
 
+// One file to be deflated, recorded while walking the temp folder.
+struct ZipWriteJob {
+    QString relpath;
+    QString fullpath;
+};
+
+// One file deflated on a pool thread, ready to be written into the
+// archive as a raw (already compressed) entry.  error is 0 on success,
+// 1 when the file on disk could not be opened and 2 when reading or
+// deflating it failed.
+struct DeflatedEntry {
+    QString    relpath;
+    QString    filename;
+    QByteArray compressed;
+    uLong      crc;
+    ZPOS64_T   uncompressed_size;
+    int        error;
+};
+
+// Compressed streams kept from the previous save, keyed by archive
+// path.  A routine save changes only a few entries, so most files can
+// reuse the deflate work of the last save; a hash of the file bytes
+// decides reuse.  The cache is pruned to the current save's entries,
+// keeping it bounded by the size of the last book saved.
+struct CachedDeflate {
+    QByteArray source_hash;
+    QByteArray compressed;
+    uLong      crc;
+    ZPOS64_T   uncompressed_size;
+};
+
+static QMutex deflate_cache_mutex;
+static QHash<QString, CachedDeflate> deflate_cache;
+
+// Reads and deflates one file with the same parameters minizip would
+// use (raw deflate, level 8, 32K window, memLevel 8), so the entries
+// the workers hand back are byte-compatible with a serial save.
+// Unchanged files are served from the deflate cache instead.
+static DeflatedEntry DeflateOneEntry(const ZipWriteJob &job)
+{
+    DeflatedEntry result;
+    result.relpath = job.relpath;
+    result.filename = QFileInfo(job.fullpath).fileName();
+    result.crc = crc32(0L, Z_NULL, 0);
+    result.uncompressed_size = 0;
+    result.error = 0;
+    QFile dfile(job.fullpath);
+
+    if (!dfile.open(QIODevice::ReadOnly)) {
+        result.error = 1;
+        return result;
+    }
+
+    QByteArray data = dfile.readAll();
+    dfile.close();
+
+    if ((data.size() == 0) && (dfile.size() != 0)) {
+        result.error = 2;
+        return result;
+    }
+
+    // Hashing the bytes is far cheaper than deflating them, so check
+    // whether the previous save already compressed this exact content.
+    QByteArray source_hash = QCryptographicHash::hash(data, QCryptographicHash::Md5);
+    {
+        QMutexLocker locker(&deflate_cache_mutex);
+        CachedDeflate cached = deflate_cache.value(job.relpath);
+
+        if (!cached.source_hash.isEmpty() && cached.source_hash == source_hash) {
+            result.compressed = cached.compressed;
+            result.crc = cached.crc;
+            result.uncompressed_size = cached.uncompressed_size;
+            return result;
+        }
+    }
+
+    result.crc = crc32(result.crc, reinterpret_cast<const Bytef *>(data.constData()), data.size());
+    result.uncompressed_size = data.size();
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+
+    if (deflateInit2(&strm, 8, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        result.error = 2;
+        return result;
+    }
+
+    strm.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data.constData()));
+    strm.avail_in = data.size();
+    char outbuff[BUFF_SIZE];
+    int zres = Z_OK;
+
+    do {
+        strm.next_out = reinterpret_cast<Bytef *>(outbuff);
+        strm.avail_out = BUFF_SIZE;
+        zres = deflate(&strm, Z_FINISH);
+
+        if (zres == Z_STREAM_ERROR) {
+            break;
+        }
+
+        result.compressed.append(outbuff, BUFF_SIZE - strm.avail_out);
+    } while (zres != Z_STREAM_END);
+
+    deflateEnd(&strm);
+
+    if (zres != Z_STREAM_END) {
+        result.error = 2;
+        return result;
+    }
+
+    CachedDeflate cached;
+    cached.source_hash = source_hash;
+    cached.compressed = result.compressed;
+    cached.crc = result.crc;
+    cached.uncompressed_size = result.uncompressed_size;
+    {
+        QMutexLocker locker(&deflate_cache_mutex);
+        deflate_cache[job.relpath] = cached;
+    }
+    return result;
+}
+
 
 // Constructor;
 // the first parameter is the location where the book
@@ -120,6 +247,7 @@ void ExportEPUB::CreatePublication(const QString &fullfolderpath)
 
 void ExportEPUB::SaveFolderAsEpubToLocation(const QString &fullfolderpath, const QString &fullfilepath)
 {
+    SIGIL_TRACE_SCOPE("ExportEPUB::SaveFolderAsEpubToLocation");
     QString tempFile = fullfolderpath + "-tmp.epub";
     QDateTime timeNow = QDateTime::currentDateTime();
     zip_fileinfo fileInfo;
@@ -158,64 +286,77 @@ void ExportEPUB::SaveFolderAsEpubToLocation(const QString &fullfolderpath, const
     }
 
     zipCloseFileInZip(zfile);
-    // Write all the files in our directory path to the archive.
+    // Collect all the files in our directory path.
+    QList<ZipWriteJob> jobs;
     QDirIterator it(fullfolderpath, QDir::Files | QDir::NoDotAndDotDot | QDir::Readable | QDir::Hidden, QDirIterator::Subdirectories);
 
     while (it.hasNext()) {
         it.next();
-        QString relpath = it.filePath().remove(fullfolderpath);
+        ZipWriteJob job;
+        job.fullpath = it.filePath();
+        job.relpath = it.filePath().remove(fullfolderpath);
 
-        while (relpath.startsWith("/")) {
-            relpath = relpath.remove(0, 1);
+        while (job.relpath.startsWith("/")) {
+            job.relpath = job.relpath.remove(0, 1);
         }
 
-        // Add the file entry to the archive.
-        // We should check the uncompressed file size. If it's over >= 0xffffffff the last parameter (zip64) should be 1.
-        if (zipOpenNewFileInZip4_64(zfile, relpath.toUtf8().constData(), &fileInfo, NULL, 0, NULL, 0, NULL, Z_DEFLATED, 8, 0, 15, 8, Z_DEFAULT_STRATEGY, NULL, 0, 0x0b00, 1<<11, 0) != ZIP_OK) {
-            zipClose(zfile, NULL);
-            QFile::remove(tempFile);
-            throw(CannotStoreFile(relpath.toStdString()));
+        jobs.append(job);
+    }
+
+    // Drop cached streams for entries that are no longer part of the
+    // book so the cache stays bounded by the last save.
+    {
+        QMutexLocker locker(&deflate_cache_mutex);
+        QSet<QString> current;
+        foreach(const ZipWriteJob &job, jobs) {
+            current.insert(job.relpath);
         }
+        foreach(const QString &key, deflate_cache.keys()) {
+            if (!current.contains(key)) {
+                deflate_cache.remove(key);
+            }
+        }
+    }
 
-        // Open the file on disk. We will read this and write what we read into
-        // the archive.
-        QFile dfile(it.filePath());
+    // Deflate the files on the thread pool - each entry is compressed
+    // independently - then write the already-compressed streams into
+    // the archive in order as raw entries.  Save time on big books is
+    // otherwise almost pure single-threaded zlib.
+    QList<DeflatedEntry> entries = FutureWaiter::Results(QtConcurrent::mapped(jobs, DeflateOneEntry));
 
-        if (!dfile.open(QIODevice::ReadOnly)) {
-            zipCloseFileInZip(zfile);
+    foreach(const DeflatedEntry &dentry, entries) {
+        if (dentry.error == 1) {
             zipClose(zfile, NULL);
             QFile::remove(tempFile);
-            throw(CannotOpenFile(it.fileName().toStdString()));
+            throw(CannotOpenFile(dentry.filename.toStdString()));
         }
 
-        // Write the data from the file on disk into the archive.
-        char buff[BUFF_SIZE] = {0};
-        qint64 read = 0;
-
-        while ((read = dfile.read(buff, BUFF_SIZE)) > 0) {
-            if (zipWriteInFileInZip(zfile, buff, read) != ZIP_OK) {
-                dfile.close();
-                zipCloseFileInZip(zfile);
-                zipClose(zfile, NULL);
-                QFile::remove(tempFile);
-                throw(CannotStoreFile(relpath.toStdString()));
-            }
+        if (dentry.error != 0) {
+            zipClose(zfile, NULL);
+            QFile::remove(tempFile);
+            throw(CannotStoreFile(dentry.relpath.toStdString()));
         }
 
-        dfile.close();
+        // Add the file entry to the archive with raw set, since the
+        // stream is already deflated.
+        // We should check the uncompressed file size. If it's over >= 0xffffffff the last parameter (zip64) should be 1.
+        if (zipOpenNewFileInZip4_64(zfile, dentry.relpath.toUtf8().constData(), &fileInfo, NULL, 0, NULL, 0, NULL, Z_DEFLATED, 8, 1, 15, 8, Z_DEFAULT_STRATEGY, NULL, 0, 0x0b00, 1<<11, 0) != ZIP_OK) {
+            zipClose(zfile, NULL);
+            QFile::remove(tempFile);
+            throw(CannotStoreFile(dentry.relpath.toStdString()));
+        }
 
-        // There was an error reading the file on disk.
-        if (read < 0) {
+        if (zipWriteInFileInZip(zfile, dentry.compressed.constData(), (unsigned int)dentry.compressed.size()) != ZIP_OK) {
             zipCloseFileInZip(zfile);
             zipClose(zfile, NULL);
             QFile::remove(tempFile);
-            throw(CannotStoreFile(relpath.toStdString()));
+            throw(CannotStoreFile(dentry.relpath.toStdString()));
         }
 
-        if (zipCloseFileInZip(zfile) != ZIP_OK) {
+        if (zipCloseFileInZipRaw64(zfile, dentry.uncompressed_size, dentry.crc) != ZIP_OK) {
             zipClose(zfile, NULL);
             QFile::remove(tempFile);
-            throw(CannotStoreFile(relpath.toStdString()));
+            throw(CannotStoreFile(dentry.relpath.toStdString()));
         }
     }
 
@@ -287,6 +428,7 @@ void ExportEPUB::ObfuscateFonts(const QString &fullfolderpath)
     QString uuid_id = m_Book->GetOPF()->GetUUIDIdentifierValue();
     QString main_id = m_Book->GetPublicationIdentifier();
     QList<FontResource *> font_resources = m_Book->GetFolderKeeper()->GetResourceTypeList<FontResource>();
+    QList<FontObfuscation::ObfuscationJob> jobs;
     foreach(FontResource *font_resource, font_resources) {
         QString algorithm = font_resource->GetObfuscationAlgorithm();
 
@@ -294,12 +436,11 @@ void ExportEPUB::ObfuscateFonts(const QString &fullfolderpath)
             continue;
         }
 
-        QString font_path = fullfolderpath + "/" + font_resource->GetRelativePath();
-
-        if (algorithm == ADOBE_FONT_ALGO_ID) {
-            FontObfuscation::ObfuscateFile(font_path, algorithm, uuid_id);
-        } else {
-            FontObfuscation::ObfuscateFile(font_path, algorithm, main_id);
-        }
+        FontObfuscation::ObfuscationJob job;
+        job.filepath = fullfolderpath + "/" + font_resource->GetRelativePath();
+        job.algorithm = algorithm;
+        job.identifier = (algorithm == ADOBE_FONT_ALGO_ID) ? uuid_id : main_id;
+        jobs.append(job);
     }
+    FontObfuscation::ObfuscateFiles(jobs);
 }
@@ -30,6 +30,8 @@
 #include "iowin32.h"
 #endif
 
+#include <cstring>
+#include <functional>
 #include <string>
 
 #include <QApplication>
@@ -37,7 +39,6 @@
 #include <QtCore/QDir>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
-#include <QtCore/QFutureSynchronizer>
 #include <QtConcurrent/QtConcurrent>
 #include <QtCore/QXmlStreamReader>
 #include <QDirIterator>
@@ -51,6 +52,8 @@
 #include "BookManipulation/FolderKeeper.h"
 #include "BookManipulation/CleanSource.h"
 #include "Importers/ImportEPUB.h"
+#include "Misc/FutureWaiter.h"
+#include "Misc/LargeBookPolicy.h"
 #include "Misc/MediaTypes.h"
 #include "Misc/FontObfuscation.h"
 #include "Misc/HTMLEncodingResolver.h"
@@ -89,6 +92,262 @@ static const QString CONTAINER_XML       = "<?xml version=\"1.0\" encoding=\"UTF
 
 static QCodePage437Codec *cp437 = 0;
 
+// minizip io routines that read the archive through a read-only memory
+// mapping of the epub instead of buffered freads.  The central directory
+// walk and every compressed stream then come straight from the page
+// cache with no read syscalls or copies into stdio buffers, which is
+// where cold opens of large epubs spend much of their time.
+struct MappedArchive {
+    const unsigned char *data;
+    ZPOS64_T             size;
+    ZPOS64_T             pos;
+};
+
+static voidpf ZCALLBACK MappedOpenFileFunc(voidpf opaque, const void *filename, int mode)
+{
+    Q_UNUSED(filename);
+    Q_UNUSED(mode);
+    // The mapping was set up by the caller; the opaque pointer is the stream.
+    return opaque;
+}
+
+static uLong ZCALLBACK MappedReadFileFunc(voidpf opaque, voidpf stream, void *buf, uLong size)
+{
+    Q_UNUSED(opaque);
+    MappedArchive *archive = static_cast<MappedArchive *>(stream);
+    ZPOS64_T remaining = archive->size - archive->pos;
+    if (size > remaining) {
+        size = static_cast<uLong>(remaining);
+    }
+    memcpy(buf, archive->data + archive->pos, size);
+    archive->pos += size;
+    return size;
+}
+
+static uLong ZCALLBACK MappedWriteFileFunc(voidpf opaque, voidpf stream, const void *buf, uLong size)
+{
+    Q_UNUSED(opaque);
+    Q_UNUSED(stream);
+    Q_UNUSED(buf);
+    Q_UNUSED(size);
+    // The mapping is read-only.
+    return 0;
+}
+
+static ZPOS64_T ZCALLBACK MappedTellFileFunc(voidpf opaque, voidpf stream)
+{
+    Q_UNUSED(opaque);
+    return static_cast<MappedArchive *>(stream)->pos;
+}
+
+static long ZCALLBACK MappedSeekFileFunc(voidpf opaque, voidpf stream, ZPOS64_T offset, int origin)
+{
+    Q_UNUSED(opaque);
+    MappedArchive *archive = static_cast<MappedArchive *>(stream);
+    ZPOS64_T newpos = 0;
+    switch (origin) {
+        case ZLIB_FILEFUNC_SEEK_SET:
+            newpos = offset;
+            break;
+        case ZLIB_FILEFUNC_SEEK_CUR:
+            newpos = archive->pos + offset;
+            break;
+        case ZLIB_FILEFUNC_SEEK_END:
+            newpos = archive->size + offset;
+            break;
+        default:
+            return -1;
+    }
+    if (newpos > archive->size) {
+        return -1;
+    }
+    archive->pos = newpos;
+    return 0;
+}
+
+static int ZCALLBACK MappedCloseFileFunc(voidpf opaque, voidpf stream)
+{
+    Q_UNUSED(opaque);
+    Q_UNUSED(stream);
+    // The QFile owning the mapping is closed by the caller.
+    return 0;
+}
+
+static int ZCALLBACK MappedErrorFileFunc(voidpf opaque, voidpf stream)
+{
+    Q_UNUSED(opaque);
+    Q_UNUSED(stream);
+    return 0;
+}
+
+static void FillMappedFileFunc(zlib_filefunc64_def *pzlib_filefunc_def, MappedArchive *archive)
+{
+    pzlib_filefunc_def->zopen64_file = MappedOpenFileFunc;
+    pzlib_filefunc_def->zread_file   = MappedReadFileFunc;
+    pzlib_filefunc_def->zwrite_file  = MappedWriteFileFunc;
+    pzlib_filefunc_def->ztell64_file = MappedTellFileFunc;
+    pzlib_filefunc_def->zseek64_file = MappedSeekFileFunc;
+    pzlib_filefunc_def->zclose_file  = MappedCloseFileFunc;
+    pzlib_filefunc_def->zerror_file  = MappedErrorFileFunc;
+    pzlib_filefunc_def->opaque       = archive;
+}
+
+// One zip entry to be inflated to the temp folder, recorded while
+// walking the central directory on the calling thread.
+struct ZipEntryJob {
+    QString         entry_name;      // zip local name, for error messages
+    QString         file_path;      // destination in the temp folder
+    QString         cp437_file_path; // extra cp437 destination, or empty
+    unz64_file_pos  zip_pos;        // directory position of the entry
+};
+
+// Inflates a single entry on a pool thread.  Zip entries are
+// independently compressed, so each worker opens its own unzFile over
+// the shared mapping (an O(1) operation - only the end-of-directory
+// record is located) and seeks straight to its entry.  Returns an
+// error message, or an empty string on success.
+static QString ExtractOneZipEntry(const ZipEntryJob &job, const unsigned char *mapping,
+                                  ZPOS64_T mapping_size, const QString &archive_path)
+{
+    MappedArchive archive;
+    unzFile zfile = NULL;
+
+    if (mapping) {
+        archive.data = mapping;
+        archive.size = mapping_size;
+        archive.pos  = 0;
+        zlib_filefunc64_def mfunc;
+        FillMappedFileFunc(&mfunc, &archive);
+        zfile = unzOpen2_64("", &mfunc);
+    } else {
+#ifdef Q_OS_WIN32
+        zlib_filefunc64_def ffunc;
+        fill_win32_filefunc64W(&ffunc);
+        zfile = unzOpen2_64(Utility::QStringToStdWString(QDir::toNativeSeparators(archive_path)).c_str(), &ffunc);
+#else
+        zfile = unzOpen64(QDir::toNativeSeparators(archive_path).toUtf8().constData());
+#endif
+    }
+
+    if (zfile == NULL) {
+        return QString(QObject::tr("Cannot extract file: %1")).arg(job.entry_name);
+    }
+
+    unz64_file_pos zip_pos = job.zip_pos;
+
+    if ((unzGoToFilePos64(zfile, &zip_pos) != UNZ_OK) ||
+        (unzOpenCurrentFile(zfile) != UNZ_OK)) {
+        unzClose(zfile);
+        return QString(QObject::tr("Cannot extract file: %1")).arg(job.entry_name);
+    }
+
+    QFile entry(job.file_path);
+
+    if (!entry.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        unzCloseCurrentFile(zfile);
+        unzClose(zfile);
+        return QString(QObject::tr("Cannot extract file: %1")).arg(job.entry_name);
+    }
+
+    // Buffered reading and writing.
+    char buff[BUFF_SIZE] = {0};
+    int read = 0;
+
+    while ((read = unzReadCurrentFile(zfile, buff, BUFF_SIZE)) > 0) {
+        entry.write(buff, read);
+    }
+
+    entry.close();
+
+    // Read errors are marked by a negative read amount.
+    // The file was read but the CRC did not match.
+    // We don't check the read file size vs the uncompressed file size
+    // because if they're different there should be a CRC error.
+    if ((read < 0) || (unzCloseCurrentFile(zfile) == UNZ_CRCERROR)) {
+        unzClose(zfile);
+        return QString(QObject::tr("Cannot extract file: %1")).arg(job.entry_name);
+    }
+
+    unzClose(zfile);
+
+    if (!job.cp437_file_path.isEmpty()) {
+        QFile::copy(job.file_path, job.cp437_file_path);
+    }
+    return QString();
+}
+
+// Inflates a single entry of an open archive into memory.  Returns an
+// empty array when the entry is missing or cannot be read.
+static QByteArray ReadZipEntry(unzFile zfile, const QString &entry_path)
+{
+    if (unzLocateFile(zfile, entry_path.toUtf8().constData(), 1) != UNZ_OK) {
+        return QByteArray();
+    }
+
+    unz_file_info64 file_info;
+
+    if (unzGetCurrentFileInfo64(zfile, &file_info, NULL, 0, NULL, 0, NULL, 0) != UNZ_OK) {
+        return QByteArray();
+    }
+
+    if (unzOpenCurrentFile(zfile) != UNZ_OK) {
+        return QByteArray();
+    }
+
+    QByteArray data;
+    data.reserve(file_info.uncompressed_size);
+    char buff[BUFF_SIZE] = {0};
+    int read = 0;
+
+    while ((read = unzReadCurrentFile(zfile, buff, BUFF_SIZE)) > 0) {
+        data.append(buff, read);
+    }
+
+    unzCloseCurrentFile(zfile);
+
+    if (read < 0) {
+        return QByteArray();
+    }
+    return data;
+}
+
+
+// Loads the text of one html resource from the extracted folder and
+// checks it for well-formedness on a pool thread; SetText defers the
+// document updates to the GUI thread so this is safe off it.  Returns
+// 1 when the resource needs mending, 0 otherwise.
+static int LoadAndCheckOneHTMLResource(HTMLResource *hresource, bool clean_on_open)
+{
+    // Load the content into the HTMLResource so we can perform a well formed check.
+    try {
+        hresource->SetText(HTMLEncodingResolver::ReadHTMLFile(hresource->GetFullPath()));
+    } catch (...) {
+        return clean_on_open ? 1 : 0;
+    }
+
+    if (!clean_on_open) {
+        return 0;
+    }
+
+    if (!XhtmlDoc::IsDataWellFormed(hresource->GetText(), hresource->GetEpubVersion())) {
+        return 1;
+    }
+
+    QString txt = hresource->GetText();
+    // had cases of large files with no line breaks
+    if (txt.size() > 307200) {
+        int lines = 0;
+        QChar *uc = txt.data();
+        QChar *e = uc + txt.size();
+        for (; uc != e; ++uc) {
+            if (uc->unicode() == 0x000A) lines++;
+        }
+        if (lines < 5) return 1;
+    }
+    return 0;
+}
+
+
 // Constructor;
 // The parameter is the file to be imported
 ImportEPUB::ImportEPUB(const QString &fullfilepath)
@@ -160,38 +419,36 @@ QSharedPointer<Book> ImportEPUB::GetBook(bool extract_metadata)
     // If we have non-well formed content and they shouldn't be auto fixed we'll pass that on to
     // the universal update function so it knows to skip them. Otherwise we won't include them and
     // let it modify the file.
+    QList<HTMLResource *> html_resources;
     for (int i=0; i<resources.count(); ++i) {
         if (resources.at(i)->Type() == Resource::HTMLResourceType) {
             HTMLResource *hresource = qobject_cast<HTMLResource *>(resources.at(i));
             if (!hresource) {
                 continue;
             }
-            // Load the content into the HTMLResource so we can perform a well formed check.
-            try {
-                hresource->SetText(HTMLEncodingResolver::ReadHTMLFile(hresource->GetFullPath()));
-            } catch (...) {
-                if (ss.cleanOn() & CLEANON_OPEN) {
-                    non_well_formed << hresource;
-                    continue;
-                }
-            }
-            if (ss.cleanOn() & CLEANON_OPEN) {
-                if (!XhtmlDoc::IsDataWellFormed(hresource->GetText(),hresource->GetEpubVersion())) {
-                    non_well_formed << hresource;
-                } else {
-                    QString txt = hresource->GetText();
-                    // had cases of large files with no line breaks
-                    if (txt.size() > 307200) {
-                        int lines = 0;
-                        QChar *uc = txt.data();
-                        QChar *e = uc + txt.size();
-                        for (; uc != e; ++uc) {
-                            if (uc->unicode() == 0x000A) lines++;
-                        }
-                        if (lines < 5) non_well_formed << hresource;
-                    }
-                }
-            }
+            html_resources << hresource;
+        }
+    }
+
+    // Classify the book for large-book mode before any of the optional
+    // work; the text byte total comes from the already extracted files.
+    qint64 total_text_bytes = 0;
+    foreach(HTMLResource *hresource, html_resources) {
+        total_text_bytes += QFileInfo(hresource->GetFullPath()).size();
+    }
+    LargeBookPolicy::instance()->Evaluate(resources.count(), total_text_bytes);
+
+    // The loads and well formed checks are all independent, so run
+    // them on the thread pool; on large books this stage used to hold
+    // the window back by several seconds of serial parsing.
+    bool clean_on_open = (ss.cleanOn() & CLEANON_OPEN) &&
+                         !LargeBookPolicy::instance()->SkipWellFormedCheckOnOpen();
+    QList<int> check_results = FutureWaiter::Results(QtConcurrent::mapped(html_resources,
+                               std::bind(LoadAndCheckOneHTMLResource, std::placeholders::_1, clean_on_open)));
+
+    for (int i=0; i<html_resources.count(); ++i) {
+        if (check_results.at(i)) {
+            non_well_formed << html_resources.at(i);
         }
     }
     if (!non_well_formed.isEmpty()) {
@@ -275,6 +532,114 @@ QSharedPointer<Book> ImportEPUB::GetBook(bool extract_metadata)
 }
 
 
+ImportEPUB::PreScanReport ImportEPUB::PreScan(const QString &fullfilepath)
+{
+    PreScanReport report;
+    report.valid = false;
+    report.file_count = 0;
+    report.compressed_size = 0;
+    report.uncompressed_size = 0;
+
+    // Open the archive the same way ExtractContainer does, preferring
+    // the memory mapping.
+    QFile archive_file(fullfilepath);
+    MappedArchive mapped_archive;
+    unzFile zfile = NULL;
+
+    if (archive_file.open(QIODevice::ReadOnly) && (archive_file.size() > 0)) {
+        uchar *mapping = archive_file.map(0, archive_file.size());
+        if (mapping) {
+            mapped_archive.data = mapping;
+            mapped_archive.size = archive_file.size();
+            mapped_archive.pos  = 0;
+            zlib_filefunc64_def mfunc;
+            FillMappedFileFunc(&mfunc, &mapped_archive);
+            zfile = unzOpen2_64("", &mfunc);
+        }
+    }
+
+    if (zfile == NULL) {
+#ifdef Q_OS_WIN32
+        zlib_filefunc64_def ffunc;
+        fill_win32_filefunc64W(&ffunc);
+        zfile = unzOpen2_64(Utility::QStringToStdWString(QDir::toNativeSeparators(fullfilepath)).c_str(), &ffunc);
+#else
+        zfile = unzOpen64(QDir::toNativeSeparators(fullfilepath).toUtf8().constData());
+#endif
+    }
+
+    if (zfile == NULL) {
+        return report;
+    }
+
+    // Tally the entries straight from the central directory records.
+    int res = unzGoToFirstFile(zfile);
+
+    while (res == UNZ_OK) {
+        char file_name[MAX_PATH] = {0};
+        unz_file_info64 file_info;
+
+        if (unzGetCurrentFileInfo64(zfile, &file_info, file_name, MAX_PATH, NULL, 0, NULL, 0) == UNZ_OK) {
+            QString qfile_name = QString::fromUtf8(file_name);
+
+            if (!qfile_name.isEmpty() && !qfile_name.endsWith('/')) {
+                report.file_count++;
+                report.compressed_size += file_info.compressed_size;
+                report.uncompressed_size += file_info.uncompressed_size;
+            }
+        }
+
+        res = unzGoToNextFile(zfile);
+    }
+
+    // Locate the OPF through container.xml; these are the only two
+    // entries actually inflated, and only into memory.
+    QXmlStreamReader container(ReadZipEntry(zfile, "META-INF/container.xml"));
+
+    while (!container.atEnd()) {
+        container.readNext();
+
+        if (container.isStartElement() && container.name() == "rootfile") {
+            if (container.attributes().value("", "media-type") == OEBPS_MIMETYPE) {
+                report.opf_bookpath = container.attributes().value("", "full-path").toString();
+                break;
+            }
+        }
+    }
+
+    if (report.opf_bookpath.isEmpty()) {
+        unzClose(zfile);
+        return report;
+    }
+
+    QByteArray opf_data = ReadZipEntry(zfile, report.opf_bookpath);
+    unzClose(zfile);
+
+    if (opf_data.isEmpty()) {
+        return report;
+    }
+
+    QXmlStreamReader opf_reader(opf_data);
+
+    while (!opf_reader.atEnd()) {
+        opf_reader.readNext();
+
+        if (!opf_reader.isStartElement()) {
+            continue;
+        }
+
+        if (opf_reader.name() == "package") {
+            report.package_version = opf_reader.attributes().value("", "version").toString();
+        } else if (opf_reader.name() == "item") {
+            report.mediatype_counts[ opf_reader.attributes().value("", "media-type").toString() ]++;
+        }
+    }
+
+    report.valid = !opf_reader.hasError();
+    return report;
+}
+
+
 QHash<QString, QString> ImportEPUB::ParseEncryptionXml()
 {
     QString encrpytion_xml_path = m_ExtractedFolderPath + "/META-INF/encryption.xml";
@@ -386,6 +751,7 @@ void ImportEPUB::ProcessFontFiles(const QList<Resource *> &resources,
         return;
     }
 
+    QList<FontObfuscation::ObfuscationJob> jobs;
     foreach(FontResource * font_resource, font_resources) {
         QString match_path = font_resource->GetRelativePath();
         QString algorithm  = encrypted_files.value(match_path);
@@ -399,12 +765,13 @@ void ImportEPUB::ProcessFontFiles(const QList<Resource *> &resources,
         // Actually we are de-obfuscating, but the inverse operations of the obfuscation methods
         // are the obfuscation methods themselves. For the math oriented, the obfuscation methods
         // are involutary [ f( f( x ) ) = x ].
-        if (algorithm == ADOBE_FONT_ALGO_ID) {
-            FontObfuscation::ObfuscateFile(font_resource->GetFullPath(), algorithm, m_UuidIdentifierValue);
-        } else {
-            FontObfuscation::ObfuscateFile(font_resource->GetFullPath(), algorithm, m_UniqueIdentifierValue);
-        }
+        FontObfuscation::ObfuscationJob job;
+        job.filepath = font_resource->GetFullPath();
+        job.algorithm = algorithm;
+        job.identifier = (algorithm == ADOBE_FONT_ALGO_ID) ? m_UuidIdentifierValue : m_UniqueIdentifierValue;
+        jobs.append(job);
     }
+    FontObfuscation::ObfuscateFiles(jobs);
 }
 
 void ImportEPUB::ExtractContainer()
@@ -413,13 +780,37 @@ void ImportEPUB::ExtractContainer()
     if (!cp437) {
         cp437 = new QCodePage437Codec();
     }
+
+    // Map the epub read-only and hand minizip io routines that read
+    // straight from the mapping; the QFile must outlive the unzFiles.
+    QFile archive_file(m_FullFilePath);
+    MappedArchive mapped_archive;
+    uchar *mapping = NULL;
+    unzFile zfile = NULL;
+
+    if (archive_file.open(QIODevice::ReadOnly) && (archive_file.size() > 0)) {
+        mapping = archive_file.map(0, archive_file.size());
+        if (mapping) {
+            mapped_archive.data = mapping;
+            mapped_archive.size = archive_file.size();
+            mapped_archive.pos  = 0;
+            zlib_filefunc64_def mfunc;
+            FillMappedFileFunc(&mfunc, &mapped_archive);
+            zfile = unzOpen2_64("", &mfunc);
+        }
+    }
+
+    if (zfile == NULL) {
+        // Mapping failed (or produced an unreadable archive) - fall
+        // back to minizip's own buffered file io.
 #ifdef Q_OS_WIN32
-    zlib_filefunc64_def ffunc;
-    fill_win32_filefunc64W(&ffunc);
-    unzFile zfile = unzOpen2_64(Utility::QStringToStdWString(QDir::toNativeSeparators(m_FullFilePath)).c_str(), &ffunc);
+        zlib_filefunc64_def ffunc;
+        fill_win32_filefunc64W(&ffunc);
+        zfile = unzOpen2_64(Utility::QStringToStdWString(QDir::toNativeSeparators(m_FullFilePath)).c_str(), &ffunc);
 #else
-    unzFile zfile = unzOpen64(QDir::toNativeSeparators(m_FullFilePath).toUtf8().constData());
+        zfile = unzOpen64(QDir::toNativeSeparators(m_FullFilePath).toUtf8().constData());
 #endif
+    }
 
     if (zfile == NULL) {
         throw (EPUBLoadParseError(QString(QObject::tr("Cannot unzip EPUB: %1")).arg(QDir::toNativeSeparators(m_FullFilePath)).toStdString()));
@@ -427,6 +818,10 @@ void ImportEPUB::ExtractContainer()
 
     res = unzGoToFirstFile(zfile);
 
+    // Walk the central directory once to validate and record the
+    // entries; the actual inflating happens in parallel afterwards.
+    QList<ZipEntryJob> jobs;
+
     if (res == UNZ_OK) {
         do {
             // Get the name of the file in the archive.
@@ -502,49 +897,21 @@ void ImportEPUB::ExtractContainer()
                     }
                 }
 
-                // Open the file entry in the archive for reading.
-                if (unzOpenCurrentFile(zfile) != UNZ_OK) {
-                    unzClose(zfile);
-                    throw (EPUBLoadParseError(QString(QObject::tr("Cannot extract file: %1")).arg(qfile_name).toStdString()));
-                }
-
-                // Open the file on disk to write the entry in the archive to.
-                QFile entry(file_path);
-
-                if (!entry.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
-                    unzCloseCurrentFile(zfile);
-                    unzClose(zfile);
-                    throw (EPUBLoadParseError(QString(QObject::tr("Cannot extract file: %1")).arg(qfile_name).toStdString()));
-                }
-
-                // Buffered reading and writing.
-                char buff[BUFF_SIZE] = {0};
-                int read = 0;
+                // Record the entry for the parallel inflate stage.
+                ZipEntryJob job;
+                job.entry_name = qfile_name;
+                job.file_path = file_path;
 
-                while ((read = unzReadCurrentFile(zfile, buff, BUFF_SIZE)) > 0) {
-                    entry.write(buff, read);
+                if (!cp437_file_name.isEmpty() && cp437_file_name != qfile_name) {
+                    job.cp437_file_path = m_ExtractedFolderPath + "/" + cp437_file_name;
                 }
 
-                entry.close();
-
-                // Read errors are marked by a negative read amount.
-                if (read < 0) {
-                    unzCloseCurrentFile(zfile);
+                if (unzGetFilePos64(zfile, &job.zip_pos) != UNZ_OK) {
                     unzClose(zfile);
                     throw (EPUBLoadParseError(QString(QObject::tr("Cannot extract file: %1")).arg(qfile_name).toStdString()));
                 }
 
-                // The file was read but the CRC did not match.
-                // We don't check the read file size vs the uncompressed file size
-                // because if they're different there should be a CRC error.
-                if (unzCloseCurrentFile(zfile) == UNZ_CRCERROR) {
-                    unzClose(zfile);
-                    throw (EPUBLoadParseError(QString(QObject::tr("Cannot extract file: %1")).arg(qfile_name).toStdString()));
-                }
-                if (!cp437_file_name.isEmpty() && cp437_file_name != qfile_name) {
-                    QString cp437_file_path = m_ExtractedFolderPath + "/" + cp437_file_name;
-                    QFile::copy(file_path, cp437_file_path);
-                }
+                jobs.append(job);
             }
         } while ((res = unzGoToNextFile(zfile)) == UNZ_OK);
     }
@@ -555,6 +922,23 @@ void ImportEPUB::ExtractContainer()
     }
 
     unzClose(zfile);
+
+    // Each entry is independently compressed, so inflate them on the
+    // thread pool; on image-heavy epubs extraction is almost pure
+    // single-threaded zlib otherwise.  Each worker opens its own
+    // unzFile over the shared mapping and seeks straight to its entry.
+    QList<QString> errors = FutureWaiter::Results(QtConcurrent::mapped(jobs,
+                            std::bind(ExtractOneZipEntry,
+                                      std::placeholders::_1,
+                                      static_cast<const unsigned char *>(mapping),
+                                      static_cast<ZPOS64_T>(archive_file.size()),
+                                      m_FullFilePath)));
+
+    foreach(const QString &error, errors) {
+        if (!error.isEmpty()) {
+            throw (EPUBLoadParseError(error.toStdString()));
+        }
+    }
 }
 
 void ImportEPUB::LocateOPF()
@@ -948,19 +1332,21 @@ bool ImportEPUB::LoadFolderStructure()
     int num_files = keys.count();
     bool success = true;
 
-    QFutureSynchronizer<std::tuple<QString, QString>> sync;
+    QList<QFuture<std::tuple<QString, QString>>> futures;
+    QList<QFuture<void>> pending;
 
     for (int i = 0; i < num_files; ++i) {
         QString id = keys.at(i);
-        sync.addFuture(QtConcurrent::run(
-                           this,
-                           &ImportEPUB::LoadOneFile,
-                           m_Files.value(id),
-                           m_FileMimetypes.value(id)));
+        QFuture<std::tuple<QString, QString>> future = QtConcurrent::run(
+                    this,
+                    &ImportEPUB::LoadOneFile,
+                    m_Files.value(id),
+                    m_FileMimetypes.value(id));
+        futures.append(future);
+        pending.append(future);
     }
 
-    sync.waitForFinished();
-    QList<QFuture<std::tuple<QString, QString>>> futures = sync.futures();
+    FutureWaiter::Wait(pending);
     int num_futures = futures.count();
 
     for (int i = 0; i < num_futures; ++i) {
@@ -42,6 +42,22 @@ class ImportEPUB : public Importer
     Q_DECLARE_TR_FUNCTIONS(ImportEPUB)
 
 public:
+
+    /**
+     * A cheap summary of an epub built from its zip central directory
+     * and OPF only; nothing else is inflated or extracted.
+     */
+    struct PreScanReport {
+        bool valid;
+        int file_count;
+        qint64 compressed_size;
+        qint64 uncompressed_size;
+        QString opf_bookpath;
+        QString package_version;
+        // media-type attribute -> number of manifest items carrying it
+        QHash<QString, int> mediatype_counts;
+    };
+
     // The parameter is the file to be imported
     ImportEPUB(const QString &fullfilepath);
 
@@ -49,6 +65,14 @@ public:
     // and returns the created Book
     virtual QSharedPointer<Book> GetBook(bool extract_metaata=true);
 
+    /**
+     * Builds a PreScanReport for the epub at fullfilepath in
+     * milliseconds, without extracting it.  Only the central
+     * directory is walked and only container.xml and the OPF are
+     * inflated, in memory.
+     */
+    static PreScanReport PreScan(const QString &fullfilepath);
+
 private:
     /**
      * Extracts the EPUB file to a temporary folder.
@@ -95,7 +95,7 @@ QSharedPointer<Book> ImportTXT::GetBook(bool extract_metadata)
 QString ImportTXT::LoadSource() const
 {
     QString source = Utility::ReadUnicodeTextFile(m_FullFilePath);
-    source = CreateParagraphs(source.split(QChar('\n')));
+    source = CreateParagraphs(source);
     return CleanSource::Mend(source, m_EpubVersion);
 }
 
@@ -116,25 +116,40 @@ void ImportTXT::InitializeHTMLResource(const QString &source, HTMLResource *reso
 }
 
 
-// Accepts a list of text lines and returns
-// a string with paragraphs wrapped into <p> tags
-QString ImportTXT::CreateParagraphs(const QStringList &lines) const
+// Accepts the raw text source and returns
+// a string with paragraphs wrapped into <p> tags.
+// The lines are walked in place instead of split into a QStringList
+// first, and the output buffer is presized, so importing a large text
+// dump needs one working copy of the text rather than three.
+QString ImportTXT::CreateParagraphs(const QString &source) const
 {
     QString text = "";
+    // The markup added per paragraph is small, so the source length
+    // plus some headroom is a good estimate of the final size.
+    text.reserve(source.length() + (source.length() / 8) + 16);
     QString paragraph = "<p>";
-    int num_lines = lines.count();
+    int pos = 0;
+    int length = source.length();
 
-    for (int i = 0; i < num_lines; ++i) {
-        QString line = lines.at(i);
+    while (pos <= length) {
+        int line_end = source.indexOf(QChar('\n'), pos);
 
-        if (line.isEmpty() || line[ 0 ].isSpace()) {
+        if (line_end == -1) {
+            line_end = length;
+        }
+
+        QStringRef line = source.midRef(pos, line_end - pos);
+
+        if (line.isEmpty() || line.at(0).isSpace()) {
             text.append(paragraph.append("</p>\n"));
             paragraph = "<p>";
         }
 
         // We prepend a space so words on
         // line breaks don't get merged
-        paragraph.append(QString(line.prepend(" ")).toHtmlEscaped());
+        paragraph.append(QChar(' '));
+        paragraph.append(line.toString().toHtmlEscaped());
+        pos = line_end + 1;
     }
 
     text.append(paragraph.append("</p>\n"));
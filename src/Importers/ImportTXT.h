@@ -50,9 +50,9 @@ private:
 
     void InitializeHTMLResource(const QString &source, HTMLResource *resource);
 
-    // Accepts a list of text lines and returns
+    // Accepts the raw text source and returns
     // a string with paragraphs wrapped into <p> tags
-    QString CreateParagraphs(const QStringList &lines) const;
+    QString CreateParagraphs(const QString &source) const;
 
     QString m_EpubVersion;
 };
@@ -84,4 +84,10 @@ Importer *ImporterFactory::GetImporter(const QString &filename)
 }
 
 
+ImportEPUB::PreScanReport ImporterFactory::PreScanEpub(const QString &filename)
+{
+    return ImportEPUB::PreScan(filename);
+}
+
+
 
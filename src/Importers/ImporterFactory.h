@@ -24,6 +24,7 @@
 #define IMPORTERFACTORY_H
 
 #include "Importers/Importer.h"
+#include "Importers/ImportEPUB.h"
 
 class ImporterFactory
 {
@@ -40,6 +41,10 @@ public:
     // for the given filename
     Importer *GetImporter(const QString &filename);
 
+    // Summarizes an epub (file counts, sizes, media types) from its
+    // central directory and OPF only, without committing to an import
+    static ImportEPUB::PreScanReport PreScanEpub(const QString &filename);
+
 private:
 
     Importer *m_importer_html;
@@ -157,6 +157,14 @@ void BookBrowser::Refresh()
 }
 
 
+void BookBrowser::RefreshAdded(Resource *resource)
+{
+    m_OPFModel->AddResource(resource);
+    RefreshCounts();
+    emit UpdateBrowserSelection();
+}
+
+
 void BookBrowser::SelectAll()
 {
     QList<Resource *> resources = m_OPFModel->GetResourceListInFolder(m_LastContextMenuType);
@@ -513,7 +521,7 @@ Resource* BookBrowser::AddFile(QString filepath)
 {
     Resource * resource = m_Book->GetFolderKeeper()->AddContentFileToFolder(filepath);
     emit BookContentModified();
-    Refresh();
+    RefreshAdded(resource);
     return resource;
 }
 
@@ -552,7 +560,7 @@ void BookBrowser::CopyHTML()
     // Open the new file in a tab
     emit ResourceActivated(new_html_resource);
     emit BookContentModified();
-    Refresh();
+    RefreshAdded(new_html_resource);
 }
 
 
@@ -574,7 +582,7 @@ void BookBrowser::AddNewHTML()
     // Open the new file in a tab
     emit ResourceActivated(new_html_resource);
     emit BookContentModified();
-    Refresh();
+    RefreshAdded(new_html_resource);
 }
 
 void BookBrowser::CopyCSS()
@@ -595,7 +603,7 @@ void BookBrowser::CopyCSS()
     // Open the new file in a tab
     emit ResourceActivated(new_resource);
     emit BookContentModified();
-    Refresh();
+    RefreshAdded(new_resource);
 }
 
 void BookBrowser::AddNewCSS()
@@ -604,7 +612,7 @@ void BookBrowser::AddNewCSS()
     // Open the new file in a tab
     emit ResourceActivated(new_resource);
     emit BookContentModified();
-    Refresh();
+    RefreshAdded(new_resource);
 }
 
 void BookBrowser::AddNewJS()
@@ -622,7 +630,7 @@ void BookBrowser::AddNewJS()
     // Open the new file in a tab
     emit ResourceActivated(new_resource);
     emit BookContentModified();
-    Refresh();
+    RefreshAdded(new_resource);
 }
 
 void BookBrowser::AddNewSVG()
@@ -631,7 +639,7 @@ void BookBrowser::AddNewSVG()
     // Open the new file in a tab
     emit ResourceActivated(new_resource);
     emit BookContentModified();
-    Refresh();
+    RefreshAdded(new_resource);
 }
 
 CSSResource* BookBrowser::CreateHTMLTOCCSSFile()
@@ -702,6 +710,10 @@ QStringList BookBrowser::AddExisting(bool only_multimedia, bool only_images)
     }
     bool yes_to_all = false;
     bool no_to_all = false;
+    // Batch the OPF manifest updates for the whole add, otherwise every
+    // single file pays for a full OPF rewrite and adding many files
+    // at once becomes quadratic.
+    m_Book->GetFolderKeeper()->SuspendOPFUpdates();
     foreach(QString filepath, filepaths) {
         if (file_count > 1) {
             // Set progress value and ensure dialog has time to display when doing extensive updates
@@ -794,6 +806,9 @@ QStringList BookBrowser::AddExisting(bool only_multimedia, bool only_images)
                 continue;
             }
 
+            // the import and the spine reorder below read the OPF, so
+            // flush any queued additions first
+            m_Book->GetFolderKeeper()->ResumeOPFUpdates();
             html_import.SetBook(m_Book, true);
             // Since we set the Book manually,
             // this call merely mutates our Book.
@@ -815,6 +830,7 @@ QStringList BookBrowser::AddExisting(bool only_multimedia, bool only_images)
                     open_resource = added_resource;
                 }
             }
+            m_Book->GetFolderKeeper()->SuspendOPFUpdates();
         } else {
             Resource *resource = m_Book->GetFolderKeeper()->AddContentFileToFolder(filepath);
             added_book_paths << resource->GetRelativePath();
@@ -822,7 +838,11 @@ QStringList BookBrowser::AddExisting(bool only_multimedia, bool only_images)
             if (CoverImageSemanticsSet) {
                 ImageResource* new_image_resource = qobject_cast<ImageResource *>(resource);
                 if (new_image_resource) {
+                    // setting the cover semantics needs the manifest entry
+                    // for this image, so flush the queued additions
+                    m_Book->GetFolderKeeper()->ResumeOPFUpdates();
                     m_Book->GetOPF()->SetResourceAsCoverImage(new_image_resource);
+                    m_Book->GetFolderKeeper()->SuspendOPFUpdates();
                 }
             }
             // TODO: adding a CSS file should add the referenced fonts too
@@ -833,6 +853,7 @@ QStringList BookBrowser::AddExisting(bool only_multimedia, bool only_images)
         }
 
     }
+    m_Book->GetFolderKeeper()->ResumeOPFUpdates();
     // turn off the QProgress Dialog by setting it as reaching its target
     progress.setValue(file_count);
 
@@ -1476,10 +1497,9 @@ void BookBrowser::RemoveResources(QList<Resource *> tab_resources, QList<Resourc
         emit ResourceActivated(next_resource);
     }
 
-    // Delete the resources
-    foreach(Resource * resource, resources) {
-        resource->Delete();
-    }
+    // Delete the resources in one batch, so the OPF manifest and spine
+    // are parsed and rewritten once instead of once per deleted file.
+    m_Book->GetFolderKeeper()->BulkRemoveResources(resources);
     emit ResourcesDeleted();
     emit BookContentModified();
     // Avoid full refresh so selection stays for non-openable resources
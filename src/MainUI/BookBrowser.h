@@ -156,6 +156,15 @@ public slots:
      */
     void Refresh();
 
+    /**
+     * Refreshes the display after a single resource was added.
+     * Inserts just the new resource into the model instead of
+     * rebuilding it from scratch.
+     *
+     * @param resource The resource that was added to the book.
+     */
+    void RefreshAdded(Resource *resource);
+
     /**
       * Refreshes the TOC file to renumber entries
       */
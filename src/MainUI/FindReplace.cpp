@@ -33,6 +33,7 @@
 #include "MainUI/FindReplace.h"
 #include "Misc/SettingsStore.h"
 #include "Misc/FindReplaceQLineEdit.h"
+#include "Misc/Tracer.h"
 #include "PCRE/PCREErrors.h"
 #include "ResourceObjects/Resource.h"
 #include "ResourceObjects/TextResource.h"
@@ -308,6 +309,13 @@ void FindReplace::CountClicked()
     ResetKeyModifiers();
 }
 
+void FindReplace::FindAllClicked()
+{
+    SetKeyModifiers();
+    FindAll();
+    ResetKeyModifiers();
+}
+
 bool FindReplace::FindAnyText(QString text, bool escape)
 {
     SetCodeViewIfNeeded(true);
@@ -393,6 +401,7 @@ bool FindReplace::FindPrevious()
 // term in the document.
 int FindReplace::Count()
 {
+    SIGIL_TRACE_SCOPE("FindReplace::Count");
     clearMessage();
 
     if (IsNewSearch()) {
@@ -439,6 +448,47 @@ int FindReplace::Count()
 }
 
 
+void FindReplace::FindAll()
+{
+    clearMessage();
+
+    if (IsNewSearch()) {
+        SetFirstResource(true);
+        SetPreviousSearch();
+    }
+
+    if (!IsValidFindText()) {
+        return;
+    }
+
+    // the spellcheck filter is a word filter, not a regex, so it
+    // cannot be listed - fall back to the plain count
+    if (m_SpellCheck) {
+        Count();
+        return;
+    }
+
+    SetCodeViewIfNeeded(true);
+    m_MainWindow->GetCurrentContentTab()->SaveTabContent();
+    QList<Resource *> resources;
+
+    if (isWhereCF() || m_LookWhereCurrentFile || IsMarkedText()) {
+        Resource *current_resource = GetCurrentResource();
+
+        if (!current_resource) {
+            return;
+        }
+
+        resources.append(current_resource);
+    } else {
+        resources = GetFilesToSearch();
+    }
+
+    UpdatePreviousFindStrings();
+    emit FindAllRequest(GetSearchRegex(), resources);
+}
+
+
 bool FindReplace::Replace()
 {
     if (IsNewSearch()) {
@@ -861,6 +911,7 @@ QList <Resource *> FindReplace::GetFilesToSearch()
 
 int FindReplace::CountInFiles()
 {
+    SIGIL_TRACE_SCOPE("FindReplace::CountInFiles");
     m_MainWindow->GetCurrentContentTab()->SaveTabContent();
 
     // When not wrapping remove the current resource as it's counted separately
@@ -1542,9 +1593,24 @@ void FindReplace::CountAllSearch()
     SetKeyModifiers();
     m_IsSearchGroupRunning = true;
     int count = 0;
-    foreach(SearchEditorModel::searchEntry * search_entry, search_entries) {
-        LoadSearch(search_entry);
-        count += Count();
+
+    if (!isWhereCF() && !m_LookWhereCurrentFile && !IsMarkedText() && m_OptionWrap) {
+        // Book-wide group counts are fused into one pass per file
+        // instead of one full pass over the book per pattern.
+        QStringList search_regexes;
+        foreach(SearchEditorModel::searchEntry * search_entry, search_entries) {
+            LoadSearch(search_entry);
+            if (IsValidFindText()) {
+                search_regexes.append(GetSearchRegex());
+            }
+        }
+        m_MainWindow->GetCurrentContentTab()->SaveTabContent();
+        count = SearchOperations::CountInFiles(search_regexes, GetFilesToSearch());
+    } else {
+        foreach(SearchEditorModel::searchEntry * search_entry, search_entries) {
+            LoadSearch(search_entry);
+            count += Count();
+        }
     }
     m_IsSearchGroupRunning = false;
 
@@ -1830,6 +1896,7 @@ void FindReplace::ConnectSignalsToSlots()
     connect(ui.findNext, SIGNAL(clicked()), this, SLOT(FindClicked()));
     connect(ui.cbFind->lineEdit(), SIGNAL(returnPressed()), this, SLOT(Find()));
     connect(ui.count, SIGNAL(clicked()), this, SLOT(CountClicked()));
+    connect(ui.findAll, SIGNAL(clicked()), this, SLOT(FindAllClicked()));
     connect(ui.replaceCurrent, SIGNAL(clicked()), this, SLOT(ReplaceCurrent()));
     connect(ui.replaceFind, SIGNAL(clicked()), this, SLOT(ReplaceClicked()));
     connect(ui.cbReplace->lineEdit(), SIGNAL(returnPressed()), this, SLOT(Replace()));
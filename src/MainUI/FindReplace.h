@@ -124,6 +124,12 @@ signals:
 
     void OpenSearchEditorRequest(SearchEditorModel::searchEntry *search_entry = NULL);
 
+    /**
+     * Emitted when the user wants every match of the current search
+     * listed in the Search Results pane.
+     */
+    void FindAllRequest(const QString &search_regex, QList<Resource *> resources);
+
     void ShowMessageRequest(const QString &message);
 
     /**
@@ -146,6 +152,7 @@ private slots:
 
     void FindClicked();
     void CountClicked();
+    void FindAllClicked();
     void ReplaceClicked();
     void ReplaceAllClicked();
 
@@ -159,6 +166,10 @@ private slots:
     // term in the document.
     int Count();
 
+    // Lists every match of the user's term in the
+    // Search Results pane instead of stepping match to match.
+    void FindAll();
+
     // Uses the find direction to determine if we should replace next
     // or previous.
     bool Replace();
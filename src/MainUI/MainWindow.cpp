@@ -23,6 +23,7 @@
 **
 *************************************************************************/
 
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QFileInfo>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
@@ -90,12 +91,14 @@
 #include "MainUI/MainWindow.h"
 #include "MainUI/FindReplace.h"
 #include "MainUI/PreviewWindow.h"
+#include "MainUI/SearchResultsView.h"
 #include "MainUI/TableOfContents.h"
 #include "MainUI/ValidationResultsView.h"
 #include "Misc/HTMLSpellCheck.h"
 #include "Misc/HTMLSpellCheckML.h"
 #include "Misc/KeyboardShortcutManager.h"
 #include "Misc/Landmarks.h"
+#include "Misc/LargeBookPolicy.h"
 #include "Misc/MediaTypes.h"
 #include "Misc/OpenExternally.h"
 #include "Misc/Plugin.h"
@@ -108,6 +111,7 @@
 #include "Misc/TOCHTMLWriter.h"
 #include "Misc/Utility.h"
 #include "MiscEditors/IndexHTMLWriter.h"
+#include "Parsers/GumboInterface.h"
 #include "Parsers/HTMLStyleInfo.h"
 #include "ResourceObjects/HTMLResource.h"
 #include "ResourceObjects/NCXResource.h"
@@ -130,6 +134,7 @@
 
 static const int TEXT_ELIDE_WIDTH   = 300;
 static const QString SETTINGS_GROUP = "mainwindow";
+static const QString TAB_SESSION_GROUP = "tabsession";
 const float ZOOM_STEP               = 0.1f;
 const float ZOOM_MIN                = 0.09f;
 const float ZOOM_MAX                = 5.0f;
@@ -147,6 +152,7 @@ static const QString BOOK_BROWSER_NAME            = "bookbrowser";
 static const QString FIND_REPLACE_NAME            = "findreplace";
 static const QString TAB_MANAGER_NAME             = "tabmgr";
 static const QString VALIDATION_RESULTS_VIEW_NAME = "validationresultsname";
+static const QString SEARCH_RESULTS_VIEW_NAME     = "searchresultsname";
 static const QString TABLE_OF_CONTENTS_NAME       = "tableofcontents";
 static const QString PREVIEW_WINDOW_NAME          = "previewwindow";
 static const QString CLIPS_WINDOW_NAME            = "clipswindow";
@@ -217,19 +223,24 @@ MainWindow::MainWindow(const QString &openfilepath,
     m_FindReplace(new FindReplace(this)),
     m_TableOfContents(NULL),
     m_ValidationResultsView(NULL),
+    m_SearchResultsView(NULL),
     m_PreviewWindow(NULL),
     m_slZoomSlider(NULL),
     m_lbZoomLabel(NULL),
     c_SaveFilters(GetSaveFiltersMap()),
     c_LoadFilters(GetLoadFiltersMap()),
     m_casingChangeGroup(new QActionGroup(this)),
-    m_SearchEditor(new SearchEditor(this)),
-    m_ClipEditor(new ClipEditor(this)),
-    m_IndexEditor(new IndexEditor(this)),
-    m_SpellcheckEditor(new SpellcheckEditor(this)),
-    m_SelectCharacter(new SelectCharacter(this)),
-    m_ViewImage(new ViewImage(this)),
-    m_Reports(new Reports(this)),
+    // The modeless dialogs are built lazily on first use - see the
+    // Get*() accessors - to keep the startup path light.
+    m_SearchEditor(NULL),
+    m_ClipEditor(NULL),
+    m_IndexEditor(NULL),
+    m_SpellcheckEditor(NULL),
+    m_SelectCharacter(NULL),
+    m_ViewImage(NULL),
+    m_Reports(NULL),
+    m_RepoCommitWatcher(NULL),
+    m_RepoCommitSnapshot(NULL),
     m_preserveHeadingAttributes(true),
     m_LinkOrStyleBookmark(new LocationBookmark()),
     m_ClipboardHistorySelector(new ClipboardHistorySelector(this)),
@@ -270,6 +281,14 @@ MainWindow::MainWindow(const QString &openfilepath,
     CreateRecentFilesActions();
     UpdateRecentFileActions();
     ChangeSignalsWhenTabChanges(NULL, m_TabManager->GetCurrentContentTab());
+    // When spellcheck highlighting is enabled, parse the dictionaries
+    // on a worker thread while the initial book loads so the first
+    // highlighted tab does not pay for it; when it is disabled they
+    // are only loaded if a spell query ever happens.
+    SettingsStore spell_settings;
+    if (spell_settings.spellCheck()) {
+        QtConcurrent::run(SpellCheck::instance(), &SpellCheck::ensureDictionariesLoaded);
+    }
     LoadInitialFile(openfilepath, version, is_internal);
     loadPluginsMenu();
 }
@@ -302,6 +321,7 @@ MainWindow::~MainWindow()
     if (m_lbZoomLabel) delete m_lbZoomLabel;
     if (m_slZoomSlider) delete m_slZoomSlider;
     if (m_ValidationResultsView) delete m_ValidationResultsView;
+    if (m_SearchResultsView) delete m_SearchResultsView;
     if (m_TableOfContents) delete m_TableOfContents;
     if (m_FindReplace) delete m_FindReplace;
     if (m_Clips) delete m_Clips;
@@ -413,7 +433,7 @@ bool MainWindow::Automate(const QStringList &commands)
 
         if (plugin_names.contains(cmd)) {
             PluginRunner prunner(m_TabManager, this);
-            prunner.exec(cmd);
+            prunner.exec(cmd, true);
 
             qApp->processEvents();
 
@@ -471,9 +491,10 @@ bool MainWindow::Automate(const QStringList &commands)
         // handle saved search and its full name parameter     
         } else if (cmd.startsWith("RunSavedSearchReplaceAll")) {
             QString fullname = cmd.mid(25, -1).trimmed();
-            m_SearchEditor->SetCurrentEntriesFromFullName(fullname);
+            SearchEditor *search_editor = GetSearchEditor();
+            search_editor->SetCurrentEntriesFromFullName(fullname);
 
-            if (m_SearchEditor->GetCurrentEntriesCount() > 0) {
+            if (search_editor->GetCurrentEntriesCount() > 0) {
                 // m_FindReplace handles deleting each searchEntry that was created with new
                 // Temporarily reroute FindReplace Messages to the Status Bar so they are logged
                 connect(m_FindReplace, SIGNAL(ShowMessageRequest(const QString &)),
@@ -834,6 +855,11 @@ void MainWindow::MoveContentFilesToStdFolders()
 
 bool MainWindow::RepoCommit()
 {
+    if (m_RepoCommitSnapshot) {
+        ShowMessageOnStatusBar(tr("A checkpoint is already being saved."));
+        return false;
+    }
+
     QApplication::setOverrideCursor(Qt::WaitCursor);
 
     // make sure that the Sigil-Preferences directory has a "repo" folder
@@ -872,23 +898,49 @@ bool MainWindow::RepoCommit()
     // add in the META-INF/container.xml file
     bookfiles << "META-INF/container.xml";
 
+    // snapshot the saved book into a temporary folder with plain file
+    // copies; committing reads only the snapshot, so the user can keep
+    // editing and even saving while the commit runs in the background
+    m_RepoCommitSnapshot = new TempFolder();
+    try {
+        Utility::CopyFiles(bookroot, m_RepoCommitSnapshot->GetPath());
+    } catch (CannotCopyFile&) {
+        delete m_RepoCommitSnapshot;
+        m_RepoCommitSnapshot = NULL;
+        ShowMessageOnStatusBar(tr("Checkpoint generation failed."));
+        QApplication::restoreOverrideCursor();
+        return false;
+    }
+
+    if (!m_RepoCommitWatcher) {
+        m_RepoCommitWatcher = new QFutureWatcher<QString>(this);
+        connect(m_RepoCommitWatcher, SIGNAL(finished()), this, SLOT(RepoCommitFinished()));
+    }
+
     // now perform the commit using python in a separate thread since this
     // may take a while depending on the speed of the filesystem
     PythonRoutines pr;
-    QFuture<QString> future = QtConcurrent::run(&pr, &PythonRoutines::PerformRepoCommitInPython, 
-                                                localRepo, bookid, bookinfo, bookroot, bookfiles);
-    future.waitForFinished();
-    QString commit_result = future.result();
+    QFuture<QString> future = QtConcurrent::run(pr, &PythonRoutines::PerformRepoCommitInPython,
+                                                localRepo, bookid, bookinfo,
+                                                m_RepoCommitSnapshot->GetPath(), bookfiles);
+    m_RepoCommitWatcher->setFuture(future);
+
+    QApplication::restoreOverrideCursor();
+    ShowMessageOnStatusBar(tr("Saving checkpoint..."));
+    return true;
+}
+
+void MainWindow::RepoCommitFinished()
+{
+    QString commit_result = m_RepoCommitWatcher->result();
+    delete m_RepoCommitSnapshot;
+    m_RepoCommitSnapshot = NULL;
 
     if (commit_result.isEmpty()) {
         ShowMessageOnStatusBar(tr("Checkpoint generation failed."));
-        QApplication::restoreOverrideCursor();
-        return false;
+        return;
     }
-
-    QApplication::restoreOverrideCursor();
     ShowMessageOnStatusBar(tr("Checkpoint saved."));
-    return true;
 }
 
 // handle both the current epub and the general case
@@ -1321,6 +1373,34 @@ void MainWindow::ResetLocationBookmark(MainWindow::LocationBookmark *locationBoo
     ui.actionGoBackFromLinkOrStyle->setEnabled(false);
 }
 
+void MainWindow::RebaseLocationBookmark(int position, int charsRemoved, int charsAdded)
+{
+    if (m_LinkOrStyleBookmark->bookpath.isEmpty()) {
+        return;
+    }
+
+    ContentTab *tab = GetCurrentContentTab();
+    if (tab == NULL) {
+        return;
+    }
+    if (tab->GetLoadedResource()->GetRelativePath() != m_LinkOrStyleBookmark->bookpath) {
+        return;
+    }
+
+    int pos = m_LinkOrStyleBookmark->cv_cursor_position;
+    if (position >= pos) {
+        // edit is entirely after the bookmark
+        return;
+    }
+    if (position + charsRemoved <= pos) {
+        // edit is entirely before the bookmark - shift by the delta
+        m_LinkOrStyleBookmark->cv_cursor_position = pos + charsAdded - charsRemoved;
+    } else {
+        // the edit swallowed the bookmarked spot - snap to the edit start
+        m_LinkOrStyleBookmark->cv_cursor_position = position;
+    }
+}
+
 void MainWindow::GoBackFromLinkOrStyle()
 {
     GoToBookmark(m_LinkOrStyleBookmark);
@@ -1606,6 +1686,9 @@ void MainWindow::closeEvent(QCloseEvent *event)
     // extra saves should not be an issue if the window close is abandoned
     WriteSettings();
 
+    // remember the open tabs so reopening this epub can restore them
+    SaveTabSession();
+
     if (MaybeSaveDialogSaysProceed()) {
 
         DBG qDebug() << "in close event after maybe save";
@@ -1976,15 +2059,16 @@ void MainWindow::ViewImageDialog(const QUrl &url)
     if (url.scheme() != "book") return;
 
     // non-modal dialog
-    m_ViewImage->show();
-    m_ViewImage->raise();
-    m_ViewImage->activateWindow();
+    ViewImage *view_image = GetViewImage();
+    view_image->show();
+    view_image->raise();
+    view_image->activateWindow();
 
     QString image_bookpath = url.path().remove(0,1);
     try {
         Resource *resource = m_Book->GetFolderKeeper()->GetResourceByBookPath(image_bookpath);
         if (resource->Type() == Resource::ImageResourceType || resource->Type() == Resource::SVGResourceType) {
-            m_ViewImage->ShowImage(resource->GetFullPath());
+            view_image->ShowImage(resource->GetFullPath());
         }
     } catch (ResourceDoesNotExist&) {
         QMessageBox::warning(this, tr("Sigil"), tr("Image does not exist: ") + image_bookpath);
@@ -2084,12 +2168,13 @@ void MainWindow::IndexEditorDialog(IndexEditorModel::indexEntry *index_entry)
 {
     SaveTabData();
     // non-modal dialog
-    m_IndexEditor->show();
-    m_IndexEditor->raise();
-    m_IndexEditor->activateWindow();
+    IndexEditor *index_editor = GetIndexEditor();
+    index_editor->show();
+    index_editor->raise();
+    index_editor->activateWindow();
 
     if (index_entry) {
-        m_IndexEditor->AddEntry(false, index_entry, false);
+        index_editor->AddEntry(false, index_entry, false);
     }
 }
 
@@ -2097,9 +2182,10 @@ void MainWindow::SpellcheckEditorDialog()
 {
     SaveTabData();
     // non-modal dialog
-    m_SpellcheckEditor->show();
-    m_SpellcheckEditor->raise();
-    m_SpellcheckEditor->activateWindow();
+    SpellcheckEditor *spellcheck_editor = GetSpellcheckEditor();
+    spellcheck_editor->show();
+    spellcheck_editor->raise();
+    spellcheck_editor->activateWindow();
 }
 
 
@@ -2178,6 +2264,17 @@ bool MainWindow::AddCover()
     HTMLResource *html_cover_resource = NULL;
     QList<HTMLResource *> html_resources;
     QList<Resource *> resources = GetAllHTMLResources();
+
+    // One batched lookup against the cached landmark/guide model
+    // serves the whole loop instead of a per-file derivation
+    QHash<QString, QString> semantic_codes;
+    if (version.startsWith('3')) {
+        NavProcessor navproc(m_Book->GetConstOPF()->GetNavResource());
+        semantic_codes = navproc.GetLandmarkCodeForPaths();
+    } else {
+        semantic_codes = m_Book->GetOPF()->GetSemanticCodeForPaths();
+    }
+
     foreach(Resource * resource, resources) {
         HTMLResource *html_resource = qobject_cast<HTMLResource *>(resource);
 
@@ -2185,13 +2282,7 @@ bool MainWindow::AddCover()
             html_resources.append(html_resource);
 
             // Check if this is an existing cover file.
-            QString semantic_code;
-            if (version.startsWith('3')) {
-                NavProcessor navproc(m_Book->GetConstOPF()->GetNavResource());
-                semantic_code = navproc.GetLandmarkCodeForResource(html_resource);
-            } else {
-                semantic_code = m_Book->GetOPF()->GetGuideSemanticCodeForResource(html_resource);
-            }
+            QString semantic_code = semantic_codes.value(html_resource->GetRelativePath());
             if (semantic_code == "cover") {
                 html_cover_resource = html_resource;
             } else if (resource->Filename().toLower() == HTML_COVER_FILENAME && html_cover_resource == NULL) {
@@ -2627,14 +2718,15 @@ void MainWindow::ReportsDialog()
     }
 
     DBG qDebug() << "Creating All of the Reports";
-    m_Reports->CreateReports(m_Book);
-    
+    Reports *reports = GetReports();
+    reports->CreateReports(m_Book);
+
     QApplication::restoreOverrideCursor();
 
     // non-modal dialog
-    m_Reports->show();
-    m_Reports->raise();
-    m_Reports->activateWindow();
+    reports->show();
+    reports->raise();
+    reports->activateWindow();
 }
 
 // This routine accepts a file_path that is a book path
@@ -2906,9 +2998,10 @@ void MainWindow::InsertFilesFromDisk()
 void MainWindow::InsertSpecialCharacter()
 {
     // non-modal dialog
-    m_SelectCharacter->show();
-    m_SelectCharacter->raise();
-    m_SelectCharacter->activateWindow();
+    SelectCharacter *select_character = GetSelectCharacter();
+    select_character->show();
+    select_character->raise();
+    select_character->activateWindow();
 }
 
 void MainWindow::InsertId()
@@ -3390,7 +3483,9 @@ void MainWindow::UpdateWord(QString old_word, QString new_word)
 
     WordUpdates::UpdateWordInAllFiles(html_resources, default_lang, old_word, new_word);
     m_Book->SetModified();
-    m_SpellcheckEditor->Refresh();
+    if (m_SpellcheckEditor) {
+        m_SpellcheckEditor->Refresh();
+    }
     ShowMessageOnStatusBar(tr("Word updated."));
 
     QApplication::restoreOverrideCursor();
@@ -3677,6 +3772,16 @@ bool MainWindow::CreateHTMLTOC()
     // list is built in spine order by the BookBrowser
     QList<Resource *> resources = GetAllHTMLResources();
 
+    // One batched lookup against the cached landmark/guide model
+    // serves the whole loop instead of a per-file derivation
+    QHash<QString, QString> semantic_codes;
+    if (version.startsWith('3')) {
+        NavProcessor navproc(navResource);
+        semantic_codes = navproc.GetLandmarkCodeForPaths();
+    } else {
+        semantic_codes = m_Book->GetOPF()->GetSemanticCodeForPaths();
+    }
+
     foreach(Resource * resource, resources) {
         HTMLResource *htmlResource = qobject_cast<HTMLResource *>(resource);
         if (htmlResource) {
@@ -3687,13 +3792,7 @@ bool MainWindow::CreateHTMLTOC()
             if (htmlResource != navResource) {
 
                 // Check if this is an existing HTML toc file.
-                QString semantic_code;
-                if (version.startsWith('3')) {
-                    NavProcessor navproc(navResource);
-                    semantic_code = navproc.GetLandmarkCodeForResource(htmlResource);
-                } else {
-                    semantic_code = m_Book->GetOPF()->GetGuideSemanticCodeForResource(htmlResource);
-                }
+                QString semantic_code = semantic_codes.value(htmlResource->GetRelativePath());
                 if (semantic_code == "toc") {
                     tocResource = htmlResource;
                 } else if (resource->Filename() == HTML_TOC_FILE && tocResource == NULL) {
@@ -3823,24 +3922,26 @@ void MainWindow::CodeView()
 void MainWindow::SearchEditorDialog(SearchEditorModel::searchEntry *search_entry)
 {
     // non-modal dialog
-    m_SearchEditor->show();
-    m_SearchEditor->raise();
-    m_SearchEditor->activateWindow();
+    SearchEditor *search_editor = GetSearchEditor();
+    search_editor->show();
+    search_editor->raise();
+    search_editor->activateWindow();
 
     if (search_entry) {
-        m_SearchEditor->AddEntry(search_entry->is_group, search_entry, false);
+        search_editor->AddEntry(search_entry->is_group, search_entry, false);
     }
 }
 
 void MainWindow::ClipEditorDialog(ClipEditorModel::clipEntry *clip_entry)
 {
     // non-modal dialog
-    m_ClipEditor->show();
-    m_ClipEditor->raise();
-    m_ClipEditor->activateWindow();
+    ClipEditor *clip_editor = GetClipEditor();
+    clip_editor->show();
+    clip_editor->raise();
+    clip_editor->activateWindow();
 
     if (clip_entry) {
-        m_ClipEditor->AddEntry(clip_entry->is_group, clip_entry, false);
+        clip_editor->AddEntry(clip_entry->is_group, clip_entry, false);
     }
 }
 
@@ -3921,7 +4022,7 @@ void MainWindow::PreferencesDialog()
         }
     }
 
-    if (m_SelectCharacter->isVisible()) {
+    if (m_SelectCharacter && m_SelectCharacter->isVisible()) {
         // To ensure any font size changes are immediately applied.
         m_SelectCharacter->show();
     }
@@ -3955,7 +4056,7 @@ void MainWindow::ManagePluginsDialog()
         m_ClipboardHistoryLimit = settings.clipboardHistoryLimit();
     }
 
-    if (m_SelectCharacter->isVisible()) {
+    if (m_SelectCharacter && m_SelectCharacter->isVisible()) {
         // To ensure any font size changes are immediately applied.
         m_SelectCharacter->show();
     }
@@ -3963,6 +4064,23 @@ void MainWindow::ManagePluginsDialog()
     loadPluginsMenu();
 }
 
+void MainWindow::MemoryUsageReport()
+{
+    QStringList report;
+    report << tr("Text resources") + ":";
+    report << m_Book->GetFolderKeeper()->GetMemoryReport();
+    report << "";
+
+    int entries = 0;
+    qint64 source_bytes = 0;
+    GumboInterface::tree_cache_stats(entries, source_bytes);
+    report << tr("Shared parse tree cache") + ":";
+    report << QString("%1 trees pinning %2 KB of source").arg(entries).arg(source_bytes / 1024);
+
+    RepoLog mlog(tr("Memory Usage"), report.join('\n'), this);
+    mlog.exec();
+}
+
 void MainWindow::updateToolTipsOnPluginIcons()
 {
     SettingsStore ss;
@@ -4360,7 +4478,7 @@ void MainWindow::SetStateActionsStaticView()
 void MainWindow::SetupPreviewTimer()
 {
     m_PreviewTimer.setSingleShot(true);
-    m_PreviewTimer.setInterval(1000);
+    m_PreviewTimer.setInterval(LargeBookPolicy::instance()->PreviewRefreshInterval());
     connect(&m_PreviewTimer, SIGNAL(timeout()), this, SLOT(UpdatePreview()));
     m_PreviewTimer.stop();
 }
@@ -4895,6 +5013,110 @@ void MainWindow::WriteSettings()
     settings.setClipboardHistoryLimit(m_ClipboardHistoryLimit);
 }
 
+
+// Settings keys cannot contain the path separators a file path is full
+// of, so sessions are stored under a digest of the epub's path.
+static QString TabSessionKey(const QString &filepath)
+{
+    return QString::fromLatin1(QCryptographicHash::hash(filepath.toUtf8(), QCryptographicHash::Md5).toHex());
+}
+
+
+void MainWindow::SaveTabSession()
+{
+    if (m_CurrentFilePath.isEmpty()) {
+        return;
+    }
+
+    SettingsStore settings;
+    settings.beginGroup(TAB_SESSION_GROUP);
+
+    // Drop sessions for books that fell off the recent files list so
+    // the group stays bounded by it.
+    foreach(const QString &key, settings.childKeys()) {
+        QString path = settings.value(key).toStringList().value(1);
+        if (path != m_CurrentFilePath && !s_RecentFiles.contains(QDir::toNativeSeparators(path))) {
+            settings.remove(key);
+        }
+    }
+
+    // Layout: the epub's mtime, its path, the active tab's book path,
+    // then one "position|bookpath" entry per open tab in tab order.
+    QStringList session;
+    session << QString::number(QFileInfo(m_CurrentFilePath).lastModified().toMSecsSinceEpoch());
+    session << m_CurrentFilePath;
+    ContentTab *current_tab = m_TabManager->GetCurrentContentTab();
+    Resource *current_resource = current_tab ? current_tab->GetLoadedResource() : NULL;
+    session << (current_resource ? current_resource->GetRelativePath() : QString());
+
+    foreach(ContentTab *tab, m_TabManager->GetContentTabs()) {
+        Resource *resource = tab->GetLoadedResource();
+        if (resource) {
+            session << QString::number(tab->GetCursorPosition()) + "|" + resource->GetRelativePath();
+        }
+    }
+
+    if (session.count() > 3) {
+        settings.setValue(TabSessionKey(m_CurrentFilePath), session);
+    } else {
+        settings.remove(TabSessionKey(m_CurrentFilePath));
+    }
+    settings.endGroup();
+}
+
+
+void MainWindow::RestoreTabSession(const QString &fullfilepath)
+{
+    SettingsStore settings;
+    settings.beginGroup(TAB_SESSION_GROUP);
+    QStringList session = settings.value(TabSessionKey(fullfilepath)).toStringList();
+    settings.endGroup();
+
+    if (session.count() < 4) {
+        return;
+    }
+
+    // A stale session - the epub was edited elsewhere since it was
+    // written - could point at positions that no longer exist; fall
+    // back to the plain freshly imported view.
+    if (session.at(0) != QString::number(QFileInfo(fullfilepath).lastModified().toMSecsSinceEpoch())) {
+        return;
+    }
+
+    QString active_bookpath = session.at(2);
+    Resource *active_resource = NULL;
+    int active_position = -1;
+
+    for (int i = 3; i < session.count(); ++i) {
+        const QString &entry = session.at(i);
+        int sep = entry.indexOf('|');
+        if (sep < 1) {
+            continue;
+        }
+        int position = entry.left(sep).toInt();
+        QString bookpath = entry.mid(sep + 1);
+
+        try {
+            Resource *resource = m_Book->GetFolderKeeper()->GetResourceByBookPath(bookpath);
+
+            // The active tab is opened last so it ends up current.
+            if (bookpath == active_bookpath) {
+                active_resource = resource;
+                active_position = position;
+            } else {
+                OpenResource(resource, -1, position);
+            }
+        } catch (ResourceDoesNotExist&) {
+            // gone or renamed since the session was written; skip it
+        }
+    }
+
+    if (active_resource) {
+        OpenResource(active_resource, -1, active_position);
+    }
+}
+
+
 bool MainWindow::MaybeSaveDialogSaysProceed()
 {
     // Make sure that any tabs currently about to be drawn etc get a chance to do so.
@@ -4942,12 +5164,23 @@ void MainWindow::SetNewBook(QSharedPointer<Book> new_book)
     m_BookBrowser->SetBook(m_Book);
     m_TableOfContents->SetBook(m_Book);
     m_ValidationResultsView->SetBook(m_Book);
-    m_IndexEditor->SetBook(m_Book);
-    m_ClipEditor->SetBook(m_Book);
-    m_SpellcheckEditor->SetBook(m_Book);
+    m_SearchResultsView->SetBook(m_Book);
+    // The lazily built dialogs pick the book up from their accessors
+    // when they are first opened.
+    if (m_IndexEditor) {
+        m_IndexEditor->SetBook(m_Book);
+    }
+    if (m_ClipEditor) {
+        m_ClipEditor->SetBook(m_Book);
+    }
+    if (m_SpellcheckEditor) {
+        m_SpellcheckEditor->SetBook(m_Book);
+    }
     SpellCheck *sc = SpellCheck::instance();
     sc->clearIgnoredWords();
     ResetLinkOrStyleBookmark();
+    // pick up the large-book classification the importer just made
+    m_PreviewTimer.setInterval(LargeBookPolicy::instance()->PreviewRefreshInterval());
     SettingsStore settings;
     settings.setRenameTemplate("");
     connect(m_Book.data(),     SIGNAL(ModifiedStateChanged(bool)), this, SLOT(setWindowModified(bool)));
@@ -4973,6 +5206,8 @@ void MainWindow::ResourcesAddedOrDeletedOrMoved()
 
 void MainWindow::CreateNewBook(const QString version, const QStringList &book_paths)
 {
+    // a freshly created book is never a large one
+    LargeBookPolicy::instance()->Reset();
     QString epubversion = version;
     if (epubversion.isEmpty()) {
         SettingsStore ss;
@@ -5099,6 +5334,9 @@ bool MainWindow::LoadFile(const QString &fullfilepath, bool is_internal)
         return false;
     }
 
+    // the outgoing book is about to be replaced; remember its tabs
+    SaveTabSession();
+
     try {
         ImporterFactory importerFactory;
         // Create the new book, clean up the old one
@@ -5147,6 +5385,7 @@ bool MainWindow::LoadFile(const QString &fullfilepath, bool is_internal)
                 // Clear the last inserted file
                 m_LastInsertedFile = "";
                 UpdateUiWithCurrentFile(fullfilepath);
+                RestoreTabSession(fullfilepath);
             } else {
                 UpdateUiWithCurrentFile(QFileInfo(fullfilepath).fileName(), true);
                 m_Book->SetModified();
@@ -5219,17 +5458,10 @@ bool MainWindow::SaveFile(const QString &fullfilepath, bool update_current_filen
 
         QApplication::setOverrideCursor(Qt::WaitCursor);
 
-        QList <HTMLResource *> broken_resources;
-        bool not_well_formed = false;
-        Q_FOREACH(Resource * r, GetAllHTMLResources()) {
-            HTMLResource *t = qobject_cast<HTMLResource *>(r);
-            if (t) {
-                if (!XhtmlDoc::IsDataWellFormed(t->GetText())) {
-                    not_well_formed = true;
-                    broken_resources.append(t);
-                }
-            }
-        }
+        // Checked in parallel over a snapshot, so the pre-save gate
+        // costs roughly one file's parse time instead of the whole book's.
+        QList <HTMLResource *> broken_resources = m_Book->GetNonWellFormedHTMLFiles();
+        bool not_well_formed = !broken_resources.isEmpty();
         if (ss.cleanOn() & CLEANON_SAVE) {
             if (not_well_formed) {
                 QApplication::restoreOverrideCursor();
@@ -5249,6 +5481,12 @@ bool MainWindow::SaveFile(const QString &fullfilepath, bool update_current_filen
             }
         }
 
+        if (not_well_formed) {
+            // show the user where the problems are; the verdicts are
+            // already memoized so this re-check costs only the hashes
+            SetValidationResults(m_Book->CheckForWellFormedErrors());
+        }
+
         ExporterFactory().GetExporter(fullfilepath, m_Book)->WriteBook();
 
         // Return the focus back to the current tab
@@ -5675,6 +5913,13 @@ void MainWindow::ExtendUI()
     // Basically, restoreGeometry() in ReadSettings() overrules this command.
     m_ValidationResultsView->hide();
 
+    m_SearchResultsView = new SearchResultsView(this);
+    m_SearchResultsView->setObjectName(SEARCH_RESULTS_VIEW_NAME);
+    addDockWidget(Qt::BottomDockWidgetArea, m_SearchResultsView);
+    // Hidden until the first Find All runs; restoreGeometry() in
+    // ReadSettings() overrules this just like the validation pane.
+    m_SearchResultsView->hide();
+
     m_PreviewWindow = new PreviewWindow(this);
     m_PreviewWindow->setObjectName(PREVIEW_WINDOW_NAME);
     m_PreviewWindow->setStyleSheet("QDockWidget {border: none;}");
@@ -5698,6 +5943,11 @@ void MainWindow::ExtendUI()
     m_TableOfContents->toggleViewAction()->setShortcut(QKeySequence(Qt::ALT + Qt::Key_F3));
     ui.menuView->addAction(m_ValidationResultsView->toggleViewAction());
     m_ValidationResultsView->toggleViewAction()->setShortcut(QKeySequence(Qt::ALT + Qt::Key_F2));
+    ui.menuView->addAction(m_SearchResultsView->toggleViewAction());
+
+    ui.menuTools->addSeparator();
+    QAction *memory_report_action = ui.menuTools->addAction(tr("Memory Usage Report"));
+    connect(memory_report_action, SIGNAL(triggered()), this, SLOT(MemoryUsageReport()));
 
     // Create the view menu to hide and show toolbars.
     ui.menuToolbars->addAction(ui.toolBarNewActions->toggleViewAction());
@@ -5884,6 +6134,7 @@ void MainWindow::ExtendUI()
     sm->registerAction(this, ui.actionZoomReset, "MainWindow.ZoomReset");
     sm->registerAction(this, m_BookBrowser->toggleViewAction(), "MainWindow.BookBrowser");
     sm->registerAction(this, m_ValidationResultsView->toggleViewAction(), "MainWindow.ValidationResults");
+    sm->registerAction(this, m_SearchResultsView->toggleViewAction(), "MainWindow.SearchResults");
     sm->registerAction(this, m_TableOfContents->toggleViewAction(), "MainWindow.TableOfContents");
     // Window
     sm->registerAction(this, ui.actionNextTab, "MainWindow.NextTab");
@@ -6267,6 +6518,10 @@ void MainWindow::ConnectSignalsToSlots()
             this,     SLOT(OpenResource(Resource *, int, int, const QString &, const QUrl &)));
     connect(m_ValidationResultsView, SIGNAL(OpenResourceRequest(Resource *, int, int, const QString &)),
             this,     SLOT(OpenResource(Resource *, int, int, const QString &)));
+    connect(m_SearchResultsView, SIGNAL(OpenResourceRequest(Resource *, int, int, const QString &)),
+            this,     SLOT(OpenResource(Resource *, int, int, const QString &)));
+    connect(m_FindReplace, SIGNAL(FindAllRequest(const QString &, QList<Resource *>)),
+            m_SearchResultsView, SLOT(StreamSearchResults(const QString &, QList<Resource *>)));
     connect(m_TabManager, SIGNAL(OpenUrlRequest(const QUrl &)),
             this, SLOT(OpenUrl(const QUrl &)));
     connect(m_TabManager, SIGNAL(OldTabRequest(QString, HTMLResource *)),
@@ -6275,54 +6530,120 @@ void MainWindow::ConnectSignalsToSlots()
             this,          SLOT(SearchEditorDialog(SearchEditorModel::searchEntry *)));
     connect(m_TabManager, SIGNAL(ShowStatusMessageRequest(const QString &, int)), this, SLOT(ShowMessageOnStatusBar(const QString &, int)));
 
-    connect(m_FindReplace, SIGNAL(ShowMessageRequest(const QString &)),
-            m_SearchEditor, SLOT(ShowMessage(const QString &)));
     connect(m_FindReplace,   SIGNAL(ClipboardSaveRequest()),     m_ClipboardHistorySelector,  SLOT(SaveClipboardState()));
     connect(m_FindReplace,   SIGNAL(ClipboardRestoreRequest()),  m_ClipboardHistorySelector,  SLOT(RestoreClipboardState()));
 
-    connect(m_SearchEditor, SIGNAL(FindSelectedSearchRequest()), m_FindReplace,   SLOT(FindSearch()));
-    connect(m_SearchEditor, SIGNAL(ReplaceCurrentSelectedSearchRequest()), m_FindReplace,   SLOT(ReplaceCurrentSearch()));
-    connect(m_SearchEditor, SIGNAL(ReplaceSelectedSearchRequest()), m_FindReplace,   SLOT(ReplaceSearch()));
-    connect(m_SearchEditor, SIGNAL(CountAllSelectedSearchRequest()), m_FindReplace,   SLOT(CountAllSearch()));
-    connect(m_SearchEditor, SIGNAL(ReplaceAllSelectedSearchRequest()), m_FindReplace,   SLOT(ReplaceAllSearch()));
-    connect(m_SearchEditor, SIGNAL(LoadSelectedSearchRequest(SearchEditorModel::searchEntry *)),
-            m_FindReplace,   SLOT(LoadSearch(SearchEditorModel::searchEntry *)));
-
     connect(m_ClipboardHistorySelector, SIGNAL(PasteRequest(const QString &)), this, SLOT(PasteTextIntoCurrentTarget(const QString &)));
-    connect(m_SelectCharacter, SIGNAL(SelectedCharacter(const QString &)), this, SLOT(PasteTextIntoCurrentTarget(const QString &)));
-    connect(m_ClipEditor, SIGNAL(PasteSelectedClipRequest(QList<ClipEditorModel::clipEntry *>)),
-            this,           SLOT(PasteClipEntriesIntoCurrentTarget(QList<ClipEditorModel::clipEntry *>)));
     connect(m_Clips,        SIGNAL(PasteClips(QList<ClipEditorModel::clipEntry *>)),
             this,            SLOT(PasteClipEntriesIntoPreviousTarget(QList<ClipEditorModel::clipEntry *>)));
-    connect(m_SearchEditor, SIGNAL(ShowStatusMessageRequest(const QString &)),
-            this,            SLOT(ShowMessageOnStatusBar(const QString &)));
-    connect(m_ClipEditor,   SIGNAL(ShowStatusMessageRequest(const QString &)),
-            this,            SLOT(ShowMessageOnStatusBar(const QString &)));
-    connect(m_ClipEditor,   SIGNAL(ClipsUpdated()),
-            this,            SLOT(UpdateClipsUI()));
-    connect(m_IndexEditor,  SIGNAL(ShowStatusMessageRequest(const QString &)),
-            this,            SLOT(ShowMessageOnStatusBar(const QString &)));
     // connect(m_MetaEditor,  SIGNAL(ShowStatusMessageRequest(const QString &)),
     //         this,            SLOT(ShowMessageOnStatusBar(const QString &)));
-    connect(m_SpellcheckEditor,  SIGNAL(ShowStatusMessageRequest(const QString &)),
-            this,            SLOT(ShowMessageOnStatusBar(const QString &)));
-    connect(m_SpellcheckEditor,   SIGNAL(SpellingHighlightRefreshRequest()), this,  SLOT(RefreshSpellingHighlighting()));
-    connect(m_SpellcheckEditor,   SIGNAL(FindWordRequest(QString)), this,  SLOT(FindWord(QString)));
-    connect(m_SpellcheckEditor,   SIGNAL(UpdateWordRequest(QString, QString)), this,  SLOT(UpdateWord(QString, QString)));
-    connect(m_SpellcheckEditor,   SIGNAL(ShowStatusMessageRequest(const QString &)),
-            this,  SLOT(ShowMessageOnStatusBar(const QString &)));
-    connect(m_Reports,       SIGNAL(Refresh()), this, SLOT(ReportsDialog()));
-    connect(m_Reports,       SIGNAL(OpenFileRequest(QString, int, int)), this, SLOT(OpenFile(QString, int, int)));
-    connect(m_Reports,       SIGNAL(DeleteFilesRequest(QStringList)), this, SLOT(DeleteFilenames(QStringList)));
-    connect(m_Reports,       SIGNAL(DeleteStylesRequest(QList<BookReports::StyleData *>)), this, SLOT(DeleteReportsStyles(QList<BookReports::StyleData *>)));
-    connect(m_Reports,       SIGNAL(FindText(QString)), m_FindReplace, SLOT(FindAnyText(QString)));
-    connect(m_Reports,       SIGNAL(FindTextInTags(QString)), m_FindReplace, SLOT(FindAnyTextInTags(QString)));
+    // The modeless dialogs (SearchEditor, ClipEditor, IndexEditor,
+    // SpellcheckEditor, SelectCharacter, ViewImage, Reports) make
+    // their connections in their lazy Get*() accessors.
 
     // Plugins
     PluginDB *pdb = PluginDB::instance();
     connect(pdb, SIGNAL(plugins_changed()), this, SLOT(loadPluginsMenu()));
 }
 
+
+SearchEditor *MainWindow::GetSearchEditor()
+{
+    if (!m_SearchEditor) {
+        m_SearchEditor = new SearchEditor(this);
+        connect(m_FindReplace, SIGNAL(ShowMessageRequest(const QString &)),
+                m_SearchEditor, SLOT(ShowMessage(const QString &)));
+        connect(m_SearchEditor, SIGNAL(FindSelectedSearchRequest()), m_FindReplace,   SLOT(FindSearch()));
+        connect(m_SearchEditor, SIGNAL(ReplaceCurrentSelectedSearchRequest()), m_FindReplace,   SLOT(ReplaceCurrentSearch()));
+        connect(m_SearchEditor, SIGNAL(ReplaceSelectedSearchRequest()), m_FindReplace,   SLOT(ReplaceSearch()));
+        connect(m_SearchEditor, SIGNAL(CountAllSelectedSearchRequest()), m_FindReplace,   SLOT(CountAllSearch()));
+        connect(m_SearchEditor, SIGNAL(ReplaceAllSelectedSearchRequest()), m_FindReplace,   SLOT(ReplaceAllSearch()));
+        connect(m_SearchEditor, SIGNAL(LoadSelectedSearchRequest(SearchEditorModel::searchEntry *)),
+                m_FindReplace,   SLOT(LoadSearch(SearchEditorModel::searchEntry *)));
+        connect(m_SearchEditor, SIGNAL(ShowStatusMessageRequest(const QString &)),
+                this,            SLOT(ShowMessageOnStatusBar(const QString &)));
+    }
+    return m_SearchEditor;
+}
+
+
+ClipEditor *MainWindow::GetClipEditor()
+{
+    if (!m_ClipEditor) {
+        m_ClipEditor = new ClipEditor(this);
+        m_ClipEditor->SetBook(m_Book);
+        connect(m_ClipEditor, SIGNAL(PasteSelectedClipRequest(QList<ClipEditorModel::clipEntry *>)),
+                this,           SLOT(PasteClipEntriesIntoCurrentTarget(QList<ClipEditorModel::clipEntry *>)));
+        connect(m_ClipEditor,   SIGNAL(ShowStatusMessageRequest(const QString &)),
+                this,            SLOT(ShowMessageOnStatusBar(const QString &)));
+        connect(m_ClipEditor,   SIGNAL(ClipsUpdated()),
+                this,            SLOT(UpdateClipsUI()));
+    }
+    return m_ClipEditor;
+}
+
+
+IndexEditor *MainWindow::GetIndexEditor()
+{
+    if (!m_IndexEditor) {
+        m_IndexEditor = new IndexEditor(this);
+        m_IndexEditor->SetBook(m_Book);
+        connect(m_IndexEditor,  SIGNAL(ShowStatusMessageRequest(const QString &)),
+                this,            SLOT(ShowMessageOnStatusBar(const QString &)));
+    }
+    return m_IndexEditor;
+}
+
+
+SpellcheckEditor *MainWindow::GetSpellcheckEditor()
+{
+    if (!m_SpellcheckEditor) {
+        m_SpellcheckEditor = new SpellcheckEditor(this);
+        m_SpellcheckEditor->SetBook(m_Book);
+        connect(m_SpellcheckEditor,  SIGNAL(ShowStatusMessageRequest(const QString &)),
+                this,            SLOT(ShowMessageOnStatusBar(const QString &)));
+        connect(m_SpellcheckEditor,   SIGNAL(SpellingHighlightRefreshRequest()), this,  SLOT(RefreshSpellingHighlighting()));
+        connect(m_SpellcheckEditor,   SIGNAL(FindWordRequest(QString)), this,  SLOT(FindWord(QString)));
+        connect(m_SpellcheckEditor,   SIGNAL(UpdateWordRequest(QString, QString)), this,  SLOT(UpdateWord(QString, QString)));
+    }
+    return m_SpellcheckEditor;
+}
+
+
+SelectCharacter *MainWindow::GetSelectCharacter()
+{
+    if (!m_SelectCharacter) {
+        m_SelectCharacter = new SelectCharacter(this);
+        connect(m_SelectCharacter, SIGNAL(SelectedCharacter(const QString &)), this, SLOT(PasteTextIntoCurrentTarget(const QString &)));
+    }
+    return m_SelectCharacter;
+}
+
+
+ViewImage *MainWindow::GetViewImage()
+{
+    if (!m_ViewImage) {
+        m_ViewImage = new ViewImage(this);
+    }
+    return m_ViewImage;
+}
+
+
+Reports *MainWindow::GetReports()
+{
+    if (!m_Reports) {
+        m_Reports = new Reports(this);
+        connect(m_Reports,       SIGNAL(Refresh()), this, SLOT(ReportsDialog()));
+        connect(m_Reports,       SIGNAL(OpenFileRequest(QString, int, int)), this, SLOT(OpenFile(QString, int, int)));
+        connect(m_Reports,       SIGNAL(DeleteFilesRequest(QStringList)), this, SLOT(DeleteFilenames(QStringList)));
+        connect(m_Reports,       SIGNAL(DeleteStylesRequest(QList<BookReports::StyleData *>)), this, SLOT(DeleteReportsStyles(QList<BookReports::StyleData *>)));
+        connect(m_Reports,       SIGNAL(FindText(QString)), m_FindReplace, SLOT(FindAnyText(QString)));
+        connect(m_Reports,       SIGNAL(FindTextInTags(QString)), m_FindReplace, SLOT(FindAnyTextInTags(QString)));
+    }
+    return m_Reports;
+}
+
 void MainWindow::MakeTabConnections(ContentTab *tab)
 {
     Resource::ResourceType rType;
@@ -6346,6 +6667,8 @@ void MainWindow::MakeTabConnections(ContentTab *tab)
         connect(ui.actionDeleteLine,               SIGNAL(triggered()),  tab,   SLOT(DeleteLine()));
         connect(tab,   SIGNAL(OpenClipEditorRequest(ClipEditorModel::clipEntry *)),
                 this,  SLOT(ClipEditorDialog(ClipEditorModel::clipEntry *)));
+        connect(tab,   SIGNAL(SourceDeltaReceived(int,int,int)),
+                this,  SLOT(RebaseLocationBookmark(int,int,int)));
     }
 
     // Allow Cut, Copy, Paste to work in other TextTabs to enable basic edit icons
@@ -6491,10 +6814,10 @@ void MainWindow::BreakTabConnections(ContentTab *tab)
 
 QList<SearchEditorModel::searchEntry*> MainWindow::SearchEditorGetCurrentEntries()
 {
-    return m_SearchEditor->GetCurrentEntries();
+    return GetSearchEditor()->GetCurrentEntries();
 }
 
 void MainWindow::SearchEditorRecordEntryAsCompleted(SearchEditorModel::searchEntry* entry)
 {
-    m_SearchEditor->RecordEntryAsCompleted(entry);
+    GetSearchEditor()->RecordEntryAsCompleted(entry);
 }
@@ -26,6 +26,7 @@
 #ifndef SIGIL_H
 #define SIGIL_H
 
+#include <QtCore/QFutureWatcher>
 #include <QtCore/QSharedPointer>
 #include <QtWidgets/QMainWindow>
 
@@ -64,11 +65,13 @@ class TabManager;
 class BookBrowser;
 class TableOfContents;
 class ValidationResultsView;
+class SearchResultsView;
 class PreviewWindow;
 class SearchEditor;
 class ClipEditor;
 class ClipsWindow;
 class SelectCharacter;
+class TempFolder;
 class ViewImage;
 class FlowTab;
 
@@ -261,6 +264,13 @@ public slots:
     void launchExternalXEditor();
 
     bool RepoCommit();
+
+    /**
+     * Reports the result of the background checkpoint commit and
+     * removes the temporary snapshot folder it committed from.
+     */
+    void RepoCommitFinished();
+
     void RepoCheckout(QString bookid="", QString destpath="", QString filename="", bool loadnow=true);
     void RepoDiff(QString bookid="");
     void RepoManage();
@@ -304,6 +314,13 @@ protected:
 
 private slots:
 
+    /**
+     * Rebases the stored bookmark offset against an edit delta from
+     * the active tab, so going back after edits stays accurate without
+     * rescanning the document.
+     */
+    void RebaseLocationBookmark(int position, int charsRemoved, int charsAdded);
+
     void UpdateLastSizes();
 
     void RestoreLastNormalGeometry();
@@ -467,6 +484,12 @@ private slots:
      */
     void ManagePluginsDialog();
 
+    /**
+     * Shows what the book's text cache and the shared parse tree
+     * cache currently keep resident.
+     */
+    void MemoryUsageReport();
+
     /**
      * Implements Validate Epub action functionality.
      */
@@ -702,6 +725,19 @@ private:
      */
     void WriteSettings();
 
+    /**
+     * Remembers which tabs are open for the current book - their book
+     * paths, cursor positions and the active tab - keyed by the epub's
+     * path, so reopening the same file can pick up where the user left off.
+     */
+    void SaveTabSession();
+
+    /**
+     * Reopens the tabs recorded for this epub by a previous SaveTabSession(),
+     * unless the file changed on disk since the session was written.
+     */
+    void RestoreTabSession(const QString &fullfilepath);
+
     /**
      * Gets called on possible saves and asks the user
      * does he want to save.
@@ -847,6 +883,19 @@ private:
      */
     void ConnectSignalsToSlots();
 
+    /**
+     * Lazy accessors for the modeless dialogs. Each one builds the
+     * dialog and makes its connections on first use, so startup only
+     * pays for the docks and editor that are actually on screen.
+     */
+    SearchEditor *GetSearchEditor();
+    ClipEditor *GetClipEditor();
+    IndexEditor *GetIndexEditor();
+    SpellcheckEditor *GetSpellcheckEditor();
+    SelectCharacter *GetSelectCharacter();
+    ViewImage *GetViewImage();
+    Reports *GetReports();
+
     /**
      * Connects all the UI signals to the provided tab.
      *
@@ -949,6 +998,12 @@ private:
      */
     ValidationResultsView *m_ValidationResultsView;
 
+    /**
+     * The Search Results pane that lists matches streamed from
+     * cross-file searches.
+     */
+    SearchResultsView *m_SearchResultsView;
+
     PreviewWindow *m_PreviewWindow;
 
     /**
@@ -1005,6 +1060,14 @@ private:
 
     Reports *m_Reports;
 
+    /**
+     * Created lazily on the first checkpoint; watches the background
+     * commit of the snapshot folder so the UI never blocks on it.
+     */
+    QFutureWatcher<QString> *m_RepoCommitWatcher;
+
+    TempFolder *m_RepoCommitSnapshot;
+
     bool m_preserveHeadingAttributes;
 
     LocationBookmark *m_LinkOrStyleBookmark;
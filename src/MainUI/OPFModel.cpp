@@ -22,6 +22,7 @@
 
 #include <limits>
 
+#include <QtCore/QTimer>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QFileIconProvider>
 #include <QMessageBox>
@@ -62,6 +63,9 @@ OPFModel::OPFModel(QObject *parent)
             this, SLOT(RowsRemovedHandler(const QModelIndex &, int, int)));
     connect(this, SIGNAL(itemChanged(QStandardItem *)),
             this, SLOT(ItemChangedHandler(QStandardItem *)));
+    m_SpineSyncTimer.setInterval(0);
+    m_SpineSyncTimer.setSingleShot(true);
+    connect(&m_SpineSyncTimer, SIGNAL(timeout()), this, SLOT(SyncHTMLReadingOrders()));
     QList<QStandardItem *> items;
     items.append(m_TextFolderItem);
     items.append(m_StylesFolderItem);
@@ -111,6 +115,76 @@ void OPFModel::SortHTML(QList <QModelIndex> index_list)
 }
 
 
+void OPFModel::AddResource(Resource *resource)
+{
+    Q_ASSERT(m_Book);
+
+    if (!resource) {
+        return;
+    }
+
+    m_RefreshInProgress = true;
+    QList<Resource *> resources = m_Book->GetFolderKeeper()->GetResourceList();
+    QHash <Resource *, int> reading_order_all = m_Book->GetOPF()->GetReadingOrderAll(resources);
+    QString version = m_Book->GetConstOPF()->GetEpubVersion();
+    QHash <QString, QString> semantic_type_all;
+    QHash <QString, QString> manifest_properties_all;
+    SettingsStore ss;
+    if (version.startsWith('3')) {
+        NavProcessor navproc(m_Book->GetConstOPF()->GetNavResource());
+        semantic_type_all = navproc.GetLandmarkNameForPaths();
+        manifest_properties_all = m_Book->GetOPF()->GetManifestPropertiesForPaths();
+    } else {
+        semantic_type_all = m_Book->GetOPF()->GetGuideSemanticNameForPaths();
+    }
+
+    AlphanumericItem *item = CreateResourceItem(resource, reading_order_all, semantic_type_all,
+                                                manifest_properties_all, ss.showFullPathOn());
+
+    if (resource->Type() == Resource::OPFResourceType ||
+        resource->Type() == Resource::NCXResourceType) {
+        appendRow(item);
+        m_RefreshInProgress = false;
+        return;
+    }
+
+    QStandardItem *folder = FolderItemForResourceType(resource->Type());
+    int row = 0;
+
+    if (folder == m_TextFolderItem) {
+        // The Text folder is kept in reading order. The roles stored on
+        // the existing items can lag behind spine edits, so place the
+        // new item by the freshly read spine order instead.
+        int reading_order = NO_READING_ORDER;
+        if (reading_order_all.contains(resource)) {
+            reading_order = reading_order_all[resource];
+        }
+
+        while (row < folder->rowCount()) {
+            Resource *other = m_Book->GetFolderKeeper()->GetResourceByIdentifier(
+                                  folder->child(row)->data().toString());
+            int other_order = NO_READING_ORDER;
+            if (other && reading_order_all.contains(other)) {
+                other_order = reading_order_all[other];
+            }
+            if (other_order > reading_order) {
+                break;
+            }
+            row++;
+        }
+    } else {
+        // All other folders are kept sorted by the displayed name.
+        while (row < folder->rowCount() &&
+               folder->child(row)->text() < item->text()) {
+            row++;
+        }
+    }
+
+    folder->insertRow(row, item);
+    m_RefreshInProgress = false;
+}
+
+
 QModelIndex OPFModel::GetFirstHTMLModelIndex()
 {
     if (!m_TextFolderItem->hasChildren()) {
@@ -294,6 +368,16 @@ void OPFModel::RowsRemovedHandler(const QModelIndex &parent, int start, int end)
         return;
     }
 
+    // A single drop of several files arrives as one rowsRemoved event
+    // per moved row, and each spine update rewrites the whole OPF.
+    // The zero length single shot timer fires once the drop has fully
+    // unwound, so the whole drag session costs one spine rewrite.
+    m_SpineSyncTimer.start();
+}
+
+
+void OPFModel::SyncHTMLReadingOrders()
+{
     UpdateHTMLReadingOrders();
 }
 
@@ -345,6 +429,11 @@ bool OPFModel:: RenameResourceList(const QList<Resource *> &resources, const QSt
     QStringList not_renamed;
     QHash<QString, QString> update;
     SettingsStore ss;
+    // every successful rename triggers a short path name recomputation
+    // and an OPF manifest rewrite, so coalesce both into a single pass
+    // once the whole list is done
+    m_Book->GetFolderKeeper()->SuspendShortPathUpdates();
+    m_Book->GetOPF()->SuspendModelUpdates();
     int i = 0;
     foreach(Resource * resource, resources) {
         QString old_bookpath = resource->GetRelativePath();
@@ -402,6 +491,9 @@ bool OPFModel:: RenameResourceList(const QList<Resource *> &resources, const QSt
         update[ old_bookpath ] = resource->GetRelativePath();
     }
 
+    m_Book->GetOPF()->ResumeModelUpdates();
+    m_Book->GetFolderKeeper()->ResumeShortPathUpdates();
+
     if (update.count() > 0) {
         UniversalUpdates::PerformUniversalUpdates(true, m_Book->GetFolderKeeper()->GetResourceList(), update);
         emit BookContentModified();
@@ -422,6 +514,10 @@ bool OPFModel::MoveResourceList(const QList<Resource *> &resources, const QStrin
     QApplication::setOverrideCursor(Qt::WaitCursor);
     QStringList not_moved;
     QHash<QString, QString> update;
+    // like RenameResourceList, fold the per-move short path name
+    // recomputations and OPF manifest rewrites into one pass at the end
+    m_Book->GetFolderKeeper()->SuspendShortPathUpdates();
+    m_Book->GetOPF()->SuspendModelUpdates();
     int i = 0;
     foreach(Resource * resource, resources) {
         const QString &oldbookpath = resource->GetRelativePath();
@@ -463,6 +559,9 @@ bool OPFModel::MoveResourceList(const QList<Resource *> &resources, const QStrin
         update[ oldbookpath ] = resource->GetRelativePath();
     }
 
+    m_Book->GetOPF()->ResumeModelUpdates();
+    m_Book->GetFolderKeeper()->ResumeShortPathUpdates();
+
     if (update.count() > 0) {
         UniversalUpdates::PerformUniversalUpdates(true, m_Book->GetFolderKeeper()->GetResourceList(), update);
         emit BookContentModified();
@@ -496,78 +595,109 @@ void OPFModel::InitializeModel()
         semantic_type_all = m_Book->GetOPF()->GetGuideSemanticNameForPaths();
     }
 
+    bool show_full_path = ss.showFullPathOn();
+    // Collect the new items per folder and append each batch in a single
+    // call, so a book with thousands of resources generates one
+    // rowsInserted signal per folder instead of one per resource.
+    QHash <QStandardItem *, QList<QStandardItem *>> folder_rows;
+
     foreach(Resource * resource, resources) {
-        AlphanumericItem * item;
-        if (ss.showFullPathOn()) {
-            item = new AlphanumericItem(resource->Icon(), resource->GetRelativePath());
+        AlphanumericItem *item = CreateResourceItem(resource, reading_order_all, semantic_type_all,
+                                                    manifest_properties_all, show_full_path);
+
+        if (resource->Type() == Resource::OPFResourceType ||
+            resource->Type() == Resource::NCXResourceType) {
+            appendRow(item);
         } else {
-            item = new AlphanumericItem(resource->Icon(), resource->ShortPathName());
-        }
-        item->setDropEnabled(false);
-        item->setData(resource->GetIdentifier());
-        QString tooltip = resource->GetRelativePath();
-        QString path = resource->GetRelativePath();
-        if (resource->Type() == Resource::FontResourceType) {
-            FontResource* font_res = qobject_cast<FontResource *>(resource);
-            if (font_res) {
-                tooltip = tooltip + " (" + font_res->GetDescription() + ")";
-            }
+            folder_rows[ FolderItemForResourceType(resource->Type()) ].append(item);
         }
+    }
 
-        if (semantic_type_all.contains(path)) {
-            tooltip += " (" + semantic_type_all[path] + ")";
-        }
-        if (manifest_properties_all.contains(path)) {
-            tooltip += " [" + manifest_properties_all[path] + "]";
+    foreach(QStandardItem * folder, folder_rows.keys()) {
+        folder->appendRows(folder_rows[ folder ]);
+    }
+}
+
+
+AlphanumericItem *OPFModel::CreateResourceItem(Resource *resource,
+                                               const QHash<Resource *, int> &reading_order_all,
+                                               const QHash<QString, QString> &semantic_type_all,
+                                               const QHash<QString, QString> &manifest_properties_all,
+                                               bool show_full_path)
+{
+    AlphanumericItem * item;
+    if (show_full_path) {
+        item = new AlphanumericItem(resource->Icon(), resource->GetRelativePath());
+    } else {
+        item = new AlphanumericItem(resource->Icon(), resource->ShortPathName());
+    }
+    item->setDropEnabled(false);
+    item->setData(resource->GetIdentifier());
+    QString tooltip = resource->GetRelativePath();
+    QString path = resource->GetRelativePath();
+    if (resource->Type() == Resource::FontResourceType) {
+        FontResource* font_res = qobject_cast<FontResource *>(resource);
+        if (font_res) {
+            tooltip = tooltip + " (" + font_res->GetDescription() + ")";
         }
-        item->setToolTip(tooltip);
+    }
 
-        if (resource->Type() == Resource::HTMLResourceType) {
-            int reading_order = -1;
-            if (reading_order_all.contains(resource)) {
-                reading_order = reading_order_all[resource];
-            } else {
-                reading_order = NO_READING_ORDER;
-            }
+    if (semantic_type_all.contains(path)) {
+        tooltip += " (" + semantic_type_all[path] + ")";
+    }
+    if (manifest_properties_all.contains(path)) {
+        tooltip += " [" + manifest_properties_all[path] + "]";
+    }
+    item->setToolTip(tooltip);
 
-            item->setData(reading_order, READING_ORDER_ROLE);
-            // Remove the extension for alphanumeric sorting
-            QString name;
-            if (ss.showFullPathOn()) {
-                name = resource->GetRelativePath().left(resource->GetRelativePath().lastIndexOf('.'));
-            } else {
-                name = resource->ShortPathName().left(resource->ShortPathName().lastIndexOf('.'));
-            }
-            item->setData(name, ALPHANUMERIC_ORDER_ROLE);
-            m_TextFolderItem->appendRow(item);
-        } else if (resource->Type() == Resource::CSSResourceType) {
-            item->setDragEnabled(false);
-            m_StylesFolderItem->appendRow(item);
-        } else if (resource->Type() == Resource::ImageResourceType ||
-                   resource->Type() == Resource::SVGResourceType
-                  ) {
-            item->setDragEnabled(false);
-            m_ImagesFolderItem->appendRow(item);
-        } else if (resource->Type() == Resource::FontResourceType) {
-            item->setDragEnabled(false);
-            m_FontsFolderItem->appendRow(item);
-        } else if (resource->Type() == Resource::AudioResourceType) {
-            item->setDragEnabled(false);
-            m_AudioFolderItem->appendRow(item);
-        } else if (resource->Type() == Resource::VideoResourceType) {
-            item->setDragEnabled(false);
-            m_VideoFolderItem->appendRow(item);
-        } else if (resource->Type() == Resource::OPFResourceType ||
-                   resource->Type() == Resource::NCXResourceType) {
-            item->setEditable(true);
-            item->setDragEnabled(false);
-            item->setToolTip(resource->GetRelativePath());
-            appendRow(item);
+    if (resource->Type() == Resource::HTMLResourceType) {
+        int reading_order = -1;
+        if (reading_order_all.contains(resource)) {
+            reading_order = reading_order_all[resource];
         } else {
-            item->setDragEnabled(false);
-            m_MiscFolderItem->appendRow(item);
+            reading_order = NO_READING_ORDER;
         }
+
+        item->setData(reading_order, READING_ORDER_ROLE);
+        // Remove the extension for alphanumeric sorting
+        QString name;
+        if (show_full_path) {
+            name = resource->GetRelativePath().left(resource->GetRelativePath().lastIndexOf('.'));
+        } else {
+            name = resource->ShortPathName().left(resource->ShortPathName().lastIndexOf('.'));
+        }
+        item->setData(name, ALPHANUMERIC_ORDER_ROLE);
+    } else if (resource->Type() == Resource::OPFResourceType ||
+               resource->Type() == Resource::NCXResourceType) {
+        item->setEditable(true);
+        item->setDragEnabled(false);
+        item->setToolTip(resource->GetRelativePath());
+    } else {
+        item->setDragEnabled(false);
     }
+
+    return item;
+}
+
+
+QStandardItem *OPFModel::FolderItemForResourceType(Resource::ResourceType resource_type)
+{
+    if (resource_type == Resource::HTMLResourceType) {
+        return m_TextFolderItem;
+    } else if (resource_type == Resource::CSSResourceType) {
+        return m_StylesFolderItem;
+    } else if (resource_type == Resource::ImageResourceType ||
+               resource_type == Resource::SVGResourceType) {
+        return m_ImagesFolderItem;
+    } else if (resource_type == Resource::FontResourceType) {
+        return m_FontsFolderItem;
+    } else if (resource_type == Resource::AudioResourceType) {
+        return m_AudioFolderItem;
+    } else if (resource_type == Resource::VideoResourceType) {
+        return m_VideoFolderItem;
+    }
+
+    return m_MiscFolderItem;
 }
 
 
@@ -596,33 +726,15 @@ void OPFModel::UpdateHTMLReadingOrders()
 
 void OPFModel::ClearModel()
 {
-    while (m_TextFolderItem->rowCount() != 0) {
-        m_TextFolderItem->removeRow(0);
-    }
-
-    while (m_StylesFolderItem->rowCount() != 0) {
-        m_StylesFolderItem->removeRow(0);
-    }
-
-    while (m_ImagesFolderItem->rowCount() != 0) {
-        m_ImagesFolderItem->removeRow(0);
-    }
-
-    while (m_FontsFolderItem->rowCount() != 0) {
-        m_FontsFolderItem->removeRow(0);
-    }
-
-    while (m_MiscFolderItem->rowCount() != 0) {
-        m_MiscFolderItem->removeRow(0);
-    }
-
-    while (m_AudioFolderItem->rowCount() != 0) {
-        m_AudioFolderItem->removeRow(0);
-    }
-
-    while (m_VideoFolderItem->rowCount() != 0) {
-        m_VideoFolderItem->removeRow(0);
-    }
+    // Remove each folder's children in one call rather than row by
+    // row, so the attached views see a single rowsRemoved per folder.
+    m_TextFolderItem->removeRows(0, m_TextFolderItem->rowCount());
+    m_StylesFolderItem->removeRows(0, m_StylesFolderItem->rowCount());
+    m_ImagesFolderItem->removeRows(0, m_ImagesFolderItem->rowCount());
+    m_FontsFolderItem->removeRows(0, m_FontsFolderItem->rowCount());
+    m_MiscFolderItem->removeRows(0, m_MiscFolderItem->rowCount());
+    m_AudioFolderItem->removeRows(0, m_AudioFolderItem->rowCount());
+    m_VideoFolderItem->removeRows(0, m_VideoFolderItem->rowCount());
 
     int i = 0;
 
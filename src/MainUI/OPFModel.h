@@ -25,6 +25,7 @@
 #define OPFMODEL_H
 
 #include <QtCore/QSharedPointer>
+#include <QtCore/QTimer>
 #include <QtGui/QStandardItemModel>
 
 #include "BookManipulation/Book.h"
@@ -77,6 +78,14 @@ public:
      */
     void SortHTML(QList <QModelIndex> index_list);
 
+    /**
+     * Inserts a single newly added resource into its folder at its
+     * sorted position, avoiding the full model rebuild of Refresh().
+     *
+     * @param resource The resource that was added to the book.
+     */
+    void AddResource(Resource *resource);
+
 
     /**
      * Returns the QModelIndex of the first HTML file.
@@ -205,6 +214,12 @@ private slots:
      */
     void ItemChangedHandler(QStandardItem *item);
 
+    /**
+     * Writes the model's reading order into the spine once the drag
+     * and drop session that scheduled it has fully completed.
+     */
+    void SyncHTMLReadingOrders();
+
 
 private:
 
@@ -214,6 +229,23 @@ private:
      */
     void InitializeModel();
 
+    /**
+     * Builds the model item for a single resource, including its
+     * icon, tooltip and sorting roles. Shared by the full model
+     * fill and the incremental add path.
+     */
+    AlphanumericItem *CreateResourceItem(Resource *resource,
+                                         const QHash<Resource *, int> &reading_order_all,
+                                         const QHash<QString, QString> &semantic_type_all,
+                                         const QHash<QString, QString> &manifest_properties_all,
+                                         bool show_full_path);
+
+    /**
+     * Returns the folder item a resource of the given type belongs
+     * in. The OPF and NCX live at the root and have no folder.
+     */
+    QStandardItem *FolderItemForResourceType(Resource::ResourceType resource_type);
+
     /**
      * Updates the reading orders of the HTMLResources
      * with their order in the model.
@@ -275,6 +307,12 @@ private:
      */
     bool m_RefreshInProgress;
 
+    /**
+     * Coalesces the per-row remove events of a text folder drop into
+     * a single spine rewrite after the drop completes.
+     */
+    QTimer m_SpineSyncTimer;
+
     /**
      * The book whose model we are representing.
      */
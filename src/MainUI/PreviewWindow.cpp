@@ -36,6 +36,7 @@
 #include <QStyleOptionFrame>
 #include <QTimer>
 #include <QProgressBar>
+#include <QCryptographicHash>
 #include <QDebug>
 
 #include "MainUI/PreviewWindow.h"
@@ -74,7 +75,9 @@ PreviewWindow::PreviewWindow(QWidget *parent)
     m_buttons(new QHBoxLayout()),
     m_overlayBase(new OverlayHelperWidget(this)),
     m_Preview(new ViewPreview(m_overlayBase)),
-    m_Inspector(new Inspector(this)),
+    // the Inspector's QWebEngineView is expensive to spin up so it is
+    // only created on first use, see InspectPreviewPage()
+    m_Inspector(nullptr),
     m_progress(new QProgressBar(this)),
     m_Filepath(QString()),
     m_titleText(QString()),
@@ -337,6 +340,22 @@ bool PreviewWindow::UpdatePage(QString filename_url, QString text, QList<Element
         }
     }
 
+    // If the fully processed page is identical to what QtWebEngine has
+    // already rendered, skip the reload and just scroll to the new
+    // location.  Typing pauses and caret moves both funnel through here
+    // and a full page load per pause is wasted when nothing changed.
+    QByteArray page_hash = QCryptographicHash::hash(text.toUtf8(), QCryptographicHash::Md5);
+    if ((filename_url == m_Filepath) && (page_hash == m_LoadedPageHash) && m_Preview->WasLoadOkay()) {
+        DBG qDebug() << "PV UpdatePage skipping reload of unchanged page";
+        m_updatingPage = false;
+        m_OverlayTimer.stop();
+        m_progress->reset();
+        m_Preview->StoreCaretLocationUpdate(m_location);
+        m_Preview->ExecuteCaretUpdate();
+        return true;
+    }
+    m_LoadedPageHash = page_hash;
+
     m_Filepath = filename_url;
     m_Preview->CustomSetDocument(filename_url, text);
 
@@ -572,6 +591,10 @@ void PreviewWindow::InspectorClosed(int i)
 
 void PreviewWindow::InspectPreviewPage()
 {
+    if (!m_Inspector) {
+        m_Inspector = new Inspector(this);
+        connect(m_Inspector, SIGNAL(finished(int)), this, SLOT(InspectorClosed(int)));
+    }
     // non-modal dialog
     if (!m_Inspector->isVisible()) {
         DBG qDebug() << "inspecting";
@@ -605,6 +628,9 @@ void PreviewWindow::ReloadPreview()
     m_OverlayTimer.stop();
     m_Preview->HideOverlay();
     m_updatingPage = false;
+    // the user asked for a reload so do not let the
+    // unchanged-page check in UpdatePage skip it
+    m_LoadedPageHash.clear();
     emit RequestPreviewReload();
 }
 
@@ -633,7 +659,8 @@ void PreviewWindow::ConnectSignalsToSlots()
     connect(m_selectAction,  SIGNAL(triggered()),           this, SLOT(SelectAllPreview()));
     connect(m_copyAction,    SIGNAL(triggered()),           this, SLOT(CopyPreview()));
     connect(m_reloadAction,  SIGNAL(triggered()),           this, SLOT(ReloadPreview()));
-    connect(m_Inspector,     SIGNAL(finished(int)),         this, SLOT(InspectorClosed(int)));
+    // the Inspector's finished(int) is connected when it is lazily
+    // created in InspectPreviewPage()
     connect(this,     SIGNAL(topLevelChanged(bool)),        this, SLOT(previewFloated(bool)));
 }
 
@@ -133,6 +133,10 @@ private:
     QString m_Filepath;
     QString m_titleText;
 
+    // md5 of the last page handed to QtWebEngine (after all
+    // injections) so UpdatePage can skip reloading unchanged pages
+    QByteArray m_LoadedPageHash;
+
     QString m_mathjaxurl;
     QString m_usercssurl;
 
@@ -0,0 +1,229 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include <QtWidgets/QHeaderView>
+#include <QtWidgets/QTableWidget>
+
+#include "BookManipulation/Book.h"
+#include "BookManipulation/FolderKeeper.h"
+#include "MainUI/SearchResultsView.h"
+#include "ResourceObjects/Resource.h"
+#include "sigil_exception.h"
+
+SearchResultsView::SearchResultsView(QWidget *parent)
+    :
+    QDockWidget(tr("Search Results"), parent),
+    m_ResultTable(new QTableWidget(this)),
+    m_MatchCount(0)
+{
+    setWidget(m_ResultTable);
+    setAllowedAreas(Qt::BottomDockWidgetArea | Qt::TopDockWidgetArea);
+    SetUpTable();
+    connect(m_ResultTable, SIGNAL(itemDoubleClicked(QTableWidgetItem *)),
+            this, SLOT(ResultDoubleClicked(QTableWidgetItem *)));
+    // resultsReadyAt delivers whole files as their workers complete
+    connect(&m_Watcher, SIGNAL(resultsReadyAt(int, int)),
+            this, SLOT(ResultsReadyAt(int, int)));
+    connect(&m_Watcher, SIGNAL(finished()), this, SLOT(SearchFinished()));
+}
+
+
+SearchResultsView::~SearchResultsView()
+{
+    CancelRunningSearch();
+}
+
+
+void SearchResultsView::CancelRunningSearch()
+{
+    if (m_Watcher.isRunning()) {
+        // stops scheduling new resources, and the cancel flag makes
+        // the in-flight workers bail out between matches
+        SearchOperations::RequestCancel();
+        m_Watcher.cancel();
+        m_Watcher.waitForFinished();
+    }
+}
+
+
+void SearchResultsView::StreamSearchResults(const QString &search_regex, QList<Resource *> resources)
+{
+    CancelRunningSearch();
+    ConfigureTableForResults();
+    m_MatchCount = 0;
+    // Show the dock before the scan so the first files' matches are
+    // visible while the rest stream in.
+    show();
+    raise();
+    m_Watcher.setFuture(SearchOperations::ListMatchesInFiles(search_regex, resources));
+}
+
+
+void SearchResultsView::ResultsReadyAt(int begin_index, int end_index)
+{
+    for (int i = begin_index; i < end_index; i++) {
+        AppendRows(m_Watcher.resultAt(i));
+    }
+}
+
+
+void SearchResultsView::AppendRows(const QList<SearchOperations::SearchMatch> &matches)
+{
+    if (matches.isEmpty()) {
+        return;
+    }
+
+    // rows are allocated in one block per file so the table relayouts
+    // once per worker, not once per match
+    int rownum = m_ResultTable->rowCount();
+    m_ResultTable->setRowCount(rownum + matches.count());
+
+    foreach(const SearchOperations::SearchMatch &match, matches) {
+        QString path;
+        try {
+            Resource *resource = m_Book->GetFolderKeeper()->GetResourceByBookPath(match.bookpath);
+            path = resource->ShortPathName();
+        } catch (ResourceDoesNotExist&) {
+            path = match.bookpath;
+        }
+
+        QTableWidgetItem *item = new QTableWidgetItem(path);
+        item->setData(Qt::UserRole+1, match.bookpath);
+        item->setData(Qt::UserRole+2, match.offset);
+        m_ResultTable->setItem(rownum, 0, item);
+
+        item = new QTableWidgetItem(QString::number(match.line));
+        m_ResultTable->setItem(rownum, 1, item);
+
+        item = new QTableWidgetItem(match.snippet);
+        item->setToolTip(match.snippet);
+        m_ResultTable->setItem(rownum, 2, item);
+
+        rownum++;
+    }
+
+    m_MatchCount += matches.count();
+}
+
+
+void SearchResultsView::SearchFinished()
+{
+    if (m_MatchCount == 0) {
+        DisplayNoMatchesMessage();
+        return;
+    }
+
+    // Sorting is only switched on once the stream is done; sorting
+    // while rows arrive would re-sort under every append.
+    m_ResultTable->setSortingEnabled(true);
+    m_ResultTable->horizontalHeader()->setSortIndicatorShown(true);
+
+    // Make File and Line columns as small as possible
+    m_ResultTable->resizeColumnToContents(0);
+    m_ResultTable->resizeColumnToContents(1);
+}
+
+
+void SearchResultsView::SetBook(QSharedPointer<Book> book)
+{
+    CancelRunningSearch();
+    m_Book = book;
+    m_ResultTable->clearContents();
+    m_ResultTable->setRowCount(0);
+    m_MatchCount = 0;
+}
+
+
+void SearchResultsView::ResultDoubleClicked(QTableWidgetItem *item)
+{
+    Q_ASSERT(item);
+    int row = item->row();
+    QTableWidgetItem *path_item = m_ResultTable->item(row, 0);
+
+    if (!path_item) {
+        return;
+    }
+
+    QString bookpath = path_item->data(Qt::UserRole+1).toString();
+
+    // the "no matches" message row carries no book path
+    if (bookpath.isEmpty()) {
+        return;
+    }
+
+    QTableWidgetItem *line_item = m_ResultTable->item(row, 1);
+
+    if (!line_item) {
+        return;
+    }
+
+    int line = line_item->text().toInt();
+    int offset = path_item->data(Qt::UserRole+2).toInt();
+
+    try {
+        Resource *resource = m_Book->GetFolderKeeper()->GetResourceByBookPath(bookpath);
+        emit OpenResourceRequest(resource, line, offset, QString());
+    } catch (ResourceDoesNotExist&) {
+        return;
+    }
+}
+
+
+void SearchResultsView::showEvent(QShowEvent *event)
+{
+    QDockWidget::showEvent(event);
+    raise();
+}
+
+
+void SearchResultsView::SetUpTable()
+{
+    m_ResultTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_ResultTable->setTabKeyNavigation(false);
+    m_ResultTable->setDropIndicatorShown(false);
+    m_ResultTable->horizontalHeader()->setStretchLastSection(true);
+    m_ResultTable->verticalHeader()->setVisible(false);
+}
+
+
+void SearchResultsView::ConfigureTableForResults()
+{
+    m_ResultTable->clear();
+    m_ResultTable->setRowCount(0);
+    m_ResultTable->setColumnCount(3);
+    m_ResultTable->setHorizontalHeaderLabels(
+        QStringList() << tr("File") << tr("Line") << tr("Match"));
+    m_ResultTable->verticalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    m_ResultTable->setSortingEnabled(false);
+}
+
+
+void SearchResultsView::DisplayNoMatchesMessage()
+{
+    m_ResultTable->setRowCount(1);
+    m_ResultTable->setColumnCount(1);
+    m_ResultTable->setHorizontalHeaderLabels(
+        QStringList() << tr("Message"));
+    QTableWidgetItem *item = new QTableWidgetItem(tr("No matches found"));
+    item->setTextAlignment(Qt::AlignHCenter | Qt::AlignVCenter);
+    m_ResultTable->setItem(0, 0, item);
+    m_ResultTable->resizeRowToContents(0);
+}
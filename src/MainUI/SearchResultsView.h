@@ -0,0 +1,155 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef SEARCHRESULTSVIEW_H
+#define SEARCHRESULTSVIEW_H
+
+#include <QtCore/QFutureWatcher>
+#include <QtCore/QSharedPointer>
+#include <QtWidgets/QDockWidget>
+
+#include "MainUI/MainWindow.h"
+#include "Misc/SearchOperations.h"
+
+class QTableWidget;
+class QTableWidgetItem;
+
+class Book;
+
+/**
+ * Represents the pane that lists every match of a cross-file search as
+ * file/line/snippet rows.  Rows stream in per file as the parallel
+ * search workers finish, so a large book can be triaged while the rest
+ * of it is still being scanned.
+ */
+class SearchResultsView : public QDockWidget
+{
+    Q_OBJECT
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param parent The QObject's parent.
+     */
+    SearchResultsView(QWidget *parent = 0);
+
+    ~SearchResultsView();
+
+public slots:
+
+    /**
+     * Cancels any scan still running, clears the table and starts a
+     * fresh parallel scan of the given resources, appending each file's
+     * matches as its worker completes.
+     */
+    void StreamSearchResults(const QString &search_regex, QList<Resource *> resources);
+
+    /**
+     * Sets the book whose resources are being searched.
+     *
+     * @param book The book being searched.
+     */
+    void SetBook(QSharedPointer<Book> book);
+
+signals:
+
+    /**
+     * Emitted when the user double-clicks a match and thus wants
+     * a resource to be opened at that match.
+     *
+     * @param resource The resource that should be opened.
+     * @param line_to_scroll_to To which line should the resource scroll.
+     */
+    void OpenResourceRequest(Resource *resource,
+                             int line_to_scroll_to = -1,
+                             int position_to_scroll_to = -1,
+                             const QString &caret_location_to_scroll_to = QString());
+
+private slots:
+
+    /**
+     * Appends the per-file match lists delivered by finished workers.
+     */
+    void ResultsReadyAt(int begin_index, int end_index);
+
+    void SearchFinished();
+
+    /**
+     * Handles double-clicking on a match in the table.
+     *
+     * @param item The item that was clicked.
+     */
+    void ResultDoubleClicked(QTableWidgetItem *item);
+
+protected:
+    virtual void showEvent(QShowEvent *event);
+
+private:
+
+    /**
+     * Sets up the table widget to our liking.
+     */
+    void SetUpTable();
+
+    /**
+     * Configures the table for presenting search matches.
+     */
+    void ConfigureTableForResults();
+
+    /**
+     * Asks in-flight workers to stop and waits for the scan to wind down.
+     */
+    void CancelRunningSearch();
+
+    void AppendRows(const QList<SearchOperations::SearchMatch> &matches);
+
+    /**
+     * Informs the user that nothing matched.
+     */
+    void DisplayNoMatchesMessage();
+
+
+    ///////////////////////////////
+    // PRIVATE MEMBER VARIABLES
+    ///////////////////////////////
+
+    /**
+     * The table that holds all the search matches.
+     */
+    QTableWidget *m_ResultTable;
+
+    /**
+     * The book being searched.
+     */
+    QSharedPointer<Book> m_Book;
+
+    /**
+     * Watches the per-resource scan and delivers results as they finish.
+     */
+    QFutureWatcher<QList<SearchOperations::SearchMatch>> m_Watcher;
+
+    int m_MatchCount;
+};
+
+#endif // SEARCHRESULTSVIEW_H
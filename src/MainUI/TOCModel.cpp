@@ -185,9 +185,39 @@ TOCModel::TOCEntry TOCModel::ParseNavPoint(QXmlStreamReader &ncx)
 
 void TOCModel::BuildModel(const TOCModel::TOCEntry &root_entry)
 {
-    clear();
-    foreach(const TOCModel::TOCEntry & child_entry, root_entry.children) {
-        AddEntryToParentItem(child_entry, invisibleRootItem());
+    // Update the existing items in place and only insert or remove rows
+    // where the new tree actually differs, so that editing one navPoint
+    // does not rebuild the whole model and throw away the view's
+    // expansion state.
+    SyncEntryChildren(root_entry, invisibleRootItem());
+}
+
+
+void TOCModel::SyncEntryChildren(const TOCEntry &entry, QStandardItem *parent)
+{
+    Q_ASSERT(parent);
+    int common = qMin(entry.children.count(), parent->rowCount());
+
+    for (int i = 0; i < common; ++i) {
+        const TOCModel::TOCEntry &child_entry = entry.children.at(i);
+        QStandardItem *item = parent->child(i);
+
+        if (item->text() != child_entry.text) {
+            item->setText(child_entry.text);
+        }
+        if (item->data().toString() != child_entry.target) {
+            item->setData(child_entry.target);
+            item->setToolTip(child_entry.target);
+        }
+        SyncEntryChildren(child_entry, item);
+    }
+
+    if (parent->rowCount() > entry.children.count()) {
+        parent->removeRows(entry.children.count(), parent->rowCount() - entry.children.count());
+    }
+
+    for (int i = common; i < entry.children.count(); ++i) {
+        AddEntryToParentItem(entry.children.at(i), parent);
     }
 }
 
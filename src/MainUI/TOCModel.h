@@ -168,6 +168,13 @@ private:
      */
     void BuildModel(const TOCEntry &root_entry);
 
+    /**
+     * Recursively reconciles the children of the given entry with the
+     * rows under the given item, editing, removing and appending only
+     * where the two differ.
+     */
+    void SyncEntryChildren(const TOCEntry &entry, QStandardItem *parent);
+
     /**
      * Adds the provided entry as an item child to the provided parent.
      * Calls itself recursively if the entry has children of it's own.
@@ -45,7 +45,8 @@ TableOfContents::TableOfContents(QWidget *parent)
     m_MainWidget(new QWidget(this)),
     m_Layout(new QVBoxLayout(m_MainWidget)),
     m_TreeView(new QTreeView(m_MainWidget)),
-    m_TOCModel(new TOCModel(this))
+    m_TOCModel(new TOCModel(this)),
+    m_ExpandOnRefresh(true)
 {
     m_Layout->setContentsMargins(0, 0, 0, 0);
 #ifdef Q_OS_MAC
@@ -59,7 +60,7 @@ TableOfContents::TableOfContents(QWidget *parent)
     SetupTreeView();
     connect(m_TreeView, SIGNAL(clicked(const QModelIndex &)), this, SLOT(ItemClickedHandler(const QModelIndex &)));
     connect(&m_RefreshTimer, SIGNAL(timeout()), this, SLOT(Refresh()));
-    connect(m_TOCModel, SIGNAL(RefreshDone()), m_TreeView, SLOT(expandAll()));
+    connect(m_TOCModel, SIGNAL(RefreshDone()), this, SLOT(RefreshDoneHandler()));
 }
 
 void TableOfContents::showEvent(QShowEvent *event)
@@ -71,6 +72,7 @@ void TableOfContents::showEvent(QShowEvent *event)
 void TableOfContents::SetBook(QSharedPointer<Book> book)
 {
     m_Book = book;
+    m_ExpandOnRefresh = true;
     m_TOCModel->SetBook(book);
     m_EpubVersion = m_Book->GetConstOPF()->GetEpubVersion();
     if (m_EpubVersion.startsWith('3')) {
@@ -97,6 +99,17 @@ void TableOfContents::StartRefreshDelay()
     m_RefreshTimer.start();
 }
 
+void TableOfContents::RefreshDoneHandler()
+{
+    // Only the first fill for a book expands everything. Later
+    // refreshes update the model in place, so the user's expansion
+    // state is kept as they type in the Nav/NCX.
+    if (m_ExpandOnRefresh) {
+        m_TreeView->expandAll();
+        m_ExpandOnRefresh = false;
+    }
+}
+
 void TableOfContents::RenumberTOCContents()
 {
     if (m_EpubVersion.startsWith('3')) {
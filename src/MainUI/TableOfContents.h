@@ -91,6 +91,12 @@ private slots:
      */
     void ItemClickedHandler(const QModelIndex &index);
 
+    /**
+     * Expands the tree after the initial model fill for a book.
+     * Later refreshes keep the user's expansion state instead.
+     */
+    void RefreshDoneHandler();
+
 protected:
 
     void contextMenuEvent(QContextMenuEvent *event);
@@ -153,6 +159,12 @@ private:
 
     QString m_EpubVersion;
 
+    /**
+     * Set when the next finished refresh should expand the whole tree,
+     * i.e. on the initial fill for a newly set book.
+     */
+    bool m_ExpandOnRefresh;
+
 };
 
 #endif // TABLEOFCONTENTS_H
@@ -46,6 +46,9 @@ const QString ValidationResultsView::SEP = QString(QChar(31));
 
 static const QString SETTINGS_GROUP = "validation_results";
 
+// How many rows are filled in before letting the view repaint.
+static const int RESULT_CHUNK_SIZE = 256;
+
 
 ValidationResultsView::ValidationResultsView(QWidget *parent)
     :
@@ -224,18 +227,20 @@ void ValidationResultsView::ValidateCurrentBook()
         }
     }
     QApplication::restoreOverrideCursor();
-    DisplayResults(results);
+    // Show the dock before filling it so the first results are
+    // visible while the rest stream in.
     show();
     raise();
+    DisplayResults(results);
 }
 
 
 void ValidationResultsView::LoadResults(const QList<ValidationResult> &results)
 {
     ClearResults();
-    DisplayResults(results);
     show();
     raise();
+    DisplayResults(results);
 }
 
 
@@ -312,9 +317,13 @@ void ValidationResultsView::DisplayResults(const QList<ValidationResult> &result
     }
 
     ConfigureTableForResults();
+    // Allocate every row up front - inserting them one at a time makes
+    // the table relayout per row, which crawls on tens of thousands of
+    // results.
+    m_ResultTable->setRowCount(results.count());
+    int rownum = 0;
 
     Q_FOREACH(ValidationResult result, results) {
-        int rownum = m_ResultTable->rowCount();
         QTableWidgetItem *item = NULL;
 
         QBrush row_brush = Utility::ValidationResultBrush(Utility::INFO_BRUSH);
@@ -324,8 +333,6 @@ void ValidationResultsView::DisplayResults(const QList<ValidationResult> &result
             row_brush = Utility::ValidationResultBrush(Utility::ERROR_BRUSH);
         }
 
-        m_ResultTable->insertRow(rownum);
- 
         QString path;
         QString bookpath = result.BookPath();
         try {
@@ -355,8 +362,21 @@ void ValidationResultsView::DisplayResults(const QList<ValidationResult> &result
         item = new QTableWidgetItem(result.Message());
         SetItemPalette(item, row_brush);
         m_ResultTable->setItem(rownum, 3, item);
+
+        rownum++;
+
+        // Let the view paint the rows filled in so far, so the first
+        // errors show up right away and the UI stays responsive.
+        if ((rownum % RESULT_CHUNK_SIZE) == 0) {
+            qApp->processEvents(QEventLoop::ExcludeUserInputEvents);
+        }
     }
 
+    // Sorting is only switched on once the table is full; sorting
+    // during the fill re-sorts on every setItem call.
+    m_ResultTable->setSortingEnabled(true);
+    m_ResultTable->horizontalHeader()->setSortIndicatorShown(true);
+
     // Make Line and Offset columns as small as possible
     // Ditto for Filename
     m_ResultTable->resizeColumnToContents(0);
@@ -394,9 +414,7 @@ void ValidationResultsView::ConfigureTableForResults()
     m_ResultTable->setHorizontalHeaderLabels(
     QStringList() << tr("File") << tr("Line") << tr("Offset") << tr("Message"));
     m_ResultTable->verticalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
-    m_ResultTable->setSortingEnabled(true);
-    m_ResultTable->horizontalHeader()->setSortIndicatorShown(true);
-
+    m_ResultTable->setSortingEnabled(false);
 }
 
 
@@ -2417,22 +2417,39 @@ AsciiFy::AsciiFy()
 
 QString AsciiFy::convertToPlainAscii(const QString &ninput) const
 {
-    QString input = ninput;
-    input = input.replace(QChar(0x2013), QStringLiteral("--")).replace(QChar(0x2014), QStringLiteral("---"));
-    input = input.replace(" ", "_");
     QString result;
-    result.reserve(input.length() + 256);
-    for (const QChar &c : input) {
+    result.reserve(ninput.length() + 256);
+    /// The dash and space rewrites are folded into the single pass
+    /// here instead of running whole-string replace() passes first,
+    /// and the table output is appended without building a temporary
+    /// QString per character.
+    for (const QChar &c : ninput) {
         if (c.isHighSurrogate() || c.isLowSurrogate())
             /// Keep surrogate code points unchanged
             result.append(c);
         else {
             const auto unicode = c.unicode();
+            if (unicode == 0x20) {
+                result.append(QLatin1Char('_'));
+                continue;
+            }
+            if (unicode == 0x2013) {
+                result.append(QLatin1String("--"));
+                continue;
+            }
+            if (unicode == 0x2014) {
+                result.append(QLatin1String("---"));
+                continue;
+            }
             const auto index = unicode < 0xd800 ? unicode : unicode - 2048;
             const auto encodedposlen = unidecode_pos[index];
             const auto pos = encodedposlen >> 5;
             const auto len = static_cast<int>(encodedposlen & 31);
-            result.append(QString::fromLatin1(unidecode_text + pos, len));
+            if (len == 1) {
+                result.append(QLatin1Char(unidecode_text[pos]));
+            } else if (len > 1) {
+                result.append(QLatin1String(unidecode_text + pos, len));
+            }
         }
     }
     return result;
@@ -2440,6 +2457,17 @@ QString AsciiFy::convertToPlainAscii(const QString &ninput) const
 
 bool AsciiFy::containsOnlyAscii(const QString &ntext)
 {
+    /// Normalization cannot introduce non-ascii into pure ascii text,
+    /// so text that scans clean as-is skips the normalization pass
+    bool only_ascii = true;
+    for (const QChar &c : ntext) {
+        if (c.unicode() > 127) {
+            only_ascii = false;
+            break;
+        }
+    }
+    if (only_ascii) return true;
+
     /// Perform Canonical Decomposition followed by Canonical Composition
     const QString text = ntext.normalized(QString::NormalizationForm_C);
 
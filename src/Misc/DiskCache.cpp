@@ -0,0 +1,168 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QStringBuilder>
+
+#include "Misc/DiskCache.h"
+#include "Misc/Utility.h"
+
+// Identifies a Sigil cache file; anything without it is ignored.
+static const quint32 CACHE_FILE_MAGIC = 0x53474C43;  // "SGLC"
+
+// Bump whenever the payload format of any category changes.  Old
+// entries then miss and are rewritten instead of being misread.
+static const quint32 CACHE_FORMAT_VERSION = 1;
+
+// Entries untouched for this long are removed on startup.
+static const int STALE_ENTRY_DAYS = 90;
+
+DiskCache *DiskCache::m_instance = 0;
+
+DiskCache *DiskCache::instance()
+{
+    if (m_instance == 0) {
+        m_instance = new DiskCache();
+    }
+
+    return m_instance;
+}
+
+
+DiskCache::DiskCache()
+    : m_CacheDir(Utility::DefinePrefsDir() % "/cache")
+{
+    QDir().mkpath(m_CacheDir);
+    PruneStaleEntries();
+}
+
+
+QString DiskCache::KeyForFile(const QString &fullfilepath)
+{
+    QFileInfo fi(fullfilepath);
+    QString identity = fullfilepath % "|" % QString::number(fi.size()) % "|" %
+                       QString::number(fi.lastModified().toMSecsSinceEpoch());
+    return QString(QCryptographicHash::hash(identity.toUtf8(), QCryptographicHash::Md5).toHex());
+}
+
+
+QString DiskCache::CacheFilePath(const QString &category, const QString &key) const
+{
+    return m_CacheDir % "/" % category % "/" % key;
+}
+
+
+QByteArray DiskCache::Load(const QString &category, const QString &key)
+{
+    QMutexLocker locker(&m_Mutex);
+    QFile file(CacheFilePath(category, key));
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+
+    // Map the file so the header check and the payload copy read
+    // straight from the page cache, falling back to a plain read on
+    // filesystems that can not map.
+    QByteArray raw;
+    uchar *mapped = file.map(0, file.size());
+
+    if (mapped) {
+        raw = QByteArray::fromRawData(reinterpret_cast<const char *>(mapped), file.size());
+    } else {
+        raw = file.readAll();
+    }
+
+    QDataStream in(raw);
+    quint32 magic = 0;
+    quint32 version = 0;
+    QByteArray payload;
+    in >> magic >> version;
+
+    if (magic != CACHE_FILE_MAGIC || version != CACHE_FORMAT_VERSION) {
+        return QByteArray();
+    }
+
+    in >> payload;
+
+    if (in.status() != QDataStream::Ok) {
+        return QByteArray();
+    }
+
+    // Detach from the mapping before the file closes; the pruner uses
+    // read times, so touch the entry to mark it as still wanted.
+    payload.detach();
+    file.close();
+#if QT_VERSION >= QT_VERSION_CHECK(5, 10, 0)
+    QFile::setFileTime(file.fileName(), QDateTime::currentDateTime(), QFileDevice::FileModificationTime);
+#endif
+    return payload;
+}
+
+
+void DiskCache::Store(const QString &category, const QString &key, const QByteArray &data)
+{
+    QMutexLocker locker(&m_Mutex);
+    QDir().mkpath(m_CacheDir % "/" % category);
+
+    // Write to the side and rename into place so a crash mid-write can
+    // never leave a truncated entry under the real name.
+    QString filepath = CacheFilePath(category, key);
+    QFile file(filepath % ".tmp");
+
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return;
+    }
+
+    QDataStream out(&file);
+    out << CACHE_FILE_MAGIC << CACHE_FORMAT_VERSION << data;
+    file.close();
+
+    if (out.status() != QDataStream::Ok) {
+        file.remove();
+        return;
+    }
+
+    QFile::remove(filepath);
+    file.rename(filepath);
+}
+
+
+void DiskCache::PruneStaleEntries()
+{
+    QDateTime cutoff = QDateTime::currentDateTime().addDays(-STALE_ENTRY_DAYS);
+    QDirIterator it(m_CacheDir, QDir::Files, QDirIterator::Subdirectories);
+
+    while (it.hasNext()) {
+        it.next();
+
+        if (it.fileInfo().lastModified() < cutoff) {
+            QFile::remove(it.filePath());
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef DISKCACHE_H
+#define DISKCACHE_H
+
+#include <QByteArray>
+#include <QMutex>
+#include <QString>
+
+/**
+ * Singleton.
+ *
+ * A persistent cache for derived data that lives in a "cache" folder
+ * next to the rest of Sigil's preference data.  The in-memory caches
+ * all start cold on every launch, so reopening the same book repeats
+ * work whose inputs have not changed at all.  Entries written here
+ * survive restarts and are keyed so an entry is only ever served while
+ * its source file is byte-for-byte the same.
+ *
+ * Every cache file carries a magic number and a format version in its
+ * header; entries written by a different Sigil simply miss and get
+ * rebuilt, so the payload format can change freely between releases.
+ */
+
+class DiskCache
+{
+
+public:
+
+    static DiskCache *instance();
+
+    /**
+     * A filename-safe key identifying the current contents of a file.
+     * The key folds in the file's path, size and modification time, so
+     * a file changed on disk misses the cache the same way it misses
+     * the in-memory caches.
+     */
+    static QString KeyForFile(const QString &fullfilepath);
+
+    /**
+     * Returns the payload stored under the category and key, or an
+     * empty byte array when there is no entry, the entry was written
+     * by a different format version, or the file is unreadable.
+     */
+    QByteArray Load(const QString &category, const QString &key);
+
+    /**
+     * Persists the payload under the category and key, replacing any
+     * previous entry.  Failures are silent; the cache is strictly an
+     * accelerator and the caller has the data it just computed.
+     */
+    void Store(const QString &category, const QString &key, const QByteArray &data);
+
+private:
+
+    DiskCache();
+
+    /**
+     * The file an entry lives in: <prefs>/cache/<category>/<key>.
+     */
+    QString CacheFilePath(const QString &category, const QString &key) const;
+
+    /**
+     * Drops entries that have not been written or read back for a long
+     * time, so books the user no longer opens do not pin disk space.
+     */
+    void PruneStaleEntries();
+
+    QString m_CacheDir;
+
+    QMutex m_Mutex;
+
+    static DiskCache *m_instance;
+};
+
+#endif // DISKCACHE_H
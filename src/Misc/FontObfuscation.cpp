@@ -19,10 +19,16 @@
 **
 *************************************************************************/
 
+#include <cstring>
+
 #include <QtCore/QByteArray>
 #include <QtCore/QCryptographicHash>
 #include <QtCore/QFile>
 #include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
+#include <QtConcurrent/QtConcurrent>
 
 #include "Misc/FontObfuscation.h"
 #include "sigil_constants.h"
@@ -55,23 +61,69 @@ QByteArray AdobeKeyFromIdentifier(const QString &identifier)
 }
 
 
-void IdpfObfuscate(const QString &filepath, const QString &identifier)
+// A book has one identifier but many fonts, so the derived key is
+// computed once per algorithm and identifier instead of once per font.
+// Guarded because the batch path runs on the thread pool.
+QMutex derived_key_mutex;
+QHash<QString, QByteArray> derived_key_cache;
+
+QByteArray DerivedKey(const QString &algorithm, const QString &identifier)
 {
+    const QString cache_key = algorithm + "|" + identifier;
+    QMutexLocker locker(&derived_key_mutex);
+    QHash<QString, QByteArray>::const_iterator it = derived_key_cache.constFind(cache_key);
+    if (it != derived_key_cache.constEnd()) {
+        return it.value();
+    }
+
+    QByteArray key = (algorithm == ADOBE_FONT_ALGO_ID)
+                     ? AdobeKeyFromIdentifier(identifier)
+                     : IdpfKeyFromIdentifier(identifier);
+    derived_key_cache.insert(cache_key, key);
+    return key;
+}
+
+
+// Both algorithms XOR only the first KB or so of the font, so there is
+// no reason to read and rewrite the whole file; only the obfuscated
+// prefix is touched on disk.
+void XorFilePrefix(const QString &filepath, const QByteArray &key, int num_bytes)
+{
+    int key_size = key.size();
+    if (key_size == 0) {
+        return;
+    }
+
     QFile file(filepath);
 
     if (!file.open(QFile::ReadWrite)) {
         return;
     }
 
-    QByteArray contents = file.readAll();
-    QByteArray key = IdpfKeyFromIdentifier(identifier);
-    int key_size   = key.size();
-    if (key_size == 0) {
-        return;
+    QByteArray contents = file.read(num_bytes);
+    const int n = contents.size();
+
+    // Tile the key across a scratch buffer once, then fold it in with
+    // word-sized XORs instead of a byte-and-modulo loop.
+    QByteArray tiled;
+    tiled.resize(n);
+    char *tiled_data = tiled.data();
+    for (int filled = 0; filled < n; filled += key_size) {
+        memcpy(tiled_data + filled, key.constData(), qMin(key_size, n - filled));
     }
 
-    for (int i = 0; (i < IDPF_METHOD_NUM_BYTES) && (i < contents.size()); ++i) {
-        contents[ i ] = contents[ i ] ^ key[ i % key_size ];
+    char *data = contents.data();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        quint64 chunk;
+        quint64 key_chunk;
+        memcpy(&chunk, data + i, 8);
+        memcpy(&key_chunk, tiled_data + i, 8);
+        chunk ^= key_chunk;
+        memcpy(data + i, &chunk, 8);
+    }
+    for (; i < n; ++i) {
+        data[ i ] = data[ i ] ^ tiled_data[ i ];
     }
 
     file.seek(0);
@@ -79,27 +131,25 @@ void IdpfObfuscate(const QString &filepath, const QString &identifier)
 }
 
 
-void AdobeObfuscate(const QString &filepath, const QString &identifier)
+void IdpfObfuscate(const QString &filepath, const QString &identifier)
 {
-    QFile file(filepath);
+    XorFilePrefix(filepath, DerivedKey(IDPF_FONT_ALGO_ID, identifier), IDPF_METHOD_NUM_BYTES);
+}
 
-    if (!file.open(QFile::ReadWrite)) {
-        return;
-    }
 
-    QByteArray contents = file.readAll();
-    QByteArray key = AdobeKeyFromIdentifier(identifier);
-    int key_size   = key.size();
-    if (key_size == 0) {
-        return;
-    }
+void AdobeObfuscate(const QString &filepath, const QString &identifier)
+{
+    XorFilePrefix(filepath, DerivedKey(ADOBE_FONT_ALGO_ID, identifier), ADOBE_METHOD_NUM_BYTES);
+}
 
-    for (int i = 0; (i < ADOBE_METHOD_NUM_BYTES) && (i < contents.size()); ++i) {
-        contents[ i ] = contents[ i ] ^ key[ i % key_size ];
-    }
 
-    file.seek(0);
-    file.write(contents);
+void ObfuscateOneValidatedFile(FontObfuscation::ObfuscationJob &job)
+{
+    if (job.algorithm == ADOBE_FONT_ALGO_ID) {
+        AdobeObfuscate(job.filepath, job.identifier);
+    } else {
+        IdpfObfuscate(job.filepath, job.identifier);
+    }
 }
 
 };
@@ -127,3 +177,22 @@ void FontObfuscation::ObfuscateFile(const QString &filepath,
 }
 
 
+void FontObfuscation::ObfuscateFiles(const QList<ObfuscationJob> &jobs)
+{
+    // Validate on the calling thread so the errors still surface as
+    // FontObfuscationError; the workers then only do file io.
+    foreach(const ObfuscationJob &job, jobs) {
+        if (!QFileInfo(job.filepath).exists() ||
+            job.algorithm.isEmpty()             ||
+            job.identifier.isEmpty()            ||
+            ((job.algorithm != ADOBE_FONT_ALGO_ID) && (job.algorithm != IDPF_FONT_ALGO_ID))) {
+            std::string msg = job.filepath.toStdString() + ": " + job.algorithm.toStdString() + ": " + job.identifier.toStdString();
+            throw(FontObfuscationError(msg));
+        }
+    }
+
+    QList<ObfuscationJob> work = jobs;
+    QtConcurrent::blockingMap(work, ObfuscateOneValidatedFile);
+}
+
+
@@ -23,13 +23,28 @@
 #ifndef FONTOBFUSCATION_H
 #define FONTOBFUSCATION_H
 
-class QString;
+#include <QtCore/QList>
+#include <QtCore/QString>
 
 namespace FontObfuscation
 {
+
+// One font file to (de)obfuscate in a batch.
+struct ObfuscationJob {
+    QString filepath;
+    QString algorithm;
+    QString identifier;
+};
+
 void ObfuscateFile(const QString &filepath,
                    const QString &algorithm,
                    const QString &identifier);
+
+// (De)obfuscates the files on the thread pool; each file is
+// independent so a batch of 60+ fonts no longer runs serially.
+// Validates every job up front with the same errors ObfuscateFile
+// throws.
+void ObfuscateFiles(const QList<ObfuscationJob> &jobs);
 }
 
 #endif // FONTOBFUSCATION_H
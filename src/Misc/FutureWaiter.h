@@ -0,0 +1,129 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef FUTUREWAITER_H
+#define FUTUREWAITER_H
+
+#include <QtCore/QEventLoop>
+#include <QtCore/QFuture>
+#include <QtCore/QList>
+#include <QtCore/QThread>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QProgressDialog>
+
+/**
+ * The one way we wait for QtConcurrent futures from the GUI thread.
+ *
+ * Calling waitForFinished() or blockingMapped() on the GUI thread
+ * freezes the window for the whole operation - no repaints, no progress,
+ * and the OS soon flags the application as not responding.  Instead
+ * these helpers pump the event loop (with user input excluded, so open
+ * tabs cannot edit resources the workers are reading) until the future
+ * finishes, the same way SearchOperations and UniversalUpdates have
+ * always driven their progress dialogs.
+ */
+class FutureWaiter
+{
+public:
+
+    /**
+     * Waits for the future to finish while keeping the GUI responsive.
+     */
+    template <typename T>
+    static void Wait(const QFuture<T> &future)
+    {
+        while (!future.isFinished()) {
+            qApp->processEvents(QEventLoop::ExcludeUserInputEvents, 100);
+            QThread::msleep(10);
+        }
+    }
+
+    /**
+     * Same, but feeds the future's own progress into a progress dialog
+     * and runs it to its maximum when the future completes.
+     */
+    template <typename T>
+    static void Wait(const QFuture<T> &future, QProgressDialog &progress)
+    {
+        while (!future.isFinished()) {
+            progress.setValue(future.progressValue());
+            qApp->processEvents(QEventLoop::ExcludeUserInputEvents, 100);
+            QThread::msleep(10);
+        }
+        progress.setValue(progress.maximum());
+    }
+
+    /**
+     * Waits for a whole batch of futures.  Any QFuture<T> converts to
+     * QFuture<void>, so heterogeneous pipelines can be waited together.
+     */
+    static void Wait(const QList<QFuture<void>> &futures)
+    {
+        foreach(const QFuture<void> &future, futures) {
+            Wait(future);
+        }
+    }
+
+    /**
+     * Batch wait with a progress dialog fed by the summed progress of
+     * every future.
+     */
+    static void Wait(const QList<QFuture<void>> &futures, QProgressDialog &progress)
+    {
+        bool finished = false;
+        while (!finished) {
+            finished = true;
+            int progress_value = 0;
+            foreach(const QFuture<void> &future, futures) {
+                if (!future.isFinished()) {
+                    finished = false;
+                }
+                progress_value += future.progressValue();
+            }
+            if (finished) {
+                break;
+            }
+            progress.setValue(progress_value);
+            qApp->processEvents(QEventLoop::ExcludeUserInputEvents, 100);
+            QThread::msleep(10);
+        }
+        progress.setValue(progress.maximum());
+    }
+
+    /**
+     * The drop-in replacement for QtConcurrent::blockingMapped(): waits
+     * for a mapped future without blocking and hands back its results.
+     */
+    template <typename T>
+    static QList<T> Results(QFuture<T> future)
+    {
+        Wait(future);
+        return future.results();
+    }
+
+private:
+
+    // Everything is static; never instantiated.
+    FutureWaiter();
+};
+
+#endif // FUTUREWAITER_H
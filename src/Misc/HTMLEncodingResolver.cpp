@@ -21,6 +21,7 @@
 **
 *************************************************************************/
 
+#include <cstring>
 #include <string>
 
 #include <QtCore/QFile>
@@ -128,7 +129,6 @@ const QTextCodec *HTMLEncodingResolver::GetCodecForHTML(const QByteArray &raw_te
 
     // Finally, let Qt guess and if it doesn't know it will return the codec
     // for the current locale.
-    text = raw_text;
     return QTextCodec::codecForHtml(raw_text, QTextCodec::codecForLocale());
 }
 
@@ -145,60 +145,96 @@ bool HTMLEncodingResolver::IsValidUtf8(const QByteArray &string)
     // checks if the sent byte-sequence conforms to this pattern.
     // If it does, chances are *very* high that this is UTF-8.
     //
-    // This function is written to be fast, not pretty.
+    // This function is written to be fast, not pretty.  It reads the
+    // buffer in place - the old version built a 4 byte QByteArray per
+    // character, which made this a visible chunk of every import -
+    // and skips runs of plain ASCII a machine word at a time, since
+    // that is what most html bytes are.
     if (string.isNull()) {
         return false;
     }
 
+    const unsigned char *data = (const unsigned char *) string.constData();
+    int size  = string.size();
     int index = 0;
 
-    while (index < string.size()) {
-        QByteArray dword = string.mid(index, 4);
+    while (index < size) {
 
-        if (dword.size() < 4) {
-            dword = dword.leftJustified(4, '\0');
+        // ASCII fast path: whole words with no high bit set are
+        // mostly-printable ASCII and only need the cheap byte checks.
+        while (index + (int) sizeof(quint64) <= size) {
+            quint64 word;
+            memcpy(&word, data + index, sizeof(quint64));
+
+            if (word & Q_UINT64_C(0x8080808080808080)) {
+                break;
+            }
+
+            bool all_plain = true;
+
+            for (int k = 0; k < (int) sizeof(quint64); ++k) {
+                unsigned char c = data[ index + k ];
+
+                if (!(c == 0x09 || c == 0x0A || c == 0x0D || (0x20 <= c && c <= 0x7E))) {
+                    all_plain = false;
+                    break;
+                }
+            }
+
+            if (!all_plain) {
+                break;
+            }
+
+            index += sizeof(quint64);
+        }
+
+        if (index >= size) {
+            break;
         }
 
-        const unsigned char *bytes = (const unsigned char *) dword.constData();
+        unsigned char b0 = data[ index ];
+        unsigned char b1 = (index + 1 < size) ? data[ index + 1 ] : 0;
+        unsigned char b2 = (index + 2 < size) ? data[ index + 2 ] : 0;
+        unsigned char b3 = (index + 3 < size) ? data[ index + 3 ] : 0;
 
         // ASCII
-        if (bytes[0] == 0x09 ||
-            bytes[0] == 0x0A ||
-            bytes[0] == 0x0D ||
-            (0x20 <= bytes[0] && bytes[0] <= 0x7E)
+        if (b0 == 0x09 ||
+            b0 == 0x0A ||
+            b0 == 0x0D ||
+            (0x20 <= b0 && b0 <= 0x7E)
            ) {
             index += 1;
         }
         // non-overlong 2-byte
-        else if ((0xC2 <= bytes[0] && bytes[0] <= 0xDF) &&
-                 (0x80 <= bytes[1] && bytes[1] <= 0xBF)
+        else if ((0xC2 <= b0 && b0 <= 0xDF) &&
+                 (0x80 <= b1 && b1 <= 0xBF)
                 ) {
             index += 2;
-        } else if ((bytes[0] == 0xE0                         &&              // excluding overlongs
-                    (0xA0 <= bytes[1] && bytes[1] <= 0xBF) &&
-                    (0x80 <= bytes[2] && bytes[2] <= 0xBF)) ||
-                   (((0xE1 <= bytes[0] && bytes[0] <= 0xEC) ||               // straight 3-byte
-                     bytes[0] == 0xEE                         ||
-                     bytes[0] == 0xEF) &&
-                    (0x80 <= bytes[1] && bytes[1] <= 0xBF)   &&
-                    (0x80 <= bytes[2] && bytes[2] <= 0xBF)) ||
-                   (bytes[0] == 0xED                         &&              // excluding surrogates
-                    (0x80 <= bytes[1] && bytes[1] <= 0x9F) &&
-                    (0x80 <= bytes[2] && bytes[2] <= 0xBF))
+        } else if ((b0 == 0xE0                 &&              // excluding overlongs
+                    (0xA0 <= b1 && b1 <= 0xBF) &&
+                    (0x80 <= b2 && b2 <= 0xBF)) ||
+                   (((0xE1 <= b0 && b0 <= 0xEC) ||             // straight 3-byte
+                     b0 == 0xEE                 ||
+                     b0 == 0xEF) &&
+                    (0x80 <= b1 && b1 <= 0xBF) &&
+                    (0x80 <= b2 && b2 <= 0xBF)) ||
+                   (b0 == 0xED                 &&              // excluding surrogates
+                    (0x80 <= b1 && b1 <= 0x9F) &&
+                    (0x80 <= b2 && b2 <= 0xBF))
                   ) {
             index += 3;
-        } else if ((bytes[0] == 0xF0                         &&              // planes 1-3
-                    (0x90 <= bytes[1] && bytes[1] <= 0xBF) &&
-                    (0x80 <= bytes[2] && bytes[2] <= 0xBF) &&
-                    (0x80 <= bytes[3] && bytes[3] <= 0xBF)) ||
-                   ((0xF1 <= bytes[0] && bytes[0] <= 0xF3) &&              // planes 4-15
-                    (0x80 <= bytes[1] && bytes[1] <= 0xBF) &&
-                    (0x80 <= bytes[2] && bytes[2] <= 0xBF) &&
-                    (0x80 <= bytes[3] && bytes[3] <= 0xBF)) ||
-                   (bytes[0] == 0xF4                         &&            // plane 16
-                    (0x80 <= bytes[1] && bytes[1] <= 0x8F) &&
-                    (0x80 <= bytes[2] && bytes[2] <= 0xBF) &&
-                    (0x80 <= bytes[3] && bytes[3] <= 0xBF))
+        } else if ((b0 == 0xF0                 &&              // planes 1-3
+                    (0x90 <= b1 && b1 <= 0xBF) &&
+                    (0x80 <= b2 && b2 <= 0xBF) &&
+                    (0x80 <= b3 && b3 <= 0xBF)) ||
+                   ((0xF1 <= b0 && b0 <= 0xF3) &&              // planes 4-15
+                    (0x80 <= b1 && b1 <= 0xBF) &&
+                    (0x80 <= b2 && b2 <= 0xBF) &&
+                    (0x80 <= b3 && b3 <= 0xBF)) ||
+                   (b0 == 0xF4                 &&              // plane 16
+                    (0x80 <= b1 && b1 <= 0x8F) &&
+                    (0x80 <= b2 && b2 <= 0xBF) &&
+                    (0x80 <= b3 && b3 <= 0xBF))
                   ) {
             index += 4;
         } else {
@@ -20,6 +20,10 @@
 **
 *************************************************************************/
 
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
 #include <QtCore/QString>
 #include <QtCore/QTextCodec>
 #include <QRegularExpression>
@@ -36,26 +40,45 @@ const int MAX_WORD_LENGTH  = 90;
 
 const QString ENTITYWORDCHARS = ";#01234567890abcdefABCDEFxX";
 
-QList<HTMLSpellCheck::MisspelledWord> HTMLSpellCheck::GetMisspelledWords(const QString &orig_text,
-        int start_offset,
-        int end_offset,
-        const QString &search_regex,
-        bool first_only,
-        bool include_all_words)
+// Token streams from earlier segmentations keyed on a hash of the text
+// and the segmentation settings.  Counting, underlining and word audit
+// paths all tokenize the same text, so they share one pass over it.
+// Guarded by a mutex since word counts are gathered on pool threads.
+static QHash<QByteArray, QList<HTMLSpellCheck::MisspelledWord>> token_cache;
+static QList<QByteArray> token_cache_order;
+static QMutex token_cache_mutex;
+static const int MAX_CACHED_TOKEN_STREAMS = 500;
+
+QList<HTMLSpellCheck::MisspelledWord> HTMLSpellCheck::GetTokens(const QString &orig_text)
 {
     SpellCheck *sc = SpellCheck::instance();
     QString wordChars = sc->getWordChars();
     // Adding a soft hyphen to wordChars to avoid treating this character
     // as a boundary within a word
     wordChars = wordChars + QChar(0x00ad);
+    bool use_nums = SettingsStore::hotSettings().spell_check_numbers;
+
+    QCryptographicHash sum(QCryptographicHash::Sha1);
+    sum.addData(QByteArray::fromRawData(reinterpret_cast<const char*>(orig_text.constData()),
+                                        orig_text.size() * int(sizeof(QChar))));
+    sum.addData(wordChars.toUtf8());
+    sum.addData(use_nums ? "1" : "0", 1);
+    QByteArray key = sum.result();
+
+    {
+        QMutexLocker locker(&token_cache_mutex);
+        if (token_cache.contains(key)) {
+            token_cache_order.removeOne(key);
+            token_cache_order.append(key);
+            return token_cache.value(key);
+        }
+    }
+
     bool in_tag = false;
     bool in_invalid_word = false;
     bool in_entity = false;
     int word_start = 0;
-    SettingsStore ss;
-    bool use_nums = ss.spellCheckNumbers();
-    QRegularExpression search(search_regex);
-    QList<HTMLSpellCheck::MisspelledWord> misspellings;
+    QList<HTMLSpellCheck::MisspelledWord> tokens;
     // Make sure text has beginning/end boundary markers for easier parsing
     QString text = QChar(' ') + orig_text + QChar(' ');
     // Ignore <style...</style> wherever it appears - change to spaces to keep text positions
@@ -87,28 +110,13 @@ QList<HTMLSpellCheck::MisspelledWord> HTMLSpellCheck::GetMisspelledWords(const Q
                 if (!in_invalid_word && !in_entity && word_start != -1 && (i - word_start) > 0) {
                     QString word = Utility::Substring(word_start, i, text);
 
-                    if (!word.isEmpty() && word_start > start_offset && word_start <= end_offset) {
-                        if (include_all_words || !sc->spellPS(word)) {
-                            int cap_start = -1;
-
-                            if (!search_regex.isEmpty()) {
-                                QRegularExpressionMatch mo = search.match(word);
-                                cap_start = mo.capturedStart();
-                            }
-
-                            if (search_regex.isEmpty() || cap_start != -1) {
-                                struct MisspelledWord misspelled_word;
-                                misspelled_word.text = word;
-                                // Make sure we account for the extra boundary added at the beginning
-                                misspelled_word.offset = word_start - 1;
-                                misspelled_word.length = i - word_start ;
-                                misspellings.append(misspelled_word);
-
-                                if (first_only) {
-                                    return misspellings;
-                                }
-                            }
-                        }
+                    if (!word.isEmpty()) {
+                        struct MisspelledWord token;
+                        token.text = word;
+                        // Make sure we account for the extra boundary added at the beginning
+                        token.offset = word_start - 1;
+                        token.length = i - word_start ;
+                        tokens.append(token);
                     }
                 }
 
@@ -144,6 +152,52 @@ QList<HTMLSpellCheck::MisspelledWord> HTMLSpellCheck::GetMisspelledWords(const Q
         }
     }
 
+    QMutexLocker locker(&token_cache_mutex);
+    token_cache.insert(key, tokens);
+    token_cache_order.append(key);
+    if (token_cache_order.count() > MAX_CACHED_TOKEN_STREAMS) {
+        token_cache.remove(token_cache_order.takeFirst());
+    }
+    return tokens;
+}
+
+
+QList<HTMLSpellCheck::MisspelledWord> HTMLSpellCheck::GetMisspelledWords(const QString &orig_text,
+        int start_offset,
+        int end_offset,
+        const QString &search_regex,
+        bool first_only,
+        bool include_all_words)
+{
+    SpellCheck *sc = SpellCheck::instance();
+    QRegularExpression search(search_regex);
+    QList<HTMLSpellCheck::MisspelledWord> misspellings;
+    const QList<HTMLSpellCheck::MisspelledWord> tokens = GetTokens(orig_text);
+
+    foreach(const HTMLSpellCheck::MisspelledWord &token, tokens) {
+        // token offsets are relative to the original text; the range
+        // check matches the one the inline tokenizer used to make
+        int word_start = token.offset + 1;
+
+        if (word_start <= start_offset || word_start > end_offset) {
+            continue;
+        }
+        if (!include_all_words && sc->spellPS(token.text)) {
+            continue;
+        }
+        if (!search_regex.isEmpty()) {
+            QRegularExpressionMatch mo = search.match(token.text);
+            if (mo.capturedStart() == -1) {
+                continue;
+            }
+        }
+        misspellings.append(token);
+
+        if (first_only) {
+            return misspellings;
+        }
+    }
+
     return misspellings;
 }
 
@@ -75,6 +75,13 @@ public:
 
 private:
 
+    /**
+     * Returns every word token in text with its offset and length.
+     * The segmentation is memoized by content, so the counting and
+     * underlining paths share one tokenization of the same text.
+     */
+    static QList<MisspelledWord> GetTokens(const QString &text);
+
     static bool IsBoundary(QChar prev_c, QChar c, QChar next_c, const QString & wordChars, bool use_nums);
     static bool IsValidChar(const QChar & c, bool use_nums);
 };
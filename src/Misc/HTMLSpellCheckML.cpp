@@ -19,6 +19,10 @@
 **
 *************************************************************************/
 
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
 #include <QString>
 #include "Misc/Utility.h"
 #include "Misc/SettingsStore.h"
@@ -29,21 +33,57 @@
 const int MAX_WORD_LENGTH  = 90;
 const QString ENTITYWORDCHARS = ";#01234567890abcdefABCDEFxX";
 
+// Word lists from earlier segmentations keyed on a hash of the source
+// and the segmentation settings, so the Spellcheck Editor scan, word
+// highlighting and word replacement share one tokenization per file.
+// Guarded by a mutex since the word scan runs on a pool thread.
+static QHash<QByteArray, QList<HTMLSpellCheckML::AWord>> wordlist_cache;
+static QList<QByteArray> wordlist_cache_order;
+static QMutex wordlist_cache_mutex;
+static const int MAX_CACHED_WORD_LISTS = 50;
+
 QList<HTMLSpellCheckML::AWord> HTMLSpellCheckML::GetWordList(const QString &source, const QString & default_lang)
 {
     QList<HTMLSpellCheckML::AWord> wordlist;
     SpellCheck *sc = SpellCheck::instance();
     QString wc = sc->getWordChars() + QChar(0x00ad); // add in soft hyphen
-    SettingsStore ss;
-    bool use_nums = ss.spellCheckNumbers();
+    bool use_nums = SettingsStore::hotSettings().spell_check_numbers;
+
+    QCryptographicHash sum(QCryptographicHash::Sha1);
+    sum.addData(QByteArray::fromRawData(reinterpret_cast<const char*>(source.constData()),
+                                        source.size() * int(sizeof(QChar))));
+    sum.addData(default_lang.toUtf8());
+    sum.addData(wc.toUtf8());
+    sum.addData(use_nums ? "1" : "0", 1);
+    QByteArray key = sum.result();
+
+    {
+        QMutexLocker locker(&wordlist_cache_mutex);
+        if (wordlist_cache.contains(key)) {
+            wordlist_cache_order.removeOne(key);
+            wordlist_cache_order.append(key);
+            return wordlist_cache.value(key);
+        }
+    }
+
+    // serve every tag's attribute nodes from one bump arena that is
+    // torn down en masse once the whole document has been scanned
+    TagAttsArena arena;
     QuickParser qp(source, default_lang);
     while(true) {
         QuickParser::MarkupInfo mi = qp.parse_next();
         if (mi.pos < 0) break;
         if (!mi.text.isEmpty() && !(mi.tpath.endsWith(".style") || mi.tpath.endsWith("script"))) {
-            parse_text_into_words(wordlist, wc, use_nums, mi.lang, mi.text, mi.pos); 
+            parse_text_into_words(wordlist, wc, use_nums, mi.lang, mi.text, mi.pos);
         }
     }
+
+    QMutexLocker locker(&wordlist_cache_mutex);
+    wordlist_cache.insert(key, wordlist);
+    wordlist_cache_order.append(key);
+    if (wordlist_cache_order.count() > MAX_CACHED_WORD_LISTS) {
+        wordlist_cache.remove(wordlist_cache_order.takeFirst());
+    }
     return wordlist;
 }
 
@@ -0,0 +1,315 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include <ctime>
+
+#include <QDateTime>
+#include <QDir>
+#include <QDirIterator>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTextStream>
+
+#include "BookManipulation/Book.h"
+#include "BookManipulation/CleanSource.h"
+#include "BookManipulation/XhtmlDoc.h"
+#include "Exporters/ExporterFactory.h"
+#include "Importers/ImporterFactory.h"
+#include "Misc/TempFolder.h"
+#include "Misc/Utility.h"
+#include "Misc/HeadlessBench.h"
+#include "Parsers/QuickParser.h"
+#include "Parsers/TagLister.h"
+#include "Parsers/qCSSParser.h"
+#include "PCRE/PCRECache.h"
+#include "PCRE/SPCRE.h"
+#include "ResourceObjects/HTMLResource.h"
+#include "ResourceObjects/OPFResource.h"
+
+namespace {
+
+// one stage's wall clock and process cpu time in milliseconds
+struct StageClock {
+    QElapsedTimer wall;
+    std::clock_t  cpu;
+
+    void start()
+    {
+        wall.start();
+        cpu = std::clock();
+    }
+
+    QJsonObject stop()
+    {
+        qint64 cpu_ms = (std::clock() - cpu) * 1000 / CLOCKS_PER_SEC;
+        QJsonObject stage;
+        stage.insert("wall_ms", wall.elapsed());
+        stage.insert("cpu_ms", cpu_ms);
+        return stage;
+    }
+};
+
+}
+
+
+int HeadlessBench::Run(const QString &corpusdir, const QString &reportpath)
+{
+    QTextStream err(stderr);
+    QDir corpus(corpusdir);
+    if (corpusdir.isEmpty() || !corpus.exists()) {
+        err << "bench: corpus directory does not exist: " << corpusdir << "\n";
+        return 1;
+    }
+
+    QStringList epubs = corpus.entryList(QStringList() << "*.epub", QDir::Files, QDir::Name);
+    if (epubs.isEmpty()) {
+        err << "bench: no epubs found in: " << corpus.absolutePath() << "\n";
+        return 1;
+    }
+
+    // exported books land in a scratch folder that is cleaned up on exit
+    TempFolder outfolder;
+
+    bool all_ok = true;
+    qint64 total_wall = 0;
+    QJsonArray books;
+
+    foreach(QString epub, epubs) {
+        QString fullfilepath = corpus.absoluteFilePath(epub);
+        QJsonObject entry;
+        entry.insert("file", epub);
+        StageClock clock;
+
+        try {
+            // stage 1: import the epub the way File->Open does
+            clock.start();
+            ImporterFactory importerFactory;
+            Importer *importer = importerFactory.GetImporter(fullfilepath);
+            if (!importer) {
+                throw QString("no importer for file type");
+            }
+            XhtmlDoc::WellFormedError error = importer->CheckValidToLoad();
+            if (error.line != -1) {
+                throw QString("not well formed at line %1: %2").arg(error.line).arg(error.message);
+            }
+            QSharedPointer<Book> book = importer->GetBook();
+            entry.insert("import", clock.stop());
+
+            // stage 2: mend every xhtml file, the heaviest of the
+            // book wide source updates
+            clock.start();
+            QString version = book->GetOPF()->GetEpubVersion();
+            foreach(HTMLResource *html_resource, book->GetHTMLResources()) {
+                html_resource->SetText(CleanSource::Mend(html_resource->GetText(), version));
+            }
+            entry.insert("update", clock.stop());
+
+            // stage 3: export the epub the way File->Save does
+            clock.start();
+            QString outpath = outfolder.GetPath() + "/" + epub;
+            ExporterFactory().GetExporter(outpath, book)->WriteBook();
+            entry.insert("export", clock.stop());
+
+            total_wall += entry.value("import").toObject().value("wall_ms").toInt() +
+                          entry.value("update").toObject().value("wall_ms").toInt() +
+                          entry.value("export").toObject().value("wall_ms").toInt();
+        } catch (QString &msg) {
+            entry.insert("error", msg);
+            all_ok = false;
+        } catch (std::exception &e) {
+            entry.insert("error", QString(e.what()));
+            all_ok = false;
+        }
+
+        books.append(entry);
+        err << "bench: " << epub << (entry.contains("error") ? " failed" : " done") << "\n";
+    }
+
+    QJsonObject report;
+    report.insert("generated", QDateTime::currentDateTime().toString(Qt::ISODate));
+    report.insert("corpus", corpus.absolutePath());
+    report.insert("book_count", books.count());
+    report.insert("total_wall_ms", total_wall);
+    report.insert("books", books);
+
+    QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    if (reportpath.isEmpty()) {
+        QTextStream out(stdout);
+        out << json;
+    } else {
+        QFile reportfile(reportpath);
+        if (!reportfile.open(QFile::WriteOnly | QFile::Truncate)) {
+            err << "bench: can not write report: " << reportpath << "\n";
+            return 1;
+        }
+        reportfile.write(json);
+    }
+
+    return all_ok ? 0 : 1;
+}
+
+
+int HeadlessBench::RunMicro(const QString &corpusdir, const QString &reportpath)
+{
+    // enough repetitions to push each primitive well past timer noise
+    const int REPS = 5;
+
+    QTextStream err(stderr);
+    QDir corpus(corpusdir);
+    if (corpusdir.isEmpty() || !corpus.exists()) {
+        err << "bench: corpus directory does not exist: " << corpusdir << "\n";
+        return 1;
+    }
+
+    // the primitives work on raw text, so the corpus here is a folder
+    // tree of xhtml and css files (an unzipped epub works as is)
+    QList<QString> html_texts;
+    QList<QString> css_texts;
+    qint64 html_chars = 0;
+    qint64 css_chars = 0;
+    QDirIterator it(corpus.absolutePath(),
+                    QStringList() << "*.xhtml" << "*.html" << "*.htm" << "*.css",
+                    QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        QString path = it.next();
+        QString text = Utility::ReadUnicodeTextFile(path);
+        if (path.endsWith(".css")) {
+            css_texts.append(text);
+            css_chars += text.length();
+        } else {
+            html_texts.append(text);
+            html_chars += text.length();
+        }
+    }
+    if (html_texts.isEmpty() && css_texts.isEmpty()) {
+        err << "bench: no xhtml or css files found under: " << corpus.absolutePath() << "\n";
+        return 1;
+    }
+
+    QJsonArray benches;
+    StageClock clock;
+
+    // TagLister: full tag list build over each document
+    clock.start();
+    for (int r = 0; r < REPS; r++) {
+        TagLister lister;
+        foreach(const QString &text, html_texts) {
+            lister.reloadLister(text);
+        }
+    }
+    {
+        QJsonObject bench = clock.stop();
+        bench.insert("name", QString("taglister_reload"));
+        bench.insert("files", html_texts.count());
+        bench.insert("chars", html_chars * REPS);
+        benches.append(bench);
+    }
+
+    // QuickParser: walk every markup node of each document
+    clock.start();
+    for (int r = 0; r < REPS; r++) {
+        foreach(const QString &text, html_texts) {
+            QuickParser qp(text);
+            while (true) {
+                QuickParser::MarkupInfo mi = qp.parse_next();
+                if (mi.pos < 0) break;
+            }
+        }
+    }
+    {
+        QJsonObject bench = clock.stop();
+        bench.insert("name", QString("quickparser_walk"));
+        bench.insert("files", html_texts.count());
+        bench.insert("chars", html_chars * REPS);
+        benches.append(bench);
+    }
+
+    // SPCRE: every-match scan with a representative tag pattern
+    clock.start();
+    QSharedPointer<SPCRE> spcre = PCRECache::instance()->getObject("<\\s*(\\w+)[^>]*>");
+    for (int r = 0; r < REPS; r++) {
+        foreach(const QString &text, html_texts) {
+            spcre->getEveryMatchInfo(text);
+        }
+    }
+    {
+        QJsonObject bench = clock.stop();
+        bench.insert("name", QString("spcre_every_match"));
+        bench.insert("files", html_texts.count());
+        bench.insert("chars", html_chars * REPS);
+        benches.append(bench);
+    }
+
+    // entity resolution over each document
+    clock.start();
+    for (int r = 0; r < REPS; r++) {
+        foreach(const QString &text, html_texts) {
+            Utility::DecodeXML(text);
+        }
+    }
+    {
+        QJsonObject bench = clock.stop();
+        bench.insert("name", QString("decode_xml_entities"));
+        bench.insert("files", html_texts.count());
+        bench.insert("chars", html_chars * REPS);
+        benches.append(bench);
+    }
+
+    // css parse of each stylesheet
+    clock.start();
+    for (int r = 0; r < REPS; r++) {
+        foreach(const QString &text, css_texts) {
+            CSSParser parser;
+            parser.parse_css(text);
+        }
+    }
+    {
+        QJsonObject bench = clock.stop();
+        bench.insert("name", QString("cssparser_parse"));
+        bench.insert("files", css_texts.count());
+        bench.insert("chars", css_chars * REPS);
+        benches.append(bench);
+    }
+
+    QJsonObject report;
+    report.insert("generated", QDateTime::currentDateTime().toString(Qt::ISODate));
+    report.insert("corpus", corpus.absolutePath());
+    report.insert("reps", REPS);
+    report.insert("benchmarks", benches);
+
+    QByteArray json = QJsonDocument(report).toJson(QJsonDocument::Indented);
+    if (reportpath.isEmpty()) {
+        QTextStream out(stdout);
+        out << json;
+    } else {
+        QFile reportfile(reportpath);
+        if (!reportfile.open(QFile::WriteOnly | QFile::Truncate)) {
+            err << "bench: can not write report: " << reportpath << "\n";
+            return 1;
+        }
+        reportfile.write(json);
+    }
+
+    return 0;
+}
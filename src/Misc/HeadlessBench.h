@@ -0,0 +1,55 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef HEADLESSBENCH_H
+#define HEADLESSBENCH_H
+
+#include <QString>
+
+/**
+ * Runs the core import -> mend -> export pipeline over every epub in a
+ * corpus directory without any windows, timing each stage.  Invoked with
+ * "sigil --bench <corpusdir> [report.json]"; the per-stage wall and cpu
+ * times go to the report file as JSON, or to stdout when no report path
+ * is given.  Used to compare builds against each other on a fixed corpus.
+ */
+class HeadlessBench
+{
+
+public:
+
+    /**
+     * Returns the process exit code: 0 when every book made it through
+     * the pipeline, 1 otherwise.
+     */
+    static int Run(const QString &corpusdir, const QString &reportpath);
+
+    /**
+     * Micro benchmarks of the parser and search primitives (TagLister,
+     * QuickParser, SPCRE, entity decoding, the css parser) over the
+     * xhtml and css files found under the corpus directory.  Invoked
+     * with "sigil --bench-micro <corpusdir> [report.json]".
+     */
+    static int RunMicro(const QString &corpusdir, const QString &reportpath);
+};
+
+#endif // HEADLESSBENCH_H
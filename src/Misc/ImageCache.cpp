@@ -0,0 +1,228 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include <functional>
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QMutexLocker>
+#include <QStringBuilder>
+#include <QtConcurrent/QtConcurrent>
+
+#include "Misc/DiskCache.h"
+#include "Misc/ImageCache.h"
+
+// Full decodes of large covers add up quickly, so the image cache is
+// bounded by an approximate byte budget rather than an entry count.
+// Thumbnails are small and uniform, so an entry cap is enough there.
+static const qint64 MAX_IMAGE_CACHE_COST = 64 * 1024 * 1024;
+static const int MAX_THUMBNAIL_CACHE_ENTRIES = 2048;
+
+// Thumbnails are decoded from the source at power of two sizes (the
+// mip levels) no smaller than this, and requested sizes are rescaled
+// from the cached level above them.
+static const int THUMBNAIL_MIP_FLOOR = 64;
+
+// The disk cache category thumbnails persist under between sessions.
+static const QString THUMBNAIL_CACHE_CATEGORY = "thumbnails";
+
+ImageCache *ImageCache::m_instance = 0;
+
+ImageCache *ImageCache::instance()
+{
+    if (m_instance == 0) {
+        m_instance = new ImageCache();
+    }
+
+    return m_instance;
+}
+
+
+ImageCache::ImageCache()
+    : m_ImagesCost(0)
+{
+}
+
+
+QString ImageCache::BuildKey(const QString &fullfilepath)
+{
+    QFileInfo fi(fullfilepath);
+    return fullfilepath % "|" % QString::number(fi.size()) % "|" %
+           QString::number(fi.lastModified().toMSecsSinceEpoch());
+}
+
+
+QImage ImageCache::GetImage(const QString &fullfilepath)
+{
+    const QString key = BuildKey(fullfilepath);
+    {
+        QMutexLocker locker(&m_Mutex);
+        QHash<QString, QImage>::const_iterator it = m_Images.constFind(key);
+
+        if (it != m_Images.constEnd()) {
+            return it.value();
+        }
+    }
+    // Decode outside the lock so parallel decodes do not serialize
+    QImage image(fullfilepath);
+    qint64 cost = qint64(image.bytesPerLine()) * image.height();
+    {
+        QMutexLocker locker(&m_Mutex);
+
+        if (m_ImagesCost + cost > MAX_IMAGE_CACHE_COST) {
+            m_Images.clear();
+            m_ImagesCost = 0;
+        }
+
+        m_Images.insert(key, image);
+        m_ImagesCost += cost;
+    }
+    return image;
+}
+
+
+QImage ImageCache::GetThumbnail(const QString &fullfilepath, int bound)
+{
+    const QString file_key = BuildKey(fullfilepath);
+    const QString key = file_key % "|" % QString::number(bound);
+    {
+        QMutexLocker locker(&m_Mutex);
+        QHash<QString, QImage>::const_iterator it = m_Thumbnails.constFind(key);
+
+        if (it != m_Thumbnails.constEnd()) {
+            return it.value();
+        }
+    }
+
+    // Decodes happen at the mip level above the requested bound, so
+    // stepping the thumbnail size up and down rescales a cached mip
+    // instead of going back to the source image every step.
+    int mip_bound = THUMBNAIL_MIP_FLOOR;
+
+    while (mip_bound < bound) {
+        mip_bound *= 2;
+    }
+
+    const QString mip_key = file_key % "|" % QString::number(mip_bound);
+    QImage mip;
+
+    if (mip_key != key) {
+        QMutexLocker locker(&m_Mutex);
+        QHash<QString, QImage>::const_iterator it = m_Thumbnails.constFind(mip_key);
+
+        if (it != m_Thumbnails.constEnd()) {
+            mip = it.value();
+        }
+    }
+
+    if (mip.isNull()) {
+        // Mip levels survive restarts on disk; a hit there skips
+        // decoding the source image entirely on the second open of
+        // a book.
+        const QString disk_key = DiskCache::KeyForFile(fullfilepath) % "-" % QString::number(mip_bound);
+        QByteArray blob = DiskCache::instance()->Load(THUMBNAIL_CACHE_CATEGORY, disk_key);
+
+        if (!blob.isEmpty()) {
+            QDataStream in(blob);
+            in >> mip;
+
+            if (in.status() != QDataStream::Ok) {
+                mip = QImage();
+            }
+        }
+
+        if (mip.isNull()) {
+            // Let the reader do the downscale so a thumbnail of a large
+            // jpeg never materializes the full size image
+            QImageReader reader(fullfilepath);
+            QSize natural_size = reader.size();
+
+            if (natural_size.isValid() &&
+                (natural_size.height() > mip_bound || natural_size.width() > mip_bound)) {
+                reader.setScaledSize(natural_size.scaled(mip_bound, mip_bound, Qt::KeepAspectRatio));
+            }
+
+            QImage decoded = reader.read();
+
+            // Formats whose readers can not report a size up front (some
+            // svg plugins) still need the old decode then scale path
+            if (!natural_size.isValid() &&
+                (decoded.height() > mip_bound || decoded.width() > mip_bound)) {
+                decoded = decoded.scaled(mip_bound, mip_bound, Qt::KeepAspectRatio);
+            }
+
+            mip = decoded;
+
+            if (!mip.isNull()) {
+                QByteArray out_blob;
+                QDataStream out(&out_blob, QIODevice::WriteOnly);
+                out << mip;
+                DiskCache::instance()->Store(THUMBNAIL_CACHE_CATEGORY, disk_key, out_blob);
+            }
+        }
+
+        QMutexLocker locker(&m_Mutex);
+
+        if (m_Thumbnails.count() >= MAX_THUMBNAIL_CACHE_ENTRIES) {
+            m_Thumbnails.clear();
+        }
+
+        m_Thumbnails.insert(mip_key, mip);
+    }
+
+    QImage thumbnail = mip;
+
+    // The mip is at most twice the requested bound, so the smooth
+    // rescale here is cheap and keeps the quality of a direct decode
+    if (thumbnail.height() > bound || thumbnail.width() > bound) {
+        thumbnail = thumbnail.scaled(bound, bound, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+    }
+
+    if (key != mip_key) {
+        QMutexLocker locker(&m_Mutex);
+
+        if (m_Thumbnails.count() >= MAX_THUMBNAIL_CACHE_ENTRIES) {
+            m_Thumbnails.clear();
+        }
+
+        m_Thumbnails.insert(key, thumbnail);
+    }
+
+    return thumbnail;
+}
+
+
+static void PrimeOneThumbnail(ImageCache *cache, int bound, const QString &fullfilepath)
+{
+    cache->GetThumbnail(fullfilepath, bound);
+}
+
+
+void ImageCache::PrimeThumbnails(const QStringList &fullfilepaths, int bound)
+{
+    if (fullfilepaths.isEmpty() || bound <= 0) {
+        return;
+    }
+
+    QtConcurrent::blockingMap(fullfilepaths, std::bind(PrimeOneThumbnail, this, bound, std::placeholders::_1));
+}
@@ -0,0 +1,90 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef IMAGECACHE_H
+#define IMAGECACHE_H
+
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QString>
+#include <QStringList>
+
+/**
+ * Singleton.
+ *
+ * A shared cache of decoded images and thumbnails.  The image report,
+ * the insert file dialog, and the image preview each used to decode
+ * the image files themselves, every time their tables were rebuilt
+ * (the report rebuilds on every sort).  Entries are keyed on the file
+ * path plus its size and modification time, so an image edited on disk
+ * simply misses the cache and gets decoded again.
+ */
+
+class ImageCache
+{
+
+public:
+
+    static ImageCache *instance();
+
+    /**
+     * Returns the fully decoded image, from the cache when possible.
+     */
+    QImage GetImage(const QString &fullfilepath);
+
+    /**
+     * Returns the image scaled (aspect preserving) to fit within
+     * bound x bound pixels.  Images already small enough come back
+     * at their natural size, matching what the thumbnail columns
+     * always did.  Decoding happens at power of two mip sizes, so
+     * nearby bounds share one decode of the source image.
+     */
+    QImage GetThumbnail(const QString &fullfilepath, int bound);
+
+    /**
+     * Decodes thumbnails for all of the given files in parallel off
+     * the GUI thread, so the table building loops that follow find
+     * their icons already in the cache.
+     */
+    void PrimeThumbnails(const QStringList &fullfilepaths, int bound);
+
+private:
+
+    ImageCache();
+
+    /**
+     * Cache key for a file: path plus size and mtime of the file.
+     */
+    QString BuildKey(const QString &fullfilepath);
+
+    QHash<QString, QImage> m_Images;
+    qint64 m_ImagesCost;
+
+    QHash<QString, QImage> m_Thumbnails;
+
+    QMutex m_Mutex;
+
+    static ImageCache *m_instance;
+};
+
+#endif // IMAGECACHE_H
@@ -58,6 +58,7 @@ void KeyboardShortcutManager::registerAction(QWidget * win, QAction *action, con
     } else {
         s = createShortcut(keySequence);
         m_shortcuts.insert(id, s);
+        addToSequenceIndex(id, s);
     }
 
     s.setName(action->iconText());
@@ -76,11 +77,15 @@ void KeyboardShortcutManager::registerAction(QWidget * win, QAction *action, con
     // If we are registering with a KeyboardShortcut that was previously created
     // we don't want to over write the key sequence.
     if (!defined && !keySequenceInUse(keySequence)) {
+        removeFromSequenceIndex(id, s);
         s.setKeySequence(keySequence);
+        addToSequenceIndex(id, s);
     }
 
     if (!defaultKeySequenceInUse(keySequence)) {
+        removeFromSequenceIndex(id, s);
         s.setDefaultKeySequence(keySequence);
+        addToSequenceIndex(id, s);
     }
 
     // Set the keyboard shortcut that is associated with this id.
@@ -105,6 +110,7 @@ void KeyboardShortcutManager::registerShortcut(QShortcut *shortcut, const QStrin
     } else {
         s = createShortcut(keySequence);
         m_shortcuts.insert(id, s);
+        addToSequenceIndex(id, s);
     }
 
     // Use the actions tool tip (falls back to text) if no description
@@ -120,11 +126,15 @@ void KeyboardShortcutManager::registerShortcut(QShortcut *shortcut, const QStrin
     // If we are registering with a KeyboardShortcut that was previously created
     // we don't want to over write the key sequence.
     if (!defined && !keySequenceInUse(keySequence)) {
+        removeFromSequenceIndex(id, s);
         s.setKeySequence(keySequence);
+        addToSequenceIndex(id, s);
     }
 
     if (!defaultKeySequenceInUse(keySequence)) {
+        removeFromSequenceIndex(id, s);
         s.setDefaultKeySequence(keySequence);
+        addToSequenceIndex(id, s);
     }
 
     // Set the keyboard shortcut that is associated with this id.
@@ -135,13 +145,7 @@ bool KeyboardShortcutManager::setKeySequence(const QString &sid, const QKeySeque
 {
     if (keySequenceInUse(keySequence)) {
         // Find the shortcut that is using this sequence.
-        QString fid;
-        foreach(QString tid, m_shortcuts.keys()) {
-            if (m_shortcuts[tid].keySequence() == keySequence) {
-                fid = tid;
-                break;
-            }
-        }
+        QString fid = m_idForSequence.value(keySequence.toString());
 
         if (!fid.isEmpty()) {
             // Resetting to a keysequence's default value will always succeed.
@@ -164,11 +168,14 @@ bool KeyboardShortcutManager::setKeySequence(const QString &sid, const QKeySeque
     if (!m_shortcuts.contains(sid)) {
         s = createShortcut(keySequence, keySequence);
         m_shortcuts.insert(sid, s);
+        addToSequenceIndex(sid, s);
     } else {
         s = m_shortcuts.value(sid);
     }
 
+    removeFromSequenceIndex(sid, s);
     s.setKeySequence(keySequence);
+    addToSequenceIndex(sid, s);
 
     // When a new MainWindow is closed, its QActions
     // are reaped which could leave behind dangling 
@@ -193,8 +200,13 @@ bool KeyboardShortcutManager::setDefaultKeySequence(const QString &id, const QKe
         return false;
     }
 
-    KeyboardShortcut s = m_shortcuts.value(id);
-    s.setDefaultKeySequence(keySequence);
+    if (m_shortcuts.contains(id)) {
+        KeyboardShortcut s = m_shortcuts.value(id);
+        removeFromSequenceIndex(id, s);
+        s.setDefaultKeySequence(keySequence);
+        addToSequenceIndex(id, s);
+    }
+
     return true;
 }
 
@@ -212,6 +224,10 @@ void KeyboardShortcutManager::setDescription(const QString &id, const QString &d
 
 void KeyboardShortcutManager::unregisterId(const QString &id)
 {
+    if (m_shortcuts.contains(id)) {
+        removeFromSequenceIndex(id, m_shortcuts.value(id));
+    }
+
     m_shortcuts.remove(id);
     m_savedShortcuts.remove(id);
 }
@@ -263,6 +279,8 @@ void KeyboardShortcutManager::unregisterAll()
 {
     m_shortcuts.clear();
     m_savedShortcuts.clear();
+    m_idForSequence.clear();
+    m_idForDefaultSequence.clear();
 }
 
 KeyboardShortcut KeyboardShortcutManager::keyboardShortcut(const QString &id)
@@ -286,12 +304,7 @@ bool KeyboardShortcutManager::keySequenceInUse(const QKeySequence &keySequence)
         return false;
     }
 
-    foreach(KeyboardShortcut s, m_shortcuts) {
-        if (s.keySequence() == keySequence) {
-            return true;
-        }
-    }
-    return false;
+    return m_idForSequence.contains(keySequence.toString());
 }
 
 bool KeyboardShortcutManager::defaultKeySequenceInUse(const QKeySequence &keySequence)
@@ -300,12 +313,7 @@ bool KeyboardShortcutManager::defaultKeySequenceInUse(const QKeySequence &keySeq
         return false;
     }
 
-    foreach(KeyboardShortcut s, m_shortcuts) {
-        if (s.defaultKeySequence() == keySequence) {
-            return true;
-        }
-    }
-    return false;
+    return m_idForDefaultSequence.contains(keySequence.toString());
 }
 
 void KeyboardShortcutManager::writeSettings()
@@ -361,7 +369,35 @@ void KeyboardShortcutManager::readSettings()
 void KeyboardShortcutManager::restoreSavedShortcutForId(const QString &id)
 {
     if (m_savedShortcuts.contains(id)) {
-        m_shortcuts.insert(id, m_savedShortcuts.value(id));
+        if (m_shortcuts.contains(id)) {
+            removeFromSequenceIndex(id, m_shortcuts.value(id));
+        }
+
+        KeyboardShortcut s = m_savedShortcuts.value(id);
+        m_shortcuts.insert(id, s);
+        addToSequenceIndex(id, s);
         m_savedShortcuts.remove(id);
     }
 }
+
+void KeyboardShortcutManager::addToSequenceIndex(const QString &id, KeyboardShortcut s)
+{
+    if (!s.keySequence().isEmpty()) {
+        m_idForSequence.insert(s.keySequence().toString(), id);
+    }
+
+    if (!s.defaultKeySequence().isEmpty()) {
+        m_idForDefaultSequence.insert(s.defaultKeySequence().toString(), id);
+    }
+}
+
+void KeyboardShortcutManager::removeFromSequenceIndex(const QString &id, KeyboardShortcut s)
+{
+    if (!s.keySequence().isEmpty()) {
+        m_idForSequence.remove(s.keySequence().toString(), id);
+    }
+
+    if (!s.defaultKeySequence().isEmpty()) {
+        m_idForDefaultSequence.remove(s.defaultKeySequence().toString(), id);
+    }
+}
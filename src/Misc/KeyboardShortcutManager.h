@@ -210,9 +210,24 @@ private:
      */
     void restoreSavedShortcutForId(const QString &id);
 
+    /**
+     * Keep the reverse sequence indexes in step with an entry.  Every
+     * site that changes an entry's sequences removes it first and adds
+     * it back afterwards.
+     */
+    void addToSequenceIndex(const QString &id, KeyboardShortcut s);
+    void removeFromSequenceIndex(const QString &id, KeyboardShortcut s);
+
     // Tracks the KeyboardShortcuts we are managing.
     QHash<QString, KeyboardShortcut> m_shortcuts;
 
+    // Reverse lookups from key sequence text to the ids holding it.
+    // Registering an action runs an in-use check for both its sequence
+    // and its default sequence, for every action of every window, so
+    // these keep that a hash probe instead of a scan of all shortcuts.
+    QMultiHash<QString, QString> m_idForSequence;
+    QMultiHash<QString, QString> m_idForDefaultSequence;
+
     // Tracks the last saved shortcuts. The ini file may contain shortcuts from
     // older versions of Sigil which we will want removed to avoid issues.
     // A saved shortcut will be ignored until its id has been registered by Sigil
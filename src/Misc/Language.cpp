@@ -20,11 +20,618 @@
 **
 *************************************************************************/
 
+#include <cstring>
+
 #include <QtCore/QString>
 #include <QtCore/QStringList>
 
 #include "Misc/Language.h"
 
+// The language data lives in a compile-time table sorted by code, so a
+// code lookup is a binary search with no startup cost, and a display
+// name is only run through tr() when a caller actually wants it.  The
+// reverse (name to code) map, the sorted name list, and the metadata
+// map are built lazily because only the Preferences and MetaEditor
+// paths use them.  Names are wrapped in QT_TRANSLATE_NOOP so lupdate
+// still collects them; regional variants keep the region separate
+// because its name is translated independently.
+//
+// Must be a 1 to 1 relationship between codes and names.
+// The keys are the ISO 639-2 language codes
+// If a code has 2 and 3 character versions, use 2 character version
+// and the values are the the full English language names.
+// See http://www.loc.gov/standards/iso639-2/php/English_list.php
+struct LangEntry {
+    const char *code;
+    const char *name;
+    const char *region;  // null unless a regional variant
+};
+
+static const LangEntry LANG_TABLE[] = {
+    {"aa", QT_TRANSLATE_NOOP("Language", "Afar"), 0},
+    {"ab", QT_TRANSLATE_NOOP("Language", "Abkhazian"), 0},
+    {"ace", QT_TRANSLATE_NOOP("Language", "Achinese"), 0},
+    {"ach", QT_TRANSLATE_NOOP("Language", "Acoli"), 0},
+    {"ada", QT_TRANSLATE_NOOP("Language", "Adangme"), 0},
+    {"ady", QT_TRANSLATE_NOOP("Language", "Adygei, Adyghe"), 0},
+    {"ae", QT_TRANSLATE_NOOP("Language", "Avestan"), 0},
+    {"af", QT_TRANSLATE_NOOP("Language", "Afrikaans"), 0},
+    {"afa", QT_TRANSLATE_NOOP("Language", "Afro-Asiatic languages"), 0},
+    {"afh", QT_TRANSLATE_NOOP("Language", "Afrihili"), 0},
+    {"ain", QT_TRANSLATE_NOOP("Language", "Ainu"), 0},
+    {"ak", QT_TRANSLATE_NOOP("Language", "Akan"), 0},
+    {"akk", QT_TRANSLATE_NOOP("Language", "Akkadian"), 0},
+    {"ale", QT_TRANSLATE_NOOP("Language", "Aleut"), 0},
+    {"alg", QT_TRANSLATE_NOOP("Language", "Algonquian languages"), 0},
+    {"alt", QT_TRANSLATE_NOOP("Language", "Southern Altai"), 0},
+    {"am", QT_TRANSLATE_NOOP("Language", "Amharic"), 0},
+    {"an", QT_TRANSLATE_NOOP("Language", "Aragonese"), 0},
+    {"ang", QT_TRANSLATE_NOOP("Language", "English- Old (ca.450-1100)"), 0},
+    {"anp", QT_TRANSLATE_NOOP("Language", "Angika"), 0},
+    {"apa", QT_TRANSLATE_NOOP("Language", "Apache languages"), 0},
+    {"ar", QT_TRANSLATE_NOOP("Language", "Arabic"), 0},
+    {"ar-AE", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "United Arab Emirates")},
+    {"ar-BH", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Bahrain")},
+    {"ar-DZ", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Algeria")},
+    {"ar-EG", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Egypt")},
+    {"ar-IQ", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Iraq")},
+    {"ar-JO", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Jordan")},
+    {"ar-KW", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Kuwait")},
+    {"ar-LB", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Lebanon")},
+    {"ar-LY", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Libya")},
+    {"ar-MA", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Morocco")},
+    {"ar-OM", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Oman")},
+    {"ar-QA", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Qatar")},
+    {"ar-SY", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Syria")},
+    {"ar-TN", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Tunisia")},
+    {"ar-YE", QT_TRANSLATE_NOOP("Language", "Arabic"), QT_TRANSLATE_NOOP("Language", "Yemen")},
+    {"arc", QT_TRANSLATE_NOOP("Language", "Official/Imperial Aramaic (700-300 BCE)"), 0},
+    {"arn", QT_TRANSLATE_NOOP("Language", "Mapuche/Mapudungun"), 0},
+    {"arp", QT_TRANSLATE_NOOP("Language", "Arapaho"), 0},
+    {"art", QT_TRANSLATE_NOOP("Language", "Artificial languages"), 0},
+    {"arw", QT_TRANSLATE_NOOP("Language", "Arawak"), 0},
+    {"as", QT_TRANSLATE_NOOP("Language", "Assamese"), 0},
+    {"ast", QT_TRANSLATE_NOOP("Language", "Asturian, Asturleonese, Bable, Leonese"), 0},
+    {"ath", QT_TRANSLATE_NOOP("Language", "Athapascan languages"), 0},
+    {"aus", QT_TRANSLATE_NOOP("Language", "Australian languages"), 0},
+    {"av", QT_TRANSLATE_NOOP("Language", "Avaric"), 0},
+    {"awa", QT_TRANSLATE_NOOP("Language", "Awadhi"), 0},
+    {"ay", QT_TRANSLATE_NOOP("Language", "Aymara"), 0},
+    {"az", QT_TRANSLATE_NOOP("Language", "Azerbaijani"), 0},
+    {"az-AZ", QT_TRANSLATE_NOOP("Language", "Azerbaijani"), QT_TRANSLATE_NOOP("Language", "Azerbaijan")},
+    {"ba", QT_TRANSLATE_NOOP("Language", "Bashkir"), 0},
+    {"bad", QT_TRANSLATE_NOOP("Language", "Banda languages"), 0},
+    {"bai", QT_TRANSLATE_NOOP("Language", "Bamileke languages"), 0},
+    {"bal", QT_TRANSLATE_NOOP("Language", "Baluchi"), 0},
+    {"ban", QT_TRANSLATE_NOOP("Language", "Balinese"), 0},
+    {"bas", QT_TRANSLATE_NOOP("Language", "Basa"), 0},
+    {"bat", QT_TRANSLATE_NOOP("Language", "Baltic languages"), 0},
+    {"be", QT_TRANSLATE_NOOP("Language", "Belarusian"), 0},
+    {"bej", QT_TRANSLATE_NOOP("Language", "Bedawiyet, Beja"), 0},
+    {"bem", QT_TRANSLATE_NOOP("Language", "Bemba"), 0},
+    {"ber", QT_TRANSLATE_NOOP("Language", "Berber languages"), 0},
+    {"bg", QT_TRANSLATE_NOOP("Language", "Bulgarian"), 0},
+    {"bh", QT_TRANSLATE_NOOP("Language", "Bihari"), 0},
+    {"bho", QT_TRANSLATE_NOOP("Language", "Bhojpuri"), 0},
+    {"bi", QT_TRANSLATE_NOOP("Language", "Bislama"), 0},
+    {"bik", QT_TRANSLATE_NOOP("Language", "Bikol"), 0},
+    {"bin", QT_TRANSLATE_NOOP("Language", "Bini, Edo"), 0},
+    {"bla", QT_TRANSLATE_NOOP("Language", "Siksika"), 0},
+    {"bm", QT_TRANSLATE_NOOP("Language", "Bambara"), 0},
+    {"bn", QT_TRANSLATE_NOOP("Language", "Bengali"), 0},
+    {"bnt", QT_TRANSLATE_NOOP("Language", "Bantu languages"), 0},
+    {"bo", QT_TRANSLATE_NOOP("Language", "Tibetan"), 0},
+    {"br", QT_TRANSLATE_NOOP("Language", "Breton"), 0},
+    {"bra", QT_TRANSLATE_NOOP("Language", "Braj"), 0},
+    {"bs", QT_TRANSLATE_NOOP("Language", "Bosnian"), 0},
+    {"btk", QT_TRANSLATE_NOOP("Language", "Batak languages"), 0},
+    {"bua", QT_TRANSLATE_NOOP("Language", "Buriat"), 0},
+    {"bug", QT_TRANSLATE_NOOP("Language", "Buginese"), 0},
+    {"byn", QT_TRANSLATE_NOOP("Language", "Bilin, Blin"), 0},
+    {"ca", QT_TRANSLATE_NOOP("Language", "Catalan"), 0},
+    {"ca-ES", QT_TRANSLATE_NOOP("Language", "Catalan"), QT_TRANSLATE_NOOP("Language", "Spain")},
+    {"cad", QT_TRANSLATE_NOOP("Language", "Caddo"), 0},
+    {"cai", QT_TRANSLATE_NOOP("Language", "Central American Indian languages"), 0},
+    {"car", QT_TRANSLATE_NOOP("Language", "Galibi Carib"), 0},
+    {"cau", QT_TRANSLATE_NOOP("Language", "Caucasian languages"), 0},
+    {"ce", QT_TRANSLATE_NOOP("Language", "Chechen"), 0},
+    {"ceb", QT_TRANSLATE_NOOP("Language", "Cebuano"), 0},
+    {"cel", QT_TRANSLATE_NOOP("Language", "Celtic languages"), 0},
+    {"ch", QT_TRANSLATE_NOOP("Language", "Chamorro"), 0},
+    {"chb", QT_TRANSLATE_NOOP("Language", "Chibcha"), 0},
+    {"chg", QT_TRANSLATE_NOOP("Language", "Chagatai"), 0},
+    {"chk", QT_TRANSLATE_NOOP("Language", "Chuukese"), 0},
+    {"chm", QT_TRANSLATE_NOOP("Language", "Mari"), 0},
+    {"chn", QT_TRANSLATE_NOOP("Language", "Chinook jargon"), 0},
+    {"cho", QT_TRANSLATE_NOOP("Language", "Choctaw"), 0},
+    {"chp", QT_TRANSLATE_NOOP("Language", "Chipewyan, Dene Suline"), 0},
+    {"chr", QT_TRANSLATE_NOOP("Language", "Cherokee"), 0},
+    {"chy", QT_TRANSLATE_NOOP("Language", "Cheyenne"), 0},
+    {"cmc", QT_TRANSLATE_NOOP("Language", "Chamic languages"), 0},
+    {"co", QT_TRANSLATE_NOOP("Language", "Corsican"), 0},
+    {"cop", QT_TRANSLATE_NOOP("Language", "Coptic"), 0},
+    {"cpe", QT_TRANSLATE_NOOP("Language", "Creoles and pidgins- English based"), 0},
+    {"cpf", QT_TRANSLATE_NOOP("Language", "Creoles and pidgins- French-based"), 0},
+    {"cpp", QT_TRANSLATE_NOOP("Language", "Creoles and pidgins- Portuguese-based"), 0},
+    {"cr", QT_TRANSLATE_NOOP("Language", "Cree"), 0},
+    {"crh", QT_TRANSLATE_NOOP("Language", "Crimean Tatar/Turkish"), 0},
+    {"crp", QT_TRANSLATE_NOOP("Language", "Creoles and pidgins"), 0},
+    {"cs", QT_TRANSLATE_NOOP("Language", "Czech"), 0},
+    {"csb", QT_TRANSLATE_NOOP("Language", "Kashubian"), 0},
+    {"cu", QT_TRANSLATE_NOOP("Language", "Church Slavic"), 0},
+    {"cus", QT_TRANSLATE_NOOP("Language", "Cushitic languages"), 0},
+    {"cv", QT_TRANSLATE_NOOP("Language", "Chuvash"), 0},
+    {"cy", QT_TRANSLATE_NOOP("Language", "Welsh"), 0},
+    {"da", QT_TRANSLATE_NOOP("Language", "Danish"), 0},
+    {"da-DK", QT_TRANSLATE_NOOP("Language", "Danish"), QT_TRANSLATE_NOOP("Language", "Denmark")},
+    {"dak", QT_TRANSLATE_NOOP("Language", "Dakota"), 0},
+    {"dar", QT_TRANSLATE_NOOP("Language", "Dargwa"), 0},
+    {"day", QT_TRANSLATE_NOOP("Language", "Land Dayak languages"), 0},
+    {"de", QT_TRANSLATE_NOOP("Language", "German"), 0},
+    {"de-AT", QT_TRANSLATE_NOOP("Language", "German"), QT_TRANSLATE_NOOP("Language", "Austria")},
+    {"de-CH", QT_TRANSLATE_NOOP("Language", "German"), QT_TRANSLATE_NOOP("Language", "Switzerland")},
+    {"de-DE", QT_TRANSLATE_NOOP("Language", "German"), QT_TRANSLATE_NOOP("Language", "Germany")},
+    {"de-LI", QT_TRANSLATE_NOOP("Language", "German"), QT_TRANSLATE_NOOP("Language", "Liechtenstein")},
+    {"de-LU", QT_TRANSLATE_NOOP("Language", "German"), QT_TRANSLATE_NOOP("Language", "Luxembourg")},
+    {"del", QT_TRANSLATE_NOOP("Language", "Delaware"), 0},
+    {"den", QT_TRANSLATE_NOOP("Language", "Slave (Athapascan)"), 0},
+    {"dgr", QT_TRANSLATE_NOOP("Language", "Dogrib"), 0},
+    {"din", QT_TRANSLATE_NOOP("Language", "Dinka"), 0},
+    {"doi", QT_TRANSLATE_NOOP("Language", "Dogri"), 0},
+    {"dra", QT_TRANSLATE_NOOP("Language", "Dravidian languages"), 0},
+    {"dsb", QT_TRANSLATE_NOOP("Language", "Lower Sorbian"), 0},
+    {"dua", QT_TRANSLATE_NOOP("Language", "Duala"), 0},
+    {"dum", QT_TRANSLATE_NOOP("Language", "Dutch- Middle (ca.1050-1350)"), 0},
+    {"dv", QT_TRANSLATE_NOOP("Language", "Dhivehi"), 0},
+    {"dyu", QT_TRANSLATE_NOOP("Language", "Dyula"), 0},
+    {"dz", QT_TRANSLATE_NOOP("Language", "Dzongkha"), 0},
+    {"ee", QT_TRANSLATE_NOOP("Language", "Ewe"), 0},
+    {"efi", QT_TRANSLATE_NOOP("Language", "Efik"), 0},
+    {"egy", QT_TRANSLATE_NOOP("Language", "Egyptian (Ancient)"), 0},
+    {"eka", QT_TRANSLATE_NOOP("Language", "Ekajuk"), 0},
+    {"el", QT_TRANSLATE_NOOP("Language", "Greek, Modern"), 0},
+    {"el-GR", QT_TRANSLATE_NOOP("Language", "Greek"), 0},
+    {"elx", QT_TRANSLATE_NOOP("Language", "Elamite"), 0},
+    {"en", QT_TRANSLATE_NOOP("Language", "English"), 0},
+    {"en-AU", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "Australia")},
+    {"en-BZ", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "Belize")},
+    {"en-CA", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "Canada")},
+    {"en-CB", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "Caribbean")},
+    {"en-GB", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "Great Britain")},
+    {"en-IE", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "Ireland")},
+    {"en-IN", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "India")},
+    {"en-JM", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "Jamaica")},
+    {"en-PH", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "Philippines")},
+    {"en-TT", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "Trinidad")},
+    {"en-US", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "United States")},
+    {"en-ZA", QT_TRANSLATE_NOOP("Language", "English"), QT_TRANSLATE_NOOP("Language", "South Africa")},
+    {"enm", QT_TRANSLATE_NOOP("Language", "English- Middle (1100-1500)"), 0},
+    {"eo", QT_TRANSLATE_NOOP("Language", "Esperanto"), 0},
+    {"es", QT_TRANSLATE_NOOP("Language", "Spanish"), 0},
+    {"es-AR", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Argentina")},
+    {"es-BO", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Bolivia")},
+    {"es-CL", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Chile")},
+    {"es-CO", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Colombia")},
+    {"es-CR", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Costa Rica")},
+    {"es-DO", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Dominican Republic")},
+    {"es-EC", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Ecuador")},
+    {"es-ES", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Spain")},
+    {"es-GT", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Guatemala")},
+    {"es-HN", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Honduras")},
+    {"es-MX", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Mexico")},
+    {"es-NI", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Nicaragua")},
+    {"es-PA", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Panama")},
+    {"es-PE", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Peru")},
+    {"es-PR", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Puerto Rico")},
+    {"es-PY", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Paraguay")},
+    {"es-SV", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "El Salvador")},
+    {"es-UY", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Uruguay")},
+    {"es-VE", QT_TRANSLATE_NOOP("Language", "Spanish"), QT_TRANSLATE_NOOP("Language", "Venezuela")},
+    {"et", QT_TRANSLATE_NOOP("Language", "Estonian"), 0},
+    {"eu", QT_TRANSLATE_NOOP("Language", "Basque"), 0},
+    {"ewo", QT_TRANSLATE_NOOP("Language", "Ewondo"), 0},
+    {"fa", QT_TRANSLATE_NOOP("Language", "Persian"), 0},
+    {"fan", QT_TRANSLATE_NOOP("Language", "Fang"), 0},
+    {"fat", QT_TRANSLATE_NOOP("Language", "Fanti"), 0},
+    {"ff", QT_TRANSLATE_NOOP("Language", "Fulah"), 0},
+    {"fi", QT_TRANSLATE_NOOP("Language", "Finnish"), 0},
+    {"fil", QT_TRANSLATE_NOOP("Language", "Filipino, Pilipino"), 0},
+    {"fiu", QT_TRANSLATE_NOOP("Language", "Finno-Ugrian languages"), 0},
+    {"fj", QT_TRANSLATE_NOOP("Language", "Fijian"), 0},
+    {"fo", QT_TRANSLATE_NOOP("Language", "Faroese"), 0},
+    {"fon", QT_TRANSLATE_NOOP("Language", "Fon"), 0},
+    {"fr", QT_TRANSLATE_NOOP("Language", "French"), 0},
+    {"fr-BE", QT_TRANSLATE_NOOP("Language", "French"), QT_TRANSLATE_NOOP("Language", "Belgium")},
+    {"fr-CA", QT_TRANSLATE_NOOP("Language", "French"), QT_TRANSLATE_NOOP("Language", "Canada")},
+    {"fr-CH", QT_TRANSLATE_NOOP("Language", "French"), QT_TRANSLATE_NOOP("Language", "Switzerland")},
+    {"fr-FR", QT_TRANSLATE_NOOP("Language", "French"), QT_TRANSLATE_NOOP("Language", "France")},
+    {"fr-LU", QT_TRANSLATE_NOOP("Language", "French"), QT_TRANSLATE_NOOP("Language", "Luxembourg")},
+    {"frm", QT_TRANSLATE_NOOP("Language", "French- Middle (ca.1400-1600)"), 0},
+    {"fro", QT_TRANSLATE_NOOP("Language", "French- Old (842-ca.1400)"), 0},
+    {"frr", QT_TRANSLATE_NOOP("Language", "Northern Frisian"), 0},
+    {"frs", QT_TRANSLATE_NOOP("Language", "Eastern Frisian"), 0},
+    {"fur", QT_TRANSLATE_NOOP("Language", "Friulian"), 0},
+    {"fy", QT_TRANSLATE_NOOP("Language", "Western Frisian"), 0},
+    {"ga", QT_TRANSLATE_NOOP("Language", "Irish"), 0},
+    {"gaa", QT_TRANSLATE_NOOP("Language", "Ga"), 0},
+    {"gay", QT_TRANSLATE_NOOP("Language", "Gayo"), 0},
+    {"gba", QT_TRANSLATE_NOOP("Language", "Gbaya"), 0},
+    {"gd", QT_TRANSLATE_NOOP("Language", "Gaelic"), QT_TRANSLATE_NOOP("Language", "Scotland")},
+    {"gd-IE", QT_TRANSLATE_NOOP("Language", "Gaelic"), QT_TRANSLATE_NOOP("Language", "Ireland")},
+    {"gem", QT_TRANSLATE_NOOP("Language", "Germanic languages"), 0},
+    {"gez", QT_TRANSLATE_NOOP("Language", "Geez"), 0},
+    {"gil", QT_TRANSLATE_NOOP("Language", "Gilbertese"), 0},
+    {"gl", QT_TRANSLATE_NOOP("Language", "Galician"), 0},
+    {"gmh", QT_TRANSLATE_NOOP("Language", "German- Middle High (ca.1050-1500)"), 0},
+    {"gn", QT_TRANSLATE_NOOP("Language", "Guarani"), 0},
+    {"goh", QT_TRANSLATE_NOOP("Language", "German- Old High (ca.750-1050)"), 0},
+    {"gon", QT_TRANSLATE_NOOP("Language", "Gondi"), 0},
+    {"gor", QT_TRANSLATE_NOOP("Language", "Gorontalo"), 0},
+    {"got", QT_TRANSLATE_NOOP("Language", "Gothic"), 0},
+    {"grb", QT_TRANSLATE_NOOP("Language", "Grebo"), 0},
+    {"grc", QT_TRANSLATE_NOOP("Language", "Greek- Ancient (to 1453)"), 0},
+    {"gsw", QT_TRANSLATE_NOOP("Language", "Alsatian, Swiss German, Alemannic"), 0},
+    {"gu", QT_TRANSLATE_NOOP("Language", "Gujarati"), 0},
+    {"gug", QT_TRANSLATE_NOOP("Language", "Paraguayan Guaraní"), 0},
+    {"gv", QT_TRANSLATE_NOOP("Language", "Manx"), 0},
+    {"gwi", QT_TRANSLATE_NOOP("Language", "Gwich'in"), 0},
+    {"ha", QT_TRANSLATE_NOOP("Language", "Hausa"), 0},
+    {"hai", QT_TRANSLATE_NOOP("Language", "Haida"), 0},
+    {"haw", QT_TRANSLATE_NOOP("Language", "Hawaiian"), 0},
+    {"he", QT_TRANSLATE_NOOP("Language", "Hebrew"), 0},
+    {"hi", QT_TRANSLATE_NOOP("Language", "Hindi"), 0},
+    {"hil", QT_TRANSLATE_NOOP("Language", "Hiligaynon"), 0},
+    {"him", QT_TRANSLATE_NOOP("Language", "Himachali, Western Pahari languages"), 0},
+    {"hit", QT_TRANSLATE_NOOP("Language", "Hittite"), 0},
+    {"hmn", QT_TRANSLATE_NOOP("Language", "Hmong, Mong"), 0},
+    {"ho", QT_TRANSLATE_NOOP("Language", "Hiri Motu"), 0},
+    {"hr", QT_TRANSLATE_NOOP("Language", "Croatian"), 0},
+    {"hsb", QT_TRANSLATE_NOOP("Language", "Upper Sorbian"), 0},
+    {"ht", QT_TRANSLATE_NOOP("Language", "Haitian"), 0},
+    {"hu", QT_TRANSLATE_NOOP("Language", "Hungarian"), 0},
+    {"hu-HU", QT_TRANSLATE_NOOP("Language", "Hungarian"), QT_TRANSLATE_NOOP("Language", "Hungary")},
+    {"hup", QT_TRANSLATE_NOOP("Language", "Hupa"), 0},
+    {"hy", QT_TRANSLATE_NOOP("Language", "Armenian"), 0},
+    {"hz", QT_TRANSLATE_NOOP("Language", "Herero"), 0},
+    {"ia", QT_TRANSLATE_NOOP("Language", "Interlingua"), 0},
+    {"iba", QT_TRANSLATE_NOOP("Language", "Iban"), 0},
+    {"id", QT_TRANSLATE_NOOP("Language", "Indonesian"), 0},
+    {"id-ID", QT_TRANSLATE_NOOP("Language", "Indonesian - Indonesia"), 0},
+    {"ie", QT_TRANSLATE_NOOP("Language", "Interlingue"), 0},
+    {"ig", QT_TRANSLATE_NOOP("Language", "Igbo"), 0},
+    {"ii", QT_TRANSLATE_NOOP("Language", "Sichuan Yi"), 0},
+    {"ijo", QT_TRANSLATE_NOOP("Language", "Ijo languages"), 0},
+    {"ik", QT_TRANSLATE_NOOP("Language", "Inupiaq"), 0},
+    {"ilo", QT_TRANSLATE_NOOP("Language", "Iloko"), 0},
+    {"inc", QT_TRANSLATE_NOOP("Language", "Indic languages"), 0},
+    {"ine", QT_TRANSLATE_NOOP("Language", "Indo-European languages"), 0},
+    {"inh", QT_TRANSLATE_NOOP("Language", "Ingush"), 0},
+    {"io", QT_TRANSLATE_NOOP("Language", "Ido"), 0},
+    {"ira", QT_TRANSLATE_NOOP("Language", "Iranian languages"), 0},
+    {"iro", QT_TRANSLATE_NOOP("Language", "Iroquoian languages"), 0},
+    {"is", QT_TRANSLATE_NOOP("Language", "Icelandic"), 0},
+    {"it", QT_TRANSLATE_NOOP("Language", "Italian"), 0},
+    {"it-CH", QT_TRANSLATE_NOOP("Language", "Italian"), QT_TRANSLATE_NOOP("Language", "Switzerland")},
+    {"it-IT", QT_TRANSLATE_NOOP("Language", "Italian"), QT_TRANSLATE_NOOP("Language", "Italy")},
+    {"iu", QT_TRANSLATE_NOOP("Language", "Inuktitut"), 0},
+    {"ja", QT_TRANSLATE_NOOP("Language", "Japanese"), 0},
+    {"jbo", QT_TRANSLATE_NOOP("Language", "Lojban"), 0},
+    {"jpr", QT_TRANSLATE_NOOP("Language", "Judeo-Persian"), 0},
+    {"jrb", QT_TRANSLATE_NOOP("Language", "Judeo-Arabic"), 0},
+    {"jv", QT_TRANSLATE_NOOP("Language", "Javanese"), 0},
+    {"ka", QT_TRANSLATE_NOOP("Language", "Georgian"), 0},
+    {"kaa", QT_TRANSLATE_NOOP("Language", "Kara-Kalpak"), 0},
+    {"kab", QT_TRANSLATE_NOOP("Language", "Kabyle"), 0},
+    {"kac", QT_TRANSLATE_NOOP("Language", "Jingpho, Kachin"), 0},
+    {"kam", QT_TRANSLATE_NOOP("Language", "Kamba"), 0},
+    {"kar", QT_TRANSLATE_NOOP("Language", "Karen languages"), 0},
+    {"kaw", QT_TRANSLATE_NOOP("Language", "Kawi"), 0},
+    {"kbd", QT_TRANSLATE_NOOP("Language", "Kabardian"), 0},
+    {"kg", QT_TRANSLATE_NOOP("Language", "Kongo"), 0},
+    {"kha", QT_TRANSLATE_NOOP("Language", "Khasi"), 0},
+    {"khi", QT_TRANSLATE_NOOP("Language", "Khoisan languages"), 0},
+    {"kho", QT_TRANSLATE_NOOP("Language", "Khotanese, Sakan"), 0},
+    {"ki", QT_TRANSLATE_NOOP("Language", "Kikuyu"), 0},
+    {"kj", QT_TRANSLATE_NOOP("Language", "Kuanyama"), 0},
+    {"kk", QT_TRANSLATE_NOOP("Language", "Kazakh"), 0},
+    {"kl", QT_TRANSLATE_NOOP("Language", "Kalaallisut"), 0},
+    {"km", QT_TRANSLATE_NOOP("Language", "Central Khmer"), 0},
+    {"kmb", QT_TRANSLATE_NOOP("Language", "Kimbundu"), 0},
+    {"kn", QT_TRANSLATE_NOOP("Language", "Kannada"), 0},
+    {"ko", QT_TRANSLATE_NOOP("Language", "Korean"), 0},
+    {"kok", QT_TRANSLATE_NOOP("Language", "Konkani"), 0},
+    {"kos", QT_TRANSLATE_NOOP("Language", "Kosraean"), 0},
+    {"kpe", QT_TRANSLATE_NOOP("Language", "Kpelle"), 0},
+    {"kr", QT_TRANSLATE_NOOP("Language", "Kanuri"), 0},
+    {"krc", QT_TRANSLATE_NOOP("Language", "Karachay-Balkar"), 0},
+    {"krl", QT_TRANSLATE_NOOP("Language", "Karelian"), 0},
+    {"kro", QT_TRANSLATE_NOOP("Language", "Kru languages"), 0},
+    {"kru", QT_TRANSLATE_NOOP("Language", "Kurukh"), 0},
+    {"ks", QT_TRANSLATE_NOOP("Language", "Kashmiri"), 0},
+    {"ku", QT_TRANSLATE_NOOP("Language", "Kurdish"), 0},
+    {"kum", QT_TRANSLATE_NOOP("Language", "Kumyk"), 0},
+    {"kut", QT_TRANSLATE_NOOP("Language", "Kutenai"), 0},
+    {"kv", QT_TRANSLATE_NOOP("Language", "Komi"), 0},
+    {"kw", QT_TRANSLATE_NOOP("Language", "Cornish"), 0},
+    {"ky", QT_TRANSLATE_NOOP("Language", "Kirghiz"), 0},
+    {"la", QT_TRANSLATE_NOOP("Language", "Latin"), 0},
+    {"lad", QT_TRANSLATE_NOOP("Language", "Ladino"), 0},
+    {"lah", QT_TRANSLATE_NOOP("Language", "Lahnda"), 0},
+    {"lam", QT_TRANSLATE_NOOP("Language", "Lamba"), 0},
+    {"lb", QT_TRANSLATE_NOOP("Language", "Luxembourgish"), 0},
+    {"lez", QT_TRANSLATE_NOOP("Language", "Lezghian"), 0},
+    {"lg", QT_TRANSLATE_NOOP("Language", "Ganda"), 0},
+    {"li", QT_TRANSLATE_NOOP("Language", "Limburgan"), 0},
+    {"ln", QT_TRANSLATE_NOOP("Language", "Lingala"), 0},
+    {"lo", QT_TRANSLATE_NOOP("Language", "Lao"), 0},
+    {"lol", QT_TRANSLATE_NOOP("Language", "Mongo"), 0},
+    {"loz", QT_TRANSLATE_NOOP("Language", "Lozi"), 0},
+    {"lt", QT_TRANSLATE_NOOP("Language", "Lithuanian"), 0},
+    {"lu", QT_TRANSLATE_NOOP("Language", "Luba-Katanga"), 0},
+    {"lua", QT_TRANSLATE_NOOP("Language", "Luba-Lulua"), 0},
+    {"lui", QT_TRANSLATE_NOOP("Language", "Luiseno"), 0},
+    {"lun", QT_TRANSLATE_NOOP("Language", "Lunda"), 0},
+    {"luo", QT_TRANSLATE_NOOP("Language", "Luo (Kenya and Tanzania)"), 0},
+    {"lus", QT_TRANSLATE_NOOP("Language", "Lushai"), 0},
+    {"lv", QT_TRANSLATE_NOOP("Language", "Latvian"), 0},
+    {"lv-LV", QT_TRANSLATE_NOOP("Language", "Latvian"), QT_TRANSLATE_NOOP("Language", "Latvia")},
+    {"mad", QT_TRANSLATE_NOOP("Language", "Madurese"), 0},
+    {"mag", QT_TRANSLATE_NOOP("Language", "Magahi"), 0},
+    {"mai", QT_TRANSLATE_NOOP("Language", "Maithili"), 0},
+    {"mak", QT_TRANSLATE_NOOP("Language", "Makasar"), 0},
+    {"man", QT_TRANSLATE_NOOP("Language", "Mandingo"), 0},
+    {"map", QT_TRANSLATE_NOOP("Language", "Austronesian languages"), 0},
+    {"mas", QT_TRANSLATE_NOOP("Language", "Masai"), 0},
+    {"mdf", QT_TRANSLATE_NOOP("Language", "Moksha"), 0},
+    {"mdr", QT_TRANSLATE_NOOP("Language", "Mandar"), 0},
+    {"men", QT_TRANSLATE_NOOP("Language", "Mende"), 0},
+    {"mg", QT_TRANSLATE_NOOP("Language", "Malagasy"), 0},
+    {"mga", QT_TRANSLATE_NOOP("Language", "Irish- Middle (900-1200)"), 0},
+    {"mh", QT_TRANSLATE_NOOP("Language", "Marshallese"), 0},
+    {"mi", QT_TRANSLATE_NOOP("Language", "Maori"), 0},
+    {"mic", QT_TRANSLATE_NOOP("Language", "Mi'kmaq, Micmac"), 0},
+    {"min", QT_TRANSLATE_NOOP("Language", "Minangkabau"), 0},
+    {"mis", QT_TRANSLATE_NOOP("Language", "Uncoded languages"), 0},
+    {"mk", QT_TRANSLATE_NOOP("Language", "Macedonian"), 0},
+    {"mkh", QT_TRANSLATE_NOOP("Language", "Mon-Khmer languages"), 0},
+    {"ml", QT_TRANSLATE_NOOP("Language", "Malayalam"), 0},
+    {"mn", QT_TRANSLATE_NOOP("Language", "Mongolian"), 0},
+    {"mnc", QT_TRANSLATE_NOOP("Language", "Manchu"), 0},
+    {"mni", QT_TRANSLATE_NOOP("Language", "Manipuri"), 0},
+    {"mno", QT_TRANSLATE_NOOP("Language", "Manobo languages"), 0},
+    {"moh", QT_TRANSLATE_NOOP("Language", "Mohawk"), 0},
+    {"mos", QT_TRANSLATE_NOOP("Language", "Mossi"), 0},
+    {"mr", QT_TRANSLATE_NOOP("Language", "Marathi"), 0},
+    {"ms", QT_TRANSLATE_NOOP("Language", "Malay"), 0},
+    {"ms-BN", QT_TRANSLATE_NOOP("Language", "Malay"), QT_TRANSLATE_NOOP("Language", "Brunei")},
+    {"ms-MY", QT_TRANSLATE_NOOP("Language", "Malay"), QT_TRANSLATE_NOOP("Language", "Malaysia")},
+    {"mt", QT_TRANSLATE_NOOP("Language", "Maltese"), 0},
+    {"mul", QT_TRANSLATE_NOOP("Language", "Multiple languages"), 0},
+    {"mun", QT_TRANSLATE_NOOP("Language", "Munda languages"), 0},
+    {"mus", QT_TRANSLATE_NOOP("Language", "Creek"), 0},
+    {"mwl", QT_TRANSLATE_NOOP("Language", "Mirandese"), 0},
+    {"mwr", QT_TRANSLATE_NOOP("Language", "Marwari"), 0},
+    {"my", QT_TRANSLATE_NOOP("Language", "Burmese"), 0},
+    {"myn", QT_TRANSLATE_NOOP("Language", "Mayan languages"), 0},
+    {"myv", QT_TRANSLATE_NOOP("Language", "Erzya"), 0},
+    {"na", QT_TRANSLATE_NOOP("Language", "Nauru"), 0},
+    {"nah", QT_TRANSLATE_NOOP("Language", "Nahuatl languages"), 0},
+    {"nai", QT_TRANSLATE_NOOP("Language", "North American Indian languages"), 0},
+    {"nap", QT_TRANSLATE_NOOP("Language", "Neapolitan"), 0},
+    {"nb", QT_TRANSLATE_NOOP("Language", "Norwegian"), QT_TRANSLATE_NOOP("Language", "Bokmal")},
+    {"nd", QT_TRANSLATE_NOOP("Language", "Ndebele"), QT_TRANSLATE_NOOP("Language", "North")},
+    {"nds", QT_TRANSLATE_NOOP("Language", "German-Low, Low Saxon"), 0},
+    {"ne", QT_TRANSLATE_NOOP("Language", "Nepali"), 0},
+    {"new", QT_TRANSLATE_NOOP("Language", "Nepal Bhasa/Newari"), 0},
+    {"ng", QT_TRANSLATE_NOOP("Language", "Ndonga"), 0},
+    {"nia", QT_TRANSLATE_NOOP("Language", "Nias"), 0},
+    {"nic", QT_TRANSLATE_NOOP("Language", "Niger-Kordofanian languages"), 0},
+    {"niu", QT_TRANSLATE_NOOP("Language", "Niuean"), 0},
+    {"nl", QT_TRANSLATE_NOOP("Language", "Dutch"), 0},
+    {"nl-BE", QT_TRANSLATE_NOOP("Language", "Dutch"), QT_TRANSLATE_NOOP("Language", "Belgium")},
+    {"nl-NL", QT_TRANSLATE_NOOP("Language", "Dutch"), QT_TRANSLATE_NOOP("Language", "Netherlands")},
+    {"nn", QT_TRANSLATE_NOOP("Language", "Norwegian"), QT_TRANSLATE_NOOP("Language", "Nynorsk")},
+    {"no", QT_TRANSLATE_NOOP("Language", "Norwegian"), 0},
+    {"nog", QT_TRANSLATE_NOOP("Language", "Nogai"), 0},
+    {"non", QT_TRANSLATE_NOOP("Language", "Norse- Old"), 0},
+    {"nqo", QT_TRANSLATE_NOOP("Language", "N'Ko"), 0},
+    {"nr", QT_TRANSLATE_NOOP("Language", "Ndebele"), QT_TRANSLATE_NOOP("Language", "South")},
+    {"nso", QT_TRANSLATE_NOOP("Language", "Northern Sotho, Sepedi, Pedi"), 0},
+    {"nub", QT_TRANSLATE_NOOP("Language", "Nubian languages"), 0},
+    {"nv", QT_TRANSLATE_NOOP("Language", "Navajo"), 0},
+    {"nwc", QT_TRANSLATE_NOOP("Language", "Classical Nepal Bhasa/Newari, Old Newari"), 0},
+    {"ny", QT_TRANSLATE_NOOP("Language", "Nyanja"), 0},
+    {"nym", QT_TRANSLATE_NOOP("Language", "Nyamwezi"), 0},
+    {"nyn", QT_TRANSLATE_NOOP("Language", "Nyankole"), 0},
+    {"nyo", QT_TRANSLATE_NOOP("Language", "Nyoro"), 0},
+    {"nzi", QT_TRANSLATE_NOOP("Language", "Nzima"), 0},
+    {"oc", QT_TRANSLATE_NOOP("Language", "Occitan"), 0},
+    {"oj", QT_TRANSLATE_NOOP("Language", "Ojibwa"), 0},
+    {"om", QT_TRANSLATE_NOOP("Language", "Oromo"), 0},
+    {"or", QT_TRANSLATE_NOOP("Language", "Oriya"), 0},
+    {"os", QT_TRANSLATE_NOOP("Language", "Ossetian"), 0},
+    {"osa", QT_TRANSLATE_NOOP("Language", "Osage"), 0},
+    {"ota", QT_TRANSLATE_NOOP("Language", "Turkish- Ottoman (1500-1928)"), 0},
+    {"oto", QT_TRANSLATE_NOOP("Language", "Otomian languages"), 0},
+    {"pa", QT_TRANSLATE_NOOP("Language", "Panjabi"), 0},
+    {"paa", QT_TRANSLATE_NOOP("Language", "Papuan languages"), 0},
+    {"pag", QT_TRANSLATE_NOOP("Language", "Pangasinan"), 0},
+    {"pal", QT_TRANSLATE_NOOP("Language", "Pahlavi"), 0},
+    {"pam", QT_TRANSLATE_NOOP("Language", "Kapampangan, Pampanga"), 0},
+    {"pap", QT_TRANSLATE_NOOP("Language", "Papiamento"), 0},
+    {"pau", QT_TRANSLATE_NOOP("Language", "Palauan"), 0},
+    {"peo", QT_TRANSLATE_NOOP("Language", "Persian- Old (ca.600-400 B.C.)"), 0},
+    {"phi", QT_TRANSLATE_NOOP("Language", "Philippine languages"), 0},
+    {"phn", QT_TRANSLATE_NOOP("Language", "Phoenician"), 0},
+    {"pi", QT_TRANSLATE_NOOP("Language", "Pali"), 0},
+    {"pl", QT_TRANSLATE_NOOP("Language", "Polish"), 0},
+    {"pon", QT_TRANSLATE_NOOP("Language", "Pohnpeian"), 0},
+    {"pra", QT_TRANSLATE_NOOP("Language", "Prakrit languages"), 0},
+    {"pro", QT_TRANSLATE_NOOP("Language", "Occitan/Provencal- Old (to 1500)"), 0},
+    {"ps", QT_TRANSLATE_NOOP("Language", "Pushto"), 0},
+    {"pt", QT_TRANSLATE_NOOP("Language", "Portuguese"), 0},
+    {"pt-BR", QT_TRANSLATE_NOOP("Language", "Portuguese"), QT_TRANSLATE_NOOP("Language", "Brazil")},
+    {"pt-TT", QT_TRANSLATE_NOOP("Language", "Portuguese"), QT_TRANSLATE_NOOP("Language", "Portugal")},
+    {"qaa-qtz", QT_TRANSLATE_NOOP("Language", "Reserved for local use"), 0},
+    {"qu", QT_TRANSLATE_NOOP("Language", "Quechua"), 0},
+    {"raj", QT_TRANSLATE_NOOP("Language", "Rajasthani"), 0},
+    {"rap", QT_TRANSLATE_NOOP("Language", "Rapanui"), 0},
+    {"rar", QT_TRANSLATE_NOOP("Language", "Rarotongan, Cook Islands Maori"), 0},
+    {"rm", QT_TRANSLATE_NOOP("Language", "Romansh"), 0},
+    {"rn", QT_TRANSLATE_NOOP("Language", "Rundi"), 0},
+    {"ro", QT_TRANSLATE_NOOP("Language", "Romanian"), 0},
+    {"ro-MO", QT_TRANSLATE_NOOP("Language", "Romanian"), QT_TRANSLATE_NOOP("Language", "Moldova")},
+    {"ro-RO", QT_TRANSLATE_NOOP("Language", "Romanian"), QT_TRANSLATE_NOOP("Language", "Romania")},
+    {"roa", QT_TRANSLATE_NOOP("Language", "Romance languages"), 0},
+    {"rom", QT_TRANSLATE_NOOP("Language", "Romany"), 0},
+    {"ru", QT_TRANSLATE_NOOP("Language", "Russian"), 0},
+    {"ru-MO", QT_TRANSLATE_NOOP("Language", "Russian"), QT_TRANSLATE_NOOP("Language", "Moldova")},
+    {"rup", QT_TRANSLATE_NOOP("Language", "Aromanian, Arumanian, Macedo-Romanian"), 0},
+    {"rw", QT_TRANSLATE_NOOP("Language", "Kinyarwanda"), 0},
+    {"sa", QT_TRANSLATE_NOOP("Language", "Sanskrit"), 0},
+    {"sad", QT_TRANSLATE_NOOP("Language", "Sandawe"), 0},
+    {"sah", QT_TRANSLATE_NOOP("Language", "Yakut"), 0},
+    {"sai", QT_TRANSLATE_NOOP("Language", "South American Indian languages"), 0},
+    {"sal", QT_TRANSLATE_NOOP("Language", "Salishan languages"), 0},
+    {"sam", QT_TRANSLATE_NOOP("Language", "Samaritan Aramaic"), 0},
+    {"sas", QT_TRANSLATE_NOOP("Language", "Sasak"), 0},
+    {"sat", QT_TRANSLATE_NOOP("Language", "Santali"), 0},
+    {"sc", QT_TRANSLATE_NOOP("Language", "Sardinian"), 0},
+    {"scn", QT_TRANSLATE_NOOP("Language", "Sicilian"), 0},
+    {"sco", QT_TRANSLATE_NOOP("Language", "Scots"), 0},
+    {"sd", QT_TRANSLATE_NOOP("Language", "Sindhi"), 0},
+    {"se", QT_TRANSLATE_NOOP("Language", "Northern, Sami"), 0},
+    {"sel", QT_TRANSLATE_NOOP("Language", "Selkup"), 0},
+    {"sem", QT_TRANSLATE_NOOP("Language", "Semitic languages"), 0},
+    {"sg", QT_TRANSLATE_NOOP("Language", "Sango"), 0},
+    {"sga", QT_TRANSLATE_NOOP("Language", "Irish- Old (to 900)"), 0},
+    {"sgn", QT_TRANSLATE_NOOP("Language", "Sign Languages"), 0},
+    {"shn", QT_TRANSLATE_NOOP("Language", "Shan"), 0},
+    {"si", QT_TRANSLATE_NOOP("Language", "Sinhala"), 0},
+    {"sid", QT_TRANSLATE_NOOP("Language", "Sidamo"), 0},
+    {"sio", QT_TRANSLATE_NOOP("Language", "Siouan languages"), 0},
+    {"sit", QT_TRANSLATE_NOOP("Language", "Sino-Tibetan languages"), 0},
+    {"sk", QT_TRANSLATE_NOOP("Language", "Slovak"), 0},
+    {"sl", QT_TRANSLATE_NOOP("Language", "Slovenian"), 0},
+    {"sla", QT_TRANSLATE_NOOP("Language", "Slavic languages"), 0},
+    {"sm", QT_TRANSLATE_NOOP("Language", "Samoan"), 0},
+    {"sma", QT_TRANSLATE_NOOP("Language", "Southern Sami"), 0},
+    {"smi", QT_TRANSLATE_NOOP("Language", "Sami languages"), 0},
+    {"smj", QT_TRANSLATE_NOOP("Language", "Lule Sami"), 0},
+    {"smn", QT_TRANSLATE_NOOP("Language", "Inari Sami"), 0},
+    {"sms", QT_TRANSLATE_NOOP("Language", "Skolt Sami"), 0},
+    {"sn", QT_TRANSLATE_NOOP("Language", "Shona"), 0},
+    {"snk", QT_TRANSLATE_NOOP("Language", "Soninke"), 0},
+    {"so", QT_TRANSLATE_NOOP("Language", "Somali"), 0},
+    {"sog", QT_TRANSLATE_NOOP("Language", "Sogdian"), 0},
+    {"son", QT_TRANSLATE_NOOP("Language", "Songhai languages"), 0},
+    {"sq", QT_TRANSLATE_NOOP("Language", "Albanian"), 0},
+    {"sr", QT_TRANSLATE_NOOP("Language", "Serbian"), 0},
+    {"sr-RS", QT_TRANSLATE_NOOP("Language", "Serbian"), QT_TRANSLATE_NOOP("Language", "Serbia")},
+    {"srn", QT_TRANSLATE_NOOP("Language", "Sranan Tongo"), 0},
+    {"srr", QT_TRANSLATE_NOOP("Language", "Serer"), 0},
+    {"ss", QT_TRANSLATE_NOOP("Language", "Swati"), 0},
+    {"ssa", QT_TRANSLATE_NOOP("Language", "Nilo-Saharan languages"), 0},
+    {"st", QT_TRANSLATE_NOOP("Language", "Sotho, Southern"), 0},
+    {"su", QT_TRANSLATE_NOOP("Language", "Sundanese"), 0},
+    {"suk", QT_TRANSLATE_NOOP("Language", "Sukuma"), 0},
+    {"sus", QT_TRANSLATE_NOOP("Language", "Susu"), 0},
+    {"sux", QT_TRANSLATE_NOOP("Language", "Sumerian"), 0},
+    {"sv", QT_TRANSLATE_NOOP("Language", "Swedish"), 0},
+    {"sv-FI", QT_TRANSLATE_NOOP("Language", "Swedish"), QT_TRANSLATE_NOOP("Language", "Finland")},
+    {"sv-SE", QT_TRANSLATE_NOOP("Language", "Swedish"), QT_TRANSLATE_NOOP("Language", "Sweden")},
+    {"sw", QT_TRANSLATE_NOOP("Language", "Swahili"), 0},
+    {"syc", QT_TRANSLATE_NOOP("Language", "Classical Syriac"), 0},
+    {"syr", QT_TRANSLATE_NOOP("Language", "Syriac"), 0},
+    {"ta", QT_TRANSLATE_NOOP("Language", "Tamil"), 0},
+    {"tai", QT_TRANSLATE_NOOP("Language", "Tai languages"), 0},
+    {"te", QT_TRANSLATE_NOOP("Language", "Telugu"), 0},
+    {"tem", QT_TRANSLATE_NOOP("Language", "Timne"), 0},
+    {"ter", QT_TRANSLATE_NOOP("Language", "Tereno"), 0},
+    {"tet", QT_TRANSLATE_NOOP("Language", "Tetum"), 0},
+    {"tg", QT_TRANSLATE_NOOP("Language", "Tajik"), 0},
+    {"th", QT_TRANSLATE_NOOP("Language", "Thai"), 0},
+    {"ti", QT_TRANSLATE_NOOP("Language", "Tigrinya"), 0},
+    {"tig", QT_TRANSLATE_NOOP("Language", "Tigre"), 0},
+    {"tiv", QT_TRANSLATE_NOOP("Language", "Tiv"), 0},
+    {"tk", QT_TRANSLATE_NOOP("Language", "Turkmen"), 0},
+    {"tkl", QT_TRANSLATE_NOOP("Language", "Tokelau"), 0},
+    {"tl", QT_TRANSLATE_NOOP("Language", "Tagalog"), 0},
+    {"tlh", QT_TRANSLATE_NOOP("Language", "Klingon, tlhIngan-Hol"), 0},
+    {"tli", QT_TRANSLATE_NOOP("Language", "Tlingit"), 0},
+    {"tmh", QT_TRANSLATE_NOOP("Language", "Tamashek"), 0},
+    {"tn", QT_TRANSLATE_NOOP("Language", "Tswana"), 0},
+    {"to", QT_TRANSLATE_NOOP("Language", "Tonga"), 0},
+    {"tog", QT_TRANSLATE_NOOP("Language", "Tonga (Nyasa)"), 0},
+    {"tpi", QT_TRANSLATE_NOOP("Language", "Tok Pisin"), 0},
+    {"tr", QT_TRANSLATE_NOOP("Language", "Turkish"), 0},
+    {"tr-TR", QT_TRANSLATE_NOOP("Language", "Turkish"), QT_TRANSLATE_NOOP("Language", "Turkey")},
+    {"ts", QT_TRANSLATE_NOOP("Language", "Tsonga"), 0},
+    {"tsi", QT_TRANSLATE_NOOP("Language", "Tsimshian"), 0},
+    {"tt", QT_TRANSLATE_NOOP("Language", "Tatar"), 0},
+    {"tum", QT_TRANSLATE_NOOP("Language", "Tumbuka"), 0},
+    {"tup", QT_TRANSLATE_NOOP("Language", "Tupi languages"), 0},
+    {"tut", QT_TRANSLATE_NOOP("Language", "Altaic languages"), 0},
+    {"tvl", QT_TRANSLATE_NOOP("Language", "Tuvalu"), 0},
+    {"tw", QT_TRANSLATE_NOOP("Language", "Twi"), 0},
+    {"ty", QT_TRANSLATE_NOOP("Language", "Tahitian"), 0},
+    {"tyv", QT_TRANSLATE_NOOP("Language", "Tuvinian"), 0},
+    {"udm", QT_TRANSLATE_NOOP("Language", "Udmurt"), 0},
+    {"ug", QT_TRANSLATE_NOOP("Language", "Uighur"), 0},
+    {"uga", QT_TRANSLATE_NOOP("Language", "Ugaritic"), 0},
+    {"uk", QT_TRANSLATE_NOOP("Language", "Ukrainian"), 0},
+    {"uk-UA", QT_TRANSLATE_NOOP("Language", "Ukrainian"), QT_TRANSLATE_NOOP("Language", "Ukraine")},
+    {"umb", QT_TRANSLATE_NOOP("Language", "Umbundu"), 0},
+    {"und", QT_TRANSLATE_NOOP("Language", "Undetermined"), 0},
+    {"ur", QT_TRANSLATE_NOOP("Language", "Urdu"), 0},
+    {"uz", QT_TRANSLATE_NOOP("Language", "Uzbek"), 0},
+    {"uz-UX", QT_TRANSLATE_NOOP("Language", "Uzbek"), QT_TRANSLATE_NOOP("Language", "Uzbekistan")},
+    {"vai", QT_TRANSLATE_NOOP("Language", "Vai"), 0},
+    {"ve", QT_TRANSLATE_NOOP("Language", "Venda"), 0},
+    {"vi", QT_TRANSLATE_NOOP("Language", "Vietnamese"), 0},
+    {"vo", QT_TRANSLATE_NOOP("Language", "Volapuk"), 0},
+    {"vot", QT_TRANSLATE_NOOP("Language", "Votic"), 0},
+    {"wa", QT_TRANSLATE_NOOP("Language", "Walloon"), 0},
+    {"wak", QT_TRANSLATE_NOOP("Language", "Wakashan languages"), 0},
+    {"wal", QT_TRANSLATE_NOOP("Language", "Wolaitta, Wolaytta"), 0},
+    {"war", QT_TRANSLATE_NOOP("Language", "Waray"), 0},
+    {"was", QT_TRANSLATE_NOOP("Language", "Washo"), 0},
+    {"wen", QT_TRANSLATE_NOOP("Language", "Sorbian languages"), 0},
+    {"wo", QT_TRANSLATE_NOOP("Language", "Wolof"), 0},
+    {"xal", QT_TRANSLATE_NOOP("Language", "Kalmyk, Oirat"), 0},
+    {"xh", QT_TRANSLATE_NOOP("Language", "Xhosa"), 0},
+    {"yao", QT_TRANSLATE_NOOP("Language", "Yao"), 0},
+    {"yap", QT_TRANSLATE_NOOP("Language", "Yapese"), 0},
+    {"yi", QT_TRANSLATE_NOOP("Language", "Yiddish"), 0},
+    {"yo", QT_TRANSLATE_NOOP("Language", "Yoruba"), 0},
+    {"ypk", QT_TRANSLATE_NOOP("Language", "Yupik languages"), 0},
+    {"za", QT_TRANSLATE_NOOP("Language", "Zhuang"), 0},
+    {"zap", QT_TRANSLATE_NOOP("Language", "Zapotec"), 0},
+    {"zbl", QT_TRANSLATE_NOOP("Language", "Bliss, Blissymbols, Blissymbolics"), 0},
+    {"zen", QT_TRANSLATE_NOOP("Language", "Zenaga"), 0},
+    {"zh", QT_TRANSLATE_NOOP("Language", "Chinese"), 0},
+    {"zh-CN", QT_TRANSLATE_NOOP("Language", "Chinese"), QT_TRANSLATE_NOOP("Language", "China")},
+    {"zh-HK", QT_TRANSLATE_NOOP("Language", "Chinese"), QT_TRANSLATE_NOOP("Language", "Hong Kong")},
+    {"zh-MO", QT_TRANSLATE_NOOP("Language", "Chinese"), QT_TRANSLATE_NOOP("Language", "Macau")},
+    {"zh-SG", QT_TRANSLATE_NOOP("Language", "Chinese"), QT_TRANSLATE_NOOP("Language", "Singapore")},
+    {"zh-TW", QT_TRANSLATE_NOOP("Language", "Chinese"), QT_TRANSLATE_NOOP("Language", "Taiwan")},
+    {"znd", QT_TRANSLATE_NOOP("Language", "Zande languages"), 0},
+    {"zu", QT_TRANSLATE_NOOP("Language", "Zulu"), 0},
+    {"zun", QT_TRANSLATE_NOOP("Language", "Zuni"), 0},
+    {"zxx", QT_TRANSLATE_NOOP("Language", "No linguistic content/Not applicable"), 0},
+    {"zza", QT_TRANSLATE_NOOP("Language", "Dimili, Dimli, Zaza, Zazaki, Kirdki, Kirmanjki"), 0},
+};
+
+static const int LANG_TABLE_COUNT = sizeof(LANG_TABLE) / sizeof(LANG_TABLE[0]);
+
+static QString LocalizedName(const LangEntry &entry)
+{
+    if (entry.region) {
+        return Language::tr(entry.name) + QString(" - ") + Language::tr(entry.region);
+    }
+    return Language::tr(entry.name);
+}
+
 Language *Language::m_instance = 0;
 
 Language *Language::instance()
@@ -38,11 +645,31 @@ Language *Language::instance()
 
 QString Language::GetLanguageName(QString code, QString ow)
 {
-    return m_languageCodeMap.value(code, ow);
+    const QByteArray utf8code = code.toUtf8();
+    int low = 0;
+    int high = LANG_TABLE_COUNT - 1;
+    while (low <= high) {
+        int mid = (low + high) / 2;
+        int cmp = strcmp(utf8code.constData(), LANG_TABLE[mid].code);
+        if (cmp == 0) {
+            return LocalizedName(LANG_TABLE[mid]);
+        }
+        if (cmp < 0) {
+            high = mid - 1;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return ow;
 }
 
 QString Language::GetLanguageCode(QString name, QString ow)
 {
+    if (m_languageNameMap.isEmpty()) {
+        for (int i = 0; i < LANG_TABLE_COUNT; i++) {
+            m_languageNameMap.insert(LocalizedName(LANG_TABLE[i]), QString::fromLatin1(LANG_TABLE[i].code));
+        }
+    }
     return m_languageNameMap.value(name, ow);
 }
 
@@ -52,8 +679,8 @@ QStringList Language::GetSortedPrimaryLanguageNames()
         return m_sortedPrimaryLanguageNames;
     }
 
-    foreach(QString code, m_languageCodeMap.keys()) {
-        m_sortedPrimaryLanguageNames.append(m_languageCodeMap.value(code));
+    for (int i = 0; i < LANG_TABLE_COUNT; i++) {
+        m_sortedPrimaryLanguageNames.append(LocalizedName(LANG_TABLE[i]));
     }
     m_sortedPrimaryLanguageNames.sort();
     return m_sortedPrimaryLanguageNames;
@@ -61,608 +688,17 @@ QStringList Language::GetSortedPrimaryLanguageNames()
 
 const QHash<QString, DescriptiveInfo> & Language::GetLangMap()
 {
+    if (m_LangInfo.isEmpty()) {
+        for (int i = 0; i < LANG_TABLE_COUNT; i++) {
+            DescriptiveInfo minfo;
+            minfo.name = LocalizedName(LANG_TABLE[i]);
+            minfo.description = QString();
+            m_LangInfo.insert(QString::fromLatin1(LANG_TABLE[i].code), minfo);
+        }
+    }
     return m_LangInfo;
 }
 
 Language::Language()
 {
-    SetLanguageMap();
-}
-
-void Language::SetLanguageMap()
-{
-    if (!m_languageCodeMap.isEmpty()) {
-        return;
-    }
-
-    // Must be a 1 to 1 relationship between codes and names.
-    // The keys are the ISO 639-2 language codes
-    // If a code has 2 and 3 character versions, use 2 character version
-    // and the values are the the full English language names.
-    // See http://www.loc.gov/standards/iso639-2/php/English_list.php
-    QStringList data;
-    data <<
-         "ab"    << tr("Abkhazian") <<
-         "aa"    << tr("Afar") <<
-         "af"    << tr("Afrikaans") <<
-         "ak"    << tr("Akan") <<
-         "sq"    << tr("Albanian") <<
-         "am"    << tr("Amharic") <<
-         "ar"    << tr("Arabic") <<
-         "ar-DZ" << tr("Arabic") + QString(" - ") + tr("Algeria") <<
-         "ar-BH" << tr("Arabic") + QString(" - ") + tr("Bahrain") <<
-         "ar-EG" << tr("Arabic") + QString(" - ") + tr("Egypt") <<
-         "ar-IQ" << tr("Arabic") + QString(" - ") + tr("Iraq") <<
-         "ar-JO" << tr("Arabic") + QString(" - ") + tr("Jordan") <<
-         "ar-KW" << tr("Arabic") + QString(" - ") + tr("Kuwait") <<
-         "ar-LB" << tr("Arabic") + QString(" - ") + tr("Lebanon") <<
-         "ar-LY" << tr("Arabic") + QString(" - ") + tr("Libya") <<
-         "ar-MA" << tr("Arabic") + QString(" - ") + tr("Morocco") <<
-         "ar-OM" << tr("Arabic") + QString(" - ") + tr("Oman") <<
-         "ar-QA" << tr("Arabic") + QString(" - ") + tr("Qatar") <<
-         "ar-SY" << tr("Arabic") + QString(" - ") + tr("Syria") <<
-         "ar-TN" << tr("Arabic") + QString(" - ") + tr("Tunisia") <<
-         "ar-AE" << tr("Arabic") + QString(" - ") + tr("United Arab Emirates") <<
-         "ar-YE" << tr("Arabic") + QString(" - ") + tr("Yemen") <<
-         "an"    << tr("Aragonese") <<
-         "hy"    << tr("Armenian") <<
-         "as"    << tr("Assamese") <<
-         "av"    << tr("Avaric") <<
-         "ae"    << tr("Avestan") <<
-         "ay"    << tr("Aymara") <<
-         "az"    << tr("Azerbaijani") <<
-         "az-AZ" << tr("Azerbaijani") + QString(" - ") + tr("Azerbaijan") <<
-         "bm"    << tr("Bambara") <<
-         "ba"    << tr("Bashkir") <<
-         "eu"    << tr("Basque") <<
-         "be"    << tr("Belarusian") <<
-         "bn"    << tr("Bengali") <<
-         "bh"    << tr("Bihari") <<
-         "bi"    << tr("Bislama") <<
-         "bs"    << tr("Bosnian") <<
-         "br"    << tr("Breton") <<
-         "bg"    << tr("Bulgarian") <<
-         "my"    << tr("Burmese") <<
-         "ca"    << tr("Catalan") <<
-         "ca-ES" << tr("Catalan") + QString(" - ") + tr("Spain") <<
-         "km"    << tr("Central Khmer") <<
-         "ch"    << tr("Chamorro") <<
-         "ce"    << tr("Chechen") <<
-         "zh"    << tr("Chinese") <<
-         "zh-CN" << tr("Chinese") + QString(" - ") + tr("China") <<
-         "zh-HK" << tr("Chinese") + QString(" - ") + tr("Hong Kong") <<
-         "zh-MO" << tr("Chinese") + QString(" - ") + tr("Macau") <<
-         "zh-SG" << tr("Chinese") + QString(" - ") + tr("Singapore") <<
-         "zh-TW" << tr("Chinese") + QString(" - ") + tr("Taiwan") <<
-         "cu"    << tr("Church Slavic") <<
-         "cv"    << tr("Chuvash") <<
-         "kw"    << tr("Cornish") <<
-         "co"    << tr("Corsican") <<
-         "cr"    << tr("Cree") <<
-         "hr"    << tr("Croatian") <<
-         "cs"    << tr("Czech") <<
-         "da"    << tr("Danish") <<
-         "da-DK" << tr("Danish") + QString(" - ") + tr("Denmark") <<
-         "dv"    << tr("Dhivehi") <<
-         "nl"    << tr("Dutch") <<
-         "nl-BE" << tr("Dutch") + QString(" - ") + tr("Belgium") <<
-         "nl-NL" << tr("Dutch") + QString(" - ") + tr("Netherlands") <<
-         "dz"    << tr("Dzongkha") <<
-         "en"    << tr("English") <<
-         "en-AU" << tr("English") + QString(" - ") + tr("Australia") <<
-         "en-BZ" << tr("English") + QString(" - ") + tr("Belize") <<
-         "en-CA" << tr("English") + QString(" - ") + tr("Canada") <<
-         "en-CB" << tr("English") + QString(" - ") + tr("Caribbean") <<
-         "en-GB" << tr("English") + QString(" - ") + tr("Great Britain") <<
-         "en-IN" << tr("English") + QString(" - ") + tr("India") <<
-         "en-IE" << tr("English") + QString(" - ") + tr("Ireland") <<
-         "en-JM" << tr("English") + QString(" - ") + tr("Jamaica") <<
-         "en-PH" << tr("English") + QString(" - ") + tr("Philippines") <<
-         "en-TT" << tr("English") + QString(" - ") + tr("Trinidad") <<
-         "en-ZA" << tr("English") + QString(" - ") + tr("South Africa") <<
-         "en-US" << tr("English") + QString(" - ") + tr("United States") <<
-         "eo"    << tr("Esperanto") <<
-         "et"    << tr("Estonian") <<
-         "ee"    << tr("Ewe") <<
-         "fo"    << tr("Faroese") <<
-         "fj"    << tr("Fijian") <<
-         "fi"    << tr("Finnish") <<
-         "fr"    << tr("French") <<
-         "fr-BE" << tr("French") + QString(" - ") + tr("Belgium") <<
-         "fr-CA" << tr("French") + QString(" - ") + tr("Canada") <<
-         "fr-FR" << tr("French") + QString(" - ") + tr("France") <<
-         "fr-LU" << tr("French") + QString(" - ") + tr("Luxembourg") <<
-         "fr-CH" << tr("French") + QString(" - ") + tr("Switzerland") <<
-         "ff"    << tr("Fulah") <<
-         "gd"    << tr("Gaelic") + QString(" - ") + tr("Scotland") <<
-         "gd-IE" << tr("Gaelic") + QString(" - ") + tr("Ireland") <<
-         "gl"    << tr("Galician") <<
-         "lg"    << tr("Ganda") <<
-         "ka"    << tr("Georgian") <<
-         "de"    << tr("German") <<
-         "de-AT" << tr("German") + QString(" - ") + tr("Austria") <<
-         "de-DE" << tr("German") + QString(" - ") + tr("Germany") <<
-         "de-LI" << tr("German") + QString(" - ") + tr("Liechtenstein") <<
-         "de-LU" << tr("German") + QString(" - ") + tr("Luxembourg") <<
-         "de-CH" << tr("German") + QString(" - ") + tr("Switzerland") <<
-         "el"    << tr("Greek, Modern") <<
-         "el-GR" << tr("Greek") <<
-         "gn"    << tr("Guarani") <<
-         "gu"    << tr("Gujarati") <<
-         "ht"    << tr("Haitian") <<
-         "ha"    << tr("Hausa") <<
-         "he"    << tr("Hebrew") <<
-         "hz"    << tr("Herero") <<
-         "hi"    << tr("Hindi") <<
-         "ho"    << tr("Hiri Motu") <<
-         "hu"    << tr("Hungarian") <<
-         "hu-HU" << tr("Hungarian") + QString(" - ") + tr("Hungary") <<
-         "is"    << tr("Icelandic") <<
-         "io"    << tr("Ido") <<
-         "ig"    << tr("Igbo") <<
-         "id"    << tr("Indonesian") <<
-         "id-ID" << tr("Indonesian - Indonesia") <<
-         "ia"    << tr("Interlingua") <<
-         "ie"    << tr("Interlingue") <<
-         "iu"    << tr("Inuktitut") <<
-         "ik"    << tr("Inupiaq") <<
-         "ga"    << tr("Irish") <<
-         "it"    << tr("Italian") <<
-         "it-IT" << tr("Italian") + QString(" - ") + tr("Italy") <<
-         "it-CH" << tr("Italian") + QString(" - ") + tr("Switzerland") <<
-         "ja"    << tr("Japanese") <<
-         "jv"    << tr("Javanese") <<
-         "kl"    << tr("Kalaallisut") <<
-         "kn"    << tr("Kannada") <<
-         "kr"    << tr("Kanuri") <<
-         "ks"    << tr("Kashmiri") <<
-         "kk"    << tr("Kazakh") <<
-         "ki"    << tr("Kikuyu") <<
-         "rw"    << tr("Kinyarwanda") <<
-         "ky"    << tr("Kirghiz") <<
-         "kv"    << tr("Komi") <<
-         "kg"    << tr("Kongo") <<
-         "ko"    << tr("Korean") <<
-         "kj"    << tr("Kuanyama") <<
-         "ku"    << tr("Kurdish") <<
-         "lo"    << tr("Lao") <<
-         "la"    << tr("Latin") <<
-         "lv"    << tr("Latvian") <<
-         "lv-LV" << tr("Latvian") + QString(" - ") + tr("Latvia") <<
-         "li"    << tr("Limburgan") <<
-         "ln"    << tr("Lingala") <<
-         "lt"    << tr("Lithuanian") <<
-         "lu"    << tr("Luba-Katanga") <<
-         "lb"    << tr("Luxembourgish") <<
-         "mk"    << tr("Macedonian") <<
-         "mg"    << tr("Malagasy") <<
-         "ml"    << tr("Malayalam") <<
-         "ms"    << tr("Malay") <<
-         "ms-BN" << tr("Malay") + QString(" - ") + tr("Brunei") <<
-         "ms-MY" << tr("Malay") + QString(" - ") + tr("Malaysia") <<
-         "mt"    << tr("Maltese") <<
-         "gv"    << tr("Manx") <<
-         "mi"    << tr("Maori") <<
-         "mr"    << tr("Marathi") <<
-         "mh"    << tr("Marshallese") <<
-         "mn"    << tr("Mongolian") <<
-         "na"    << tr("Nauru") <<
-         "nv"    << tr("Navajo") <<
-         "nd"    << tr("Ndebele") + QString(" - ") + tr("North") <<
-         "nr"    << tr("Ndebele") + QString(" - ") + tr("South") <<
-         "ng"    << tr("Ndonga") <<
-         "ne"    << tr("Nepali") <<
-         "se"    << tr("Northern, Sami") <<
-         "no"    << tr("Norwegian") <<
-         "nb"    << tr("Norwegian") + QString(" - ") + tr("Bokmal") <<
-         "nn"    << tr("Norwegian") + QString(" - ") + tr("Nynorsk") <<
-         "ny"    << tr("Nyanja") <<
-         "oc"    << tr("Occitan") <<
-         "oj"    << tr("Ojibwa") <<
-         "or"    << tr("Oriya") <<
-         "om"    << tr("Oromo") <<
-         "os"    << tr("Ossetian") <<
-         "pi"    << tr("Pali") <<
-         "pa"    << tr("Panjabi") <<
-         "fa"    << tr("Persian") <<
-         "pl"    << tr("Polish") <<
-         "pt"    << tr("Portuguese") <<
-         "pt-BR" << tr("Portuguese") + QString(" - ") + tr("Brazil") <<
-         "pt-TT" << tr("Portuguese") + QString(" - ") + tr("Portugal") <<
-         "ps"    << tr("Pushto") <<
-         "qu"    << tr("Quechua") <<
-         "ro"    << tr("Romanian") <<
-         "ro-MO" << tr("Romanian") + QString(" - ") + tr("Moldova") <<
-         "ro-RO" << tr("Romanian") + QString(" - ") + tr("Romania") <<
-         "rm"    << tr("Romansh") <<
-         "rn"    << tr("Rundi") <<
-         "ru"    << tr("Russian") <<
-         "ru-MO" << tr("Russian") + QString(" - ") + tr("Moldova") <<
-         "sm"    << tr("Samoan") <<
-         "sg"    << tr("Sango") <<
-         "sa"    << tr("Sanskrit") <<
-         "sc"    << tr("Sardinian") <<
-         "sr"    << tr("Serbian") <<
-         "sr-RS" << tr("Serbian") + QString(" - ") + tr("Serbia") <<
-         "sn"    << tr("Shona") <<
-         "ii"    << tr("Sichuan Yi") <<
-         "sd"    << tr("Sindhi") <<
-         "si"    << tr("Sinhala") <<
-         "sk"    << tr("Slovak") <<
-         "sl"    << tr("Slovenian") <<
-         "so"    << tr("Somali") <<
-         "st"    << tr("Sotho, Southern") <<
-         "es"    << tr("Spanish") <<
-         "es-AR" << tr("Spanish") + QString(" - ") + tr("Argentina") <<
-         "es-BO" << tr("Spanish") + QString(" - ") + tr("Bolivia") <<
-         "es-CL" << tr("Spanish") + QString(" - ") + tr("Chile") <<
-         "es-CO" << tr("Spanish") + QString(" - ") + tr("Colombia") <<
-         "es-CR" << tr("Spanish") + QString(" - ") + tr("Costa Rica") <<
-         "es-DO" << tr("Spanish") + QString(" - ") + tr("Dominican Republic") <<
-         "es-EC" << tr("Spanish") + QString(" - ") + tr("Ecuador") <<
-         "es-SV" << tr("Spanish") + QString(" - ") + tr("El Salvador") <<
-         "es-GT" << tr("Spanish") + QString(" - ") + tr("Guatemala") <<
-         "es-HN" << tr("Spanish") + QString(" - ") + tr("Honduras") <<
-         "es-MX" << tr("Spanish") + QString(" - ") + tr("Mexico") <<
-         "es-NI" << tr("Spanish") + QString(" - ") + tr("Nicaragua") <<
-         "es-PA" << tr("Spanish") + QString(" - ") + tr("Panama") <<
-         "es-PY" << tr("Spanish") + QString(" - ") + tr("Paraguay") <<
-         "es-PE" << tr("Spanish") + QString(" - ") + tr("Peru") <<
-         "es-PR" << tr("Spanish") + QString(" - ") + tr("Puerto Rico") <<
-         "es-ES" << tr("Spanish") + QString(" - ") + tr("Spain") <<
-         "es-UY" << tr("Spanish") + QString(" - ") + tr("Uruguay") <<
-         "es-VE" << tr("Spanish") + QString(" - ") + tr("Venezuela") <<
-         "su"    << tr("Sundanese") <<
-         "sw"    << tr("Swahili") <<
-         "ss"    << tr("Swati") <<
-         "sv"    << tr("Swedish") <<
-         "sv-FI" << tr("Swedish") + QString(" - ") + tr("Finland") <<
-         "sv-SE" << tr("Swedish") + QString(" - ") + tr("Sweden") <<
-         "tl"    << tr("Tagalog") <<
-         "ty"    << tr("Tahitian") <<
-         "tg"    << tr("Tajik") <<
-         "ta"    << tr("Tamil") <<
-         "tt"    << tr("Tatar") <<
-         "te"    << tr("Telugu") <<
-         "th"    << tr("Thai") <<
-         "bo"    << tr("Tibetan") <<
-         "ti"    << tr("Tigrinya") <<
-         "to"    << tr("Tonga") <<
-         "ts"    << tr("Tsonga") <<
-         "tn"    << tr("Tswana") <<
-         "tr"    << tr("Turkish") <<
-         "tr-TR" << tr("Turkish") + QString(" - ") + tr("Turkey") <<
-         "tk"    << tr("Turkmen") <<
-         "tw"    << tr("Twi") <<
-         "ug"    << tr("Uighur") <<
-         "uk"    << tr("Ukrainian") <<
-         "uk-UA" << tr("Ukrainian") + QString(" - ") + tr("Ukraine") <<
-         "ur"    << tr("Urdu") <<
-         "uz"    << tr("Uzbek") <<
-         "uz-UX" << tr("Uzbek") + QString(" - ") + tr("Uzbekistan") <<
-         "ve"    << tr("Venda") <<
-         "vi"    << tr("Vietnamese") <<
-         "vo"    << tr("Volapuk") <<
-         "wa"    << tr("Walloon") <<
-         "cy"    << tr("Welsh") <<
-         "fy"    << tr("Western Frisian") <<
-         "wo"    << tr("Wolof") <<
-         "xh"    << tr("Xhosa") <<
-         "yi"    << tr("Yiddish") <<
-         "yo"    << tr("Yoruba") <<
-         "za"    << tr("Zhuang") <<
-         "zu"    << tr("Zulu") <<
-         "ace"   << tr("Achinese") <<
-         "ach"   << tr("Acoli") <<
-         "ada"   << tr("Adangme") <<
-         "ady"   << tr("Adygei, Adyghe") <<
-         "afh"   << tr("Afrihili") <<
-         "afa"   << tr("Afro-Asiatic languages") <<
-         "ain"   << tr("Ainu") <<
-         "akk"   << tr("Akkadian") <<
-         "ale"   << tr("Aleut") <<
-         "alg"   << tr("Algonquian languages") <<
-         "tut"   << tr("Altaic languages") <<
-         "anp"   << tr("Angika") <<
-         "apa"   << tr("Apache languages") <<
-         "arp"   << tr("Arapaho") <<
-         "arw"   << tr("Arawak") <<
-         "rup"   << tr("Aromanian, Arumanian, Macedo-Romanian") <<
-         "art"   << tr("Artificial languages") <<
-         "ast"   << tr("Asturian, Asturleonese, Bable, Leonese") <<
-         "ath"   << tr("Athapascan languages") <<
-         "aus"   << tr("Australian languages") <<
-         "map"   << tr("Austronesian languages") <<
-         "awa"   << tr("Awadhi") <<
-         "ban"   << tr("Balinese") <<
-         "bat"   << tr("Baltic languages") <<
-         "bal"   << tr("Baluchi") <<
-         "bai"   << tr("Bamileke languages") <<
-         "bad"   << tr("Banda languages") <<
-         "bnt"   << tr("Bantu languages") <<
-         "bas"   << tr("Basa") <<
-         "btk"   << tr("Batak languages") <<
-         "bej"   << tr("Bedawiyet, Beja") <<
-         "bem"   << tr("Bemba") <<
-         "ber"   << tr("Berber languages") <<
-         "bho"   << tr("Bhojpuri") <<
-         "bik"   << tr("Bikol") <<
-         "byn"   << tr("Bilin, Blin") <<
-         "bin"   << tr("Bini, Edo") <<
-         "zbl"   << tr("Bliss, Blissymbols, Blissymbolics") <<
-         "bra"   << tr("Braj") <<
-         "bug"   << tr("Buginese") <<
-         "bua"   << tr("Buriat") <<
-         "cad"   << tr("Caddo") <<
-         "cau"   << tr("Caucasian languages") <<
-         "ceb"   << tr("Cebuano") <<
-         "cel"   << tr("Celtic languages") <<
-         "cai"   << tr("Central American Indian languages") <<
-         "chg"   << tr("Chagatai") <<
-         "cmc"   << tr("Chamic languages") <<
-         "chr"   << tr("Cherokee") <<
-         "chy"   << tr("Cheyenne") <<
-         "chb"   << tr("Chibcha") <<
-         "chn"   << tr("Chinook jargon") <<
-         "chp"   << tr("Chipewyan, Dene Suline") <<
-         "cho"   << tr("Choctaw") <<
-         "chk"   << tr("Chuukese") <<
-         "nwc"   << tr("Classical Nepal Bhasa/Newari, Old Newari") <<
-         "syc"   << tr("Classical Syriac") <<
-         "cop"   << tr("Coptic") <<
-         "mus"   << tr("Creek") <<
-         "crp"   << tr("Creoles and pidgins") <<
-         "cpe"   << tr("Creoles and pidgins- English based") <<
-         "cpf"   << tr("Creoles and pidgins- French-based") <<
-         "cpp"   << tr("Creoles and pidgins- Portuguese-based") <<
-         "crh"   << tr("Crimean Tatar/Turkish") <<
-         "cus"   << tr("Cushitic languages") <<
-         "dak"   << tr("Dakota") <<
-         "dar"   << tr("Dargwa") <<
-         "del"   << tr("Delaware") <<
-         "zza"   << tr("Dimili, Dimli, Zaza, Zazaki, Kirdki, Kirmanjki") <<
-         "din"   << tr("Dinka") <<
-         "doi"   << tr("Dogri") <<
-         "dgr"   << tr("Dogrib") <<
-         "dra"   << tr("Dravidian languages") <<
-         "dua"   << tr("Duala") <<
-         "dum"   << tr("Dutch- Middle (ca.1050-1350)") <<
-         "dyu"   << tr("Dyula") <<
-         "frs"   << tr("Eastern Frisian") <<
-         "efi"   << tr("Efik") <<
-         "egy"   << tr("Egyptian (Ancient)") <<
-         "eka"   << tr("Ekajuk") <<
-         "elx"   << tr("Elamite") <<
-         "enm"   << tr("English- Middle (1100-1500)") <<
-         "ang"   << tr("English- Old (ca.450-1100)") <<
-         "myv"   << tr("Erzya") <<
-         "ewo"   << tr("Ewondo") <<
-         "fan"   << tr("Fang") <<
-         "fat"   << tr("Fanti") <<
-         "fil"   << tr("Filipino, Pilipino") <<
-         "fiu"   << tr("Finno-Ugrian languages") <<
-         "fon"   << tr("Fon") <<
-         "frm"   << tr("French- Middle (ca.1400-1600)") <<
-         "fro"   << tr("French- Old (842-ca.1400)") <<
-         "fur"   << tr("Friulian") <<
-         "gaa"   << tr("Ga") <<
-         "car"   << tr("Galibi Carib") <<
-         "gay"   << tr("Gayo") <<
-         "gba"   << tr("Gbaya") <<
-         "gez"   << tr("Geez") <<
-         "gmh"   << tr("German- Middle High (ca.1050-1500)") <<
-         "goh"   << tr("German- Old High (ca.750-1050)") <<
-         "gem"   << tr("Germanic languages") <<
-         "gil"   << tr("Gilbertese") <<
-         "gon"   << tr("Gondi") <<
-         "gor"   << tr("Gorontalo") <<
-         "got"   << tr("Gothic") <<
-         "grb"   << tr("Grebo") <<
-         "grc"   << tr("Greek- Ancient (to 1453)") <<
-         "gwi"   << tr("Gwich'in") <<
-         "hai"   << tr("Haida") <<
-         "haw"   << tr("Hawaiian") <<
-         "hil"   << tr("Hiligaynon") <<
-         "him"   << tr("Himachali, Western Pahari languages") <<
-         "hit"   << tr("Hittite") <<
-         "hmn"   << tr("Hmong, Mong") <<
-         "hup"   << tr("Hupa") <<
-         "iba"   << tr("Iban") <<
-         "ijo"   << tr("Ijo languages") <<
-         "ilo"   << tr("Iloko") <<
-         "smn"   << tr("Inari Sami") <<
-         "inc"   << tr("Indic languages") <<
-         "ine"   << tr("Indo-European languages") <<
-         "inh"   << tr("Ingush") <<
-         "ira"   << tr("Iranian languages") <<
-         "mga"   << tr("Irish- Middle (900-1200)") <<
-         "sga"   << tr("Irish- Old (to 900)") <<
-         "iro"   << tr("Iroquoian languages") <<
-         "kac"   << tr("Jingpho, Kachin") <<
-         "jrb"   << tr("Judeo-Arabic") <<
-         "jpr"   << tr("Judeo-Persian") <<
-         "kbd"   << tr("Kabardian") <<
-         "kab"   << tr("Kabyle") <<
-         "xal"   << tr("Kalmyk, Oirat") <<
-         "kam"   << tr("Kamba") <<
-         "pam"   << tr("Kapampangan, Pampanga") <<
-         "kaa"   << tr("Kara-Kalpak") <<
-         "krc"   << tr("Karachay-Balkar") <<
-         "krl"   << tr("Karelian") <<
-         "kar"   << tr("Karen languages") <<
-         "csb"   << tr("Kashubian") <<
-         "kaw"   << tr("Kawi") <<
-         "kha"   << tr("Khasi") <<
-         "khi"   << tr("Khoisan languages") <<
-         "kho"   << tr("Khotanese, Sakan") <<
-         "kmb"   << tr("Kimbundu") <<
-         "tlh"   << tr("Klingon, tlhIngan-Hol") <<
-         "kok"   << tr("Konkani") <<
-         "kos"   << tr("Kosraean") <<
-         "kpe"   << tr("Kpelle") <<
-         "kro"   << tr("Kru languages") <<
-         "kum"   << tr("Kumyk") <<
-         "kru"   << tr("Kurukh") <<
-         "kut"   << tr("Kutenai") <<
-         "lad"   << tr("Ladino") <<
-         "lah"   << tr("Lahnda") <<
-         "lam"   << tr("Lamba") <<
-         "day"   << tr("Land Dayak languages") <<
-         "lez"   << tr("Lezghian") <<
-         "jbo"   << tr("Lojban") <<
-         "nds"   << tr("German-Low, Low Saxon") <<
-         "dsb"   << tr("Lower Sorbian") <<
-         "loz"   << tr("Lozi") <<
-         "lua"   << tr("Luba-Lulua") <<
-         "lui"   << tr("Luiseno") <<
-         "smj"   << tr("Lule Sami") <<
-         "lun"   << tr("Lunda") <<
-         "luo"   << tr("Luo (Kenya and Tanzania)") <<
-         "lus"   << tr("Lushai") <<
-         "mad"   << tr("Madurese") <<
-         "mag"   << tr("Magahi") <<
-         "mai"   << tr("Maithili") <<
-         "mak"   << tr("Makasar") <<
-         "mnc"   << tr("Manchu") <<
-         "mdr"   << tr("Mandar") <<
-         "man"   << tr("Mandingo") <<
-         "mni"   << tr("Manipuri") <<
-         "mno"   << tr("Manobo languages") <<
-         "arn"   << tr("Mapuche/Mapudungun") <<
-         "chm"   << tr("Mari") <<
-         "mwr"   << tr("Marwari") <<
-         "mas"   << tr("Masai") <<
-         "myn"   << tr("Mayan languages") <<
-         "men"   << tr("Mende") <<
-         "mic"   << tr("Mi'kmaq, Micmac") <<
-         "min"   << tr("Minangkabau") <<
-         "mwl"   << tr("Mirandese") <<
-         "moh"   << tr("Mohawk") <<
-         "mdf"   << tr("Moksha") <<
-         "mkh"   << tr("Mon-Khmer languages") <<
-         "lol"   << tr("Mongo") <<
-         "mos"   << tr("Mossi") <<
-         "mul"   << tr("Multiple languages") <<
-         "mun"   << tr("Munda languages") <<
-         "nqo"   << tr("N'Ko") <<
-         "nah"   << tr("Nahuatl languages") <<
-         "nap"   << tr("Neapolitan") <<
-         "new"   << tr("Nepal Bhasa/Newari") <<
-         "nia"   << tr("Nias") <<
-         "nic"   << tr("Niger-Kordofanian languages") <<
-         "ssa"   << tr("Nilo-Saharan languages") <<
-         "niu"   << tr("Niuean") <<
-         "zxx"   << tr("No linguistic content/Not applicable") <<
-         "nog"   << tr("Nogai") <<
-         "non"   << tr("Norse- Old") <<
-         "nai"   << tr("North American Indian languages") <<
-         "frr"   << tr("Northern Frisian") <<
-         "nso"   << tr("Northern Sotho, Sepedi, Pedi") <<
-         "nub"   << tr("Nubian languages") <<
-         "nym"   << tr("Nyamwezi") <<
-         "nyn"   << tr("Nyankole") <<
-         "nyo"   << tr("Nyoro") <<
-         "nzi"   << tr("Nzima") <<
-         "pro"   << tr("Occitan/Provencal- Old (to 1500)") <<
-         "arc"   << tr("Official/Imperial Aramaic (700-300 BCE)") <<
-         "osa"   << tr("Osage") <<
-         "oto"   << tr("Otomian languages") <<
-         "pal"   << tr("Pahlavi") <<
-         "pau"   << tr("Palauan") <<
-         "pag"   << tr("Pangasinan") <<
-         "pap"   << tr("Papiamento") <<
-         "paa"   << tr("Papuan languages") <<
-         "gug"   << tr("Paraguayan Guaraní") <<
-         "peo"   << tr("Persian- Old (ca.600-400 B.C.)") <<
-         "phi"   << tr("Philippine languages") <<
-         "phn"   << tr("Phoenician") <<
-         "pon"   << tr("Pohnpeian") <<
-         "pra"   << tr("Prakrit languages") <<
-         "raj"   << tr("Rajasthani") <<
-         "rap"   << tr("Rapanui") <<
-         "rar"   << tr("Rarotongan, Cook Islands Maori") <<
-         "qaa-qtz"   << tr("Reserved for local use") <<
-         "roa"   << tr("Romance languages") <<
-         "rom"   << tr("Romany") <<
-         "sal"   << tr("Salishan languages") <<
-         "sam"   << tr("Samaritan Aramaic") <<
-         "smi"   << tr("Sami languages") <<
-         "sad"   << tr("Sandawe") <<
-         "sat"   << tr("Santali") <<
-         "sas"   << tr("Sasak") <<
-         "sco"   << tr("Scots") <<
-         "sel"   << tr("Selkup") <<
-         "sem"   << tr("Semitic languages") <<
-         "srr"   << tr("Serer") <<
-         "shn"   << tr("Shan") <<
-         "scn"   << tr("Sicilian") <<
-         "sid"   << tr("Sidamo") <<
-         "sgn"   << tr("Sign Languages") <<
-         "bla"   << tr("Siksika") <<
-         "sit"   << tr("Sino-Tibetan languages") <<
-         "sio"   << tr("Siouan languages") <<
-         "sms"   << tr("Skolt Sami") <<
-         "den"   << tr("Slave (Athapascan)") <<
-         "sla"   << tr("Slavic languages") <<
-         "sog"   << tr("Sogdian") <<
-         "son"   << tr("Songhai languages") <<
-         "snk"   << tr("Soninke") <<
-         "wen"   << tr("Sorbian languages") <<
-         "sai"   << tr("South American Indian languages") <<
-         "alt"   << tr("Southern Altai") <<
-         "sma"   << tr("Southern Sami") <<
-         "srn"   << tr("Sranan Tongo") <<
-         "suk"   << tr("Sukuma") <<
-         "sux"   << tr("Sumerian") <<
-         "sus"   << tr("Susu") <<
-         "gsw"   << tr("Alsatian, Swiss German, Alemannic") <<
-         "syr"   << tr("Syriac") <<
-         "tai"   << tr("Tai languages") <<
-         "tmh"   << tr("Tamashek") <<
-         "ter"   << tr("Tereno") <<
-         "tet"   << tr("Tetum") <<
-         "tig"   << tr("Tigre") <<
-         "tem"   << tr("Timne") <<
-         "tiv"   << tr("Tiv") <<
-         "tli"   << tr("Tlingit") <<
-         "tpi"   << tr("Tok Pisin") <<
-         "tkl"   << tr("Tokelau") <<
-         "tog"   << tr("Tonga (Nyasa)") <<
-         "tsi"   << tr("Tsimshian") <<
-         "tum"   << tr("Tumbuka") <<
-         "tup"   << tr("Tupi languages") <<
-         "ota"   << tr("Turkish- Ottoman (1500-1928)") <<
-         "tvl"   << tr("Tuvalu") <<
-         "tyv"   << tr("Tuvinian") <<
-         "udm"   << tr("Udmurt") <<
-         "uga"   << tr("Ugaritic") <<
-         "umb"   << tr("Umbundu") <<
-         "mis"   << tr("Uncoded languages") <<
-         "und"   << tr("Undetermined") <<
-         "hsb"   << tr("Upper Sorbian") <<
-         "vai"   << tr("Vai") <<
-         "vot"   << tr("Votic") <<
-         "wak"   << tr("Wakashan languages") <<
-         "war"   << tr("Waray") <<
-         "was"   << tr("Washo") <<
-         "wal"   << tr("Wolaitta, Wolaytta") <<
-         "sah"   << tr("Yakut") <<
-         "yao"   << tr("Yao") <<
-         "yap"   << tr("Yapese") <<
-         "ypk"   << tr("Yupik languages") <<
-         "znd"   << tr("Zande languages") <<
-         "zap"   << tr("Zapotec") <<
-         "zen"   << tr("Zenaga") <<
-         "zun"   << tr("Zuni");
-
-    for (int i = 0; i < data.count(); i++) {
-        QString code = data.at(i++);
-        QString name = data.at(i);
-        m_languageCodeMap.insert(code, name);
-        m_languageNameMap.insert(name, code);
-        DescriptiveInfo minfo;
-        minfo.name = name;
-        minfo.description = QString();
-        m_LangInfo.insert(code, minfo);
-    }
 }
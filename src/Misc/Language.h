@@ -50,10 +50,9 @@ public:
 private:
     Language();
 
-    void SetLanguageMap();
-
-    // Use hash since order is not important (sort later)
-    QHash<QString, QString> m_languageCodeMap;
+    // The code to name direction is served by a binary search over the
+    // compile-time table; these reverse/aggregate views are localized
+    // and built lazily on first use.
     QHash<QString, QString> m_languageNameMap;
     QHash<QString, DescriptiveInfo> m_LangInfo;
 
@@ -0,0 +1,100 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include "Misc/LargeBookPolicy.h"
+#include "Misc/SettingsStore.h"
+
+// A book is "large" once either threshold trips; the numbers are sized
+// so that ordinary novels never qualify but omnibus titles always do.
+static const int    LARGE_BOOK_FILE_COUNT = 500;
+static const qint64 LARGE_BOOK_TEXT_BYTES = 20 * 1024 * 1024;
+
+// Preview re-render delay after a change, normal and degraded.
+static const int PREVIEW_REFRESH_NORMAL_MS = 1000;
+static const int PREVIEW_REFRESH_SLOW_MS   = 3000;
+
+LargeBookPolicy *LargeBookPolicy::m_instance = 0;
+
+LargeBookPolicy *LargeBookPolicy::instance()
+{
+    if (m_instance == 0) {
+        m_instance = new LargeBookPolicy();
+    }
+
+    return m_instance;
+}
+
+
+LargeBookPolicy::LargeBookPolicy()
+    : m_IsLargeBook(false)
+{
+    SettingsStore ss;
+    m_Knobs = ss.largeBookOn();
+}
+
+
+void LargeBookPolicy::Evaluate(int file_count, qint64 total_text_bytes)
+{
+    SettingsStore ss;
+    m_Knobs = ss.largeBookOn();
+    m_IsLargeBook = (file_count >= LARGE_BOOK_FILE_COUNT) ||
+                    (total_text_bytes >= LARGE_BOOK_TEXT_BYTES);
+}
+
+
+void LargeBookPolicy::Reset()
+{
+    m_IsLargeBook = false;
+}
+
+
+void LargeBookPolicy::SetKnobs(int knobs)
+{
+    m_Knobs = knobs;
+}
+
+
+bool LargeBookPolicy::IsLargeBook() const
+{
+    return m_IsLargeBook;
+}
+
+
+bool LargeBookPolicy::SkipWellFormedCheckOnOpen() const
+{
+    return m_IsLargeBook && (m_Knobs & LARGEBOOK_SKIP_WF_CHECK);
+}
+
+
+int LargeBookPolicy::PreviewRefreshInterval() const
+{
+    if (m_IsLargeBook && (m_Knobs & LARGEBOOK_SLOW_PREVIEW)) {
+        return PREVIEW_REFRESH_SLOW_MS;
+    }
+
+    return PREVIEW_REFRESH_NORMAL_MS;
+}
+
+
+bool LargeBookPolicy::SuppressTagHighlighting() const
+{
+    return m_IsLargeBook && (m_Knobs & LARGEBOOK_NO_TAG_HIGHLIGHT);
+}
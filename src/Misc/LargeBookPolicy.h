@@ -0,0 +1,94 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef LARGEBOOKPOLICY_H
+#define LARGEBOOKPOLICY_H
+
+#include <QtGlobal>
+
+/**
+ * Decides, once per opened book, whether the expensive comfort features
+ * should be dialed back because the book is too big for them.
+ *
+ * Importers call Evaluate() with the book's file count and total text
+ * bytes; everything else just asks the accessors.  Each knob can be
+ * vetoed from Preferences (General Settings), stored as a bitmask in
+ * SettingsStore::largeBookOn() - a cleared bit means "keep the feature
+ * on even for omnibus books".  On normal sized books every accessor
+ * answers as if the policy did not exist.
+ */
+class LargeBookPolicy
+{
+public:
+
+    static LargeBookPolicy *instance();
+
+    /**
+     * Classifies the book about to be shown and caches the knob bitmask
+     * so the per-keystroke accessors never touch QSettings.
+     */
+    void Evaluate(int file_count, qint64 total_text_bytes);
+
+    /**
+     * Back to normal-book behavior; used when a book is created rather
+     * than imported.
+     */
+    void Reset();
+
+    /**
+     * Keeps the cached knob bitmask current when Preferences change it.
+     */
+    void SetKnobs(int knobs);
+
+    bool IsLargeBook() const;
+
+    /**
+     * Skip the import-time well formed check of every HTML file; tabs
+     * still check their own file when it is edited.
+     */
+    bool SkipWellFormedCheckOnOpen() const;
+
+    /**
+     * How long the Preview window should wait after a change before
+     * re-rendering, in milliseconds.
+     */
+    int PreviewRefreshInterval() const;
+
+    /**
+     * Skip the matching open/close tag highlighting done on every
+     * cursor move in Code View.
+     */
+    bool SuppressTagHighlighting() const;
+
+private:
+
+    LargeBookPolicy();
+
+    bool m_IsLargeBook;
+
+    // cached copy of SettingsStore::largeBookOn()
+    int m_Knobs;
+
+    static LargeBookPolicy *m_instance;
+};
+
+#endif // LARGEBOOKPOLICY_H
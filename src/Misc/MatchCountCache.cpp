@@ -0,0 +1,94 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include <QMutexLocker>
+
+#include "Misc/MatchCountCache.h"
+#include "ResourceObjects/Resource.h"
+
+MatchCountCache *MatchCountCache::m_instance = 0;
+
+MatchCountCache *MatchCountCache::instance()
+{
+    // may be first reached from a pool thread, so guard creation;
+    // thread affinity does not matter because every connection made
+    // to this object is direct
+    static QMutex instance_mutex;
+    QMutexLocker locker(&instance_mutex);
+    if (m_instance == 0) {
+        m_instance = new MatchCountCache();
+    }
+
+    return m_instance;
+}
+
+MatchCountCache::MatchCountCache()
+    : QObject(NULL)
+{
+}
+
+bool MatchCountCache::lookup(Resource *resource, const QString &key, int &count)
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_counts.contains(resource)) {
+        return false;
+    }
+    const QHash<QString, int> &entries = m_counts[resource];
+    if (!entries.contains(key)) {
+        return false;
+    }
+    count = entries.value(key);
+    return true;
+}
+
+void MatchCountCache::store(Resource *resource, const QString &key, int count)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_counts[resource][key] = count;
+    }
+    // Direct connections so invalidation runs immediately on the
+    // emitting (GUI) thread - this object lives behind a mutex, not
+    // an event loop, and counts may be stored from pool threads.
+    connect(resource, SIGNAL(Modified()), this, SLOT(ResourceModified()),
+            static_cast<Qt::ConnectionType>(Qt::DirectConnection | Qt::UniqueConnection));
+    connect(resource, SIGNAL(Deleted(const Resource *)), this, SLOT(ResourceDeleted(const Resource *)),
+            static_cast<Qt::ConnectionType>(Qt::DirectConnection | Qt::UniqueConnection));
+}
+
+void MatchCountCache::ResourceModified()
+{
+    forget(qobject_cast<Resource *>(sender()));
+}
+
+void MatchCountCache::ResourceDeleted(const Resource *resource)
+{
+    forget(resource);
+}
+
+void MatchCountCache::forget(const Resource *resource)
+{
+    if (!resource) {
+        return;
+    }
+    QMutexLocker locker(&m_mutex);
+    m_counts.remove(resource);
+}
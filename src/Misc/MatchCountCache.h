@@ -0,0 +1,82 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef MATCHCOUNTCACHE_H
+#define MATCHCOUNTCACHE_H
+
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+class Resource;
+
+/**
+ * Singleton. Remembers per-resource match counts so repeated counts
+ * during an interactive search session only pay for the resources the
+ * user has actually edited since the last count.
+ *
+ * Entries are keyed by (resource, search key) and a resource's entries
+ * are dropped the moment it reports itself modified or deleted, so a
+ * cached value is only ever served for unchanged text.  All methods
+ * are safe to call from worker threads.
+ */
+class MatchCountCache : public QObject
+{
+    Q_OBJECT
+
+public:
+    static MatchCountCache *instance();
+
+    /**
+     * Retrieve a cached count for the resource and search key.
+     *
+     * @param resource The resource the count applies to.
+     * @param key The search key (pattern plus any option markers).
+     * @param[out] count The cached count if present.
+     *
+     * @return True if a still-valid count was found.
+     */
+    bool lookup(Resource *resource, const QString &key, int &count);
+
+    /**
+     * Record a freshly computed count and start watching the resource
+     * for modifications so the entry can be invalidated.
+     */
+    void store(Resource *resource, const QString &key, int count);
+
+private slots:
+    void ResourceModified();
+    void ResourceDeleted(const Resource *resource);
+
+private:
+    MatchCountCache();
+
+    void forget(const Resource *resource);
+
+    QMutex m_mutex;
+    QHash<const Resource *, QHash<QString, int> > m_counts;
+
+    static MatchCountCache *m_instance;
+};
+
+#endif // MATCHCOUNTCACHE_H
@@ -20,18 +20,63 @@
 **
 *************************************************************************/
 
+#include <QDataStream>
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
 #include <QStringList>
 #include <QXmlStreamReader>
 
+#include "Misc/DiskCache.h"
 #include "Misc/Plugin.h"
 #include "Misc/PluginDB.h"
 #include "Misc/SettingsStore.h"
 #include "Misc/Utility.h"
 #include "sigil_constants.h"
 
+// The disk cache category and key the plugin registry persists under;
+// there is only one plugins folder, so the key is fixed.
+static const QString PLUGIN_REGISTRY_CATEGORY = "plugins";
+static const QString PLUGIN_REGISTRY_KEY = "registry";
+
+// The registry entry key the validation stamp is stored under; it is
+// not a plugin.xml field so it can not collide with plugin metadata.
+static const QString REGISTRY_STAMP_KEY = "registry_stamp";
+
+// Identifies the current plugin.xml of the named plugin by size and
+// modification time; an edited or reinstalled plugin gets a new stamp.
+static QString PluginXmlStamp(const QString &name)
+{
+    QFileInfo fi(PluginDB::pluginsPath() + "/" + name + "/plugin.xml");
+
+    if (!fi.exists()) {
+        return QString();
+    }
+
+    return QString::number(fi.size()) + "|" + QString::number(fi.lastModified().toMSecsSinceEpoch());
+}
+
+// First look for a persistent custom user-specified
+// icon in the plugin's preference folder. And then
+// next look in the plugin folder itself for a dev
+// supplied icon. Prefer svg versions to png versions
+static QString ResolveIconPath(const QString &name)
+{
+    QStringList iconpaths;
+    iconpaths << PluginDB::pluginsPath() + "/../plugins_prefs/" + name + "/plugin.svg";
+    iconpaths << PluginDB::pluginsPath() + "/../plugins_prefs/" + name + "/plugin.png";
+    iconpaths << PluginDB::pluginsPath() + "/" + name + "/plugin.svg";
+    iconpaths << PluginDB::pluginsPath() + "/" + name + "/plugin.png";
+    foreach(QString ipath, iconpaths) {
+        QFileInfo iconinfo(ipath);
+        if (iconinfo.exists() && iconinfo.isFile() && iconinfo.isReadable()) {
+            return iconinfo.absoluteFilePath();
+        }
+    }
+    return QString();
+}
+
 PluginDB *PluginDB::m_instance = 0;
 
 PluginDB *PluginDB::instance()
@@ -139,13 +184,99 @@ void PluginDB::load_plugins_from_disk(bool force)
 
     dplugins = d.entryList(QStringList("*"), QDir::Dirs|QDir::NoDotAndDotDot);
 
+    // In the common nothing-changed case the cached registry replays
+    // every plugin's metadata from one cache entry, validated with a
+    // single stat per plugin.xml, instead of reparsing them all.
+    if (!force && load_plugins_from_registry(dplugins)) {
+        emit plugins_changed();
+        return;
+    }
+
     Q_FOREACH(QString p, dplugins) {
         add_plugin_int(p, force);
     }
 
+    store_plugin_registry();
     emit plugins_changed();
 }
 
+bool PluginDB::load_plugins_from_registry(const QStringList &names)
+{
+    QByteArray blob = DiskCache::instance()->Load(PLUGIN_REGISTRY_CATEGORY, PLUGIN_REGISTRY_KEY);
+
+    if (blob.isEmpty()) {
+        return false;
+    }
+
+    QHash<QString, QHash<QString, QString>> registry;
+    QDataStream in(blob);
+    in >> registry;
+
+    if (in.status() != QDataStream::Ok) {
+        return false;
+    }
+
+    // The registry only replays when the plugins folder holds exactly
+    // the plugins it recorded, each with an unchanged plugin.xml;
+    // anything else falls back to the full scan, which rewrites the
+    // registry.
+    if (registry.count() != names.count()) {
+        return false;
+    }
+
+    QList<Plugin *> loaded;
+
+    Q_FOREACH(QString name, names) {
+        QHash<QString, QString> info = registry.value(name);
+
+        if (info.take(REGISTRY_STAMP_KEY) != PluginXmlStamp(name)) {
+            break;
+        }
+
+        // Icons can be dropped into plugins_prefs by hand without
+        // touching plugin.xml, so they are re-resolved every launch
+        info.insert("iconpath", ResolveIconPath(name));
+
+        Plugin *plugin = new Plugin(info);
+
+        if (!plugin->isvalid()) {
+            delete plugin;
+            break;
+        }
+
+        loaded.append(plugin);
+    }
+
+    if (loaded.count() != names.count()) {
+        foreach(Plugin *p, loaded) {
+            delete p;
+        }
+        return false;
+    }
+
+    foreach(Plugin *p, loaded) {
+        m_plugins.insert(p->get_name(), p);
+    }
+
+    return true;
+}
+
+void PluginDB::store_plugin_registry()
+{
+    QHash<QString, QHash<QString, QString>> registry;
+
+    foreach(Plugin *p, m_plugins) {
+        QHash<QString, QString> info = p->serialize();
+        info.insert(REGISTRY_STAMP_KEY, PluginXmlStamp(p->get_name()));
+        registry.insert(p->get_name(), info);
+    }
+
+    QByteArray blob;
+    QDataStream out(&blob, QIODevice::WriteOnly);
+    out << registry;
+    DiskCache::instance()->Store(PLUGIN_REGISTRY_CATEGORY, PLUGIN_REGISTRY_KEY, blob);
+}
+
 PluginDB::AddResult PluginDB::add_plugin(const QString &path, bool force)
 {
     PluginDB::AddResult ret;
@@ -171,6 +302,7 @@ PluginDB::AddResult PluginDB::add_plugin(const QString &path, bool force)
         // Couldn't load the plugin so remove it.
         Utility::removeDir(pluginsPath() + "/" + name);
     } else {
+        store_plugin_registry();
         emit plugins_changed();
     }
 
@@ -227,6 +359,7 @@ void PluginDB::remove_plugin(const QString &name)
         delete p;
     }
     Utility::removeDir(pluginsPath() + "/" + name);
+    store_plugin_registry();
     emit plugins_changed();
 }
 
@@ -239,6 +372,7 @@ void PluginDB::remove_all_plugins()
         Utility::removeDir(pluginsPath() + "/" + k);
     }
     m_plugins.clear();
+    store_plugin_registry();
     emit plugins_changed();
 }
 
@@ -311,22 +445,7 @@ Plugin *PluginDB::load_plugin(const QString &name)
         }
     }
 
-    // First look for a persistent custom user-specified
-    // icon in the plugin's preference folder. And then
-    // next look in the plugin folder itself for a dev
-    // supplied icon. Prefer svg versions to png versions
-    QStringList iconpaths;
-    iconpaths << pluginsPath() + "/../plugins_prefs/" + name + "/plugin.svg";
-    iconpaths << pluginsPath() + "/../plugins_prefs/" + name + "/plugin.png";
-    iconpaths << pluginsPath() + "/" + name + "/plugin.svg";
-    iconpaths << pluginsPath() + "/" + name + "/plugin.png";
-    foreach(QString ipath, iconpaths) {
-        QFileInfo iconinfo(ipath);
-        if (iconinfo.exists() && iconinfo.isFile() && iconinfo.isReadable()) {
-            plugin->set_iconpath(iconinfo.absoluteFilePath());
-            break;
-        }
-    }
+    plugin->set_iconpath(ResolveIconPath(name));
 
     if (!plugin->isvalid()) {
         delete plugin;
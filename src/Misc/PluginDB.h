@@ -73,6 +73,20 @@ private:
     Plugin *load_plugin(const QString &name);
     bool verify_plugin_zip(const QString &path, const QString &name);
 
+    /**
+     * Replays plugin metadata from the persisted registry when the
+     * plugins folder holds exactly the recorded plugins with unchanged
+     * plugin.xml files.  Returns false when anything differs, leaving
+     * the caller to do a full scan.
+     */
+    bool load_plugins_from_registry(const QStringList &names);
+
+    /**
+     * Persists the current plugin metadata with per-plugin validation
+     * stamps so the next launch can skip parsing the plugin.xml files.
+     */
+    void store_plugin_registry();
+
     QHash<QString, Plugin *> m_plugins;
     QHash<QString, QString> m_engine_paths;
 
@@ -22,12 +22,17 @@
 
 #include <signal.h>
 
+#include <functional>
+
 #include <QtCore/QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QProgressDialog>
 
 #include "BookManipulation/CleanSource.h"
+#include "Misc/MatchCountCache.h"
 #include "Misc/SearchOperations.h"
+#include "Misc/TrigramIndex.h"
 #include "Misc/SettingsStore.h"
 #include "Misc/Utility.h"
 #include "PCRE/PCRECache.h"
@@ -37,41 +42,247 @@
 #include "ViewEditors/Searchable.h"
 #include "sigil_constants.h"
 
+QAtomicInt SearchOperations::m_CancelRequested;
+
+bool SearchOperations::CancelRequested()
+{
+    return m_CancelRequested.loadAcquire() != 0;
+}
+
+
+void SearchOperations::RequestCancel()
+{
+    m_CancelRequested.storeRelease(1);
+}
+
+
+// Run a per-resource map in the global thread pool while keeping the
+// progress dialog live and honouring its cancel button.  Results from
+// resources finished before a cancel are still summed.
+int SearchOperations::RunMappedOperation(QFuture<int> future, QProgressDialog &progress)
+{
+    m_CancelRequested.storeRelease(0);
+    while (!future.isFinished()) {
+        progress.setValue(future.progressValue());
+        qApp->processEvents();
+        if (progress.wasCanceled()) {
+            // stops scheduling new resources, and the cancel flag makes
+            // the in-flight workers bail out between matches
+            m_CancelRequested.storeRelease(1);
+            future.cancel();
+        }
+        QThread::msleep(10);
+    }
+    int count = 0;
+    for (int i = 0; i < future.resultCount(); i++) {
+        count += future.resultAt(i);
+    }
+    return count;
+}
+
+
 int SearchOperations::CountInFiles(const QString &search_regex,
                                    QList<Resource *> resources,
                                    bool check_spelling)
 {
-    QProgressDialog progress(QObject::tr("Counting occurrences.."), 0, 0, resources.count(), Utility::GetMainWindow());
+    QProgressDialog progress(QObject::tr("Counting occurrences.."), QObject::tr("Cancel"), 0, resources.count(), Utility::GetMainWindow());
+    progress.setMinimumDuration(PROGRESS_BAR_MINIMUM_DURATION);
+    progress.setValue(0);
+
+    if (check_spelling) {
+        // the spellcheck engine is a single-threaded singleton so
+        // spelling counts stay sequential
+        int count = 0;
+        int progress_value = 0;
+        foreach(Resource * resource, resources) {
+            progress.setValue(progress_value++);
+            qApp->processEvents();
+            if (progress.wasCanceled()) {
+                break;
+            }
+            count += CountInFile(search_regex, resource, check_spelling);
+        }
+        return count;
+    }
+
+    return RunMappedOperation(QtConcurrent::mapped(resources,
+                              std::bind(CountInFile, search_regex, std::placeholders::_1, check_spelling)),
+                              progress);
+}
+
+
+int SearchOperations::CountInFiles(const QStringList &search_regexes,
+                                   QList<Resource *> resources)
+{
+    QProgressDialog progress(QObject::tr("Counting occurrences.."), QObject::tr("Cancel"), 0, resources.count(), Utility::GetMainWindow());
     progress.setMinimumDuration(PROGRESS_BAR_MINIMUM_DURATION);
-    int progress_value = 0;
-    progress.setValue(progress_value);
-    // Count sequentially in order to see if occassional crashes are due to threading
+    progress.setValue(0);
+    return RunMappedOperation(QtConcurrent::mapped(resources,
+                              std::bind(CountInFileMulti, search_regexes, std::placeholders::_1)),
+                              progress);
+}
+
+
+int SearchOperations::CountInFileMulti(const QStringList &search_regexes,
+                                       Resource *resource)
+{
     int count = 0;
-    foreach(Resource * resource, resources) {
-        progress.setValue(progress_value++);
-        qApp->processEvents();
-        count += CountInFile(search_regex, resource, check_spelling);
+    // serve what we can from the per-resource count cache first
+    QStringList todo;
+    foreach(const QString &search_regex, search_regexes) {
+        int cached = 0;
+        if (MatchCountCache::instance()->lookup(resource, search_regex, cached)) {
+            count += cached;
+        } else {
+            todo.append(search_regex);
+        }
+    }
+    if (todo.isEmpty()) {
+        return count;
+    }
+
+    // rule out patterns whose required literal the trigram signature
+    // says is absent before fetching the text at all
+    QStringList remaining;
+    foreach(const QString &search_regex, todo) {
+        QString literal = PCRECache::instance()->getObject(search_regex)->requiredLiteral();
+        if (!literal.isEmpty() && !TrigramIndex::instance()->MightContain(resource, literal)) {
+            MatchCountCache::instance()->store(resource, search_regex, 0);
+        } else {
+            remaining.append(search_regex);
+        }
+    }
+    if (remaining.isEmpty()) {
+        return count;
+    }
+
+    QReadLocker locker(&resource->GetLock());
+    HTMLResource *html_resource = qobject_cast<HTMLResource *>(resource);
+    TextResource *text_resource = qobject_cast<TextResource *>(resource);
+    QString text;
+
+    if (html_resource) {
+        text = html_resource->GetText();
+    } else if (text_resource) {
+        text = text_resource->GetText();
+    } else {
+        return count;
+    }
+
+    // one text fetch, every remaining pattern dispatched against it
+    foreach(const QString &search_regex, remaining) {
+        if (CancelRequested()) {
+            break;
+        }
+        int c = PCRECache::instance()->getObject(search_regex)->forEachMatchInfo(text,
+                [](const SPCRE::MatchInfo &) { return !CancelRequested(); });
+        if (CancelRequested()) {
+            break;
+        }
+        MatchCountCache::instance()->store(resource, search_regex, c);
+        count += c;
     }
     return count;
 }
 
 
+QFuture<QList<SearchOperations::SearchMatch>> SearchOperations::ListMatchesInFiles(const QString &search_regex,
+        QList<Resource *> resources)
+{
+    m_CancelRequested.storeRelease(0);
+    return QtConcurrent::mapped(resources,
+                                std::bind(ListMatchesInFile, search_regex, std::placeholders::_1));
+}
+
+
+QList<SearchOperations::SearchMatch> SearchOperations::ListMatchesInFile(const QString &search_regex,
+        Resource *resource)
+{
+    // longest snippet shown per match before elision
+    const int SNIPPET_MAX_CHARS = 120;
+
+    QList<SearchMatch> matches;
+
+    // skip the lock and the text fetch entirely for files the trigram
+    // signature proves cannot match
+    QString literal = PCRECache::instance()->getObject(search_regex)->requiredLiteral();
+    if (!literal.isEmpty() && !TrigramIndex::instance()->MightContain(resource, literal)) {
+        return matches;
+    }
+
+    QReadLocker locker(&resource->GetLock());
+    HTMLResource *html_resource = qobject_cast<HTMLResource *>(resource);
+    TextResource *text_resource = qobject_cast<TextResource *>(resource);
+    QString text;
+
+    if (html_resource) {
+        text = html_resource->GetText();
+    } else if (text_resource) {
+        text = text_resource->GetText();
+    } else {
+        return matches;
+    }
+
+    const QString bookpath = resource->GetRelativePath();
+    // line numbers advance incrementally between matches so a file full
+    // of matches does not rescan its whole text per match
+    int line = 1;
+    int scanned_upto = 0;
+
+    PCRECache::instance()->getObject(search_regex)->forEachMatchInfo(text, [&](const SPCRE::MatchInfo & mi) {
+        line += text.midRef(scanned_upto, mi.offset.first - scanned_upto).count(QChar('\n'));
+        scanned_upto = mi.offset.first;
+
+        int line_start = mi.offset.first > 0 ? text.lastIndexOf(QChar('\n'), mi.offset.first - 1) + 1 : 0;
+        int line_end = text.indexOf(QChar('\n'), mi.offset.first);
+        if (line_end < 0) {
+            line_end = text.length();
+        }
+
+        QString snippet;
+        if (line_end - line_start <= SNIPPET_MAX_CHARS) {
+            snippet = text.mid(line_start, line_end - line_start);
+        } else {
+            // very long lines get a window around the match instead
+            int window_start = qMax(line_start, mi.offset.first - SNIPPET_MAX_CHARS / 4);
+            snippet = text.mid(window_start, qMin(SNIPPET_MAX_CHARS, line_end - window_start));
+            if (window_start > line_start) {
+                snippet.prepend("...");
+            }
+            if (window_start + SNIPPET_MAX_CHARS < line_end) {
+                snippet.append("...");
+            }
+        }
+
+        SearchMatch match;
+        match.bookpath = bookpath;
+        match.line = line;
+        match.offset = mi.offset.first;
+        match.snippet = snippet.simplified();
+        matches.append(match);
+        return !CancelRequested();
+    });
+
+    // the full scan doubles as a count, so let a later Count All reuse it
+    if (!CancelRequested()) {
+        MatchCountCache::instance()->store(resource, search_regex, matches.count());
+    }
+    return matches;
+}
+
+
 int SearchOperations::ReplaceInAllFIles(const QString &search_regex,
                                         const QString &replacement,
                                         QList<Resource *> resources)
 {
-    QProgressDialog progress(QObject::tr("Replacing search term..."), 0, 0, resources.count(), Utility::GetMainWindow());
+    QProgressDialog progress(QObject::tr("Replacing search term..."), QObject::tr("Cancel"), 0, resources.count(), Utility::GetMainWindow());
     progress.setMinimumDuration(PROGRESS_BAR_MINIMUM_DURATION);
-    int progress_value = 0;
-    progress.setValue(progress_value);
-    // Replace sequentially in order to see if occassional crashes are due to threading
-    int count = 0;
-    foreach(Resource * resource, resources) {
-        progress.setValue(progress_value++);
-        qApp->processEvents();
-        count += ReplaceInFile(search_regex, replacement, resource);
-    }
-    return count;
+    progress.setValue(0);
+    // each resource is replaced under its own write lock and SetText
+    // already defers QTextDocument updates back to the GUI thread
+    return RunMappedOperation(QtConcurrent::mapped(resources,
+                              std::bind(ReplaceInFile, search_regex, replacement, std::placeholders::_1)),
+                              progress);
 }
 
 
@@ -79,21 +290,42 @@ int SearchOperations::CountInFile(const QString &search_regex,
                                   Resource *resource,
                                   bool check_spelling)
 {
-    QReadLocker locker(&resource->GetLock());
-    HTMLResource *html_resource = qobject_cast<HTMLResource *>(resource);
+    // spelling counts share the pattern namespace so mark their keys
+    QString cache_key = check_spelling ? "\x1f" + search_regex : search_regex;
+    int count = 0;
+    if (MatchCountCache::instance()->lookup(resource, cache_key, count)) {
+        return count;
+    }
 
-    if (html_resource) {
-        return CountInHTMLFile(search_regex, html_resource, check_spelling);
+    // a definitive trigram miss means zero matches without any scan
+    // (spelling counts use the pattern as a word filter, not a regex)
+    if (!check_spelling) {
+        QString literal = PCRECache::instance()->getObject(search_regex)->requiredLiteral();
+        if (!literal.isEmpty() && !TrigramIndex::instance()->MightContain(resource, literal)) {
+            MatchCountCache::instance()->store(resource, cache_key, 0);
+            return 0;
+        }
     }
 
+    QReadLocker locker(&resource->GetLock());
+    HTMLResource *html_resource = qobject_cast<HTMLResource *>(resource);
     TextResource *text_resource = qobject_cast<TextResource *>(resource);
 
-    if (text_resource) {
-        return CountInTextFile(search_regex, text_resource);
+    if (html_resource) {
+        count = CountInHTMLFile(search_regex, html_resource, check_spelling);
+    } else if (text_resource) {
+        count = CountInTextFile(search_regex, text_resource);
+    } else {
+        // We should never get here.
+        return 0;
     }
 
-    // We should never get here.
-    return 0;
+    // a cancelled scan yields a partial count that must not be cached
+    if (CancelRequested()) {
+        return count;
+    }
+    MatchCountCache::instance()->store(resource, cache_key, count);
+    return count;
 }
 
 
@@ -107,14 +339,18 @@ int SearchOperations::CountInHTMLFile(const QString &search_regex,
     if (check_spelling) {
         return HTMLSpellCheck::CountMisspelledWords(text, 0, text.count(), search_regex);
     } else {
-        return PCRECache::instance()->getObject(search_regex)->getEveryMatchInfo(text).count();
+        // stream the count so a cancel takes effect between matches
+    return PCRECache::instance()->getObject(search_regex)->forEachMatchInfo(text,
+            [](const SPCRE::MatchInfo &) { return !CancelRequested(); });
     }
 }
 
 int SearchOperations::CountInTextFile(const QString &search_regex, TextResource *text_resource)
 {
     const QString &text = text_resource->GetText();
-    return PCRECache::instance()->getObject(search_regex)->getEveryMatchInfo(text).count();
+    // stream the count so a cancel takes effect between matches
+    return PCRECache::instance()->getObject(search_regex)->forEachMatchInfo(text,
+            [](const SPCRE::MatchInfo &) { return !CancelRequested(); });
 }
 
 
@@ -122,6 +358,13 @@ int SearchOperations::ReplaceInFile(const QString &search_regex,
                                     const QString &replacement,
                                     Resource *resource)
 {
+    // skip the write lock and the text fetch entirely for files the
+    // trigram signature proves cannot match
+    QString literal = PCRECache::instance()->getObject(search_regex)->requiredLiteral();
+    if (!literal.isEmpty() && !TrigramIndex::instance()->MightContain(resource, literal)) {
+        return 0;
+    }
+
     QWriteLocker locker(&resource->GetLock());
     HTMLResource *html_resource = qobject_cast<HTMLResource *>(resource);
 
@@ -168,16 +411,72 @@ int SearchOperations::ReplaceTextInFile(const QString &search_regex,
 }
 
 
+int SearchOperations::DryRunReplaceInFile(const QString &search_regex,
+                                          const QString &replacement,
+                                          Resource *resource,
+                                          int max_snippets,
+                                          QList<ReplacementSnippet> &snippets)
+{
+    const int CONTEXT_CHARS = 20;
+
+    QString literal = PCRECache::instance()->getObject(search_regex)->requiredLiteral();
+    if (!literal.isEmpty() && !TrigramIndex::instance()->MightContain(resource, literal)) {
+        return 0;
+    }
+
+    QReadLocker locker(&resource->GetLock());
+    HTMLResource *html_resource = qobject_cast<HTMLResource *>(resource);
+    TextResource *text_resource = qobject_cast<TextResource *>(resource);
+    QString text;
+
+    if (html_resource) {
+        text = html_resource->GetText();
+    } else if (text_resource) {
+        text = text_resource->GetText();
+    } else {
+        return 0;
+    }
+
+    QSharedPointer<SPCRE> spcre = PCRECache::instance()->getObject(search_regex);
+    return spcre->forEachMatchInfo(text, [&](const SPCRE::MatchInfo & mi) {
+        if (snippets.count() >= max_snippets) {
+            // keep counting so the total is right, just stop building
+            return true;
+        }
+        QString match_segment = Utility::Substring(mi.offset.first, mi.offset.second, text);
+        QString replacement_text;
+        if (!spcre->replaceText(match_segment, mi.capture_groups_offsets, replacement, replacement_text)) {
+            // a broken replacement pattern leaves the text untouched
+            replacement_text = match_segment;
+        }
+        int context_start = qMax(0, mi.offset.first - CONTEXT_CHARS);
+        int context_end = qMin(text.length(), mi.offset.second + CONTEXT_CHARS);
+        QString leading = Utility::Substring(context_start, mi.offset.first, text);
+        QString trailing = Utility::Substring(mi.offset.second, context_end, text);
+        ReplacementSnippet snippet;
+        snippet.offset = mi.offset.first;
+        snippet.before = leading + match_segment + trailing;
+        snippet.after = leading + replacement_text + trailing;
+        snippets.append(snippet);
+        return true;
+    });
+}
+
+
 std::tuple<QString, int> SearchOperations::PerformGlobalReplace(const QString &text,
         const QString &search_regex,
         const QString &replacement)
 {
     QString new_text = text;
     int count = 0;
-    SPCRE *spcre = PCRECache::instance()->getObject(search_regex);
+    QSharedPointer<SPCRE> spcre = PCRECache::instance()->getObject(search_regex);
     QList<SPCRE::MatchInfo> match_info = spcre->getEveryMatchInfo(text);
 
     for (int i =  match_info.count() - 1; i >= 0; i--) {
+        if (CancelRequested()) {
+            // abandon the whole file rather than commit a half-replaced text
+            return std::make_tuple(text, 0);
+        }
         QString match_segement = Utility::Substring(match_info.at(i).offset.first, match_info.at(i).offset.second, new_text);
         QString replacement_text;
 
@@ -198,7 +497,7 @@ std::tuple<QString, int> SearchOperations::PerformHTMLSpellCheckReplace(const QS
     QString new_text = text;
     int count = 0;
     int offset = 0;
-    SPCRE *spcre = PCRECache::instance()->getObject(search_regex);
+    QSharedPointer<SPCRE> spcre = PCRECache::instance()->getObject(search_regex);
     QList<HTMLSpellCheck::MisspelledWord> check_spelling = HTMLSpellCheck::GetMisspelledWords(text, 0, text.count(), search_regex);
     foreach(HTMLSpellCheck::MisspelledWord misspelled_word, check_spelling) {
         SPCRE::MatchInfo match_info = spcre->getFirstMatchInfo(misspelled_word.text);
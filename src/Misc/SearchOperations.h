@@ -24,6 +24,10 @@
 #ifndef SEARCHOPERATIONS_H
 #define SEARCHOPERATIONS_H
 
+#include <QtCore/QAtomicInt>
+#include <QtCore/QFuture>
+
+class QProgressDialog;
 class Resource;
 class TextResource;
 class HTMLResource;
@@ -43,17 +47,109 @@ public:
                             QList<Resource *> resources,
                             bool check_spelling = false);
 
+    /**
+     * Count a whole group of patterns in one pass over the files.
+     * Each resource is locked and its text fetched once, with every
+     * pattern in the group dispatched against that text, instead of
+     * making a full pass over the book per pattern.
+     *
+     * @param search_regexes The regexes to match with.
+     * @return The summed number of matches across all patterns.
+     */
+    static int CountInFiles(const QStringList &search_regexes,
+                            QList<Resource *> resources);
+
+    /**
+     * Whether the user has cancelled the operation currently running.
+     * Checked cooperatively between matches inside the per-file
+     * workers, so even a single huge file stops almost immediately.
+     */
+    static bool CancelRequested();
+
+    /**
+     * Ask the workers of the current operation to stop between matches.
+     * For callers that drive a future themselves instead of going
+     * through the modal progress dialog loop.
+     */
+    static void RequestCancel();
+
+    /**
+     * One located match for a results view: where it is, and the text
+     * of the line it sits on.
+     */
+    struct SearchMatch {
+        // book path of the resource the match was found in
+        QString bookpath;
+        // 1-based line number of the start of the match
+        int line;
+        // character offset of the match within the resource text
+        int offset;
+        // the match's line, whitespace-collapsed and capped for display
+        QString snippet;
+    };
+
+    /**
+     * Kick off a parallel scan listing every match in every given
+     * resource.  Returns immediately; the caller watches the future and
+     * consumes per-resource match lists as workers finish, so rows can
+     * stream into a view instead of waiting on the whole book.
+     */
+    static QFuture<QList<SearchMatch>> ListMatchesInFiles(const QString &search_regex,
+            QList<Resource *> resources);
+
 
     static int ReplaceInAllFIles(const QString &search_regex,
                                  const QString &replacement,
                                  QList<Resource *> resources);
 
+    /**
+     * One would-be replacement shown as matched text and replacement
+     * text, each wrapped in a little surrounding context.
+     */
+    struct ReplacementSnippet {
+        // offset of the match within the resource text
+        int offset;
+        // context with the matched text still in place
+        QString before;
+        // the same context with the replacement applied
+        QString after;
+    };
+
+    /**
+     * Dry-run a replacement against a single resource without touching
+     * its text.  Counts every match but materializes before/after
+     * snippets only up to max_snippets, so a preview view can call this
+     * per file as the user expands it instead of computing the whole
+     * book's replacements up front.
+     *
+     * @param search_regex The regex to match with.
+     * @param replacement The replacement pattern.
+     * @param resource The resource to preview against.
+     * @param max_snippets Most snippets to build; counting continues past it.
+     * @param[out] snippets The built snippets, in document order.
+     *
+     * @return The number of matches that a real replace would act on.
+     */
+    static int DryRunReplaceInFile(const QString &search_regex,
+                                   const QString &replacement,
+                                   Resource *resource,
+                                   int max_snippets,
+                                   QList<ReplacementSnippet> &snippets);
+
 private:
 
+    static int RunMappedOperation(QFuture<int> future, QProgressDialog &progress);
+
     static int CountInFile(const QString &search_regex,
                            Resource *resource,
                            bool check_spelling);
 
+    static int CountInFileMulti(const QStringList &search_regexes,
+                                Resource *resource);
+
+    static QList<SearchMatch> ListMatchesInFile(const QString &search_regex,
+            Resource *resource);
+
 
     static int CountInHTMLFile(const QString &search_regex,
                                HTMLResource *html_resource,
@@ -84,6 +180,9 @@ private:
             const QString &replacement);
 
     static void Accumulate(int &first, const int &second);
+
+    // set by RunMappedOperation when the progress dialog is cancelled
+    static QAtomicInt m_CancelRequested;
 };
 
 #endif // SEARCHOPERATIONS_H
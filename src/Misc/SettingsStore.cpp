@@ -55,6 +55,7 @@ static QString KEY_DEFAULT_USER_DICTIONARY = SETTINGS_GROUP + "/" + "user_dictio
 static QString KEY_ENABLED_USER_DICTIONARIES = SETTINGS_GROUP + "/" + "enabled_user_dictionaries";
 static QString KEY_PLUGIN_USER_MAP = SETTINGS_GROUP + "/" + "plugin_user_map";
 static QString KEY_CLEAN_ON = SETTINGS_GROUP + "/" + "clean_on";
+static QString KEY_LARGEBOOK_ON = SETTINGS_GROUP + "/" + "largebook_on";
 static QString KEY_REMOTE_ON = SETTINGS_GROUP + "/" + "remote_on";
 static QString KEY_JAVASCRIPT_ON = SETTINGS_GROUP + "/" + "javascript_on";
 static QString KEY_SHOWFULLPATH_ON = SETTINGS_GROUP + "/" + "showfullpath_on";
@@ -131,9 +132,26 @@ static QString KEY_SPECIAL_CHARACTER_FONT_SIZE = SETTINGS_GROUP + "/" + "special
 static QString KEY_MAIN_MENU_ICON_SIZE = SETTINGS_GROUP + "/" + "main_menu_icon_size";
 static QString KEY_CLIPBOARD_HISTORY_LIMIT = SETTINGS_GROUP + "/" + "clipboard_history_limit";
 
+// The hot settings snapshot; stale means the next hotSettings()
+// call re-reads the backing store. Only touched on the GUI thread.
+static SettingsStore::HotSettings hot_settings;
+static bool hot_settings_loaded = false;
+
+const SettingsStore::HotSettings &SettingsStore::hotSettings()
+{
+    if (!hot_settings_loaded) {
+        SettingsStore settings;
+        hot_settings.spell_check = settings.spellCheck();
+        hot_settings.spell_check_numbers = settings.spellCheckNumbers();
+        hot_settings.highlight_open_close_tags = settings.highlightOpenCloseTags();
+        hot_settings_loaded = true;
+    }
+    return hot_settings;
+}
+
 SettingsStore::SettingsStore()
     : QSettings(Utility::DefinePrefsDir() + "/sigil.ini", QSettings::IniFormat)
-{  
+{
     // See QTBUG-40796 and QTBUG-54510 as using UTF-8 as a codec for ini files is very broken
     // setIniCodec("UTF-8");
 }
@@ -295,6 +313,12 @@ int SettingsStore::cleanOn()
     return value(KEY_CLEAN_ON, (CLEANON_OPEN | CLEANON_SAVE)).toInt();
 }
 
+int SettingsStore::largeBookOn()
+{
+    clearSettingsGroup();
+    return value(KEY_LARGEBOOK_ON, (LARGEBOOK_SKIP_WF_CHECK | LARGEBOOK_SLOW_PREVIEW | LARGEBOOK_NO_TAG_HIGHLIGHT)).toInt();
+}
+
 QStringList SettingsStore::pluginMap()
 {
     clearSettingsGroup();
@@ -579,12 +603,14 @@ void SettingsStore::setSpellCheck(bool enabled)
 {
     clearSettingsGroup();
     setValue(KEY_SPELL_CHECK, enabled);
+    hot_settings_loaded = false;
 }
 
 void SettingsStore::setSpellCheckNumbers(bool enabled)
 {
     clearSettingsGroup();
     setValue(KEY_SPELL_CHECK_NUMBERS, enabled);
+    hot_settings_loaded = false;
 }
 
 void SettingsStore::setDefaultUserDictionary(const QString &name)
@@ -636,6 +662,12 @@ void SettingsStore::setCleanOn(int on)
     setValue(KEY_CLEAN_ON, on);
 }
 
+void SettingsStore::setLargeBookOn(int on)
+{
+    clearSettingsGroup();
+    setValue(KEY_LARGEBOOK_ON, on);
+}
+
 void SettingsStore::setPluginMap(const QStringList &map)
 {
     clearSettingsGroup();
@@ -749,6 +781,7 @@ void SettingsStore::setHighlightOpenCloseTags(bool enabled)
 {
     clearSettingsGroup();
     setValue(KEY_CODE_VIEW_HIGHLIGHT_OPEN_CLOSE_TAGS, enabled);
+    hot_settings_loaded = false;
 }
 
 void SettingsStore::setCodeViewDarkAppearance(const SettingsStore::CodeViewAppearance &code_view_appearance)
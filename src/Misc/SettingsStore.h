@@ -34,6 +34,11 @@
 #define CLEANON_OPEN         (1 << 0)
 #define CLEANON_SAVE         (1 << 1)
 
+// Which features large book mode is allowed to degrade; see LargeBookPolicy.
+#define LARGEBOOK_SKIP_WF_CHECK    (1 << 0)
+#define LARGEBOOK_SLOW_PREVIEW     (1 << 1)
+#define LARGEBOOK_NO_TAG_HIGHLIGHT (1 << 2)
+
 class QColor;
 
 /**
@@ -156,6 +161,8 @@ public:
 
     int cleanOn();
 
+    int largeBookOn();
+
     QStringList pluginMap();
 
     QString defaultVersion();
@@ -256,6 +263,20 @@ public:
 
     bool enableAltGr();
 
+    /**
+     * Snapshot of the settings queried on per-keystroke and
+     * per-block paths (highlighting, spellcheck scanning). Reading
+     * it costs a struct field access instead of a QSettings lookup;
+     * the corresponding setters keep it current.
+     */
+    struct HotSettings {
+        bool spell_check;
+        bool spell_check_numbers;
+        bool highlight_open_close_tags;
+    };
+
+    static const HotSettings &hotSettings();
+
 public slots:
 
     /**
@@ -365,6 +386,8 @@ public slots:
 
     void setCleanOn(int on);
 
+    void setLargeBookOn(int on);
+
     void setPluginMap(const QStringList & map);
 
     void setDefaultVersion(const QString &version);
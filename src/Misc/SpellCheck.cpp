@@ -23,6 +23,7 @@
 #include <hunspell.hxx>
 
 #include <QCoreApplication>
+#include <QDateTime>
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
@@ -47,6 +48,37 @@
 # include <stdlib.h>
 #endif
 
+// Parsing a hunspell dictionary is by far the most expensive part of
+// loadDictionary, so parsed handles are kept in a process wide cache
+// keyed by the .aff/.dic file pair and reused for as long as those
+// files are unchanged on disk.  Every user of SpellCheck (highlighter,
+// Spellcheck Editor, HTMLSpellCheckML) then shares one parsed copy per
+// dictionary, and unloading a dictionary followed by reloading it
+// (e.g. cycling preferences) costs a hash lookup instead of a reparse.
+// The vendored hunspell can only be constructed from file paths, so
+// the sharing happens at the level of parsed handles rather than raw
+// memory mappings.
+namespace {
+
+struct SharedDictionary {
+    Hunspell  *handle;
+    QTextCodec *codec;
+    QString    wordchars;
+    QDateTime  aff_modified;
+    QDateTime  dic_modified;
+    bool       user_words_added;
+    int        refcount;
+};
+
+QHash<QString, SharedDictionary> shared_dictionaries;
+
+QString SharedDictionaryKey(const QString &aff, const QString &dic)
+{
+    return aff + "|" + dic;
+}
+
+} // namespace
+
 SpellCheck *SpellCheck::m_instance = 0;
 
 SpellCheck *SpellCheck::instance()
@@ -59,13 +91,12 @@ SpellCheck *SpellCheck::instance()
 }
 
 SpellCheck::SpellCheck()
+    : m_dictionariesLoaded(false)
 {
     DBG qDebug() << "In SpellCheck Constructor";
     m_primary.handle = NULL;
     m_secondary.handle = NULL;
 
-    // There is a considerable lag involved in loading the Spellcheck dictionaries
-    QApplication::setOverrideCursor(Qt::WaitCursor);
     loadDictionaryNames();
     // Create the user dictionary word list directiory if necessary.
     const QString user_directory = userDictionaryDirectory();
@@ -84,10 +115,26 @@ SpellCheck::SpellCheck()
         }
     }
 
-    QApplication::restoreOverrideCursor();
-
     UpdateLangCodeToDictMapping();
 
+    // The expensive part - parsing the primary and secondary
+    // dictionaries - is deferred to ensureDictionariesLoaded() so the
+    // singleton can be created (and the ignored word list used) at
+    // startup without the load lag.
+}
+
+
+void SpellCheck::ensureDictionariesLoaded()
+{
+    if (m_dictionariesLoaded) {
+        return;
+    }
+
+    QMutexLocker locker(&m_loadOnceMutex);
+    if (m_dictionariesLoaded) {
+        return;
+    }
+
     // Load the dictionary the user has selected
     // now open primary and secondary dictionaries
     SettingsStore settings;
@@ -95,6 +142,7 @@ SpellCheck::SpellCheck()
     if (!settings.secondary_dictionary().isEmpty()) {
         loadDictionary(settings.secondary_dictionary());
     }
+    m_dictionariesLoaded = true;
 }
 
 void SpellCheck::UpdateLangCodeToDictMapping()
@@ -129,16 +177,36 @@ void SpellCheck::UpdateLangCodeToDictMapping()
     }
 }
 
-void SpellCheck::UnloadDictionary(const QString &dname)
+void SpellCheck::UnloadDictionary(const QString &dname, bool drop_shared)
 {
     DBG qDebug() << "In UnloadDictionary";
     QMutexLocker locker(&mutex);
     if (m_opendicts.contains(dname)) {
         HDictionary hdic = m_opendicts[dname];
         if (hdic.handle) {
-            delete hdic.handle;
+            // A handle owned by the shared cache is only released here;
+            // the parsed data stays cached for the next load unless the
+            // caller explicitly wants it dropped (forceReplace).
+            bool in_cache = false;
+            QMutableHashIterator<QString, SharedDictionary> it(shared_dictionaries);
+            while (it.hasNext()) {
+                it.next();
+                if (it.value().handle == hdic.handle) {
+                    in_cache = true;
+                    it.value().refcount--;
+                    if (drop_shared && it.value().refcount <= 0) {
+                        delete it.value().handle;
+                        it.remove();
+                    }
+                    break;
+                }
+            }
+            if (!in_cache) {
+                delete hdic.handle;
+            }
         }
         m_opendicts.remove(dname);
+        clearVerdictCaches();
     }
 }
 
@@ -155,6 +223,14 @@ SpellCheck::~SpellCheck()
     DBG qDebug() << "In SpellCheck destructor";
     UnloadAllDictionaries();
 
+    // Release the parsed handles retained by the shared cache.
+    foreach(const QString &key, shared_dictionaries.keys()) {
+        if (shared_dictionaries[key].refcount <= 0) {
+            delete shared_dictionaries[key].handle;
+            shared_dictionaries.remove(key);
+        }
+    }
+
     if (m_instance) {
         delete m_instance;
         m_instance = 0;
@@ -188,9 +264,21 @@ QString SpellCheck::currentPrimaryDictionary() const
     return settings.dictionary();
 }
 
+// Cached verdicts stay valid until a dictionary or the ignored word
+// list changes; the caches are simply capped, not evicted, since a
+// full refill is cheap compared to thrashing on a huge book.
+static const int MAX_SPELL_VERDICT_CACHE_ENTRIES = 100000;
+
 bool SpellCheck::spell(const QString &word)
 {
     DBG qDebug() << "In spell";
+    ensureDictionariesLoaded();
+    {
+        QHash<QString, bool>::const_iterator it = m_spellVerdicts.constFind(word);
+        if (it != m_spellVerdicts.constEnd()) {
+            return it.value();
+        }
+    }
     QString dname = m_langcode2dict.value(HTMLSpellCheckML::langOf(word), "");
 
     // if no dictionary exists for this language treat it as correct
@@ -206,27 +294,112 @@ bool SpellCheck::spell(const QString &word)
     Q_ASSERT(hdic.handle != nullptr);
     bool res = hdic.handle->spell(hdic.codec->fromUnicode(Utility::getSpellingSafeText(HTMLSpellCheckML::textOf(word))).constData()) != 0;
     res = res || isIgnored(HTMLSpellCheckML::textOf(word));
+
+    if (m_spellVerdicts.count() >= MAX_SPELL_VERDICT_CACHE_ENTRIES) {
+        m_spellVerdicts.clear();
+    }
+    m_spellVerdicts.insert(word, res);
     return res;
 }
 
 
+QHash<QString, bool> SpellCheck::spellBatch(const QStringList &words)
+{
+    ensureDictionariesLoaded();
+    // One pass over the batch resolves each distinct word exactly
+    // once: the verdict cache answers everything checked before, and
+    // the remaining words are grouped by dictionary so the langcode
+    // mapping and dictionary lookups are not repeated per word.
+    QHash<QString, bool> verdicts;
+    verdicts.reserve(words.count());
+    QHash<QString, QStringList> unseen;
+
+    foreach(const QString &word, words) {
+        if (verdicts.contains(word)) {
+            continue;
+        }
+
+        QHash<QString, bool>::const_iterator it = m_spellVerdicts.constFind(word);
+
+        if (it != m_spellVerdicts.constEnd()) {
+            verdicts.insert(word, it.value());
+            continue;
+        }
+
+        QString dname = m_langcode2dict.value(HTMLSpellCheckML::langOf(word), "");
+
+        // if no dictionary exists for this language treat it as correct
+        if (dname.isEmpty()) {
+            verdicts.insert(word, true);
+            continue;
+        }
+
+        // if a dictionary exists but is not open yet, open it first
+        if (!m_opendicts.contains(dname)) {
+            loadDictionary(dname);
+        }
+
+        if (!m_opendicts.contains(dname)) {
+            verdicts.insert(word, true);
+            continue;
+        }
+
+        unseen[dname].append(word);
+    }
+
+    foreach(const QString &dname, unseen.keys()) {
+        HDictionary hdic = m_opendicts[dname];
+        Q_ASSERT(hdic.codec != nullptr);
+        Q_ASSERT(hdic.handle != nullptr);
+
+        foreach(const QString &word, unseen[dname]) {
+            bool res = hdic.handle->spell(hdic.codec->fromUnicode(Utility::getSpellingSafeText(HTMLSpellCheckML::textOf(word))).constData()) != 0;
+            res = res || isIgnored(HTMLSpellCheckML::textOf(word));
+
+            if (m_spellVerdicts.count() >= MAX_SPELL_VERDICT_CACHE_ENTRIES) {
+                m_spellVerdicts.clear();
+            }
+
+            m_spellVerdicts.insert(word, res);
+            verdicts.insert(word, res);
+        }
+    }
+
+    return verdicts;
+}
+
+
 // Speed here is very important as it is invoked by the XHTMLHighlighter2 code
 // and this is the limiting factor
 // spell check word without langcode info in Primary and Secondary Dictionaries
 bool SpellCheck::spellPS(const QString &word)
 {
+    ensureDictionariesLoaded();
     if (!m_primary.handle) return true;
     if(m_ignoredWords.contains(word)) return true;
+    {
+        QHash<QString, bool>::const_iterator it = m_spellPSVerdicts.constFind(word);
+        if (it != m_spellPSVerdicts.constEnd()) {
+            return it.value();
+        }
+    }
     bool res = m_primary.handle->spell(m_primary.codec->fromUnicode(Utility::getSpellingSafeText(word)).constData()) != 0;
-    if (res) return true;
-    if (!m_secondary.handle) return false;
-    return m_secondary.handle->spell(m_secondary.codec->fromUnicode(Utility::getSpellingSafeText(word)).constData()) != 0;
+    if (!res && m_secondary.handle) {
+        res = m_secondary.handle->spell(m_secondary.codec->fromUnicode(Utility::getSpellingSafeText(word)).constData()) != 0;
+    }
+
+    if (m_spellPSVerdicts.count() >= MAX_SPELL_VERDICT_CACHE_ENTRIES) {
+        m_spellPSVerdicts.clear();
+    }
+    m_spellPSVerdicts.insert(word, res);
+    return res;
 }
 
 
 QStringList SpellCheck::suggest(const QString &word)
 {
     DBG qDebug() << "In suggest";
+    ensureDictionariesLoaded();
     QStringList suggestions;
     char **suggestedWords;
     QString dname = m_langcode2dict.value(HTMLSpellCheckML::langOf(word), "");
@@ -249,6 +422,7 @@ QStringList SpellCheck::suggest(const QString &word)
 // suggesttions for word without langcode using Primary and Secondary Dictionaries
 QStringList SpellCheck::suggestPS(const QString &word)
 {
+    ensureDictionariesLoaded();
     QStringList suggestions;
     char **suggestedWords;
     char **suggestedWords2;
@@ -276,6 +450,7 @@ void SpellCheck::clearIgnoredWords()
 {
     DBG qDebug() << "In clearIgnoredWords";
     m_ignoredWords.clear();
+    clearVerdictCaches();
 }
 
 
@@ -283,6 +458,14 @@ void SpellCheck::ignoreWord(const QString &word)
 {
     DBG qDebug() << "In ignoreWord";
     m_ignoredWords.insert(word);
+    clearVerdictCaches();
+}
+
+
+void SpellCheck::clearVerdictCaches()
+{
+    m_spellVerdicts.clear();
+    m_spellPSVerdicts.clear();
 }
 
 
@@ -299,6 +482,7 @@ void SpellCheck::addWordToDictionary(const QString &word, const QString &dname)
     if (m_opendicts.contains(dname)) {
         HDictionary hdic = m_opendicts[dname];
         hdic.handle->add(hdic.codec->fromUnicode(Utility::getSpellingSafeText(HTMLSpellCheckML::textOf(word))).constData());
+        clearVerdictCaches();
     }
 }
 
@@ -321,47 +505,88 @@ void SpellCheck::loadDictionary(const QString &dname)
     // qDebug() << dic_delta;
     // qDebug() << alt_dic_delta;
 
-    // Create a new hunspell object.
     HDictionary hdic;
     hdic.name = dname;
-    hdic.handle = new Hunspell(aff.toLocal8Bit().constData(), dic.toLocal8Bit().constData());
-    if (!hdic.handle) {
-        qDebug() << "failed to load new Hunspell dictionary " << dname;
-        return;
-    }
 
-    // Get the encoding for the text in the dictionary.
-    hdic.codec = QTextCodec::codecForName(hdic.handle->get_dic_encoding());
-    if (hdic.codec == nullptr) {
-        hdic.codec = QTextCodec::codecForName("UTF-8");
-    }
-    if (!hdic.codec) {
-        qDebug() << "failed to load codec " << dname;
-        return;
+    // Reuse the shared parsed handle when the dictionary files are
+    // unchanged; the delta and user words injected at parse time are
+    // still present in it, so only a parse from scratch needs them.
+    const QString key = SharedDictionaryKey(aff, dic);
+    bool reused = false;
+    if (shared_dictionaries.contains(key)) {
+        SharedDictionary &shared = shared_dictionaries[key];
+        if (shared.aff_modified == QFileInfo(aff).lastModified() &&
+            shared.dic_modified == QFileInfo(dic).lastModified()) {
+            hdic.handle = shared.handle;
+            hdic.codec = shared.codec;
+            hdic.wordchars = shared.wordchars;
+            shared.refcount++;
+            reused = true;
+        } else {
+            // The files were replaced on disk - the cached parse is stale.
+            if (shared.refcount <= 0) {
+                delete shared.handle;
+            }
+            shared_dictionaries.remove(key);
+        }
     }
 
-    // Get the extra wordchars used for tokenization
-    hdic.wordchars = hdic.codec->toUnicode(hdic.handle->get_wordchars());
+    if (!reused) {
+        // Create a new hunspell object.
+        hdic.handle = new Hunspell(aff.toLocal8Bit().constData(), dic.toLocal8Bit().constData());
+        if (!hdic.handle) {
+            qDebug() << "failed to load new Hunspell dictionary " << dname;
+            return;
+        }
 
-    // register it as an open dictionary
-    m_opendicts[dname] = hdic;
+        // Get the encoding for the text in the dictionary.
+        hdic.codec = QTextCodec::codecForName(hdic.handle->get_dic_encoding());
+        if (hdic.codec == nullptr) {
+            hdic.codec = QTextCodec::codecForName("UTF-8");
+        }
+        if (!hdic.codec) {
+            qDebug() << "failed to load codec " << dname;
+            return;
+        }
 
-    // check for appropriate .dic_delta file and add it
-    // check in user prefs hunspell_dictionaries first
-    // so that user's version is given preference over 
-    // any system version
-    QStringList deltaWords;
-    if (QFile(dic_delta).exists()) {
-        dicDeltaWords(dic_delta, deltaWords);
-    } else if (QFile(alt_dic_delta).exists()) {
-        dicDeltaWords(alt_dic_delta, deltaWords);
+        // Get the extra wordchars used for tokenization
+        hdic.wordchars = hdic.codec->toUnicode(hdic.handle->get_wordchars());
+
+        SharedDictionary shared;
+        shared.handle = hdic.handle;
+        shared.codec = hdic.codec;
+        shared.wordchars = hdic.wordchars;
+        shared.aff_modified = QFileInfo(aff).lastModified();
+        shared.dic_modified = QFileInfo(dic).lastModified();
+        shared.user_words_added = false;
+        shared.refcount = 1;
+        shared_dictionaries[key] = shared;
     }
-    foreach(QString word, deltaWords){
-        addWordToDictionary(word, dname);
+
+    // register it as an open dictionary
+    m_opendicts[dname] = hdic;
+    clearVerdictCaches();
+
+    if (!reused) {
+        // check for appropriate .dic_delta file and add it
+        // check in user prefs hunspell_dictionaries first
+        // so that user's version is given preference over
+        // any system version
+        QStringList deltaWords;
+        if (QFile(dic_delta).exists()) {
+            dicDeltaWords(dic_delta, deltaWords);
+        } else if (QFile(alt_dic_delta).exists()) {
+            dicDeltaWords(alt_dic_delta, deltaWords);
+        }
+        foreach(QString word, deltaWords){
+            addWordToDictionary(word, dname);
+        }
     }
 
     // add UserDictionary words to the Primary Dictionary only
-    if (dname == currentPrimaryDictionary()) {
+    // (at most once per parsed handle - hunspell add() persists in it)
+    if (dname == currentPrimaryDictionary() && !shared_dictionaries[key].user_words_added) {
+        shared_dictionaries[key].user_words_added = true;
         // Load in the words from the user dictionaries.
         foreach(QString word, allUserDictionaryWords()) {
             addWordToDictionary(word, dname);
@@ -388,7 +613,9 @@ void SpellCheck::setDictionary(const QString &dname, bool forceReplace)
         return;
     }
 
-    UnloadDictionary(dname);
+    // forceReplace drops the shared parse too so that user dictionary
+    // changes are picked up by the rebuilt handle
+    UnloadDictionary(dname, forceReplace);
     loadDictionary(dname);
 }
 
@@ -396,6 +623,7 @@ void SpellCheck::setDictionary(const QString &dname, bool forceReplace)
 QString SpellCheck::getWordChars(const QString &lang)
 {
     DBG qDebug() << "In getWordChars";
+    ensureDictionariesLoaded();
     QString dname;
     if (lang.isEmpty()) { 
         dname = currentPrimaryDictionary();
@@ -420,6 +648,7 @@ QString SpellCheck::getWordChars(const QString &lang)
 void SpellCheck::addToUserDictionary(const QString &word, QString dict_name)
 {
     DBG qDebug() << "In AddToUserDictionary";
+    ensureDictionariesLoaded();
     // Adding to the user dictionary also marks the word as a correct spelling.
     if (word.isEmpty()) {
         return;
@@ -58,6 +58,13 @@ public:
     bool spell(const QString &word);
     QStringList suggest(const QString &word);
 
+    /**
+     * Checks a whole batch of words in one call.  Words already in
+     * the verdict cache cost a hash probe; the rest are grouped by
+     * dictionary and hit hunspell once per distinct word.
+     */
+    QHash<QString, bool> spellBatch(const QStringList &words);
+
     bool spellPS(const QString &word);
     QStringList suggestPS(const QString &word);
 
@@ -66,8 +73,24 @@ public:
     bool isIgnored(const QString &word);
 
     QString getWordChars(const QString &lang="");
+
+    /**
+     * Loads the configured primary and secondary dictionaries if no
+     * one has done so yet.  The constructor deliberately does not -
+     * parsing hunspell data is the expensive part of startup and a
+     * session that never spellchecks should never pay for it.  Every
+     * spell query calls this, so after the first load it costs one
+     * boolean test; it is thread safe so the load can also be warmed
+     * from a background thread.
+     */
+    void ensureDictionariesLoaded();
+
     void loadDictionary(const QString &dname);
-    void UnloadDictionary(const QString &dname);
+    /**
+     * Closes a dictionary.  The parsed hunspell data is retained in a
+     * shared cache for cheap reloading unless drop_shared is set.
+     */
+    void UnloadDictionary(const QString &dname, bool drop_shared = false);
     void UnloadAllDictionaries();
 
     void setDictionary(const QString &dname, bool forceReplace = false);
@@ -92,13 +115,36 @@ public:
 
 private:
     SpellCheck();
+
+    /**
+     * Forgets all cached spelling verdicts.  Must be called whenever
+     * a dictionary or the ignored word list changes.
+     */
+    void clearVerdictCaches();
+
     QHash<QString, QString> m_dictionaries;
     QHash<QString, QString> m_langcode2dict;
+
+    /**
+     * Whether the configured dictionaries have been loaded yet.
+     * @see ensureDictionariesLoaded().
+     */
+    bool m_dictionariesLoaded;
+    QMutex m_loadOnceMutex;
+
     mutable QMutex mutex;
     QHash<QString, struct HDictionary> m_opendicts;
     QSet<QString> m_ignoredWords;
     struct HDictionary m_primary;
     struct HDictionary m_secondary;
+
+    /**
+     * Per-word spelling verdicts.  Highlighting rechecks the same
+     * words over and over (every edit rechecks its whole block), and
+     * a hash probe is far cheaper than a round trip into hunspell.
+     */
+    QHash<QString, bool> m_spellVerdicts;
+    QHash<QString, bool> m_spellPSVerdicts;
     
     static SpellCheck *m_instance;
 };
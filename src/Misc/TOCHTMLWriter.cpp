@@ -21,6 +21,8 @@
 **
 *************************************************************************/
 
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QHash>
 #include <QtCore/QXmlStreamWriter>
 
 #include "TOCHTMLWriter.h"
@@ -29,6 +31,26 @@
 
 const QString SGC_TOC_CSS_FILENAME = "sgc-toc.css";
 
+// Serialized sections from earlier runs, keyed on a hash of the entry
+// subtree and the TOC bookpath so regenerating the inline TOC after
+// small edits only rewrites the sections that actually changed.
+// Generation runs on the GUI thread only, so no locking is needed.
+static QHash<QByteArray, QString> toc_fragment_cache;
+static QList<QByteArray> toc_fragment_order;
+static const int MAX_CACHED_TOC_FRAGMENTS = 1000;
+
+static void AddEntryToHash(const TOCModel::TOCEntry &entry, QCryptographicHash &sum)
+{
+    sum.addData(entry.text.toUtf8());
+    sum.addData("\x1f", 1);
+    sum.addData(entry.target.toUtf8());
+    sum.addData("\x1f", 1);
+    foreach(const TOCModel::TOCEntry &child, entry.children) {
+        AddEntryToHash(child, sum);
+    }
+    sum.addData("\x1e", 1);
+}
+
 TOCHTMLWriter::TOCHTMLWriter(const QString &toc_bookpath,
                              const QString &css_bookpath, 
                              TOCModel::TOCEntry toc_root_entry,
@@ -77,10 +99,47 @@ QString TOCHTMLWriter::WriteXML(const QString &version)
     }
     WriteHead();
     WriteBody();
+
+    // The entry sections are appended behind the stream writer's back;
+    // WriteBody() left the body start tag flushed, and writeEndDocument()
+    // still closes the elements the writer itself opened.
+    foreach(TOCModel::TOCEntry entry, m_TOCRootEntry.children) {
+        out += CachedEntryFragment(entry);
+    }
+
     m_Writer->writeEndDocument();
     return out;
 }
 
+
+QString TOCHTMLWriter::CachedEntryFragment(TOCModel::TOCEntry entry)
+{
+    QCryptographicHash sum(QCryptographicHash::Sha1);
+    sum.addData(m_TOCBookPath.toUtf8());
+    sum.addData("\x1f", 1);
+    AddEntryToHash(entry, sum);
+    QByteArray key = sum.result();
+
+    if (toc_fragment_cache.contains(key)) {
+        toc_fragment_order.removeOne(key);
+        toc_fragment_order.append(key);
+        return toc_fragment_cache.value(key);
+    }
+
+    QString fragment;
+    QXmlStreamWriter fragment_writer(&fragment);
+    TOCModel::TOCEntry wrapper;
+    wrapper.children.append(entry);
+    WriteEntries(&fragment_writer, wrapper);
+
+    toc_fragment_cache.insert(key, fragment);
+    toc_fragment_order.append(key);
+    if (toc_fragment_order.count() > MAX_CACHED_TOC_FRAGMENTS) {
+        toc_fragment_cache.remove(toc_fragment_order.takeFirst());
+    }
+    return fragment;
+}
+
 void TOCHTMLWriter::WriteHead()
 {
     // Title
@@ -114,18 +173,17 @@ void TOCHTMLWriter::WriteBody()
     m_Writer->writeCharacters(m_title);
     m_Writer->writeEndElement();
     m_Writer->writeCharacters("\n");
-    // Entries
-    WriteEntries(m_TOCRootEntry);
+    // The entries themselves are assembled from cached fragments in WriteXML().
 }
 
-void TOCHTMLWriter::WriteEntries(TOCModel::TOCEntry parent_entry, int level)
+void TOCHTMLWriter::WriteEntries(QXmlStreamWriter *writer, TOCModel::TOCEntry parent_entry, int level)
 {
     foreach(TOCModel::TOCEntry entry, parent_entry.children) {
-        m_Writer->writeStartElement("div");
-        m_Writer->writeAttribute("class", "sgc-toc-level-" % QString::number(level));
-        m_Writer->writeCharacters("\n");
-        m_Writer->writeCharacters("  ");
-        m_Writer->writeStartElement("a");
+        writer->writeStartElement("div");
+        writer->writeAttribute("class", "sgc-toc-level-" % QString::number(level));
+        writer->writeCharacters("\n");
+        writer->writeCharacters("  ");
+        writer->writeStartElement("a");
         // entry.target is now a full urlencoded bookpath that may have a fragment
         QString href = entry.target;
         // only process internal not external hrefs
@@ -135,13 +193,13 @@ void TOCHTMLWriter::WriteEntries(TOCModel::TOCEntry parent_entry, int level)
             href = Utility::buildRelativePath(m_TOCBookPath, pieces.first);
             href = Utility::buildRelativeHREF(href, pieces.second);
         }
-        m_Writer->writeAttribute("href", href);
-        m_Writer->writeCharacters(entry.text);
-        m_Writer->writeEndElement();
-        m_Writer->writeCharacters("\n");
+        writer->writeAttribute("href", href);
+        writer->writeCharacters(entry.text);
+        writer->writeEndElement();
+        writer->writeCharacters("\n");
         // Recursively write out subheadings
-        WriteEntries(entry, level + 1);
-        m_Writer->writeEndElement();
-        m_Writer->writeCharacters("\n");
+        WriteEntries(writer, entry, level + 1);
+        writer->writeEndElement();
+        writer->writeCharacters("\n");
     }
 }
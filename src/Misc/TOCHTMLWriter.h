@@ -46,7 +46,13 @@ public:
 private:
     void WriteHead();
     void WriteBody();
-    void WriteEntries(TOCModel::TOCEntry entry, int level = 1);
+    void WriteEntries(QXmlStreamWriter *writer, TOCModel::TOCEntry entry, int level = 1);
+
+    /**
+     * Returns the serialized section for one top level entry and its
+     * subentries, reusing the cached fragment when the subtree is unchanged.
+     */
+    QString CachedEntryFragment(TOCModel::TOCEntry entry);
 
     QXmlStreamWriter *m_Writer;
 
@@ -0,0 +1,76 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include <QMutexLocker>
+#include <QThread>
+
+#include "Misc/Tracer.h"
+#include "Misc/Utility.h"
+
+Tracer *Tracer::m_instance = 0;
+
+Tracer *Tracer::instance()
+{
+    if (m_instance == 0) {
+        m_instance = new Tracer();
+    }
+    return m_instance;
+}
+
+Tracer::Tracer()
+    : m_enabled(false)
+{
+    m_epoch.start();
+    QString trace_file = Utility::GetEnvironmentVar("SIGIL_TRACE_FILE");
+    if (trace_file.isEmpty()) {
+        return;
+    }
+    m_file.setFileName(trace_file);
+    if (!m_file.open(QFile::WriteOnly | QFile::Truncate)) {
+        return;
+    }
+    // Chrome's trace readers accept an unterminated event array, so
+    // events can be appended (and survive a crash) without bookkeeping
+    m_file.write("[\n");
+    m_enabled = true;
+}
+
+Tracer::~Tracer()
+{
+    if (m_enabled) {
+        m_file.close();
+    }
+}
+
+void Tracer::record(const char *name, qint64 start_us, qint64 duration_us)
+{
+    if (!m_enabled) {
+        return;
+    }
+    QString event = QString("{\"name\":\"%1\",\"ph\":\"X\",\"ts\":%2,\"dur\":%3,\"pid\":1,\"tid\":%4},\n")
+                    .arg(name)
+                    .arg(start_us)
+                    .arg(duration_us)
+                    .arg((quint64)(quintptr)QThread::currentThreadId());
+    QMutexLocker locker(&m_mutex);
+    m_file.write(event.toUtf8());
+    m_file.flush();
+}
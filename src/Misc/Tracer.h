@@ -0,0 +1,104 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <QElapsedTimer>
+#include <QFile>
+#include <QMutex>
+#include <QString>
+
+/**
+ * Lightweight scoped tracing for the known hot paths.  Disabled (one
+ * boolean test per scope) unless the SIGIL_TRACE_FILE environment
+ * variable names a writable file; when enabled, every traced scope
+ * appends one Chrome trace-event JSON record, so a slow session can be
+ * captured by a user and inspected in chrome://tracing or Perfetto.
+ *
+ * Usage: put SIGIL_TRACE_SCOPE("SubSystem::operation"); at the top of
+ * the function to trace.
+ */
+class Tracer
+{
+
+public:
+
+    static Tracer *instance();
+    ~Tracer();
+
+    bool enabled() const { return m_enabled; }
+
+    // microseconds since tracing started
+    qint64 now() const { return m_epoch.nsecsElapsed() / 1000; }
+
+    void record(const char *name, qint64 start_us, qint64 duration_us);
+
+private:
+
+    Tracer();
+
+    static Tracer *m_instance;
+
+    bool m_enabled;
+    QElapsedTimer m_epoch;
+    QFile m_file;
+    QMutex m_mutex;
+};
+
+
+/**
+ * Times the scope it lives in and hands the result to the Tracer.
+ * Costs one boolean test when tracing is off.  The name must outlive
+ * the scope - use string literals.
+ */
+class ScopedTrace
+{
+
+public:
+
+    ScopedTrace(const char *name)
+        : m_name(name), m_start(-1)
+    {
+        Tracer *tracer = Tracer::instance();
+        if (tracer->enabled()) {
+            m_start = tracer->now();
+        }
+    }
+
+    ~ScopedTrace()
+    {
+        if (m_start >= 0) {
+            Tracer *tracer = Tracer::instance();
+            tracer->record(m_name, m_start, tracer->now() - m_start);
+        }
+    }
+
+private:
+
+    const char *m_name;
+    qint64 m_start;
+};
+
+#define SIGIL_TRACE_SCOPE(name) ScopedTrace sigil_scoped_trace_(name)
+
+#endif // TRACER_H
@@ -0,0 +1,172 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include <QMutexLocker>
+#include <QReadLocker>
+
+#include "Misc/TrigramIndex.h"
+#include "ResourceObjects/HTMLResource.h"
+#include "ResourceObjects/Resource.h"
+#include "ResourceObjects/TextResource.h"
+
+// Bits per signature - 32 KB of filter per resource keeps even a
+// several hundred file book in a few MB while holding the false
+// positive rate low for typical chapter-sized texts.
+static const quint32 SIGNATURE_BITS = 1 << 18;
+
+// Position-salted hash of three code units.  The same function signs
+// the text and probes the query, so a collision can only ever cost a
+// scan, never lose a match.
+static inline quint32 TrigramHash(const QChar *p)
+{
+    return quint32(p[0].unicode()) * 0x9E3779B1u ^
+           quint32(p[1].unicode()) * 0x85EBCA77u ^
+           quint32(p[2].unicode()) * 0xC2B2AE3Du;
+}
+
+// Two probes per trigram halve the false positive rate for almost no
+// extra build cost.
+static inline void SetTrigramBits(QBitArray &bits, quint32 h)
+{
+    bits.setBit(h % SIGNATURE_BITS);
+    bits.setBit((h >> 13) % SIGNATURE_BITS);
+}
+
+static inline bool TestTrigramBits(const QBitArray &bits, quint32 h)
+{
+    return bits.testBit(h % SIGNATURE_BITS) &&
+           bits.testBit((h >> 13) % SIGNATURE_BITS);
+}
+
+TrigramIndex *TrigramIndex::m_instance = 0;
+
+TrigramIndex *TrigramIndex::instance()
+{
+    // may be first reached from a pool thread, so guard creation;
+    // thread affinity does not matter because every connection made
+    // to this object is direct
+    static QMutex instance_mutex;
+    QMutexLocker locker(&instance_mutex);
+    if (m_instance == 0) {
+        m_instance = new TrigramIndex();
+    }
+
+    return m_instance;
+}
+
+TrigramIndex::TrigramIndex()
+    : QObject(NULL)
+{
+}
+
+bool TrigramIndex::MightContain(Resource *resource, const QString &literal)
+{
+    if (literal.length() < 3) {
+        return true;
+    }
+
+    QBitArray signature;
+    bool have = false;
+    {
+        QMutexLocker locker(&m_mutex);
+        QHash<const Resource *, QBitArray>::const_iterator it = m_signatures.constFind(resource);
+        if (it != m_signatures.constEnd()) {
+            signature = it.value();
+            have = true;
+        }
+    }
+
+    if (!have) {
+        QString text;
+        {
+            QReadLocker locker(&resource->GetLock());
+            HTMLResource *html_resource = qobject_cast<HTMLResource *>(resource);
+            TextResource *text_resource = qobject_cast<TextResource *>(resource);
+
+            if (html_resource) {
+                text = html_resource->GetText();
+            } else if (text_resource) {
+                text = text_resource->GetText();
+            } else {
+                return true;
+            }
+        }
+        // two workers racing here both build the same signature and
+        // one insert simply wins; cheaper than holding the mutex
+        // across a full text pass
+        signature = BuildSignature(text);
+        {
+            QMutexLocker locker(&m_mutex);
+            m_signatures.insert(resource, signature);
+        }
+        // Direct connections so invalidation runs immediately on the
+        // emitting (GUI) thread - this object lives behind a mutex,
+        // not an event loop, and signatures are built on pool threads.
+        connect(resource, SIGNAL(Modified()), this, SLOT(ResourceModified()),
+                static_cast<Qt::ConnectionType>(Qt::DirectConnection | Qt::UniqueConnection));
+        connect(resource, SIGNAL(Deleted(const Resource *)), this, SLOT(ResourceDeleted(const Resource *)),
+                static_cast<Qt::ConnectionType>(Qt::DirectConnection | Qt::UniqueConnection));
+    }
+
+    // the index is signed lowercased so one signature serves both
+    // case-sensitive and case-insensitive searches
+    const QString query = literal.toLower();
+    const QChar *data = query.constData();
+
+    for (int i = 0; i + 3 <= query.length(); ++i) {
+        if (!TestTrigramBits(signature, TrigramHash(data + i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+QBitArray TrigramIndex::BuildSignature(const QString &text)
+{
+    QBitArray bits(SIGNATURE_BITS);
+    const QString lowered = text.toLower();
+    const QChar *data = lowered.constData();
+
+    for (int i = 0; i + 3 <= lowered.length(); ++i) {
+        SetTrigramBits(bits, TrigramHash(data + i));
+    }
+
+    return bits;
+}
+
+void TrigramIndex::ResourceModified()
+{
+    forget(qobject_cast<Resource *>(sender()));
+}
+
+void TrigramIndex::ResourceDeleted(const Resource *resource)
+{
+    forget(resource);
+}
+
+void TrigramIndex::forget(const Resource *resource)
+{
+    if (!resource) {
+        return;
+    }
+    QMutexLocker locker(&m_mutex);
+    m_signatures.remove(resource);
+}
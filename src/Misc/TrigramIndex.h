@@ -0,0 +1,80 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#pragma once
+#ifndef TRIGRAMINDEX_H
+#define TRIGRAMINDEX_H
+
+#include <QtCore/QBitArray>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+class Resource;
+
+/**
+ * Singleton.  Per-resource trigram signatures used to rule files out
+ * of cross-file searches before any regex runs against their text.
+ *
+ * Each signature is a small bloom filter over the trigrams of the
+ * resource's lowercased text, built lazily the first time a search
+ * asks about the resource and dropped the moment the resource reports
+ * itself modified, so an edited file is simply re-signed by the next
+ * search instead of taxing the typing path.  A signature can say a
+ * literal is definitely absent, never that it is present, so a false
+ * positive only costs the scan that would have run anyway.  All
+ * methods are safe to call from worker threads.
+ */
+class TrigramIndex : public QObject
+{
+    Q_OBJECT
+
+public:
+    static TrigramIndex *instance();
+
+    /**
+     * Whether the resource's text could contain the literal.  True
+     * means "maybe" - the literal is too short to judge, the resource
+     * holds no text, or every trigram's bits are set; false is
+     * definitive: no match requiring this literal exists in the
+     * resource.
+     */
+    bool MightContain(Resource *resource, const QString &literal);
+
+private slots:
+    void ResourceModified();
+    void ResourceDeleted(const Resource *resource);
+
+private:
+    TrigramIndex();
+
+    void forget(const Resource *resource);
+
+    static QBitArray BuildSignature(const QString &text);
+
+    QMutex m_mutex;
+    QHash<const Resource *, QBitArray> m_signatures;
+
+    static TrigramIndex *m_instance;
+};
+
+#endif // TRIGRAMINDEX_H
@@ -28,6 +28,11 @@
 #include <QBuffer>
 #include <QFile>
 #include <QFileInfo>
+#include <QDateTime>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QDebug>
 #include "MainUI/MainApplication.h"
 #include "Misc/MediaTypes.h"
@@ -39,6 +44,25 @@
 
 static const QStringList REDIRECT = QStringList() << "audio/mp4" << "video/mp4" << "audio/mpeg";
 
+// Every Preview reload re-requests all of the page's linked css, fonts,
+// and images even though almost none of them changed, so the served
+// bytes are kept in a small lru cache keyed by the local file path and
+// revalidated against the file's modification time and size (the only
+// revision marker the book folder has).  An edited asset fails the
+// revalidation and is simply re-read.  The mutex is needed because
+// requestStarted() runs on QtWebEngine's io thread.
+struct CachedAsset {
+    QDateTime  modified;
+    qint64     size;
+    QByteArray data;
+};
+
+static QHash<QString, CachedAsset> asset_cache;
+static QList<QString> asset_cache_order;
+static qint64 asset_cache_bytes = 0;
+static QMutex asset_cache_mutex;
+static const qint64 MAX_ASSET_CACHE_BYTES = 20 * 1024 * 1024;
+
 URLSchemeHandler::URLSchemeHandler(QObject *parent)
     : QWebEngineUrlSchemeHandler(parent)
 {
@@ -92,11 +116,45 @@ void URLSchemeHandler::requestStarted(QWebEngineUrlRequestJob *request)
                 request->redirect(fileurl);
                 return;
             }
-            
-            QFile file(local_file);
-            if (file.open(QIODevice::ReadOnly)) {
-                data = file.readAll();
-                file.close();
+
+            {
+                QMutexLocker locker(&asset_cache_mutex);
+                if (asset_cache.contains(local_file)) {
+                    const CachedAsset &asset = asset_cache[local_file];
+                    if ((asset.modified == fi.lastModified()) && (asset.size == fi.size())) {
+                        DBG qDebug() << "URLSchemeHandler serving from asset cache: " << local_file;
+                        asset_cache_order.removeOne(local_file);
+                        asset_cache_order.append(local_file);
+                        data = asset.data;
+                    }
+                }
+            }
+
+            if (data.isEmpty()) {
+                QFile file(local_file);
+                if (file.open(QIODevice::ReadOnly)) {
+                    data = file.readAll();
+                    file.close();
+                }
+                if (!data.isEmpty() && (data.size() < MAX_ASSET_CACHE_BYTES)) {
+                    QMutexLocker locker(&asset_cache_mutex);
+                    if (asset_cache.contains(local_file)) {
+                        asset_cache_bytes -= asset_cache[local_file].data.size();
+                        asset_cache_order.removeOne(local_file);
+                    }
+                    CachedAsset asset;
+                    asset.modified = fi.lastModified();
+                    asset.size = fi.size();
+                    asset.data = data;
+                    asset_cache.insert(local_file, asset);
+                    asset_cache_order.append(local_file);
+                    asset_cache_bytes += data.size();
+                    while ((asset_cache_bytes > MAX_ASSET_CACHE_BYTES) && !asset_cache_order.isEmpty()) {
+                        QString evicted = asset_cache_order.takeFirst();
+                        asset_cache_bytes -= asset_cache[evicted].data.size();
+                        asset_cache.remove(evicted);
+                    }
+                }
             }
         }
     }
@@ -46,6 +46,7 @@
 #include <QtCore/QStandardPaths>
 #include <QtCore/QStringList>
 #include <QtCore/QStringRef>
+#include <QtCore/QTextCodec>
 #include <QtCore/QTextStream>
 #include <QtCore/QtGlobal>
 #include <QtCore/QUrl>
@@ -528,13 +529,42 @@ QString Utility::ReadUnicodeTextFile(const QString &fullfilepath)
         throw(CannotOpenFile(msg));
     }
 
-    QTextStream in(&file);
-    // Input should be UTF-8
-    in.setCodec("UTF-8");
-    // This will automatically switch reading from
-    // UTF-8 to UTF-16 if a BOM is detected
-    in.setAutoDetectUnicode(true);
-    return ConvertLineEndings(in.readAll());
+    // Map the file read-only and decode straight out of the page
+    // cache - no intermediate byte array copy and no QTextStream
+    // buffering. Resources and filesystems that refuse the mapping
+    // fall back to a plain read of the bytes.
+    qint64 size = file.size();
+    uchar *mapped = (size > 0) ? file.map(0, size) : nullptr;
+    QByteArray bytes;
+    const char *data;
+    if (mapped) {
+        data = reinterpret_cast<const char *>(mapped);
+    } else {
+        bytes = file.readAll();
+        data = bytes.constData();
+        size = bytes.size();
+    }
+
+    // Input should be UTF-8; switch to UTF-16 or UTF-32 if the file
+    // leads with a BOM, just as QTextStream's autodetection did
+    QString text;
+    const uchar *udata = reinterpret_cast<const uchar *>(data);
+    if (size >= 4 && ((udata[0] == 0xFF && udata[1] == 0xFE && udata[2] == 0x00 && udata[3] == 0x00) ||
+                      (udata[0] == 0x00 && udata[1] == 0x00 && udata[2] == 0xFE && udata[3] == 0xFF))) {
+        text = QTextCodec::codecForName("UTF-32")->toUnicode(data, static_cast<int>(size));
+    } else if (size >= 2 && ((udata[0] == 0xFE && udata[1] == 0xFF) ||
+                             (udata[0] == 0xFF && udata[1] == 0xFE))) {
+        text = QTextCodec::codecForName("UTF-16")->toUnicode(data, static_cast<int>(size));
+    } else if (size >= 3 && udata[0] == 0xEF && udata[1] == 0xBB && udata[2] == 0xBF) {
+        text = QString::fromUtf8(data + 3, static_cast<int>(size) - 3);
+    } else {
+        text = QString::fromUtf8(data, static_cast<int>(size));
+    }
+
+    if (mapped) {
+        file.unmap(mapped);
+    }
+    return ConvertLineEndings(text);
 }
 
 
@@ -560,6 +590,25 @@ void Utility::WriteUnicodeTextFile(const QString &text, const QString &fullfilep
 }
 
 
+// Writes the provided already utf-8 encoded bytes to the specified
+// file; if the file exists, it is truncated
+void Utility::WriteUTF8TextFile(const QByteArray &utf8text, const QString &fullfilepath)
+{
+    QFile file(fullfilepath);
+
+    if (!file.open(QIODevice::WriteOnly |
+                   QIODevice::Truncate  |
+                   QIODevice::Text
+                  )
+       ) {
+        std::string msg = file.fileName().toStdString() + ": " + file.errorString().toStdString();
+        throw(CannotOpenFile(msg));
+    }
+
+    file.write(utf8text);
+}
+
+
 // Converts Mac and Windows style line endings to Unix style
 // line endings that are expected throughout the Qt framework
 QString Utility::ConvertLineEndings(const QString &text)
@@ -569,23 +618,115 @@ QString Utility::ConvertLineEndings(const QString &text)
 }
 
 
-// Decodes XML escaped string to normal text                                                                                
+// Returns the length of the xml entity starting at data (which must
+// point at a '&') and its decoded character, or 0 if none of the five
+// xml entities starts there.
+static int MatchXMLEntity(const QChar *data, int remaining, QChar &decoded)
+{
+    struct Entity {
+        const char *name;
+        int         length;
+        char        character;
+    };
+    static const Entity entities[] = {
+        { "&amp;",  5, '&'  },
+        { "&lt;",   4, '<'  },
+        { "&gt;",   4, '>'  },
+        { "&quot;", 6, '"'  },
+        { "&apos;", 6, '\'' }
+    };
+
+    for (const Entity &entity : entities) {
+        if (remaining < entity.length) {
+            continue;
+        }
+        int i = 1;
+        while (i < entity.length && data[i] == QLatin1Char(entity.name[i])) {
+            i++;
+        }
+        if (i == entity.length) {
+            decoded = QLatin1Char(entity.character);
+            return entity.length;
+        }
+    }
+    return 0;
+}
+
+// Decodes XML escaped string to normal text
 // &amp; -> "&"    &apos; -> "'"  &quot; -> "\""   &lt; -> "<"  &gt; -> ">"
 QString Utility::DecodeXML(const QString &text)
 {
-    QString newtext(text);
-    newtext.replace("&apos;", "'");
-    newtext.replace("&quot;", "\"");
-    newtext.replace("&lt;", "<");
-    newtext.replace("&gt;", ">");
-    newtext.replace("&amp;", "&");
+    int amp = text.indexOf(QChar('&'));
+
+    // the common case of nothing to decode costs one scan and no copy
+    if (amp == -1) {
+        return text;
+    }
+
+    // a single pass replaces one replace() pass per entity: clean
+    // spans between entities are appended in bulk
+    QString newtext;
+    newtext.reserve(text.length());
+    const QChar *data = text.constData();
+    int copied = 0;
+
+    while (amp != -1) {
+        QChar decoded;
+        int entity_length = MatchXMLEntity(data + amp, text.length() - amp, decoded);
+
+        if (entity_length > 0) {
+            newtext.append(data + copied, amp - copied);
+            newtext.append(decoded);
+            copied = amp + entity_length;
+            amp = text.indexOf(QChar('&'), copied);
+        } else {
+            amp = text.indexOf(QChar('&'), amp + 1);
+        }
+    }
+
+    newtext.append(data + copied, text.length() - copied);
     return newtext;
 }
 
 QString Utility::EncodeXML(const QString &text)
 {
     QString newtext = Utility::DecodeXML(text);
-    return newtext.toHtmlEscaped();
+
+    // single-pass equivalent of toHtmlEscaped() that copies clean
+    // spans in bulk rather than appending character by character
+    const QChar *data = newtext.constData();
+    int n = newtext.length();
+    int first = 0;
+    while (first < n && data[first] != QLatin1Char('&') && data[first] != QLatin1Char('<') &&
+           data[first] != QLatin1Char('>') && data[first] != QLatin1Char('"')) {
+        first++;
+    }
+    if (first == n) {
+        return newtext;
+    }
+
+    QString encoded;
+    encoded.reserve(n + 8);
+    int copied = 0;
+    for (int i = first; i < n; i++) {
+        const char *replacement = 0;
+        if (data[i] == QLatin1Char('&')) {
+            replacement = "&amp;";
+        } else if (data[i] == QLatin1Char('<')) {
+            replacement = "&lt;";
+        } else if (data[i] == QLatin1Char('>')) {
+            replacement = "&gt;";
+        } else if (data[i] == QLatin1Char('"')) {
+            replacement = "&quot;";
+        }
+        if (replacement) {
+            encoded.append(data + copied, i - copied);
+            encoded.append(QLatin1String(replacement));
+            copied = i + 1;
+        }
+    }
+    encoded.append(data + copied, n - copied);
+    return encoded;
 }
 
 
@@ -1057,7 +1198,6 @@ QString Utility::resolveRelativeSegmentsInFilePath(const QString& file_path, con
 // Both paths should be cannonical
 QString Utility::relativePath(const QString & destination, const QString & start_dir)
 {
-    QString dest(destination);
     QString start(start_dir);
 
     // first handle the special case
@@ -1065,12 +1205,26 @@ QString Utility::relativePath(const QString & destination, const QString & start
 
     QChar sep = '/';
 
-    // remove any trailing path separators from both paths
-    while (dest.endsWith(sep)) dest.chop(1);
+    // remove any trailing path separators
     while (start.endsWith(sep)) start.chop(1);
 
+    return relativePath(destination, start.split(sep, QString::KeepEmptyParts));
+}
+
+
+QString Utility::relativePath(const QString &destination, const QStringList &start_segments)
+{
+    // first handle the special case of an empty starting directory
+    if (start_segments.isEmpty()) return destination;
+
+    QString dest(destination);
+    QChar sep = '/';
+
+    // remove any trailing path separators
+    while (dest.endsWith(sep)) dest.chop(1);
+
     QStringList dsegs = dest.split(sep, QString::KeepEmptyParts);
-    QStringList ssegs = start.split(sep, QString::KeepEmptyParts);
+    const QStringList &ssegs = start_segments;
     QStringList res;
     int i = 0;
     int nd = dsegs.size();
@@ -1122,6 +1276,15 @@ QString Utility::startingDir(const QString &file_bookpath)
     return start_dir;
 }
 
+
+QStringList Utility::startingDirSegments(const QString &file_bookpath)
+{
+    QString start = startingDir(file_bookpath);
+    if (start.isEmpty()) return QStringList();
+    while (start.endsWith('/')) start.chop(1);
+    return start.split('/', QString::KeepEmptyParts);
+}
+
 // This is the equivalent of Resource.cpp's GetRelativePathFromResource but using book paths
 QString Utility::buildRelativePath(const QString &from_file_bkpath, const QString & to_file_bkpath)
 {
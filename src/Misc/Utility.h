@@ -139,6 +139,12 @@ public:
     // file; if the file exists, it is truncated
     static void WriteUnicodeTextFile(const QString &text, const QString &fullfilepath);
 
+    // Writes already utf-8 encoded text to the specified file,
+    // with the same truncation and line ending behavior as
+    // WriteUnicodeTextFile, so callers holding cached bytes
+    // need not encode the text again
+    static void WriteUTF8TextFile(const QByteArray &utf8text, const QString &fullfilepath);
+
     // Converts Mac and Windows style line endings to Unix style
     // line endings that are expected throughout the Qt framework
     static QString ConvertLineEndings(const QString &text);
@@ -200,7 +206,15 @@ public:
 
     // Generate relative path to destination from starting directory path
     // Both paths should be absolute and preferably cannonical
-    static QString relativePath(const QString & destination, const QString & starting_dir); 
+    static QString relativePath(const QString & destination, const QString & starting_dir);
+
+    // batch variant for loops: the starting directory is split once by
+    // the caller (see startingDirSegments) and reused per destination
+    static QString relativePath(const QString &destination, const QStringList &start_segments);
+
+    // the starting directory of a file book path, pre-split for the
+    // batch relativePath variant above
+    static QStringList startingDirSegments(const QString &file_bookpath);
 
     // works with absolute or book paths
     static QString longestCommonPath(const QStringList& filepaths, const QString& sep);
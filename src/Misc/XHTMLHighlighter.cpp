@@ -164,8 +164,9 @@ void XHTMLHighlighter::highlightBlock(const QString &text)
         return;
     }
 
-    SettingsStore settings;
-    bool enableSpellCheck = settings.spellCheck();
+    // this runs once per block on every rehighlight, so the cached
+    // snapshot is read instead of going through QSettings
+    bool enableSpellCheck = SettingsStore::hotSettings().spell_check;
 
     // Run spell check over the text.
     if (enableSpellCheck && m_checkSpelling) {
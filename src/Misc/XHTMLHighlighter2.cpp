@@ -78,12 +78,19 @@ static const QString WHITESPACE = " \f\t\r\n";
 // Constructor
 XHTMLHighlighter2::XHTMLHighlighter2(bool checkSpelling, QObject *parent)
     : QSyntaxHighlighter(parent),
-      m_checkSpelling(checkSpelling)
+      m_checkSpelling(checkSpelling),
+      m_SpellingDeferred(false)
 
 {
     SetRules();
 }
 
+
+void XHTMLHighlighter2::SetSpellingDeferred(bool deferred)
+{
+    m_SpellingDeferred = deferred;
+}
+
 void XHTMLHighlighter2::SetRules()
 {
     m_Rules.clear();
@@ -139,13 +146,18 @@ void XHTMLHighlighter2::highlightBlock(const QString &text)
     int n = text.length();
     int start = 0;
     int pos = 0;
-    int nstate = -1;
+    // An empty block must pass the incoming state through unchanged:
+    // resetting it to text state cut comments, style blocks, and
+    // multi-line tags at every blank line, and made an edit above one
+    // look like a state change so the rehighlight cascade restarted
+    // below it instead of converging there.
+    int nstate = state;
     QChar ch;
 
     // Run spell check over the text if needed first.
-    SettingsStore settings;
-    bool enableSpellCheck = settings.spellCheck();
-    if (enableSpellCheck && m_checkSpelling) {
+    // Per-block path, so read the cached settings snapshot.
+    bool enableSpellCheck = SettingsStore::hotSettings().spell_check;
+    if (enableSpellCheck && m_checkSpelling && !m_SpellingDeferred) {
         CheckSpelling(text);
     }
 
@@ -425,7 +437,8 @@ void XHTMLHighlighter2::highlightBlock(const QString &text)
                             DBG qDebug() << " found a doctype";
                             nstate = State_DOCTYPE;
                         }
-                        else if (text.indexOf(RXCSSBegin, pos) == pos) {
+                        else if (RXCSSBegin.match(text, pos, QRegularExpression::NormalMatch,
+                                                  QRegularExpression::AnchoredMatchOption).hasMatch()) {
                             DBG qDebug() << " found a style";
                             nstate = State_CSSTagStart;
                         } else {
@@ -43,6 +43,13 @@ public:
 
     void SetRules();
 
+    // While deferred, highlightBlock() runs only the syntax state
+    // machine and skips the spell check, which is what makes a full
+    // document pass expensive.  The CodeViewEditor turns this on for
+    // bulk rehighlights and then spell checks the visible blocks
+    // right away and the rest in chunks from the event loop.
+    void SetSpellingDeferred(bool deferred);
+
 protected:
 
     // Overrides the function from QSyntaxHighlighter;
@@ -64,6 +71,9 @@ private:
     // Determine if spell check should be used on the document.
     bool m_checkSpelling;
 
+    // @see SetSpellingDeferred().
+    bool m_SpellingDeferred;
+
     SettingsStore::CodeViewAppearance m_codeViewAppearance;
 };
 
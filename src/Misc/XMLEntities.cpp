@@ -37,20 +37,14 @@ XMLEntities *XMLEntities::instance()
 
 QString XMLEntities::GetEntityName(ushort code)
 {
-    QString name;
-    if (m_EntityName.contains(code)) {
-        name = m_EntityName.value(code, QString());
-    }
-    return name;
+    // one hash probe - these run once per distinct character in the
+    // Reports character listing
+    return m_EntityName.value(code, QString());
 }
 
 QString XMLEntities::GetEntityDescription(ushort code)
 {
-    QString name;
-    if (m_EntityDescription.contains(code)) {
-        name = m_EntityDescription.value(code, QString());
-    }
-    return name;
+    return m_EntityDescription.value(code, QString());
 }
 
 ushort XMLEntities::GetEntityCode(const QString name)
@@ -73,9 +67,7 @@ ushort XMLEntities::GetEntityCode(const QString name)
                 code = rcode;
             }
         } else {
-            if (m_EntityCode.contains(root)) {
-                code = m_EntityCode.value(root, 0);
-            }
+            code = m_EntityCode.value(root, 0);
         }
     }
     return code;
@@ -1,2625 +0,0 @@
-/************************************************************************
-**
-**  Copyright (C) 2009, 2010, 2011  Strahinja Markovic  <strahinja.markovic@gmail.com>
-**
-**  This file is part of Sigil.
-**
-**  Sigil is free software: you can redistribute it and/or modify
-**  it under the terms of the GNU General Public License as published by
-**  the Free Software Foundation, either version 3 of the License, or
-**  (at your option) any later version.
-**
-**  Sigil is distributed in the hope that it will be useful,
-**  but WITHOUT ANY WARRANTY; without even the implied warranty of
-**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-**  GNU General Public License for more details.
-**
-**  You should have received a copy of the GNU General Public License
-**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
-**
-*************************************************************************/
-
-#include "sigil_constants.h"
-
-/*
-   Xtml DTD with entities only.
-
- */
-
-const char         *XHTML_ENTITIES_DTD_ID  = "http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd";
-const unsigned int  XHTML_ENTITIES_DTD_LEN = 31101;
-const unsigned char XHTML_ENTITIES_DTD[]   = {
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
-    0x65, 0x72, 0x20, 0x45, 0x6e, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20,
-    0x66, 0x6f, 0x72, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x0d, 0x0a, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6d,
-    0x6f, 0x64, 0x75, 0x6c, 0x65, 0x20, 0x64, 0x65, 0x63, 0x6c, 0x61, 0x72,
-    0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6f,
-    0x66, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20,
-    0x65, 0x6e, 0x74, 0x69, 0x74, 0x69, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72,
-    0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20,
-    0x74, 0x68, 0x65, 0x20, 0x4c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x31, 0x2c,
-    0x20, 0x53, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20,
-    0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x63, 0x68, 0x61, 0x72,
-    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x0d, 0x0a, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x25, 0x20, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x2d, 0x6c, 0x61, 0x74, 0x31,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43,
-    0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x49, 0x45, 0x53, 0x20, 0x4c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x31, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c,
-    0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x78, 0x68, 0x74, 0x6d, 0x6c,
-    0x2d, 0x6c, 0x61, 0x74, 0x31, 0x2e, 0x65, 0x6e, 0x74, 0x22, 0x20, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x50, 0x6f, 0x72, 0x74, 0x69,
-    0x6f, 0x6e, 0x73, 0x20, 0x28, 0x43, 0x29, 0x20, 0x49, 0x6e, 0x74, 0x65,
-    0x72, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x4f, 0x72,
-    0x67, 0x61, 0x6e, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66,
-    0x6f, 0x72, 0x20, 0x53, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x69,
-    0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x39, 0x38, 0x36, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x65, 0x72, 0x6d, 0x69, 0x73,
-    0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f, 0x70, 0x79,
-    0x20, 0x69, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x66, 0x6f, 0x72, 0x6d,
-    0x20, 0x69, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65, 0x64, 0x20,
-    0x66, 0x6f, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x66, 0x6f,
-    0x72, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x47, 0x4d, 0x4c, 0x20, 0x73,
-    0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61,
-    0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20,
-    0x61, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x69,
-    0x6e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x53, 0x4f, 0x20,
-    0x38, 0x38, 0x37, 0x39, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x76, 0x69, 0x64,
-    0x65, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x69,
-    0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
-    0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x63, 0x6f,
-    0x70, 0x69, 0x65, 0x73, 0x2e, 0x0d, 0x0a, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
-    0x65, 0x72, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x73, 0x65,
-    0x74, 0x2e, 0x20, 0x54, 0x79, 0x70, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x69,
-    0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x25, 0x20, 0x48, 0x54, 0x4d, 0x4c, 0x6c, 0x61, 0x74, 0x31, 0x20,
-    0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x49, 0x45, 0x53, 0x20, 0x4c, 0x61, 0x74,
-    0x69, 0x6e, 0x20, 0x31, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x58, 0x48, 0x54,
-    0x4d, 0x4c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f,
-    0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54,
-    0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44,
-    0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x2d, 0x6c, 0x61, 0x74, 0x31, 0x2e,
-    0x65, 0x6e, 0x74, 0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x25,
-    0x48, 0x54, 0x4d, 0x4c, 0x6c, 0x61, 0x74, 0x31, 0x3b, 0x0d, 0x0a, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x6e, 0x62, 0x73, 0x70, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x31, 0x36, 0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6e, 0x6f, 0x2d, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x20, 0x73, 0x70,
-    0x61, 0x63, 0x65, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x62, 0x72,
-    0x65, 0x61, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x41, 0x30, 0x20, 0x49, 0x53, 0x4f, 0x6e,
-    0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x69, 0x65, 0x78, 0x63, 0x6c, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x31, 0x36, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x74, 0x65, 0x64, 0x20,
-    0x65, 0x78, 0x63, 0x6c, 0x61, 0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-    0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x41, 0x31,
-    0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x63, 0x65,
-    0x6e, 0x74, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31, 0x36, 0x32, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x63, 0x65, 0x6e, 0x74,
-    0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x41,
-    0x32, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x70,
-    0x6f, 0x75, 0x6e, 0x64, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31, 0x36, 0x33,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x70, 0x6f, 0x75,
-    0x6e, 0x64, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x41, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x20, 0x22, 0x26, 0x23, 0x31,
-    0x36, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x63,
-    0x75, 0x72, 0x72, 0x65, 0x6e, 0x63, 0x79, 0x20, 0x73, 0x69, 0x67, 0x6e,
-    0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x41, 0x34, 0x20, 0x49, 0x53, 0x4f,
-    0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x79, 0x65, 0x6e, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x31, 0x36, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x79, 0x65, 0x6e, 0x20, 0x73, 0x69, 0x67, 0x6e,
-    0x20, 0x3d, 0x20, 0x79, 0x75, 0x61, 0x6e, 0x20, 0x73, 0x69, 0x67, 0x6e,
-    0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x41, 0x35, 0x20, 0x49, 0x53, 0x4f,
-    0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x62, 0x72, 0x76, 0x62, 0x61, 0x72,
-    0x20, 0x22, 0x26, 0x23, 0x31, 0x36, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x6e, 0x20, 0x62,
-    0x61, 0x72, 0x20, 0x3d, 0x20, 0x62, 0x72, 0x6f, 0x6b, 0x65, 0x6e, 0x20,
-    0x76, 0x65, 0x72, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x62, 0x61, 0x72,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x41, 0x36, 0x20, 0x49, 0x53, 0x4f, 0x6e,
-    0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x65, 0x63, 0x74, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x31, 0x36, 0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73,
-    0x69, 0x67, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x41, 0x37, 0x20,
-    0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x75, 0x6d, 0x6c,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31, 0x36, 0x38, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x64, 0x69, 0x61, 0x65, 0x72,
-    0x65, 0x73, 0x69, 0x73, 0x20, 0x3d, 0x20, 0x73, 0x70, 0x61, 0x63, 0x69,
-    0x6e, 0x67, 0x20, 0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x41, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x64,
-    0x69, 0x61, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x31, 0x36, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74,
-    0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x41,
-    0x39, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6f,
-    0x72, 0x64, 0x66, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31, 0x37, 0x30,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x66, 0x65, 0x6d,
-    0x69, 0x6e, 0x69, 0x6e, 0x65, 0x20, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61,
-    0x6c, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x2c,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x41, 0x41, 0x20, 0x49, 0x53, 0x4f, 0x6e,
-    0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x6c, 0x61, 0x71, 0x75, 0x6f, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x31, 0x37, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x70, 0x6f, 0x69, 0x6e,
-    0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20,
-    0x61, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74,
-    0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x65,
-    0x66, 0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20,
-    0x67, 0x75, 0x69, 0x6c, 0x6c, 0x65, 0x6d, 0x65, 0x74, 0x2c, 0x20, 0x55,
-    0x2b, 0x30, 0x30, 0x41, 0x42, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x31, 0x37, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20,
-    0x64, 0x69, 0x73, 0x63, 0x72, 0x65, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x72,
-    0x79, 0x20, 0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x41, 0x43, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x73, 0x68, 0x79, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31,
-    0x37, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73,
-    0x6f, 0x66, 0x74, 0x20, 0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x20, 0x3d,
-    0x20, 0x64, 0x69, 0x73, 0x63, 0x72, 0x65, 0x74, 0x69, 0x6f, 0x6e, 0x61,
-    0x72, 0x79, 0x20, 0x68, 0x79, 0x70, 0x68, 0x65, 0x6e, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x41, 0x44, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x72, 0x65, 0x67, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x31, 0x37, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x73,
-    0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74,
-    0x65, 0x72, 0x65, 0x64, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x6d,
-    0x61, 0x72, 0x6b, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x41, 0x45, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x6d, 0x61, 0x63, 0x72, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31,
-    0x37, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6d,
-    0x61, 0x63, 0x72, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x73, 0x70, 0x61, 0x63,
-    0x69, 0x6e, 0x67, 0x20, 0x6d, 0x61, 0x63, 0x72, 0x6f, 0x6e, 0x20, 0x3d,
-    0x20, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x69, 0x6e, 0x65, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x41,
-    0x50, 0x4c, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x62, 0x61, 0x72, 0x2c, 0x20,
-    0x55, 0x2b, 0x30, 0x30, 0x41, 0x46, 0x20, 0x49, 0x53, 0x4f, 0x64, 0x69,
-    0x61, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x64, 0x65, 0x67, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x31, 0x37, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x64, 0x65, 0x67, 0x72, 0x65, 0x65, 0x20, 0x73, 0x69, 0x67,
-    0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x30, 0x20, 0x49, 0x53,
-    0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x70, 0x6c, 0x75, 0x73, 0x6d,
-    0x6e, 0x20, 0x22, 0x26, 0x23, 0x31, 0x37, 0x37, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x70, 0x6c, 0x75, 0x73, 0x2d, 0x6d, 0x69,
-    0x6e, 0x75, 0x73, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20, 0x70,
-    0x6c, 0x75, 0x73, 0x2d, 0x6f, 0x72, 0x2d, 0x6d, 0x69, 0x6e, 0x75, 0x73,
-    0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x31,
-    0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x75,
-    0x70, 0x32, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31, 0x37, 0x38, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x75, 0x70, 0x65,
-    0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x74, 0x77, 0x6f, 0x20,
-    0x3d, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70,
-    0x74, 0x20, 0x64, 0x69, 0x67, 0x69, 0x74, 0x20, 0x74, 0x77, 0x6f, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d,
-    0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x64, 0x2c, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x42, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x73, 0x75, 0x70, 0x33, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x31, 0x37, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20,
-    0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x75, 0x70, 0x65,
-    0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x64, 0x69, 0x67, 0x69,
-    0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x62,
-    0x65, 0x64, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x33, 0x20, 0x49,
-    0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x61, 0x63, 0x75, 0x74,
-    0x65, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31, 0x38, 0x30, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 0x20,
-    0x61, 0x63, 0x63, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x73, 0x70, 0x61,
-    0x63, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x30, 0x30, 0x42, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x64, 0x69, 0x61,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x31, 0x38, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x6e,
-    0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x70, 0x61, 0x72, 0x61, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x31, 0x38, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x70, 0x69, 0x6c, 0x63, 0x72, 0x6f, 0x77, 0x20, 0x73,
-    0x69, 0x67, 0x6e, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x72, 0x61, 0x67, 0x72,
-    0x61, 0x70, 0x68, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x42, 0x36, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x6d, 0x69, 0x64, 0x64, 0x6f, 0x74, 0x20, 0x22, 0x26, 0x23, 0x31,
-    0x38, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6d,
-    0x69, 0x64, 0x64, 0x6c, 0x65, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x3d, 0x20,
-    0x47, 0x65, 0x6f, 0x72, 0x67, 0x69, 0x61, 0x6e, 0x20, 0x63, 0x6f, 0x6d,
-    0x6d, 0x61, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3d, 0x20, 0x47, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x6d, 0x69,
-    0x64, 0x64, 0x6c, 0x65, 0x20, 0x64, 0x6f, 0x74, 0x2c, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x42, 0x37, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x31, 0x38, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x20, 0x3d, 0x20, 0x73, 0x70,
-    0x61, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c,
-    0x61, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x38, 0x20, 0x49, 0x53,
-    0x4f, 0x64, 0x69, 0x61, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x75, 0x70, 0x31, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x31, 0x38, 0x35, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x73, 0x63,
-    0x72, 0x69, 0x70, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x73,
-    0x75, 0x70, 0x65, 0x72, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x64,
-    0x69, 0x67, 0x69, 0x74, 0x20, 0x6f, 0x6e, 0x65, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x42, 0x39, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x6f, 0x72, 0x64, 0x6d, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31,
-    0x38, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6d,
-    0x61, 0x73, 0x63, 0x75, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x6f, 0x72, 0x64,
-    0x69, 0x6e, 0x61, 0x6c, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74,
-    0x6f, 0x72, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x41, 0x20, 0x49, 0x53,
-    0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x72, 0x61, 0x71, 0x75, 0x6f,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x31, 0x38, 0x37, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x70,
-    0x6f, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x75, 0x62,
-    0x6c, 0x65, 0x20, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x71, 0x75, 0x6f,
-    0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d,
-    0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74,
-    0x69, 0x6e, 0x67, 0x20, 0x67, 0x75, 0x69, 0x6c, 0x6c, 0x65, 0x6d, 0x65,
-    0x74, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x42, 0x20, 0x49, 0x53,
-    0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x66, 0x72, 0x61, 0x63, 0x31,
-    0x34, 0x20, 0x22, 0x26, 0x23, 0x31, 0x38, 0x38, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x76, 0x75, 0x6c, 0x67, 0x61, 0x72, 0x20,
-    0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x6e, 0x65,
-    0x20, 0x71, 0x75, 0x61, 0x72, 0x74, 0x65, 0x72, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x72,
-    0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x71,
-    0x75, 0x61, 0x72, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30,
-    0x42, 0x43, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x66, 0x72, 0x61, 0x63, 0x31, 0x32, 0x20, 0x22, 0x26, 0x23, 0x31, 0x38,
-    0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x76, 0x75,
-    0x6c, 0x67, 0x61, 0x72, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x68, 0x61, 0x6c, 0x66, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
-    0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6f, 0x6e, 0x65,
-    0x20, 0x68, 0x61, 0x6c, 0x66, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42,
-    0x44, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x66,
-    0x72, 0x61, 0x63, 0x33, 0x34, 0x20, 0x22, 0x26, 0x23, 0x31, 0x39, 0x30,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x76, 0x75, 0x6c,
-    0x67, 0x61, 0x72, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-    0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x71, 0x75, 0x61, 0x72, 0x74,
-    0x65, 0x72, 0x73, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x74, 0x68, 0x72, 0x65, 0x65, 0x20, 0x71, 0x75, 0x61, 0x72,
-    0x74, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x45,
-    0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x69, 0x71,
-    0x75, 0x65, 0x73, 0x74, 0x20, 0x22, 0x26, 0x23, 0x31, 0x39, 0x31, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x69, 0x6e, 0x76, 0x65,
-    0x72, 0x74, 0x65, 0x64, 0x20, 0x71, 0x75, 0x65, 0x73, 0x74, 0x69, 0x6f,
-    0x6e, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x74, 0x75, 0x72, 0x6e,
-    0x65, 0x64, 0x20, 0x71, 0x75, 0x65, 0x73, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-    0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x46,
-    0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x41, 0x67,
-    0x72, 0x61, 0x76, 0x65, 0x20, 0x22, 0x26, 0x23, 0x31, 0x39, 0x32, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69,
-    0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x41, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-    0x67, 0x72, 0x61, 0x76, 0x65, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x20, 0x41, 0x20, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x55, 0x2b, 0x30, 0x30, 0x43, 0x30, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61,
-    0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x41, 0x61, 0x63, 0x75, 0x74, 0x65, 0x20,
-    0x22, 0x26, 0x23, 0x31, 0x39, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70,
-    0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
-    0x41, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x63, 0x75, 0x74, 0x65,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x43, 0x31, 0x20, 0x49, 0x53, 0x4f, 0x6c,
-    0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x41, 0x63, 0x69, 0x72, 0x63, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x31, 0x39, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61,
-    0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
-    0x20, 0x41, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x69, 0x72, 0x63,
-    0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x43,
-    0x32, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x41, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x20, 0x22, 0x26, 0x23, 0x31, 0x39,
-    0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61,
-    0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x41, 0x20, 0x77, 0x69, 0x74,
-    0x68, 0x20, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30,
-    0x43, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x41, 0x75, 0x6d, 0x6c, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x31,
-    0x39, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c,
-    0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c,
-    0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x41, 0x20, 0x77, 0x69,
-    0x74, 0x68, 0x20, 0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x43, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x6c,
-    0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x41, 0x72, 0x69, 0x6e, 0x67, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x31, 0x39, 0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61,
-    0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
-    0x20, 0x41, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x69, 0x6e, 0x67,
-    0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x61, 0x74, 0x69,
-    0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x41, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x2c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x55, 0x2b, 0x30, 0x30, 0x43, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61,
-    0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x41, 0x45, 0x6c, 0x69, 0x67, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x31, 0x39, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70,
-    0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
-    0x41, 0x45, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x3d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61,
-    0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x69, 0x67, 0x61, 0x74, 0x75,
-    0x72, 0x65, 0x20, 0x41, 0x45, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x43, 0x36,
-    0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x43,
-    0x63, 0x65, 0x64, 0x69, 0x6c, 0x20, 0x22, 0x26, 0x23, 0x31, 0x39, 0x39,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74,
-    0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x43, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x20, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x43, 0x37, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x45, 0x67, 0x72, 0x61, 0x76, 0x65, 0x20, 0x22, 0x26, 0x23,
-    0x32, 0x30, 0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61,
-    0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x45, 0x20, 0x77,
-    0x69, 0x74, 0x68, 0x20, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x43, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x45, 0x61, 0x63, 0x75, 0x74, 0x65, 0x20, 0x22, 0x26,
-    0x23, 0x32, 0x30, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74,
-    0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x45, 0x20,
-    0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x30, 0x30, 0x43, 0x39, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74,
-    0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x45, 0x63, 0x69, 0x72, 0x63, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x32, 0x30, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69,
-    0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x45,
-    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d,
-    0x66, 0x6c, 0x65, 0x78, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x43, 0x41, 0x20,
-    0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x45, 0x75,
-    0x6d, 0x6c, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x30, 0x33, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69,
-    0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x45, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-    0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x43, 0x42, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x49, 0x67, 0x72, 0x61, 0x76, 0x65, 0x20, 0x22, 0x26,
-    0x23, 0x32, 0x30, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74,
-    0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x49, 0x20,
-    0x77, 0x69, 0x74, 0x68, 0x20, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x30, 0x30, 0x43, 0x43, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74,
-    0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x49, 0x61, 0x63, 0x75, 0x74, 0x65, 0x20, 0x22,
-    0x26, 0x23, 0x32, 0x30, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69,
-    0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x49,
-    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x55, 0x2b, 0x30, 0x30, 0x43, 0x44, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61,
-    0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x49, 0x63, 0x69, 0x72, 0x63, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x32, 0x30, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70,
-    0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
-    0x49, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75,
-    0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x43, 0x45,
-    0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x49,
-    0x75, 0x6d, 0x6c, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x30, 0x37,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74,
-    0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x49, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x20, 0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x30, 0x30, 0x43, 0x46, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74,
-    0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x45, 0x54, 0x48, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x32, 0x30, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69,
-    0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x45,
-    0x54, 0x48, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x30, 0x20, 0x49,
-    0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4e, 0x74, 0x69,
-    0x6c, 0x64, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x30, 0x39, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x20, 0x4e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x31, 0x20,
-    0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4f, 0x67,
-    0x72, 0x61, 0x76, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x31, 0x30, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69,
-    0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x4f, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-    0x67, 0x72, 0x61, 0x76, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x32,
-    0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4f,
-    0x61, 0x63, 0x75, 0x74, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x31, 0x31,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74,
-    0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x4f, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44,
-    0x33, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x4f, 0x63, 0x69, 0x72, 0x63, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x31,
-    0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61,
-    0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x4f, 0x20, 0x77, 0x69, 0x74,
-    0x68, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x6c,
-    0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4f, 0x74, 0x69, 0x6c, 0x64, 0x65,
-    0x20, 0x22, 0x26, 0x23, 0x32, 0x31, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61,
-    0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
-    0x20, 0x4f, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x69, 0x6c, 0x64,
-    0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x35, 0x20, 0x49, 0x53, 0x4f,
-    0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4f, 0x75, 0x6d, 0x6c, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x31, 0x34, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63,
-    0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x4f, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x61,
-    0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44,
-    0x36, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x31,
-    0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6d, 0x75,
-    0x6c, 0x74, 0x69, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-    0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44,
-    0x37, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4f,
-    0x73, 0x6c, 0x61, 0x73, 0x68, 0x20, 0x22, 0x26, 0x23, 0x32, 0x31, 0x36,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74,
-    0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x4f, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x20, 0x73, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x61, 0x74,
-    0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x4f, 0x20, 0x73, 0x6c, 0x61, 0x73,
-    0x68, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x38, 0x20, 0x49, 0x53, 0x4f,
-    0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x55, 0x67, 0x72, 0x61, 0x76,
-    0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x31, 0x37, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63,
-    0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x55, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x67, 0x72, 0x61,
-    0x76, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x39, 0x20, 0x49, 0x53,
-    0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x55, 0x61, 0x63, 0x75,
-    0x74, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x31, 0x38, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20,
-    0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x55, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x41, 0x20, 0x49,
-    0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x55, 0x63, 0x69,
-    0x72, 0x63, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x31, 0x39, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x20, 0x55, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63,
-    0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x44, 0x42, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x55, 0x75, 0x6d, 0x6c, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x32, 0x32, 0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74,
-    0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x55, 0x20,
-    0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73,
-    0x69, 0x73, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x43, 0x20, 0x49, 0x53,
-    0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x59, 0x61, 0x63, 0x75,
-    0x74, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x32, 0x31, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20,
-    0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x59, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x44, 0x20, 0x49,
-    0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x54, 0x48, 0x4f,
-    0x52, 0x4e, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x32, 0x32, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x20, 0x54, 0x48, 0x4f, 0x52, 0x4e, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x44, 0x45, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x73, 0x7a, 0x6c, 0x69, 0x67, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x32, 0x32, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c,
-    0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x73, 0x68, 0x61, 0x72,
-    0x70, 0x20, 0x73, 0x20, 0x3d, 0x20, 0x65, 0x73, 0x73, 0x2d, 0x7a, 0x65,
-    0x64, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x44, 0x46, 0x20, 0x49, 0x53, 0x4f,
-    0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x61, 0x67, 0x72, 0x61, 0x76,
-    0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x32, 0x34, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73,
-    0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
-    0x61, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x67, 0x72, 0x61, 0x76, 0x65,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c,
-    0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x67,
-    0x72, 0x61, 0x76, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x45, 0x30, 0x20,
-    0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x61, 0x61,
-    0x63, 0x75, 0x74, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x32, 0x35, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69,
-    0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x61, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x45, 0x31, 0x20, 0x49,
-    0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x61, 0x63, 0x69,
-    0x72, 0x63, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x32, 0x36, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x61, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x69, 0x72,
-    0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30,
-    0x45, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x61, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32,
-    0x32, 0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c,
-    0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x20, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x45,
-    0x33, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x61, 0x75, 0x6d, 0x6c, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x32,
-    0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61,
-    0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-    0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x45, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x61, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x32, 0x32, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c,
-    0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20, 0x77, 0x69,
-    0x74, 0x68, 0x20, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x62, 0x6f, 0x76,
-    0x65, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x3d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61,
-    0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x61, 0x20,
-    0x72, 0x69, 0x6e, 0x67, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x45, 0x35, 0x20,
-    0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x61, 0x65,
-    0x6c, 0x69, 0x67, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x33, 0x30, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69,
-    0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x61, 0x65, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x69, 0x67, 0x61, 0x74,
-    0x75, 0x72, 0x65, 0x20, 0x61, 0x65, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30,
-    0x45, 0x36, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x63, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x20, 0x22, 0x26, 0x23, 0x32,
-    0x33, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c,
-    0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x63, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x20, 0x63, 0x65, 0x64, 0x69, 0x6c, 0x6c, 0x61, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x45, 0x37, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x65, 0x67, 0x72, 0x61, 0x76, 0x65, 0x20, 0x22, 0x26, 0x23,
-    0x32, 0x33, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x20, 0x77, 0x69, 0x74,
-    0x68, 0x20, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30,
-    0x45, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x65, 0x61, 0x63, 0x75, 0x74, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32,
-    0x33, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c,
-    0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x45,
-    0x39, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x65, 0x63, 0x69, 0x72, 0x63, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x33,
-    0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61,
-    0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-    0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x30, 0x30, 0x45, 0x41, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74,
-    0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x65, 0x75, 0x6d, 0x6c, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x32, 0x33, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c,
-    0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x20, 0x77,
-    0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73, 0x69,
-    0x73, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x45, 0x42, 0x20, 0x49, 0x53, 0x4f,
-    0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x69, 0x67, 0x72, 0x61, 0x76,
-    0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x33, 0x36, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73,
-    0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
-    0x69, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x67, 0x72, 0x61, 0x76, 0x65,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x45, 0x43, 0x20, 0x49, 0x53, 0x4f, 0x6c,
-    0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x69, 0x61, 0x63, 0x75, 0x74, 0x65,
-    0x20, 0x22, 0x26, 0x23, 0x32, 0x33, 0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d,
-    0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x69,
-    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x55, 0x2b, 0x30, 0x30, 0x45, 0x44, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61,
-    0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x69, 0x63, 0x69, 0x72, 0x63, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x32, 0x33, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61,
-    0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x69, 0x20,
-    0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66,
-    0x6c, 0x65, 0x78, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x45, 0x45, 0x20, 0x49,
-    0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x69, 0x75, 0x6d,
-    0x6c, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x33, 0x39, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x69, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x61,
-    0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x45,
-    0x46, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x65, 0x74, 0x68, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x34,
-    0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61,
-    0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x74, 0x68, 0x2c, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x46, 0x30, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x6e, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x20, 0x22, 0x26,
-    0x23, 0x32, 0x34, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c,
-    0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x6e, 0x20, 0x77, 0x69,
-    0x74, 0x68, 0x20, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x46, 0x31, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x6f, 0x67, 0x72, 0x61, 0x76, 0x65, 0x20, 0x22, 0x26, 0x23,
-    0x32, 0x34, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x20, 0x77, 0x69, 0x74,
-    0x68, 0x20, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30,
-    0x46, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x6f, 0x61, 0x63, 0x75, 0x74, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32,
-    0x34, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c,
-    0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x46,
-    0x33, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x6f, 0x63, 0x69, 0x72, 0x63, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x34,
-    0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61,
-    0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-    0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x30, 0x30, 0x46, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74,
-    0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x6f, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x20, 0x22,
-    0x26, 0x23, 0x32, 0x34, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c,
-    0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x20, 0x77,
-    0x69, 0x74, 0x68, 0x20, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x46, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x6f, 0x75, 0x6d, 0x6c, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x32, 0x34, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c,
-    0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x20, 0x77, 0x69,
-    0x74, 0x68, 0x20, 0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x46, 0x36, 0x20, 0x49, 0x53, 0x4f, 0x6c,
-    0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64, 0x65,
-    0x20, 0x22, 0x26, 0x23, 0x32, 0x34, 0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x64, 0x69, 0x76, 0x69, 0x73, 0x69, 0x6f, 0x6e,
-    0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x46,
-    0x37, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6f,
-    0x73, 0x6c, 0x61, 0x73, 0x68, 0x20, 0x22, 0x26, 0x23, 0x32, 0x34, 0x38,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74,
-    0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x20, 0x6f, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x73,
-    0x74, 0x72, 0x6f, 0x6b, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x61, 0x74, 0x69,
-    0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x6f, 0x20, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x30, 0x30, 0x46, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74,
-    0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x75, 0x67, 0x72, 0x61, 0x76, 0x65, 0x20, 0x22,
-    0x26, 0x23, 0x32, 0x34, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c,
-    0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x75, 0x20, 0x77,
-    0x69, 0x74, 0x68, 0x20, 0x67, 0x72, 0x61, 0x76, 0x65, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x46, 0x39, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x75, 0x61, 0x63, 0x75, 0x74, 0x65, 0x20, 0x22, 0x26,
-    0x23, 0x32, 0x35, 0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c,
-    0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x75, 0x20, 0x77, 0x69,
-    0x74, 0x68, 0x20, 0x61, 0x63, 0x75, 0x74, 0x65, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x46, 0x41, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x75, 0x63, 0x69, 0x72, 0x63, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x32, 0x35, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x75, 0x20, 0x77, 0x69, 0x74,
-    0x68, 0x20, 0x63, 0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x46, 0x42, 0x20, 0x49, 0x53, 0x4f, 0x6c,
-    0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x75, 0x75, 0x6d, 0x6c, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x32, 0x35, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d,
-    0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x75,
-    0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x61, 0x65, 0x72, 0x65,
-    0x73, 0x69, 0x73, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x46, 0x43, 0x20, 0x49,
-    0x53, 0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x79, 0x61, 0x63,
-    0x75, 0x74, 0x65, 0x20, 0x22, 0x26, 0x23, 0x32, 0x35, 0x33, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x79, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x63, 0x75,
-    0x74, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x46, 0x44, 0x20, 0x49, 0x53,
-    0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x74, 0x68, 0x6f, 0x72,
-    0x6e, 0x20, 0x20, 0x22, 0x26, 0x23, 0x32, 0x35, 0x34, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20,
-    0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
-    0x20, 0x74, 0x68, 0x6f, 0x72, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x2c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x55, 0x2b, 0x30, 0x30, 0x46, 0x45, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61,
-    0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x79, 0x75, 0x6d, 0x6c, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x32, 0x35, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61,
-    0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x79, 0x20,
-    0x77, 0x69, 0x74, 0x68, 0x20, 0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73,
-    0x69, 0x73, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x46, 0x46, 0x20, 0x49, 0x53,
-    0x4f, 0x6c, 0x61, 0x74, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d,
-    0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x25, 0x20, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x2d, 0x73, 0x79, 0x6d, 0x62,
-    0x6f, 0x6c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x55, 0x42, 0x4c,
-    0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f, 0x2f,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x49, 0x45, 0x53, 0x20, 0x53, 0x79, 0x6d,
-    0x62, 0x6f, 0x6c, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x58, 0x48, 0x54,
-    0x4d, 0x4c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x78, 0x68, 0x74,
-    0x6d, 0x6c, 0x2d, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x2e, 0x65, 0x6e,
-    0x74, 0x22, 0x20, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x4d,
-    0x61, 0x74, 0x68, 0x65, 0x6d, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x2c,
-    0x20, 0x47, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x53,
-    0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x69, 0x63, 0x20, 0x63, 0x68, 0x61, 0x72,
-    0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x48,
-    0x54, 0x4d, 0x4c, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x43, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65,
-    0x72, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x73, 0x65, 0x74,
-    0x2e, 0x20, 0x54, 0x79, 0x70, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x69, 0x6e,
-    0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x25, 0x20, 0x48, 0x54, 0x4d, 0x4c, 0x73, 0x79, 0x6d, 0x62, 0x6f,
-    0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33,
-    0x43, 0x2f, 0x2f, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x49, 0x45, 0x53, 0x20,
-    0x53, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20,
-    0x58, 0x48, 0x54, 0x4d, 0x4c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68, 0x74, 0x74,
-    0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33, 0x2e, 0x6f,
-    0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x31,
-    0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x2d, 0x73,
-    0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x2e, 0x65, 0x6e, 0x74, 0x22, 0x3e, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x25, 0x48, 0x54, 0x4d, 0x4c, 0x73,
-    0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x3b, 0x0d, 0x0a, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x50, 0x6f, 0x72, 0x74,
-    0x69, 0x6f, 0x6e, 0x73, 0x20, 0x28, 0x43, 0x29, 0x20, 0x49, 0x6e, 0x74,
-    0x65, 0x72, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x4f,
-    0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-    0x66, 0x6f, 0x72, 0x20, 0x53, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64,
-    0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x39, 0x38, 0x36,
-    0x3a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50, 0x65, 0x72, 0x6d,
-    0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x6f,
-    0x70, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x66, 0x6f,
-    0x72, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x67, 0x72, 0x61, 0x6e, 0x74, 0x65,
-    0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x75, 0x73, 0x65, 0x20, 0x77, 0x69,
-    0x74, 0x68, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
-    0x66, 0x6f, 0x72, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x53, 0x47, 0x4d, 0x4c,
-    0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73, 0x20, 0x61, 0x6e, 0x64,
-    0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-    0x73, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
-    0x20, 0x69, 0x6e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x53,
-    0x4f, 0x20, 0x38, 0x38, 0x37, 0x39, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x76,
-    0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6e, 0x6f,
-    0x74, 0x69, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20, 0x69, 0x6e, 0x63, 0x6c,
-    0x75, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6c, 0x6c, 0x20,
-    0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x2e, 0x0d, 0x0a, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x52, 0x65, 0x6c,
-    0x65, 0x76, 0x61, 0x6e, 0x74, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x65, 0x6e,
-    0x74, 0x69, 0x74, 0x79, 0x20, 0x73, 0x65, 0x74, 0x20, 0x69, 0x73, 0x20,
-    0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73,
-    0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e,
-    0x65, 0x77, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x74, 0x72, 0x6f, 0x64, 0x75,
-    0x63, 0x65, 0x64, 0x2e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4e,
-    0x65, 0x77, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x28, 0x69, 0x2e,
-    0x65, 0x2e, 0x2c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x49,
-    0x53, 0x4f, 0x20, 0x38, 0x38, 0x37, 0x39, 0x20, 0x6c, 0x69, 0x73, 0x74,
-    0x29, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x63, 0x6c, 0x61,
-    0x73, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x6e, 0x79, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x69,
-    0x6e, 0x67, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x38, 0x38, 0x37, 0x39, 0x20,
-    0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73,
-    0x2e, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x31, 0x30, 0x36, 0x34, 0x36, 0x20,
-    0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x6e, 0x75,
-    0x6d, 0x62, 0x65, 0x72, 0x73, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x61, 0x72, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x66, 0x6f,
-    0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61,
-    0x63, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x68, 0x65, 0x78,
-    0x2e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65,
-    0x20, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f,
-    0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x49, 0x53,
-    0x4f, 0x20, 0x31, 0x30, 0x36, 0x34, 0x36, 0x20, 0x76, 0x61, 0x6c, 0x75,
-    0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72, 0x65, 0x66, 0x65, 0x72,
-    0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x6f, 0x63, 0x75,
-    0x6d, 0x65, 0x6e, 0x74, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x73, 0x65, 0x74,
-    0x2e, 0x20, 0x4e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
-    0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65,
-    0x73, 0x2e, 0x20, 0x0d, 0x0a, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x4c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x45,
-    0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x2d, 0x42, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x66, 0x6e, 0x6f, 0x66, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x34, 0x30, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20,
-    0x66, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68, 0x6f, 0x6f, 0x6b, 0x20,
-    0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x72, 0x69, 0x6e, 0x2c, 0x20, 0x55, 0x2b,
-    0x30, 0x31, 0x39, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x47, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x41, 0x6c, 0x70,
-    0x68, 0x61, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x31, 0x33,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65,
-    0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x2c,
-    0x20, 0x55, 0x2b, 0x30, 0x33, 0x39, 0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x42, 0x65,
-    0x74, 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x31,
-    0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72,
-    0x65, 0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x62, 0x65, 0x74, 0x61, 0x2c,
-    0x20, 0x55, 0x2b, 0x30, 0x33, 0x39, 0x32, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x47, 0x61,
-    0x6d, 0x6d, 0x61, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x31,
-    0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72,
-    0x65, 0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x67, 0x61, 0x6d, 0x6d, 0x61,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x39, 0x33, 0x20, 0x49, 0x53,
-    0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x44, 0x65, 0x6c, 0x74,
-    0x61, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x31, 0x36, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65,
-    0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x33, 0x39, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x67,
-    0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x45, 0x70, 0x73, 0x69, 0x6c, 0x6f,
-    0x6e, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x31, 0x37, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20,
-    0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x65, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x2c, 0x20,
-    0x55, 0x2b, 0x30, 0x33, 0x39, 0x35, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x5a, 0x65, 0x74,
-    0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x31, 0x38,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65,
-    0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x7a, 0x65, 0x74, 0x61, 0x2c, 0x20,
-    0x55, 0x2b, 0x30, 0x33, 0x39, 0x36, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x45, 0x74, 0x61,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x31, 0x39,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65,
-    0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x74, 0x61, 0x2c, 0x20, 0x55,
-    0x2b, 0x30, 0x33, 0x39, 0x37, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x54, 0x68, 0x65, 0x74,
-    0x61, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x32, 0x30, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65,
-    0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x74, 0x61, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x33, 0x39, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x67,
-    0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x49, 0x6f, 0x74, 0x61, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x32, 0x31, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20,
-    0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x69, 0x6f, 0x74, 0x61, 0x2c, 0x20, 0x55, 0x2b, 0x30,
-    0x33, 0x39, 0x39, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4b, 0x61, 0x70, 0x70, 0x61, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x32, 0x32, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20,
-    0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x6b, 0x61, 0x70, 0x70, 0x61, 0x2c, 0x20, 0x55, 0x2b,
-    0x30, 0x33, 0x39, 0x41, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4c, 0x61, 0x6d, 0x62, 0x64,
-    0x61, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x32, 0x33, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b,
-    0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x20, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x33, 0x39, 0x42, 0x20, 0x49, 0x53, 0x4f, 0x67,
-    0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4d, 0x75, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x32, 0x34, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20,
-    0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x6d, 0x75, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x39,
-    0x43, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x4e, 0x75, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x39, 0x32, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x63, 0x61,
-    0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
-    0x20, 0x6e, 0x75, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x39, 0x44, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x58, 0x69, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x39, 0x32, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69,
-    0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x78,
-    0x69, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x39, 0x45, 0x20, 0x49, 0x53,
-    0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x4f, 0x6d, 0x69, 0x63,
-    0x72, 0x6f, 0x6e, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x32, 0x37, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65,
-    0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e,
-    0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x39, 0x46, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x50,
-    0x69, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39,
-    0x32, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67,
-    0x72, 0x65, 0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c,
-    0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x70, 0x69, 0x2c, 0x20,
-    0x55, 0x2b, 0x30, 0x33, 0x41, 0x30, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72,
-    0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x52, 0x68, 0x6f, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x32, 0x39, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x63,
-    0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x72, 0x68, 0x6f, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x41,
-    0x31, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x20,
-    0x53, 0x69, 0x67, 0x6d, 0x61, 0x66, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20,
-    0x6e, 0x6f, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x41, 0x32, 0x20, 0x63, 0x68,
-    0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x65, 0x69, 0x74, 0x68,
-    0x65, 0x72, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x53, 0x69, 0x67, 0x6d, 0x61, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x33, 0x31, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x63,
-    0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x33, 0x41, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x54, 0x61, 0x75, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x39, 0x33, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x63, 0x61, 0x70,
-    0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
-    0x74, 0x61, 0x75, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x41, 0x34, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x55, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x39, 0x33, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69,
-    0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x75,
-    0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30,
-    0x33, 0x41, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x50, 0x68, 0x69, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x39, 0x33, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69,
-    0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x70,
-    0x68, 0x69, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x41, 0x36, 0x20,
-    0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x43, 0x68,
-    0x69, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x33,
-    0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72,
-    0x65, 0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x63, 0x68, 0x69, 0x2c, 0x20,
-    0x55, 0x2b, 0x30, 0x33, 0x41, 0x37, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x50, 0x73, 0x69,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x33, 0x36,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65,
-    0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x70, 0x73, 0x69, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x55, 0x2b, 0x30, 0x33, 0x41, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72,
-    0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x4f, 0x6d, 0x65, 0x67, 0x61, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x33, 0x37, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x63,
-    0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x33, 0x41, 0x39, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x34, 0x35, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73,
-    0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
-    0x61, 0x6c, 0x70, 0x68, 0x61, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x33,
-    0x42, 0x31, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x62, 0x65, 0x74, 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x39, 0x34, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c,
-    0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x62, 0x65, 0x74, 0x61,
-    0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x42, 0x32, 0x20, 0x49, 0x53, 0x4f,
-    0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x67, 0x61, 0x6d, 0x6d, 0x61,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x34, 0x37, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b,
-    0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x67, 0x61, 0x6d, 0x6d, 0x61, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x33, 0x42, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x64, 0x65, 0x6c, 0x74, 0x61, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x39, 0x34, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61,
-    0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x64, 0x65,
-    0x6c, 0x74, 0x61, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x42, 0x34,
-    0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x65,
-    0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39,
-    0x34, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67,
-    0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x70, 0x73, 0x69, 0x6c, 0x6f,
-    0x6e, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x42, 0x35, 0x20, 0x49,
-    0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x7a, 0x65, 0x74,
-    0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x35, 0x30,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65,
-    0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x20, 0x7a, 0x65, 0x74, 0x61, 0x2c, 0x20, 0x55, 0x2b,
-    0x30, 0x33, 0x42, 0x36, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x65, 0x74, 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x39, 0x35, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61,
-    0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x65, 0x74,
-    0x61, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x42, 0x37, 0x20, 0x49, 0x53,
-    0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x74, 0x68, 0x65, 0x74,
-    0x61, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x35, 0x32, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65,
-    0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x74, 0x61, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x30, 0x33, 0x42, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b,
-    0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x69, 0x6f, 0x74, 0x61, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x39, 0x35, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d,
-    0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x69,
-    0x6f, 0x74, 0x61, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x42, 0x39, 0x20,
-    0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6b, 0x61,
-    0x70, 0x70, 0x61, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x35,
-    0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72,
-    0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x20, 0x6b, 0x61, 0x70, 0x70, 0x61, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x33, 0x42, 0x41, 0x20, 0x49, 0x53, 0x4f, 0x67,
-    0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x35, 0x35, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20,
-    0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
-    0x20, 0x6c, 0x61, 0x6d, 0x62, 0x64, 0x61, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x33, 0x42, 0x42, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x6d, 0x75, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x39, 0x35, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61,
-    0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x75,
-    0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x42, 0x43, 0x20, 0x49, 0x53, 0x4f,
-    0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6e, 0x75, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x35, 0x37, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b,
-    0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x6e, 0x75, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x42, 0x44,
-    0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x78,
-    0x69, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39,
-    0x35, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67,
-    0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x78, 0x69, 0x2c, 0x20, 0x55, 0x2b,
-    0x30, 0x33, 0x42, 0x45, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x6f, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x6e, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x39, 0x35, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61,
-    0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x6f, 0x6d,
-    0x69, 0x63, 0x72, 0x6f, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x42,
-    0x46, 0x20, 0x4e, 0x45, 0x57, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x70, 0x69, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x36, 0x30, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65,
-    0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x70, 0x69, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x43,
-    0x30, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x72, 0x68, 0x6f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x39, 0x36, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x72, 0x68, 0x6f, 0x2c, 0x20,
-    0x55, 0x2b, 0x30, 0x33, 0x43, 0x31, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72,
-    0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x66, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x36, 0x32, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73,
-    0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
-    0x66, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x2c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x43, 0x32, 0x20, 0x49, 0x53, 0x4f,
-    0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x69, 0x67, 0x6d, 0x61,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x36, 0x33, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b,
-    0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x73, 0x69, 0x67, 0x6d, 0x61, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x30, 0x33, 0x43, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x74, 0x61, 0x75, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x39, 0x36, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61,
-    0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x74, 0x61,
-    0x75, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x43, 0x34, 0x20, 0x49, 0x53,
-    0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x75, 0x70, 0x73, 0x69,
-    0x6c, 0x6f, 0x6e, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x36, 0x35, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65,
-    0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74,
-    0x65, 0x72, 0x20, 0x75, 0x70, 0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x33, 0x43, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x67,
-    0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x70, 0x68, 0x69, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x36, 0x36, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20,
-    0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
-    0x20, 0x70, 0x68, 0x69, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x43, 0x36,
-    0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x63,
-    0x68, 0x69, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39,
-    0x36, 0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67,
-    0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x63, 0x68, 0x69, 0x2c, 0x20, 0x55,
-    0x2b, 0x30, 0x33, 0x43, 0x37, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b,
-    0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x70, 0x73, 0x69, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x39, 0x36, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73, 0x6d,
-    0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x70,
-    0x73, 0x69, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x43, 0x38, 0x20, 0x49,
-    0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6f, 0x6d, 0x65,
-    0x67, 0x61, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x36, 0x39,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65,
-    0x65, 0x6b, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x20, 0x6f, 0x6d, 0x65, 0x67, 0x61, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x55, 0x2b, 0x30, 0x33, 0x43, 0x39, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72,
-    0x6b, 0x33, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x74, 0x68, 0x65, 0x74, 0x61, 0x73, 0x79,
-    0x6d, 0x20, 0x22, 0x26, 0x23, 0x39, 0x37, 0x37, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x73,
-    0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20,
-    0x74, 0x68, 0x65, 0x74, 0x61, 0x20, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x44, 0x31, 0x20, 0x4e, 0x45,
-    0x57, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x75, 0x70, 0x73, 0x69, 0x68, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x39, 0x37, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x75, 0x70,
-    0x73, 0x69, 0x6c, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68,
-    0x6f, 0x6f, 0x6b, 0x20, 0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x33, 0x44, 0x32, 0x20, 0x4e, 0x45, 0x57, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x70, 0x69, 0x76, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x39, 0x38, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x70, 0x69, 0x20, 0x73,
-    0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x44,
-    0x36, 0x20, 0x49, 0x53, 0x4f, 0x67, 0x72, 0x6b, 0x33, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x47, 0x65,
-    0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x6e, 0x63, 0x74, 0x75,
-    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x62, 0x75, 0x6c, 0x6c,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x32, 0x36,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x62, 0x75, 0x6c,
-    0x6c, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x20,
-    0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x32, 0x32, 0x20, 0x49,
-    0x53, 0x4f, 0x70, 0x75, 0x62, 0x20, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x62, 0x75, 0x6c, 0x6c, 0x65, 0x74, 0x20,
-    0x69, 0x73, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
-    0x61, 0x6d, 0x65, 0x20, 0x61, 0x73, 0x20, 0x62, 0x75, 0x6c, 0x6c, 0x65,
-    0x74, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x2c, 0x20,
-    0x55, 0x2b, 0x32, 0x32, 0x31, 0x39, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x68, 0x65, 0x6c,
-    0x6c, 0x69, 0x70, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x33,
-    0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x68, 0x6f,
-    0x72, 0x69, 0x7a, 0x6f, 0x6e, 0x74, 0x61, 0x6c, 0x20, 0x65, 0x6c, 0x6c,
-    0x69, 0x70, 0x73, 0x69, 0x73, 0x20, 0x3d, 0x20, 0x74, 0x68, 0x72, 0x65,
-    0x65, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x6c, 0x65, 0x61, 0x64, 0x65, 0x72,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x32, 0x36, 0x20, 0x49,
-    0x53, 0x4f, 0x70, 0x75, 0x62, 0x20, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x70, 0x72, 0x69,
-    0x6d, 0x65, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x34,
-    0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x70, 0x72,
-    0x69, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x75, 0x74, 0x65,
-    0x73, 0x20, 0x3d, 0x20, 0x66, 0x65, 0x65, 0x74, 0x2c, 0x20, 0x55, 0x2b,
-    0x32, 0x30, 0x33, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x50, 0x72, 0x69, 0x6d, 0x65, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x38, 0x32, 0x34, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x70,
-    0x72, 0x69, 0x6d, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x63, 0x6f, 0x6e,
-    0x64, 0x73, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x63, 0x68, 0x65, 0x73, 0x2c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x33, 0x33, 0x20, 0x49, 0x53,
-    0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6f, 0x6c, 0x69, 0x6e,
-    0x65, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x35, 0x34,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6f, 0x76, 0x65,
-    0x72, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x70, 0x61, 0x63,
-    0x69, 0x6e, 0x67, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x73, 0x63, 0x6f, 0x72,
-    0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x33, 0x45, 0x20,
-    0x4e, 0x45, 0x57, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x66, 0x72, 0x61, 0x73, 0x6c, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x36, 0x30, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x66, 0x72, 0x61, 0x63, 0x74,
-    0x69, 0x6f, 0x6e, 0x20, 0x73, 0x6c, 0x61, 0x73, 0x68, 0x2c, 0x20, 0x55,
-    0x2b, 0x32, 0x30, 0x34, 0x34, 0x20, 0x4e, 0x45, 0x57, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x4c, 0x65,
-    0x74, 0x74, 0x65, 0x72, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x53, 0x79, 0x6d,
-    0x62, 0x6f, 0x6c, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x77, 0x65, 0x69, 0x65, 0x72,
-    0x70, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x34, 0x37, 0x32, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x63, 0x72, 0x69,
-    0x70, 0x74, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x50,
-    0x20, 0x3d, 0x20, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x73, 0x65, 0x74,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x3d, 0x20, 0x57, 0x65, 0x69, 0x65, 0x72, 0x73, 0x74,
-    0x72, 0x61, 0x73, 0x73, 0x20, 0x70, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x31,
-    0x31, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x6f, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x34, 0x36, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x49, 0x20,
-    0x3d, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x69, 0x6e, 0x61, 0x72, 0x79, 0x20,
-    0x70, 0x61, 0x72, 0x74, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x31,
-    0x31, 0x31, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x6f, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x72, 0x65, 0x61, 0x6c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x34, 0x37, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x52, 0x20,
-    0x3d, 0x20, 0x72, 0x65, 0x61, 0x6c, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20,
-    0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x32, 0x31, 0x31, 0x43, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x6f,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x38, 0x34, 0x38, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x74, 0x72, 0x61, 0x64, 0x65, 0x20, 0x6d, 0x61,
-    0x72, 0x6b, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x32,
-    0x31, 0x32, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x61, 0x6c, 0x65, 0x66, 0x73, 0x79, 0x6d, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x35, 0x30, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x61, 0x6c, 0x65, 0x66, 0x20, 0x73, 0x79, 0x6d, 0x62, 0x6f,
-    0x6c, 0x20, 0x3d, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x74, 0x72,
-    0x61, 0x6e, 0x73, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x65, 0x20, 0x63, 0x61,
-    0x72, 0x64, 0x69, 0x6e, 0x61, 0x6c, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x32, 0x31, 0x33, 0x35, 0x20, 0x4e, 0x45, 0x57, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x61, 0x6c, 0x65, 0x66, 0x20,
-    0x73, 0x79, 0x6d, 0x62, 0x6f, 0x6c, 0x20, 0x69, 0x73, 0x20, 0x4e, 0x4f,
-    0x54, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x61,
-    0x73, 0x20, 0x68, 0x65, 0x62, 0x72, 0x65, 0x77, 0x20, 0x6c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x20, 0x61, 0x6c, 0x65, 0x66, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x35, 0x44, 0x30, 0x20, 0x61,
-    0x6c, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x73, 0x61, 0x6d, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x63,
-    0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64,
-    0x20, 0x74, 0x6f, 0x20, 0x64, 0x65, 0x70, 0x69, 0x63, 0x74, 0x20, 0x62,
-    0x6f, 0x74, 0x68, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65,
-    0x72, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x41, 0x72, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x6c, 0x61, 0x72, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x38, 0x35, 0x39, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x65, 0x66, 0x74, 0x77, 0x61, 0x72, 0x64, 0x73, 0x20, 0x61,
-    0x72, 0x72, 0x6f, 0x77, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x31, 0x39, 0x30,
-    0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x75, 0x61,
-    0x72, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x35,
-    0x39, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x75,
-    0x70, 0x77, 0x61, 0x72, 0x64, 0x73, 0x20, 0x61, 0x72, 0x72, 0x6f, 0x77,
-    0x2c, 0x20, 0x55, 0x2b, 0x32, 0x31, 0x39, 0x31, 0x20, 0x49, 0x53, 0x4f,
-    0x6e, 0x75, 0x6d, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x72, 0x61, 0x72, 0x72, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x35, 0x39, 0x34, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x77,
-    0x61, 0x72, 0x64, 0x73, 0x20, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2c, 0x20,
-    0x55, 0x2b, 0x32, 0x31, 0x39, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75,
-    0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x64, 0x61, 0x72, 0x72, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x38, 0x35, 0x39, 0x35, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x77, 0x61, 0x72,
-    0x64, 0x73, 0x20, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2c, 0x20, 0x55, 0x2b,
-    0x32, 0x31, 0x39, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x68, 0x61, 0x72, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x35, 0x39, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x72, 0x69, 0x67, 0x68,
-    0x74, 0x20, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2c, 0x20, 0x55, 0x2b, 0x32,
-    0x31, 0x39, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x61, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x63, 0x72, 0x61, 0x72, 0x72, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x36, 0x32, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x77, 0x61, 0x72, 0x64, 0x73,
-    0x20, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-    0x63, 0x6f, 0x72, 0x6e, 0x65, 0x72, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x77,
-    0x61, 0x72, 0x64, 0x73, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x63, 0x61, 0x72,
-    0x72, 0x69, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-    0x2c, 0x20, 0x55, 0x2b, 0x32, 0x31, 0x42, 0x35, 0x20, 0x4e, 0x45, 0x57,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x6c, 0x41, 0x72, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x38, 0x36, 0x35, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x77, 0x61, 0x72, 0x64,
-    0x73, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x72, 0x72,
-    0x6f, 0x77, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x31, 0x44, 0x30, 0x20, 0x49,
-    0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65,
-    0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73, 0x61,
-    0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6c, 0x41, 0x72, 0x72, 0x20,
-    0x69, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20,
-    0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x27, 0x69, 0x73, 0x20, 0x69,
-    0x6d, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x27, 0x20, 0x61,
-    0x72, 0x72, 0x6f, 0x77, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x75,
-    0x74, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20,
-    0x6e, 0x6f, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x79,
-    0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61,
-    0x63, 0x74, 0x65, 0x72, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x61,
-    0x74, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x20,
-    0x53, 0x6f, 0x20, 0x3f, 0x20, 0x6c, 0x41, 0x72, 0x72, 0x20, 0x63, 0x61,
-    0x6e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73,
-    0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x27, 0x69, 0x73, 0x20, 0x69,
-    0x6d, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79, 0x27, 0x20, 0x61,
-    0x73, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x73, 0x75,
-    0x67, 0x67, 0x65, 0x73, 0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x75, 0x41, 0x72,
-    0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x36, 0x35,
-    0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x75, 0x70,
-    0x77, 0x61, 0x72, 0x64, 0x73, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65,
-    0x20, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x31,
-    0x44, 0x31, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x61, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x72, 0x41, 0x72, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x36, 0x35, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x77, 0x61, 0x72, 0x64, 0x73,
-    0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x72, 0x72, 0x6f,
-    0x77, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x31, 0x44, 0x32, 0x20,
-    0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64,
-    0x65, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73,
-    0x61, 0x79, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x74,
-    0x68, 0x65, 0x20, 0x27, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65, 0x73, 0x27,
-    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x62,
-    0x75, 0x74, 0x20, 0x64, 0x6f, 0x65, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-    0x68, 0x61, 0x76, 0x65, 0x20, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x61, 0x6e, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63, 0x68, 0x61, 0x72,
-    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74,
-    0x68, 0x69, 0x73, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-    0x20, 0x73, 0x6f, 0x20, 0x3f, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x72, 0x41, 0x72, 0x72, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x62, 0x65, 0x20,
-    0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x27, 0x69, 0x6d,
-    0x70, 0x6c, 0x69, 0x65, 0x73, 0x27, 0x20, 0x61, 0x73, 0x20, 0x49, 0x53,
-    0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x73, 0x75, 0x67, 0x67, 0x65, 0x73,
-    0x74, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x64, 0x41, 0x72, 0x72, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x36, 0x35, 0x39, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x77, 0x61,
-    0x72, 0x64, 0x73, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x61,
-    0x72, 0x72, 0x6f, 0x77, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x31, 0x44, 0x33,
-    0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x61, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x68,
-    0x41, 0x72, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38,
-    0x36, 0x36, 0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6c, 0x65, 0x66, 0x74, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x64,
-    0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x2c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x31, 0x44, 0x34, 0x20, 0x49, 0x53,
-    0x4f, 0x61, 0x6d, 0x73, 0x61, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d,
-    0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x4d, 0x61, 0x74, 0x68, 0x65, 0x6d,
-    0x61, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x4f, 0x70, 0x65, 0x72, 0x61,
-    0x74, 0x6f, 0x72, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x66, 0x6f, 0x72, 0x61, 0x6c,
-    0x6c, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x30, 0x34, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x66, 0x6f, 0x72, 0x20,
-    0x61, 0x6c, 0x6c, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x30, 0x30, 0x20,
-    0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x70, 0x61,
-    0x72, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37,
-    0x30, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x70,
-    0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65,
-    0x72, 0x65, 0x6e, 0x74, 0x69, 0x61, 0x6c, 0x2c, 0x20, 0x55, 0x2b, 0x32,
-    0x32, 0x30, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x65, 0x78, 0x69, 0x73, 0x74, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x38, 0x37, 0x30, 0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x65, 0x78,
-    0x69, 0x73, 0x74, 0x73, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x30, 0x33,
-    0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x65,
-    0x6d, 0x70, 0x74, 0x79, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38,
-    0x37, 0x30, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x20,
-    0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x73, 0x65, 0x74, 0x20, 0x3d, 0x20, 0x64,
-    0x69, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x32, 0x32, 0x30, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73,
-    0x6f, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x6e, 0x61, 0x62, 0x6c, 0x61, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x31, 0x31, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6e, 0x61, 0x62, 0x6c, 0x61, 0x20, 0x3d,
-    0x20, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x20, 0x64, 0x69,
-    0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x2c, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x55, 0x2b, 0x32, 0x32, 0x30, 0x37, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65,
-    0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x69, 0x73, 0x69, 0x6e, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x31, 0x32, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
-    0x74, 0x20, 0x6f, 0x66, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x30, 0x38,
-    0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6e,
-    0x6f, 0x74, 0x69, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38,
-    0x37, 0x31, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6e, 0x6f, 0x74, 0x20, 0x61, 0x6e, 0x20, 0x65, 0x6c, 0x65, 0x6d, 0x65,
-    0x6e, 0x74, 0x20, 0x6f, 0x66, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x30,
-    0x39, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x6e, 0x69, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x38, 0x37, 0x31, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x73, 0x20, 0x61, 0x73,
-    0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x2c, 0x20, 0x55, 0x2b, 0x32,
-    0x32, 0x30, 0x42, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x68,
-    0x6f, 0x75, 0x6c, 0x64, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x62,
-    0x65, 0x20, 0x61, 0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x6d, 0x65, 0x6d,
-    0x6f, 0x72, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20,
-    0x74, 0x68, 0x61, 0x6e, 0x20, 0x27, 0x6e, 0x69, 0x27, 0x3f, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x70, 0x72, 0x6f, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x37, 0x31, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6e, 0x2d, 0x61, 0x72, 0x79, 0x20, 0x70, 0x72, 0x6f, 0x64,
-    0x75, 0x63, 0x74, 0x20, 0x3d, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63,
-    0x74, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x32, 0x32, 0x30, 0x46, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x62,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x70,
-    0x72, 0x6f, 0x64, 0x20, 0x69, 0x73, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x74,
-    0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72,
-    0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x61, 0x73, 0x20, 0x55, 0x2b, 0x30,
-    0x33, 0x41, 0x30, 0x20, 0x27, 0x67, 0x72, 0x65, 0x65, 0x6b, 0x20, 0x63,
-    0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65,
-    0x72, 0x20, 0x70, 0x69, 0x27, 0x20, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
-    0x61, 0x6d, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6d, 0x69,
-    0x67, 0x68, 0x74, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20,
-    0x66, 0x6f, 0x72, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x73,
-    0x75, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38,
-    0x37, 0x32, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6e, 0x2d, 0x61, 0x72, 0x79, 0x20, 0x73, 0x75, 0x6d, 0x61, 0x74, 0x69,
-    0x6f, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x31, 0x31, 0x20, 0x49,
-    0x53, 0x4f, 0x61, 0x6d, 0x73, 0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x75, 0x6d, 0x20, 0x69, 0x73, 0x20,
-    0x4e, 0x4f, 0x54, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65,
-    0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x61,
-    0x73, 0x20, 0x55, 0x2b, 0x30, 0x33, 0x41, 0x33, 0x20, 0x27, 0x67, 0x72,
-    0x65, 0x65, 0x6b, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20,
-    0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x73, 0x69, 0x67, 0x6d, 0x61,
-    0x27, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68, 0x6f, 0x75,
-    0x67, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20,
-    0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6d, 0x69, 0x67, 0x68, 0x74, 0x20,
-    0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20,
-    0x62, 0x6f, 0x74, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6d, 0x69, 0x6e, 0x75, 0x73,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x32, 0x32, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6d, 0x69, 0x6e, 0x75,
-    0x73, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32,
-    0x31, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x6c, 0x6f, 0x77, 0x61, 0x73, 0x74, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x37, 0x32, 0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x61, 0x73, 0x74, 0x65, 0x72, 0x69, 0x73, 0x6b, 0x20, 0x6f,
-    0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x2c, 0x20, 0x55, 0x2b, 0x32,
-    0x32, 0x31, 0x37, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x72, 0x61, 0x64, 0x69, 0x63, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x37, 0x33, 0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x72, 0x6f,
-    0x6f, 0x74, 0x20, 0x3d, 0x20, 0x72, 0x61, 0x64, 0x69, 0x63, 0x61, 0x6c,
-    0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32,
-    0x32, 0x31, 0x41, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x37, 0x33, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x6f, 0x72, 0x74, 0x69, 0x6f,
-    0x6e, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32,
-    0x31, 0x44, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x69, 0x6e, 0x66, 0x69, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x37, 0x33, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x69, 0x6e, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x79, 0x2c, 0x20,
-    0x55, 0x2b, 0x32, 0x32, 0x31, 0x45, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65,
-    0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x61, 0x6e, 0x67, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x33, 0x36, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2c,
-    0x20, 0x55, 0x2b, 0x32, 0x32, 0x32, 0x30, 0x20, 0x49, 0x53, 0x4f, 0x61,
-    0x6d, 0x73, 0x6f, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x34, 0x33, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x6f, 0x67, 0x69, 0x63,
-    0x61, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x77, 0x65, 0x64,
-    0x67, 0x65, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x32, 0x37, 0x20, 0x49,
-    0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6f, 0x72, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x34,
-    0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x6f,
-    0x67, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x76,
-    0x65, 0x65, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x32, 0x38, 0x20, 0x49,
-    0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x63, 0x61, 0x70,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x34,
-    0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x69, 0x6e,
-    0x74, 0x65, 0x72, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d,
-    0x20, 0x63, 0x61, 0x70, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x32, 0x39,
-    0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x63,
-    0x75, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38,
-    0x37, 0x34, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x75, 0x6e, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x70, 0x2c,
-    0x20, 0x55, 0x2b, 0x32, 0x32, 0x32, 0x41, 0x20, 0x49, 0x53, 0x4f, 0x74,
-    0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x34, 0x37, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67,
-    0x72, 0x61, 0x6c, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x32, 0x42, 0x20,
-    0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x74, 0x68,
-    0x65, 0x72, 0x65, 0x34, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37,
-    0x35, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x74,
-    0x68, 0x65, 0x72, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x2c, 0x20, 0x55, 0x2b,
-    0x32, 0x32, 0x33, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x73, 0x69, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x38, 0x37, 0x36, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x20, 0x6f, 0x70,
-    0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x76, 0x61, 0x72,
-    0x69, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x73,
-    0x69, 0x6d, 0x69, 0x6c, 0x61, 0x72, 0x20, 0x74, 0x6f, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x32, 0x32, 0x33, 0x43, 0x20, 0x49, 0x53, 0x4f, 0x74,
-    0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x20, 0x6f, 0x70, 0x65, 0x72,
-    0x61, 0x74, 0x6f, 0x72, 0x20, 0x69, 0x73, 0x20, 0x4e, 0x4f, 0x54, 0x20,
-    0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x63, 0x68, 0x61,
-    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68,
-    0x65, 0x20, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2c, 0x20, 0x55, 0x2b, 0x30,
-    0x30, 0x37, 0x45, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61,
-    0x6c, 0x74, 0x68, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x73, 0x61, 0x6d, 0x65, 0x20, 0x67, 0x6c, 0x79, 0x70, 0x68, 0x20, 0x6d,
-    0x69, 0x67, 0x68, 0x74, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64,
-    0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e,
-    0x74, 0x20, 0x62, 0x6f, 0x74, 0x68, 0x20, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x63, 0x6f,
-    0x6e, 0x67, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x37,
-    0x37, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x61,
-    0x70, 0x70, 0x72, 0x6f, 0x78, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x6c, 0x79,
-    0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x2c, 0x20, 0x55,
-    0x2b, 0x32, 0x32, 0x34, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63,
-    0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x61, 0x73, 0x79, 0x6d, 0x70, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x38, 0x37, 0x37, 0x36, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x61, 0x6c, 0x6d, 0x6f, 0x73, 0x74, 0x20,
-    0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x3d, 0x20, 0x61,
-    0x73, 0x79, 0x6d, 0x70, 0x74, 0x6f, 0x74, 0x69, 0x63, 0x20, 0x74, 0x6f,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x34, 0x38, 0x20, 0x49,
-    0x53, 0x4f, 0x61, 0x6d, 0x73, 0x72, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6e, 0x65, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x38, 0x30,
-    0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6e, 0x6f,
-    0x74, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x2c, 0x20,
-    0x55, 0x2b, 0x32, 0x32, 0x36, 0x30, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65,
-    0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x65, 0x71, 0x75, 0x69, 0x76, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x38, 0x30, 0x31, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69,
-    0x63, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32,
-    0x36, 0x31, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x6c, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x38, 0x30, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6c, 0x65, 0x73, 0x73, 0x2d, 0x74, 0x68, 0x61, 0x6e, 0x20,
-    0x6f, 0x72, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x2c,
-    0x20, 0x55, 0x2b, 0x32, 0x32, 0x36, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x74,
-    0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x67, 0x65, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x38, 0x30, 0x35, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74,
-    0x65, 0x72, 0x2d, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x6f, 0x72, 0x20, 0x65,
-    0x71, 0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x32, 0x32, 0x36, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63,
-    0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x73, 0x75, 0x62, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x38, 0x38, 0x33, 0x34, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x74, 0x20,
-    0x6f, 0x66, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x38, 0x32, 0x20, 0x49,
-    0x53, 0x4f, 0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x75, 0x70,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x38, 0x33,
-    0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x75,
-    0x70, 0x65, 0x72, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x2c, 0x20, 0x55,
-    0x2b, 0x32, 0x32, 0x38, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63,
-    0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6e, 0x6f, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6e, 0x73,
-    0x75, 0x70, 0x2c, 0x20, 0x27, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x73,
-    0x75, 0x70, 0x65, 0x72, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x2c, 0x20,
-    0x55, 0x2b, 0x32, 0x32, 0x38, 0x33, 0x27, 0x20, 0x69, 0x73, 0x20, 0x6e,
-    0x6f, 0x74, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x62,
-    0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x79, 0x6d, 0x62, 0x6f, 0x6c,
-    0x20, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x6e, 0x74,
-    0x20, 0x65, 0x6e, 0x63, 0x6f, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e,
-    0x64, 0x20, 0x69, 0x73, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x63,
-    0x6c, 0x75, 0x64, 0x65, 0x64, 0x2e, 0x20, 0x53, 0x68, 0x6f, 0x75, 0x6c,
-    0x64, 0x20, 0x69, 0x74, 0x20, 0x62, 0x65, 0x2c, 0x20, 0x66, 0x6f, 0x72,
-    0x20, 0x73, 0x79, 0x6d, 0x6d, 0x65, 0x74, 0x72, 0x79, 0x3f, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x49, 0x74, 0x20, 0x69, 0x73, 0x20, 0x69,
-    0x6e, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x6e, 0x20, 0x20, 0x2d,
-    0x2d, 0x3e, 0x20, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x6e, 0x73, 0x75, 0x62, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x38, 0x33, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x61, 0x20, 0x73, 0x75, 0x62,
-    0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x32,
-    0x38, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x6e, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x73, 0x75, 0x62, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x38, 0x33, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x73, 0x75, 0x62, 0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20,
-    0x6f, 0x72, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x2c,
-    0x20, 0x55, 0x2b, 0x32, 0x32, 0x38, 0x36, 0x20, 0x49, 0x53, 0x4f, 0x74,
-    0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x75, 0x70, 0x65, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x38, 0x33, 0x39, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72,
-    0x73, 0x65, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x72, 0x20, 0x65, 0x71,
-    0x75, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b,
-    0x32, 0x32, 0x38, 0x37, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63, 0x68,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x6f, 0x70, 0x6c, 0x75, 0x73, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x38, 0x38, 0x35, 0x33, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x64, 0x20,
-    0x70, 0x6c, 0x75, 0x73, 0x20, 0x3d, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63,
-    0x74, 0x20, 0x73, 0x75, 0x6d, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32,
-    0x32, 0x39, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x62, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x6f, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x38, 0x35, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x63, 0x69, 0x72, 0x63, 0x6c, 0x65, 0x64, 0x20, 0x74,
-    0x69, 0x6d, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x74, 0x6f,
-    0x72, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x74, 0x2c, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x32, 0x32, 0x39, 0x37, 0x20, 0x49, 0x53, 0x4f, 0x61,
-    0x6d, 0x73, 0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x70, 0x65, 0x72, 0x70, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x38, 0x36, 0x39, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x75, 0x70, 0x20, 0x74, 0x61,
-    0x63, 0x6b, 0x20, 0x3d, 0x20, 0x6f, 0x72, 0x74, 0x68, 0x6f, 0x67, 0x6f,
-    0x6e, 0x61, 0x6c, 0x20, 0x74, 0x6f, 0x20, 0x3d, 0x20, 0x70, 0x65, 0x72,
-    0x70, 0x65, 0x6e, 0x64, 0x69, 0x63, 0x75, 0x6c, 0x61, 0x72, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x55, 0x2b, 0x32, 0x32, 0x41, 0x35, 0x20, 0x49, 0x53, 0x4f,
-    0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x64, 0x6f, 0x74, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x39, 0x30, 0x31, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x64, 0x6f, 0x74, 0x20,
-    0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x2c, 0x20, 0x55, 0x2b,
-    0x32, 0x32, 0x43, 0x35, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x62,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x64,
-    0x6f, 0x74, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x20,
-    0x69, 0x73, 0x20, 0x4e, 0x4f, 0x54, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
-    0x61, 0x6d, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65,
-    0x72, 0x20, 0x61, 0x73, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x42, 0x37, 0x20,
-    0x6d, 0x69, 0x64, 0x64, 0x6c, 0x65, 0x20, 0x64, 0x6f, 0x74, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x4d,
-    0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c, 0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73,
-    0x20, 0x54, 0x65, 0x63, 0x68, 0x6e, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x6c, 0x63, 0x65, 0x69, 0x6c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x39, 0x36, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x63, 0x65, 0x69, 0x6c, 0x69,
-    0x6e, 0x67, 0x20, 0x3d, 0x20, 0x61, 0x70, 0x6c, 0x20, 0x75, 0x70, 0x73,
-    0x74, 0x69, 0x6c, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x33,
-    0x30, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x63, 0x20, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x72, 0x63, 0x65, 0x69, 0x6c, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x39, 0x36, 0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x63, 0x65, 0x69,
-    0x6c, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x33, 0x30, 0x39,
-    0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x63, 0x20, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x6c, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x38, 0x39, 0x37, 0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x20,
-    0x3d, 0x20, 0x61, 0x70, 0x6c, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x73, 0x74,
-    0x69, 0x6c, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x33, 0x30,
-    0x41, 0x20, 0x49, 0x53, 0x4f, 0x61, 0x6d, 0x73, 0x63, 0x20, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x72, 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x39, 0x37, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x6f,
-    0x72, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x33, 0x30, 0x42, 0x20, 0x49, 0x53,
-    0x4f, 0x61, 0x6d, 0x73, 0x63, 0x20, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6c, 0x61, 0x6e,
-    0x67, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x30, 0x30,
-    0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x65,
-    0x66, 0x74, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20,
-    0x61, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x62, 0x72, 0x61, 0x63, 0x6b, 0x65,
-    0x74, 0x20, 0x3d, 0x20, 0x62, 0x72, 0x61, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x32, 0x33, 0x32, 0x39, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63,
-    0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6c, 0x61, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x4e, 0x4f, 0x54, 0x20,
-    0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x63, 0x68, 0x61,
-    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x61, 0x73, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x33, 0x43, 0x20, 0x27, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x74,
-    0x68, 0x61, 0x6e, 0x27, 0x20, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x6f, 0x72, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x33, 0x39, 0x20, 0x27, 0x73,
-    0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x70,
-    0x6f, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x67, 0x6c,
-    0x65, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-    0x6d, 0x61, 0x72, 0x6b, 0x27, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x72, 0x61, 0x6e, 0x67,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x30, 0x30, 0x32,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x72, 0x69, 0x67,
-    0x68, 0x74, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20,
-    0x61, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x62, 0x72, 0x61, 0x63, 0x6b, 0x65,
-    0x74, 0x20, 0x3d, 0x20, 0x6b, 0x65, 0x74, 0x2c, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55,
-    0x2b, 0x32, 0x33, 0x32, 0x41, 0x20, 0x49, 0x53, 0x4f, 0x74, 0x65, 0x63,
-    0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x72, 0x61, 0x6e, 0x67, 0x20, 0x69, 0x73, 0x20, 0x4e, 0x4f, 0x54, 0x20,
-    0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x63, 0x68, 0x61,
-    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x20, 0x61, 0x73, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x33, 0x45, 0x20, 0x27, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65,
-    0x72, 0x20, 0x74, 0x68, 0x61, 0x6e, 0x27, 0x20, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x6f, 0x72, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x33, 0x41,
-    0x20, 0x27, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x72, 0x69, 0x67,
-    0x68, 0x74, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20,
-    0x61, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74,
-    0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x27, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x47, 0x65,
-    0x6f, 0x6d, 0x65, 0x74, 0x72, 0x69, 0x63, 0x20, 0x53, 0x68, 0x61, 0x70,
-    0x65, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x6c, 0x6f, 0x7a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x36, 0x37, 0x34, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x6f, 0x7a, 0x65, 0x6e, 0x67,
-    0x65, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x35, 0x43, 0x41, 0x20, 0x49, 0x53,
-    0x4f, 0x70, 0x75, 0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x4d, 0x69, 0x73, 0x63, 0x65, 0x6c, 0x6c,
-    0x61, 0x6e, 0x65, 0x6f, 0x75, 0x73, 0x20, 0x53, 0x79, 0x6d, 0x62, 0x6f,
-    0x6c, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x70, 0x61, 0x64, 0x65, 0x73, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x38, 0x32, 0x34, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x20,
-    0x73, 0x70, 0x61, 0x64, 0x65, 0x20, 0x73, 0x75, 0x69, 0x74, 0x2c, 0x20,
-    0x55, 0x2b, 0x32, 0x36, 0x36, 0x30, 0x20, 0x49, 0x53, 0x4f, 0x70, 0x75,
-    0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x62, 0x6c, 0x61, 0x63, 0x6b, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x73,
-    0x65, 0x65, 0x6d, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x65, 0x61, 0x6e,
-    0x20, 0x66, 0x69, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x6f,
-    0x70, 0x70, 0x6f, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x6f,
-    0x6c, 0x6c, 0x6f, 0x77, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x63, 0x6c, 0x75, 0x62, 0x73,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x38, 0x32, 0x37, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x62, 0x6c, 0x61, 0x63,
-    0x6b, 0x20, 0x63, 0x6c, 0x75, 0x62, 0x20, 0x73, 0x75, 0x69, 0x74, 0x20,
-    0x3d, 0x20, 0x73, 0x68, 0x61, 0x6d, 0x72, 0x6f, 0x63, 0x6b, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x55, 0x2b, 0x32, 0x36, 0x36, 0x33, 0x20, 0x49, 0x53, 0x4f,
-    0x70, 0x75, 0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x68, 0x65, 0x61, 0x72, 0x74, 0x73,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x38, 0x32, 0x39, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x62, 0x6c, 0x61, 0x63, 0x6b,
-    0x20, 0x68, 0x65, 0x61, 0x72, 0x74, 0x20, 0x73, 0x75, 0x69, 0x74, 0x20,
-    0x3d, 0x20, 0x76, 0x61, 0x6c, 0x65, 0x6e, 0x74, 0x69, 0x6e, 0x65, 0x2c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x36, 0x36, 0x35, 0x20, 0x49, 0x53,
-    0x4f, 0x70, 0x75, 0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x64, 0x69, 0x61, 0x6d, 0x73,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x39, 0x38, 0x33, 0x30, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x62, 0x6c, 0x61, 0x63,
-    0x6b, 0x20, 0x64, 0x69, 0x61, 0x6d, 0x6f, 0x6e, 0x64, 0x20, 0x73, 0x75,
-    0x69, 0x74, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x36, 0x36, 0x36, 0x20, 0x49,
-    0x53, 0x4f, 0x70, 0x75, 0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d,
-    0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x25, 0x20, 0x78, 0x68, 0x74, 0x6d, 0x6c, 0x2d, 0x73, 0x70, 0x65, 0x63,
-    0x69, 0x61, 0x6c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x55, 0x42,
-    0x4c, 0x49, 0x43, 0x20, 0x22, 0x2d, 0x2f, 0x2f, 0x57, 0x33, 0x43, 0x2f,
-    0x2f, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x49, 0x45, 0x53, 0x20, 0x53, 0x70,
-    0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x58, 0x48,
-    0x54, 0x4d, 0x4c, 0x2f, 0x2f, 0x45, 0x4e, 0x22, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x78, 0x68,
-    0x74, 0x6d, 0x6c, 0x2d, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x2e,
-    0x65, 0x6e, 0x74, 0x22, 0x20, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x63, 0x68, 0x61,
-    0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20,
-    0x48, 0x54, 0x4d, 0x4c, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74,
-    0x65, 0x72, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x73, 0x65,
-    0x74, 0x2e, 0x20, 0x54, 0x79, 0x70, 0x69, 0x63, 0x61, 0x6c, 0x20, 0x69,
-    0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x25, 0x20, 0x48, 0x54, 0x4d, 0x4c, 0x73, 0x70, 0x65, 0x63,
-    0x69, 0x61, 0x6c, 0x20, 0x50, 0x55, 0x42, 0x4c, 0x49, 0x43, 0x0d, 0x0a,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x2d, 0x2f, 0x2f,
-    0x57, 0x33, 0x43, 0x2f, 0x2f, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x49, 0x45,
-    0x53, 0x20, 0x53, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x20, 0x66, 0x6f,
-    0x72, 0x20, 0x58, 0x48, 0x54, 0x4d, 0x4c, 0x2f, 0x2f, 0x45, 0x4e, 0x22,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x68,
-    0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x77, 0x33,
-    0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x54, 0x52, 0x2f, 0x78, 0x68, 0x74, 0x6d,
-    0x6c, 0x31, 0x2f, 0x44, 0x54, 0x44, 0x2f, 0x78, 0x68, 0x74, 0x6d, 0x6c,
-    0x2d, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x2e, 0x65, 0x6e, 0x74,
-    0x22, 0x3e, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x25, 0x48, 0x54,
-    0x4d, 0x4c, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x3b, 0x0d, 0x0a,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x50, 0x6f, 0x72, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x28, 0x43, 0x29,
-    0x20, 0x49, 0x6e, 0x74, 0x65, 0x72, 0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-    0x61, 0x6c, 0x20, 0x4f, 0x72, 0x67, 0x61, 0x6e, 0x69, 0x7a, 0x61, 0x74,
-    0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x53, 0x74, 0x61, 0x6e,
-    0x64, 0x61, 0x72, 0x64, 0x69, 0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-    0x31, 0x39, 0x38, 0x36, 0x3a, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x50, 0x65, 0x72, 0x6d, 0x69, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74,
-    0x6f, 0x20, 0x63, 0x6f, 0x70, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x61, 0x6e,
-    0x79, 0x20, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x67, 0x72,
-    0x61, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x75, 0x73,
-    0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x63, 0x6f, 0x6e, 0x66, 0x6f, 0x72, 0x6d, 0x69, 0x6e, 0x67, 0x20,
-    0x53, 0x47, 0x4d, 0x4c, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x73,
-    0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x63, 0x61,
-    0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x66,
-    0x69, 0x6e, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x0d, 0x0a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x38, 0x38, 0x37, 0x39, 0x2c, 0x20,
-    0x70, 0x72, 0x6f, 0x76, 0x69, 0x64, 0x65, 0x64, 0x20, 0x74, 0x68, 0x69,
-    0x73, 0x20, 0x6e, 0x6f, 0x74, 0x69, 0x63, 0x65, 0x20, 0x69, 0x73, 0x20,
-    0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20,
-    0x61, 0x6c, 0x6c, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x2e, 0x0d,
-    0x0a, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x52, 0x65, 0x6c, 0x65, 0x76, 0x61, 0x6e, 0x74, 0x20, 0x49, 0x53,
-    0x4f, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x73, 0x65, 0x74,
-    0x20, 0x69, 0x73, 0x20, 0x67, 0x69, 0x76, 0x65, 0x6e, 0x20, 0x75, 0x6e,
-    0x6c, 0x65, 0x73, 0x73, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x20, 0x61,
-    0x72, 0x65, 0x20, 0x6e, 0x65, 0x77, 0x6c, 0x79, 0x20, 0x69, 0x6e, 0x74,
-    0x72, 0x6f, 0x64, 0x75, 0x63, 0x65, 0x64, 0x2e, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x4e, 0x65, 0x77, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73,
-    0x20, 0x28, 0x69, 0x2e, 0x65, 0x2e, 0x2c, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-    0x69, 0x6e, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x38, 0x38, 0x37, 0x39, 0x20,
-    0x6c, 0x69, 0x73, 0x74, 0x29, 0x20, 0x64, 0x6f, 0x20, 0x6e, 0x6f, 0x74,
-    0x20, 0x63, 0x6c, 0x61, 0x73, 0x68, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20,
-    0x61, 0x6e, 0x79, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x78,
-    0x69, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x38,
-    0x38, 0x37, 0x39, 0x20, 0x65, 0x6e, 0x74, 0x69, 0x74, 0x79, 0x20, 0x6e,
-    0x61, 0x6d, 0x65, 0x73, 0x2e, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x31, 0x30,
-    0x36, 0x34, 0x36, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65,
-    0x72, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x0d, 0x0a, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x61, 0x72, 0x65, 0x20, 0x67, 0x69, 0x76, 0x65,
-    0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x63,
-    0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72, 0x2c, 0x20, 0x69, 0x6e,
-    0x20, 0x68, 0x65, 0x78, 0x2e, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73,
-    0x20, 0x61, 0x72, 0x65, 0x20, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c,
-    0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x76, 0x65,
-    0x72, 0x73, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
-    0x65, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x31, 0x30, 0x36, 0x34, 0x36, 0x20,
-    0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72,
-    0x65, 0x66, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20,
-    0x64, 0x6f, 0x63, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x0d, 0x0a, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61, 0x63, 0x74, 0x65, 0x72,
-    0x20, 0x73, 0x65, 0x74, 0x2e, 0x20, 0x4e, 0x61, 0x6d, 0x65, 0x73, 0x20,
-    0x61, 0x72, 0x65, 0x20, 0x55, 0x6e, 0x69, 0x63, 0x6f, 0x64, 0x65, 0x20,
-    0x6e, 0x61, 0x6d, 0x65, 0x73, 0x2e, 0x20, 0x0d, 0x0a, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x43, 0x30, 0x20,
-    0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x20, 0x61, 0x6e, 0x64,
-    0x20, 0x42, 0x61, 0x73, 0x69, 0x63, 0x20, 0x4c, 0x61, 0x74, 0x69, 0x6e,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x20, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x33, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-    0x6d, 0x61, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x41, 0x50, 0x4c, 0x20, 0x71,
-    0x75, 0x6f, 0x74, 0x65, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x32,
-    0x32, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x61,
-    0x6d, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x33, 0x38,
-    0x3b, 0x23, 0x33, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x20, 0x61, 0x6d, 0x70, 0x65, 0x72, 0x73, 0x61, 0x6e, 0x64, 0x2c,
-    0x20, 0x55, 0x2b, 0x30, 0x30, 0x32, 0x36, 0x20, 0x49, 0x53, 0x4f, 0x6e,
-    0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x6c, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x33, 0x38, 0x3b, 0x23, 0x36, 0x30, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x20, 0x6c, 0x65, 0x73, 0x73,
-    0x2d, 0x74, 0x68, 0x61, 0x6e, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20,
-    0x55, 0x2b, 0x30, 0x30, 0x33, 0x43, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75,
-    0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x67, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x36, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x2d, 0x74,
-    0x68, 0x61, 0x6e, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x2c, 0x20, 0x55, 0x2b,
-    0x30, 0x30, 0x33, 0x45, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x61, 0x70, 0x6f, 0x73, 0x09, 0x20, 0x22, 0x26, 0x23, 0x33,
-    0x39, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x20, 0x61,
-    0x70, 0x6f, 0x73, 0x74, 0x72, 0x6f, 0x70, 0x68, 0x65, 0x20, 0x6d, 0x61,
-    0x72, 0x6b, 0x2c, 0x20, 0x55, 0x2b, 0x30, 0x30, 0x32, 0x37, 0x20, 0x49,
-    0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d,
-    0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x4c, 0x61, 0x74, 0x69, 0x6e, 0x20,
-    0x45, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x2d, 0x41, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x4f, 0x45, 0x6c, 0x69, 0x67, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x33, 0x33, 0x38, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74,
-    0x61, 0x6c, 0x20, 0x6c, 0x69, 0x67, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20,
-    0x4f, 0x45, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x31, 0x35, 0x32, 0x20,
-    0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74, 0x32, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6f, 0x65,
-    0x6c, 0x69, 0x67, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x33, 0x33, 0x39,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x20, 0x6c, 0x61,
-    0x74, 0x69, 0x6e, 0x20, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x69,
-    0x67, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x6f, 0x65, 0x2c, 0x20, 0x55,
-    0x2b, 0x30, 0x31, 0x35, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x6c, 0x61, 0x74,
-    0x32, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x6c, 0x69, 0x67, 0x61, 0x74, 0x75, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20,
-    0x61, 0x20, 0x6d, 0x69, 0x73, 0x6e, 0x6f, 0x6d, 0x65, 0x72, 0x2c, 0x20,
-    0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x73, 0x65,
-    0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x61,
-    0x63, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x6f, 0x6d, 0x65,
-    0x20, 0x6c, 0x61, 0x6e, 0x67, 0x75, 0x61, 0x67, 0x65, 0x73, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x53, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x33, 0x35, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74,
-    0x61, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x53, 0x20,
-    0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x61, 0x72, 0x6f, 0x6e, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x31, 0x36, 0x30, 0x20, 0x49, 0x53, 0x4f, 0x6c,
-    0x61, 0x74, 0x32, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x63, 0x61, 0x72, 0x6f, 0x6e,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x33, 0x35, 0x33, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x20, 0x6c, 0x61, 0x74, 0x69, 0x6e, 0x20,
-    0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72,
-    0x20, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x63, 0x61, 0x72, 0x6f,
-    0x6e, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x31, 0x36, 0x31, 0x20, 0x49,
-    0x53, 0x4f, 0x6c, 0x61, 0x74, 0x32, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x59, 0x75, 0x6d,
-    0x6c, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x33, 0x37, 0x36, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x20, 0x6c, 0x61, 0x74,
-    0x69, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x69, 0x74, 0x61, 0x6c, 0x20, 0x6c,
-    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x59, 0x20, 0x77, 0x69, 0x74, 0x68,
-    0x20, 0x64, 0x69, 0x61, 0x65, 0x72, 0x65, 0x73, 0x69, 0x73, 0x2c, 0x0d,
-    0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x55, 0x2b, 0x30, 0x31, 0x37, 0x38, 0x20, 0x49, 0x53, 0x4f, 0x6c,
-    0x61, 0x74, 0x32, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x20,
-    0x4d, 0x6f, 0x64, 0x69, 0x66, 0x69, 0x65, 0x72, 0x20, 0x4c, 0x65, 0x74,
-    0x74, 0x65, 0x72, 0x73, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x63, 0x69, 0x72, 0x63, 0x20,
-    0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x37, 0x31, 0x30, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x20, 0x6d, 0x6f, 0x64, 0x69, 0x66,
-    0x69, 0x65, 0x72, 0x20, 0x6c, 0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x63,
-    0x69, 0x72, 0x63, 0x75, 0x6d, 0x66, 0x6c, 0x65, 0x78, 0x20, 0x61, 0x63,
-    0x63, 0x65, 0x6e, 0x74, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x30, 0x32, 0x43,
-    0x36, 0x20, 0x49, 0x53, 0x4f, 0x70, 0x75, 0x62, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x74,
-    0x69, 0x6c, 0x64, 0x65, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x37, 0x33,
-    0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x20, 0x73,
-    0x6d, 0x61, 0x6c, 0x6c, 0x20, 0x74, 0x69, 0x6c, 0x64, 0x65, 0x2c, 0x20,
-    0x55, 0x2b, 0x30, 0x32, 0x44, 0x43, 0x20, 0x49, 0x53, 0x4f, 0x64, 0x69,
-    0x61, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x47, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75,
-    0x6e, 0x63, 0x74, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x65, 0x6e, 0x73, 0x70, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38,
-    0x31, 0x39, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x65, 0x6e, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2c, 0x20, 0x55, 0x2b,
-    0x32, 0x30, 0x30, 0x32, 0x20, 0x49, 0x53, 0x4f, 0x70, 0x75, 0x62, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x65, 0x6d, 0x73, 0x70, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x31, 0x39, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x65, 0x6d, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x2c, 0x20,
-    0x55, 0x2b, 0x32, 0x30, 0x30, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x70, 0x75,
-    0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x74, 0x68, 0x69, 0x6e, 0x73, 0x70, 0x20, 0x20,
-    0x22, 0x26, 0x23, 0x38, 0x32, 0x30, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c,
-    0x21, 0x2d, 0x2d, 0x20, 0x74, 0x68, 0x69, 0x6e, 0x20, 0x73, 0x70, 0x61,
-    0x63, 0x65, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x30, 0x39, 0x20, 0x49,
-    0x53, 0x4f, 0x70, 0x75, 0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x7a, 0x77, 0x6e, 0x6a,
-    0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x30, 0x34, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x7a, 0x65, 0x72, 0x6f,
-    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x6e, 0x6f, 0x6e, 0x2d, 0x6a,
-    0x6f, 0x69, 0x6e, 0x65, 0x72, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30,
-    0x30, 0x43, 0x20, 0x4e, 0x45, 0x57, 0x20, 0x52, 0x46, 0x43, 0x20, 0x32,
-    0x30, 0x37, 0x30, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45,
-    0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x7a, 0x77, 0x6a, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x30, 0x35, 0x3b, 0x22, 0x3e,
-    0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x7a, 0x65, 0x72, 0x6f, 0x20, 0x77,
-    0x69, 0x64, 0x74, 0x68, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x65, 0x72, 0x2c,
-    0x20, 0x55, 0x2b, 0x32, 0x30, 0x30, 0x44, 0x20, 0x4e, 0x45, 0x57, 0x20,
-    0x52, 0x46, 0x43, 0x20, 0x32, 0x30, 0x37, 0x30, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6c,
-    0x72, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32,
-    0x30, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c,
-    0x65, 0x66, 0x74, 0x2d, 0x74, 0x6f, 0x2d, 0x72, 0x69, 0x67, 0x68, 0x74,
-    0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x30,
-    0x45, 0x20, 0x4e, 0x45, 0x57, 0x20, 0x52, 0x46, 0x43, 0x20, 0x32, 0x30,
-    0x37, 0x30, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e,
-    0x54, 0x49, 0x54, 0x59, 0x20, 0x72, 0x6c, 0x6d, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x30, 0x37, 0x3b, 0x22, 0x3e, 0x20,
-    0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x74,
-    0x6f, 0x2d, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2c,
-    0x20, 0x55, 0x2b, 0x32, 0x30, 0x30, 0x46, 0x20, 0x4e, 0x45, 0x57, 0x20,
-    0x52, 0x46, 0x43, 0x20, 0x32, 0x30, 0x37, 0x30, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6e,
-    0x64, 0x61, 0x73, 0x68, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32,
-    0x31, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x65,
-    0x6e, 0x20, 0x64, 0x61, 0x73, 0x68, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x30,
-    0x31, 0x33, 0x20, 0x49, 0x53, 0x4f, 0x70, 0x75, 0x62, 0x20, 0x2d, 0x2d,
-    0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20,
-    0x6d, 0x64, 0x61, 0x73, 0x68, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38,
-    0x32, 0x31, 0x32, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20,
-    0x65, 0x6d, 0x20, 0x64, 0x61, 0x73, 0x68, 0x2c, 0x20, 0x55, 0x2b, 0x32,
-    0x30, 0x31, 0x34, 0x20, 0x49, 0x53, 0x4f, 0x70, 0x75, 0x62, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59,
-    0x20, 0x6c, 0x73, 0x71, 0x75, 0x6f, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23,
-    0x38, 0x32, 0x31, 0x36, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d,
-    0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65,
-    0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d,
-    0x61, 0x72, 0x6b, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x31, 0x38,
-    0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x72, 0x73,
-    0x71, 0x75, 0x6f, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x31,
-    0x37, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x72, 0x69,
-    0x67, 0x68, 0x74, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x71,
-    0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x72,
-    0x6b, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x31, 0x39, 0x20, 0x49,
-    0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c,
-    0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x73, 0x62, 0x71, 0x75,
-    0x6f, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x31, 0x38, 0x3b,
-    0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x69, 0x6e, 0x67,
-    0x6c, 0x65, 0x20, 0x6c, 0x6f, 0x77, 0x2d, 0x39, 0x20, 0x71, 0x75, 0x6f,
-    0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2c,
-    0x20, 0x55, 0x2b, 0x32, 0x30, 0x31, 0x41, 0x20, 0x4e, 0x45, 0x57, 0x20,
-    0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54,
-    0x59, 0x20, 0x6c, 0x64, 0x71, 0x75, 0x6f, 0x20, 0x20, 0x20, 0x22, 0x26,
-    0x23, 0x38, 0x32, 0x32, 0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c,
-    0x65, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
-    0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x31,
-    0x43, 0x20, 0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x72,
-    0x64, 0x71, 0x75, 0x6f, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32,
-    0x32, 0x31, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x72,
-    0x69, 0x67, 0x68, 0x74, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20,
-    0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61,
-    0x72, 0x6b, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x31, 0x44, 0x20,
-    0x49, 0x53, 0x4f, 0x6e, 0x75, 0x6d, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a,
-    0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x62, 0x64, 0x71,
-    0x75, 0x6f, 0x20, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x32, 0x32,
-    0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x64, 0x6f, 0x75,
-    0x62, 0x6c, 0x65, 0x20, 0x6c, 0x6f, 0x77, 0x2d, 0x39, 0x20, 0x71, 0x75,
-    0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x72, 0x6b,
-    0x2c, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x31, 0x45, 0x20, 0x4e, 0x45, 0x57,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x64, 0x61, 0x67, 0x67, 0x65, 0x72, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x32, 0x32, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x64, 0x61, 0x67, 0x67, 0x65, 0x72, 0x2c, 0x20, 0x55,
-    0x2b, 0x32, 0x30, 0x32, 0x30, 0x20, 0x49, 0x53, 0x4f, 0x70, 0x75, 0x62,
-    0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49,
-    0x54, 0x59, 0x20, 0x44, 0x61, 0x67, 0x67, 0x65, 0x72, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x32, 0x32, 0x35, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x64, 0x61,
-    0x67, 0x67, 0x65, 0x72, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x32, 0x31,
-    0x20, 0x49, 0x53, 0x4f, 0x70, 0x75, 0x62, 0x20, 0x2d, 0x2d, 0x3e, 0x0d,
-    0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x70, 0x65,
-    0x72, 0x6d, 0x69, 0x6c, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x34,
-    0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x70, 0x65,
-    0x72, 0x20, 0x6d, 0x69, 0x6c, 0x6c, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6e,
-    0x2c, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x33, 0x30, 0x20, 0x49, 0x53, 0x4f,
-    0x74, 0x65, 0x63, 0x68, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21,
-    0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x6c, 0x73, 0x61, 0x71, 0x75,
-    0x6f, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32, 0x34, 0x39, 0x3b, 0x22,
-    0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c,
-    0x65, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74,
-    0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x71, 0x75,
-    0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6d, 0x61, 0x72, 0x6b,
-    0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x33, 0x39, 0x20, 0x49, 0x53,
-    0x4f, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x6f, 0x73, 0x65, 0x64, 0x20, 0x2d,
-    0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x6c, 0x73, 0x61,
-    0x71, 0x75, 0x6f, 0x20, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x6f,
-    0x73, 0x65, 0x64, 0x20, 0x62, 0x75, 0x74, 0x20, 0x6e, 0x6f, 0x74, 0x20,
-    0x79, 0x65, 0x74, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x73, 0x74, 0x61, 0x6e,
-    0x64, 0x61, 0x72, 0x64, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x2d, 0x2d, 0x3e,
-    0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54, 0x49, 0x54, 0x59, 0x20, 0x72,
-    0x73, 0x61, 0x71, 0x75, 0x6f, 0x20, 0x20, 0x22, 0x26, 0x23, 0x38, 0x32,
-    0x35, 0x30, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21, 0x2d, 0x2d, 0x20, 0x73,
-    0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x2d,
-    0x70, 0x6f, 0x69, 0x6e, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x67,
-    0x6c, 0x65, 0x20, 0x71, 0x75, 0x6f, 0x74, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-    0x20, 0x6d, 0x61, 0x72, 0x6b, 0x2c, 0x0d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x2b, 0x32, 0x30,
-    0x33, 0x41, 0x20, 0x49, 0x53, 0x4f, 0x20, 0x70, 0x72, 0x6f, 0x70, 0x6f,
-    0x73, 0x65, 0x64, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x2d,
-    0x2d, 0x20, 0x72, 0x73, 0x61, 0x71, 0x75, 0x6f, 0x20, 0x69, 0x73, 0x20,
-    0x70, 0x72, 0x6f, 0x70, 0x6f, 0x73, 0x65, 0x64, 0x20, 0x62, 0x75, 0x74,
-    0x20, 0x6e, 0x6f, 0x74, 0x20, 0x79, 0x65, 0x74, 0x20, 0x49, 0x53, 0x4f,
-    0x20, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x61, 0x72, 0x64, 0x69, 0x7a, 0x65,
-    0x64, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x3c, 0x21, 0x45, 0x4e, 0x54,
-    0x49, 0x54, 0x59, 0x20, 0x65, 0x75, 0x72, 0x6f, 0x20, 0x20, 0x20, 0x22,
-    0x26, 0x23, 0x38, 0x33, 0x36, 0x34, 0x3b, 0x22, 0x3e, 0x20, 0x3c, 0x21,
-    0x2d, 0x2d, 0x20, 0x20, 0x65, 0x75, 0x72, 0x6f, 0x20, 0x73, 0x69, 0x67,
-    0x6e, 0x2c, 0x20, 0x55, 0x2b, 0x32, 0x30, 0x41, 0x43, 0x20, 0x4e, 0x45,
-    0x57, 0x20, 0x2d, 0x2d, 0x3e, 0x0d, 0x0a, 0x0d, 0x0a
-};
-
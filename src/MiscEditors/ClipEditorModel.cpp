@@ -25,6 +25,7 @@
 #include <QtCore/QCoreApplication>
 #include <QByteArray>
 #include <QDataStream>
+#include <QFileInfo>
 #include <QtCore/QTime>
 #include <QRegularExpression>
 
@@ -58,7 +59,8 @@ ClipEditorModel *ClipEditorModel::instance()
 ClipEditorModel::ClipEditorModel(QObject *parent)
     : QStandardItemModel(parent),
       m_FSWatcher(new QFileSystemWatcher()),
-      m_IsDataModified(false)
+      m_IsDataModified(false),
+      m_CacheFileSize(-1)
 {
     m_SettingsPath = Utility::DefinePrefsDir() + "/" + SETTINGS_FILE;
     QStringList header;
@@ -333,6 +335,32 @@ void ClipEditorModel::LoadData(const QString &filename, QStandardItem *item)
     QString settings_path = filename;
     if (settings_path.isEmpty()) settings_path = m_SettingsPath;
 
+    // Full reloads of the shared settings file are common (discarding
+    // unsaved edits, external file changes) so keep the parsed entries
+    // in memory and only re-run the ini parser when the file on disk
+    // has actually changed.  Imports and the example file load into a
+    // specific parent item and bypass the cache.
+    bool use_cache = (settings_path == m_SettingsPath) && !item;
+    // Snapshot the file stats before reading so a change that lands
+    // mid-parse makes the cache stale rather than wrongly fresh
+    QFileInfo info(settings_path);
+
+    if (use_cache && !m_CachedEntries.isEmpty() &&
+        info.lastModified() == m_CacheFileTime && info.size() == m_CacheFileSize) {
+        for (int i = 0; i < m_CachedEntries.count(); ++i) {
+            // AddFullNameEntry rewrites the name field so hand it a copy
+            ClipEditorModel::clipEntry entry = m_CachedEntries.at(i);
+            AddFullNameEntry(&entry, item);
+        }
+        return;
+    }
+
+    if (use_cache) {
+        m_CachedEntries.clear();
+        m_CacheFileTime = info.lastModified();
+        m_CacheFileSize = info.size();
+    }
+
     SettingsStore ss(settings_path);
 
     int size = ss.beginReadArray(SETTINGS_GROUP);
@@ -349,6 +377,9 @@ void ClipEditorModel::LoadData(const QString &filename, QStandardItem *item)
         entry->name = fullname;
         entry->fullname = fullname;
         entry->text = ss.value(ENTRY_TEXT).toString();
+        if (use_cache) {
+            m_CachedEntries.append(*entry);
+        }
         AddFullNameEntry(entry, item);
         delete entry;
     }
@@ -28,6 +28,7 @@
 
 #include <QtGui/QStandardItemModel>
 #include <QFileSystemWatcher>
+#include <QDateTime>
 #include <QDropEvent>
 
 #include "Misc/SettingsStore.h"
@@ -113,6 +114,12 @@ private:
     QFileSystemWatcher *m_FSWatcher;
 
     bool m_IsDataModified;
+
+    // Parsed entries from the shared settings file, kept across
+    // full reloads so an unchanged file never hits the ini parser twice
+    QList<ClipEditorModel::clipEntry> m_CachedEntries;
+    QDateTime m_CacheFileTime;
+    qint64 m_CacheFileSize;
 };
 
 #endif // CLIPEDITORMODEL_H
@@ -21,6 +21,9 @@
 **
 *************************************************************************/
 
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QHash>
+
 #include "Misc/Utility.h"
 #include "MiscEditors/IndexHTMLWriter.h"
 #include "MiscEditors/IndexEntries.h"
@@ -28,6 +31,24 @@
 
 const QString SGC_INDEX_CSS_FILENAME = "sgc-index.css";
 
+// Serialized sections from earlier runs, keyed on a hash of the entry
+// subtree and the index bookpath so regenerating the index after small
+// edits only rewrites the sections that actually changed.
+// Generation runs on the GUI thread only, so no locking is needed.
+static QHash<QByteArray, QString> index_fragment_cache;
+static QList<QByteArray> index_fragment_order;
+static const int MAX_CACHED_INDEX_FRAGMENTS = 4000;
+
+static void AddItemToHash(QStandardItem *item, QCryptographicHash &sum)
+{
+    sum.addData(item->text().toUtf8());
+    sum.addData("\x1f", 1);
+    for (int i = 0; i < item->rowCount(); i++) {
+        AddItemToHash(item->child(i, 0), sum);
+    }
+    sum.addData("\x1e", 1);
+}
+
 static const QString TEMPLATE_BEGIN_TEXT =
     "<?xml version=\"1.0\" encoding=\"utf-8\" standalone=\"no\"?>\n"
     "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\"\n"
@@ -81,33 +102,23 @@ QString IndexHTMLWriter::WriteXML(const QString &version)
     return m_IndexHTMLFile;
 }
 
-void IndexHTMLWriter::WriteEntries(QStandardItem *parent_item)
+void IndexHTMLWriter::WriteEntries()
 {
     QStandardItem *root_item = IndexEntries::instance()->GetRootItem();
-
-    if (!parent_item) {
-        parent_item = root_item;
-    }
-
-    if (!parent_item->rowCount()) {
-        return;
-    }
-
     QChar letter = ' ';
-    for (int i = 0; i < parent_item->rowCount(); i++) {
-        QStandardItem *item = parent_item->child(i, 0);
+    for (int i = 0; i < root_item->rowCount(); i++) {
+        QStandardItem *item = root_item->child(i, 0);
 
         // If this is a target entry then skip.
         if (!item->rowCount()) {
             continue;
         }
 
-        // Need to html escape entry text
         // If the first letter of this entry is different than the last
         // entry then insert a special separator.
         // Get actual first letter not htmlescaped
         QChar new_letter = item->text()[0].toLower();
-        if (new_letter != letter && parent_item == root_item) {
+        if (new_letter != letter) {
             letter = new_letter;
             m_IndexHTMLFile += "<div class=\"sgc-index-new-letter\">";
             // starting letter may be an & or > or < - therefore html escape it
@@ -115,32 +126,67 @@ void IndexHTMLWriter::WriteEntries(QStandardItem *parent_item)
             m_IndexHTMLFile += "</div>";
         }
 
-        m_IndexHTMLFile += "<div class=\"sgc-index-entry\">";
-        // make sure to use the html escaped text here for entry
-        QString etext = item->text().toHtmlEscaped();
-        m_IndexHTMLFile += etext % "\n";
-        m_IndexHTMLFile += " ";
-
-        // Print all the targets for this entry
-        int ref_count = 1;
-        for (int j = 0; j < item->rowCount(); j++) {
-            // If the entry has no children then its a target id.
-            if (item->child(j, 0)->rowCount() == 0) {
-                QString target = item->child(j,0)->text();
-                std::pair<QString,QString> parts = Utility::parseRelativeHREF(target);
-                QString fragment = parts.second;
-                target = Utility::buildRelativePath(m_IndexBookPath, parts.first);
-                target = Utility::buildRelativeHREF(target, fragment);
-                if (ref_count > 1) {
-                    m_IndexHTMLFile += ", ";
-                }
-                m_IndexHTMLFile += "<a href=\"" % target % "\">" % QString::number(ref_count) % "</a>";
-                ref_count++;
+        m_IndexHTMLFile += CachedEntryFragment(item);
+    }
+}
+
+QString IndexHTMLWriter::CachedEntryFragment(QStandardItem *item)
+{
+    QCryptographicHash sum(QCryptographicHash::Sha1);
+    sum.addData(m_IndexBookPath.toUtf8());
+    sum.addData("\x1f", 1);
+    AddItemToHash(item, sum);
+    QByteArray key = sum.result();
+
+    if (index_fragment_cache.contains(key)) {
+        index_fragment_order.removeOne(key);
+        index_fragment_order.append(key);
+        return index_fragment_cache.value(key);
+    }
+
+    QString fragment;
+    WriteEntry(item, fragment);
+
+    index_fragment_cache.insert(key, fragment);
+    index_fragment_order.append(key);
+    if (index_fragment_order.count() > MAX_CACHED_INDEX_FRAGMENTS) {
+        index_fragment_cache.remove(index_fragment_order.takeFirst());
+    }
+    return fragment;
+}
+
+void IndexHTMLWriter::WriteEntry(QStandardItem *item, QString &out)
+{
+    out += "<div class=\"sgc-index-entry\">";
+    // make sure to use the html escaped text here for entry
+    QString etext = item->text().toHtmlEscaped();
+    out += etext % "\n";
+    out += " ";
+
+    // Print all the targets for this entry
+    int ref_count = 1;
+    for (int j = 0; j < item->rowCount(); j++) {
+        // If the entry has no children then its a target id.
+        if (item->child(j, 0)->rowCount() == 0) {
+            QString target = item->child(j,0)->text();
+            std::pair<QString,QString> parts = Utility::parseRelativeHREF(target);
+            QString fragment = parts.second;
+            target = Utility::buildRelativePath(m_IndexBookPath, parts.first);
+            target = Utility::buildRelativeHREF(target, fragment);
+            if (ref_count > 1) {
+                out += ", ";
             }
+            out += "<a href=\"" % target % "\">" % QString::number(ref_count) % "</a>";
+            ref_count++;
         }
+    }
 
-        // Print any subentries and their targets
-        WriteEntries(item);
-        m_IndexHTMLFile += "</div>";
+    // Print any subentries and their targets
+    for (int j = 0; j < item->rowCount(); j++) {
+        QStandardItem *subentry = item->child(j, 0);
+        if (subentry->rowCount()) {
+            WriteEntry(subentry, out);
+        }
     }
+    out += "</div>";
 }
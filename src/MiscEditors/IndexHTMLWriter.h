@@ -36,7 +36,15 @@ public:
     QString WriteXML(const QString &version);
 
 private:
-    void WriteEntries(QStandardItem *parent_item = NULL);
+    void WriteEntries();
+
+    /**
+     * Returns the serialized section for one top level entry and its
+     * subentries, reusing the cached fragment when the subtree is unchanged.
+     */
+    QString CachedEntryFragment(QStandardItem *item);
+
+    void WriteEntry(QStandardItem *item, QString &out);
 
     QString m_IndexHTMLFile;
 
@@ -20,12 +20,19 @@
 **
 *************************************************************************/
 
+#include <QMutexLocker>
+
 #include "PCRE/PCRECache.h"
 
+// raise cost of each entry to 5 to reduce memory footprint
+static const int ENTRY_COST = 5;
+
 PCRECache *PCRECache::m_instance = 0;
+QMutex PCRECache::m_instance_mutex;
 
 PCRECache *PCRECache::instance()
 {
+    QMutexLocker locker(&m_instance_mutex);
     if (m_instance == 0) {
         m_instance = new PCRECache();
     }
@@ -34,26 +41,58 @@ PCRECache *PCRECache::instance()
 }
 
 PCRECache::PCRECache()
+    : m_hits(0),
+      m_misses(0)
+{
+    // keep the historical total of 100 cost units
+    setCapacity(100);
+}
+
+PCRECache::~PCRECache()
+{
+}
+
+PCRECache::Shard &PCRECache::shardFor(const QString &key)
+{
+    return m_shards[qHash(key) & (NUM_SHARDS - 1)];
+}
+
+void PCRECache::setCapacity(int max_cost)
 {
-  // defaults to maxCacheCost of 100
+    int per_shard = qMax(max_cost / NUM_SHARDS, ENTRY_COST);
+    for (int i = 0; i < NUM_SHARDS; i++) {
+        QMutexLocker locker(&m_shards[i].mutex);
+        m_shards[i].cache.setMaxCost(per_shard);
+    }
 }
 
 bool PCRECache::insert(const QString &key, SPCRE *object)
 {
-    // raise cost of each entry to 5 to reduce memory footprint
-    return m_cache.insert(key, object, 5);
+    Shard &shard = shardFor(key);
+    QMutexLocker locker(&shard.mutex);
+    return shard.cache.insert(key, new QSharedPointer<SPCRE>(object), ENTRY_COST);
 }
 
-SPCRE *PCRECache::getObject(const QString &key)
+QSharedPointer<SPCRE> PCRECache::getObject(const QString &key)
 {
     // Create a new SPCRE if it doesn't already exist.
     // The key is the pattern for initializing the SPCRE.
-    if (!m_cache.contains(key)) {
-        SPCRE *spcre = new SPCRE(key);
-        // raise cost of each entry to 5 to reduce memory footprint
-        m_cache.insert(key, spcre, 5);
-        return spcre;
+    Shard &shard = shardFor(key);
+    QMutexLocker locker(&shard.mutex);
+    QSharedPointer<SPCRE> *entry = shard.cache.object(key);
+    if (entry) {
+        m_hits.fetchAndAddRelaxed(1);
+        return *entry;
     }
 
-    return m_cache.object(key);
+    // compile outside the shard lock so other threads wanting this
+    // shard are not stalled behind pcre_compile
+    locker.unlock();
+    QSharedPointer<SPCRE> spcre(new SPCRE(key));
+    locker.relock();
+    // if another thread compiled the same pattern meanwhile the newer
+    // entry simply replaces it - both compiles are equally valid
+    shard.cache.insert(key, new QSharedPointer<SPCRE>(spcre), ENTRY_COST);
+    m_misses.fetchAndAddRelaxed(1);
+    return spcre;
 }
@@ -25,7 +25,10 @@
 #ifndef PCRECACHE_H
 #define PCRECACHE_H
 
+#include <QtCore/QAtomicInt>
 #include <QtCore/QCache>
+#include <QtCore/QMutex>
+#include <QtCore/QSharedPointer>
 #include <QtCore/QString>
 
 #include "PCRE/SPCRE.h"
@@ -33,7 +36,11 @@
 /**
  * Singleton. A cache of SPCRE regular expression objects.
  *
- * The SPCRE's are cached to improve performance.
+ * The SPCRE's are cached to improve performance.  The cache is split
+ * into independently locked shards (selected by the pattern's hash) so
+ * worker threads can share compiled patterns without serializing on a
+ * single lock, and entries are handed out as QSharedPointers so LRU
+ * eviction can never free a pattern another thread is still matching with.
  */
 class PCRECache
 {
@@ -46,7 +53,7 @@ public:
 
     /**
      * Insert an SPCRE into the cache. The key is the regular expression
-     * pattern by the SPCRE as a string.
+     * pattern by the SPCRE as a string.  The cache takes ownership.
      *
      * @param key The key associated with the SPCRE.
      * @param object The SPCRE to store.
@@ -58,11 +65,21 @@ public:
      * Retrieve the SPCRE object from the cache.
      *
      * If the object does not exist it is created and inserted into te cache
-     * then returned.
+     * then returned.  Safe to call from any thread.
      *
      * @param key The key associated with the SPCRE.
      */
-    SPCRE *getObject(const QString &key);
+    QSharedPointer<SPCRE> getObject(const QString &key);
+
+    /**
+     * Total cost the cache may hold before evicting least recently
+     * used patterns (spread evenly across the shards).
+     */
+    void setCapacity(int max_cost);
+
+    // lifetime hit/miss counts for tuning the capacity
+    int hits() const   { return m_hits.loadAcquire(); }
+    int misses() const { return m_misses.loadAcquire(); }
 
 private:
     /**
@@ -70,10 +87,23 @@ private:
      */
     PCRECache();
 
-    // The cache that we store the SPCRE's.
-    QCache<QString, SPCRE> m_cache;
+    // must be a power of two
+    static const int NUM_SHARDS = 8;
+
+    struct Shard {
+        QMutex mutex;
+        QCache<QString, QSharedPointer<SPCRE> > cache;
+    };
+
+    Shard &shardFor(const QString &key);
+
+    Shard m_shards[NUM_SHARDS];
+    QAtomicInt m_hits;
+    QAtomicInt m_misses;
+
     // The single instance of the cache.
     static PCRECache *m_instance;
+    static QMutex m_instance_mutex;
 };
 
 #endif // PCRECACHE_H
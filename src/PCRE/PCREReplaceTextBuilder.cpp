@@ -19,7 +19,10 @@
 **
 *************************************************************************/
 
+#include <QtCore/QCache>
 #include <QtCore/QChar>
+#include <QtCore/QMutex>
+#include <QtCore/QMutexLocker>
 
 #include "PCRE/PCREReplaceTextBuilder.h"
 #include "Misc/Utility.h"
@@ -53,6 +56,78 @@ bool PCREReplaceTextBuilder::BuildReplacementText(SPCRE &sre,
         return true;
     }
 
+    // The replacement pattern is parsed once per search and replayed as
+    // an op-list for each match; only the per-match work (substituting
+    // the captured text and applying case changes) happens here.
+    QSharedPointer<QList<ReplacementOp> > ops = compiledOps(sre, replacement_pattern);
+    foreach(const ReplacementOp &op, *ops) {
+        switch (op.type) {
+            case ReplacementOp::Op_Literal:
+                accumulateReplcementText(op.literal);
+                break;
+
+            case ReplacementOp::Op_Backref:
+                // Check if there is we have a back reference we can
+                // actually get.
+                if (op.backref >= 0 && op.backref < capture_groups_offsets.count()) {
+                    accumulateReplcementText(Utility::Substring(capture_groups_offsets.at(op.backref).first, capture_groups_offsets.at(op.backref).second, text));
+                } else {
+                    accumulateReplcementText(op.literal);
+                }
+                break;
+
+            case ReplacementOp::Op_LowerNext:
+                trySetCaseChange(CaseChange_LowerNext);
+                break;
+
+            case ReplacementOp::Op_Lower:
+                trySetCaseChange(CaseChange_Lower);
+                break;
+
+            case ReplacementOp::Op_UpperNext:
+                trySetCaseChange(CaseChange_UpperNext);
+                break;
+
+            case ReplacementOp::Op_Upper:
+                trySetCaseChange(CaseChange_Upper);
+                break;
+
+            case ReplacementOp::Op_CaseEnd:
+                m_caseChangeState = CaseChange_None;
+                break;
+        }
+    }
+
+    out = m_finalText;
+    return true;
+}
+
+QSharedPointer<QList<PCREReplaceTextBuilder::ReplacementOp> > PCREReplaceTextBuilder::compiledOps(SPCRE &sre, const QString &replacement_pattern)
+{
+    // Named back references resolve against the regex's capture names,
+    // so the cache key needs the search pattern as well.
+    static QMutex cache_mutex;
+    static QCache<QString, QSharedPointer<QList<ReplacementOp> > > cache(100);
+
+    QString key = sre.getPattern() + QChar(0x1f) + replacement_pattern;
+    QMutexLocker locker(&cache_mutex);
+    QSharedPointer<QList<ReplacementOp> > *entry = cache.object(key);
+    if (entry) {
+        return *entry;
+    }
+
+    locker.unlock();
+    QSharedPointer<QList<ReplacementOp> > ops(compileOps(sre, replacement_pattern));
+    locker.relock();
+    cache.insert(key, new QSharedPointer<QList<ReplacementOp> >(ops));
+    return ops;
+}
+
+QList<PCREReplaceTextBuilder::ReplacementOp> *PCREReplaceTextBuilder::compileOps(SPCRE &sre, const QString &replacement_pattern)
+{
+    QList<ReplacementOp> *ops = new QList<ReplacementOp>();
+    // Literal text accumulated until the next control forces an op.
+    QString literal;
     // Tempory character used as we loop though all characters so we can
     // determine if it is a control character or text.
     QChar c;
@@ -69,10 +144,35 @@ bool PCREReplaceTextBuilder::BuildReplacementText(SPCRE &sre,
     // The state of our progress through the replacment string.
     bool in_control = false;
 
+    // helpers to emit ops while folding adjacent literal text together
+    auto flush_literal = [&]() {
+        if (!literal.isEmpty()) {
+            ReplacementOp op;
+            op.type = ReplacementOp::Op_Literal;
+            op.literal = literal;
+            ops->append(op);
+            literal.clear();
+        }
+    };
+    auto emit_case = [&](ReplacementOp::OpType type) {
+        flush_literal();
+        ReplacementOp op;
+        op.type = type;
+        ops->append(op);
+    };
+    auto emit_backref = [&](int number, const QString &raw) {
+        flush_literal();
+        ReplacementOp op;
+        op.type = ReplacementOp::Op_Backref;
+        op.backref = number;
+        op.literal = raw;
+        ops->append(op);
+    };
+
     // We are going to parse the replacment pattern one character at a time
-    // to build the final replacement string. We need to replace subpatterns
-    // numbered and named with the text matched by the regex. As well as
-    // do any required case chagnes.
+    // to build the op-list. We need to replace subpatterns numbered and
+    // named with the text matched by the regex. As well as do any
+    // required case chagnes.
     //
     // We do a linear replacement one character at a time instead of using
     // a regex because we don't want false positives or replacments
@@ -113,47 +213,38 @@ bool PCREReplaceTextBuilder::BuildReplacementText(SPCRE &sre,
                 // # is special because it's a numbered back reference.
                 // We processed it here.
                 if (c.isDigit()) {
-                    int backref_number = c.digitValue();
-
-                    // Check if this number is a back reference we can
-                    // actually get.
-                    if (backref_number >= 0 && backref_number < capture_groups_offsets.count()) {
-                        accumulateReplcementText(Utility::Substring(capture_groups_offsets.at(backref_number).first, capture_groups_offsets.at(backref_number).second, text));
-                    } else {
-                        accumulateReplcementText(invalid_contol);
-                    }
-
+                    emit_backref(c.digitValue(), invalid_contol);
                     in_control = false;
                 }
                 // Metacharacters
                 else if (c == 'a') {
-                    accumulateReplcementText("\a");
+                    literal += "\a";
                     in_control = false;
                 } else if (c == 'b') {
-                    accumulateReplcementText("\b");
+                    literal += "\b";
                     in_control = false;
                 } else if (c == 'f') {
-                    accumulateReplcementText("\f");
+                    literal += "\f";
                     in_control = false;
                 } else if (c == 'n') {
-                    accumulateReplcementText("\n");
+                    literal += "\n";
                     in_control = false;
                 } else if (c == 'r') {
-                    accumulateReplcementText("\r");
+                    literal += "\r";
                     in_control = false;
                 } else if (c == 't') {
-                    accumulateReplcementText("\t");
+                    literal += "\t";
                     in_control = false;
                 } else if (c == 'v') {
-                    accumulateReplcementText("\v");
+                    literal += "\v";
                     in_control = false;
                 } else if (c == '\\') {
-                    accumulateReplcementText("\\");
+                    literal += "\\";
                     in_control = false;
                 }
                 // End case change.
                 else if (c == 'E') {
-                    m_caseChangeState = CaseChange_None;
+                    emit_case(ReplacementOp::Op_CaseEnd);
                     in_control = false;
                 }
                 // Backreference.
@@ -162,22 +253,22 @@ bool PCREReplaceTextBuilder::BuildReplacementText(SPCRE &sre,
                 }
                 // Lower case next character.
                 else if (c == 'l') {
-                    trySetCaseChange(CaseChange_LowerNext);
+                    emit_case(ReplacementOp::Op_LowerNext);
                     in_control = false;
                 }
                 // Lower case until \E.
                 else if (c == 'L') {
-                    trySetCaseChange(CaseChange_Lower);
+                    emit_case(ReplacementOp::Op_Lower);
                     in_control = false;
                 }
                 // Upper case next character.
                 else if (c == 'u') {
-                    trySetCaseChange(CaseChange_UpperNext);
+                    emit_case(ReplacementOp::Op_UpperNext);
                     in_control = false;
                 }
                 // Upper case until \E.
                 else if (c == 'U') {
-                    trySetCaseChange(CaseChange_Upper);
+                    emit_case(ReplacementOp::Op_Upper);
                     in_control = false;
                 }
             }
@@ -192,7 +283,7 @@ bool PCREReplaceTextBuilder::BuildReplacementText(SPCRE &sre,
                             backref_name.clear();
                         } else {
                             in_control = false;
-                            accumulateReplcementText(invalid_contol);
+                            literal += invalid_contol;
                         }
                     } else {
                         if ((c == '}' && backref_bracket_start_char == '{') ||
@@ -208,14 +299,7 @@ bool PCREReplaceTextBuilder::BuildReplacementText(SPCRE &sre,
                                 backref_number = sre.getCaptureStringNumber(backref_name);
                             }
 
-                            // Check if there is we have a back reference we can
-                            // actually get.
-                            if (backref_number >= 0 && backref_number < capture_groups_offsets.count()) {
-                                accumulateReplcementText(Utility::Substring(capture_groups_offsets.at(backref_number).first, capture_groups_offsets.at(backref_number).second, text));
-                            } else {
-                                accumulateReplcementText(invalid_contol);
-                            }
-
+                            emit_backref(backref_number, invalid_contol);
                             in_control = false;
                         } else {
                             backref_name += c;
@@ -226,17 +310,17 @@ bool PCREReplaceTextBuilder::BuildReplacementText(SPCRE &sre,
                         control_x_hex += c;
 
                         if (control_x_hex.count() == 2) {
-                            accumulateReplcementText(QChar(control_x_hex.toUInt(NULL, 16)));
+                            literal += QChar(control_x_hex.toUInt(NULL, 16));
                             in_control = false;
                         }
                     } else {
-                        accumulateReplcementText(invalid_contol);
+                        literal += invalid_contol;
                         in_control = false;
                     }
                 }
                 // Invalid or unsupported control.
                 else {
-                    accumulateReplcementText(invalid_contol);
+                    literal += invalid_contol;
                     in_control = false;
                 }
             }
@@ -256,7 +340,7 @@ bool PCREReplaceTextBuilder::BuildReplacementText(SPCRE &sre,
             }
             // Normal text.
             else {
-                accumulateReplcementText(c);
+                literal += c;
             }
         }
     }
@@ -265,11 +349,11 @@ bool PCREReplaceTextBuilder::BuildReplacementText(SPCRE &sre,
     // a back reference then we have an invalid back reference because
     // it never ended. Put the invalid reference into the replacment string.
     if (in_control) {
-        accumulateReplcementText(invalid_contol);
+        literal += invalid_contol;
     }
 
-    out = m_finalText;
-    return true;
+    flush_literal();
+    return ops;
 }
 
 void PCREReplaceTextBuilder::accumulateReplcementText(const QChar &ch)
@@ -24,6 +24,8 @@
 #ifndef PCREREPLACETEXTBUILDER_H
 #define PCREREPLACETEXTBUILDER_H
 
+#include <QtCore/QList>
+#include <QtCore/QSharedPointer>
 #include <QtCore/QString>
 
 #include "PCRE/SPCRE.h"
@@ -72,6 +74,44 @@ private:
         CaseChange_None
     };
 
+    /**
+     * One step of a pre-compiled replacement pattern.  The pattern is
+     * parsed into a list of these once per (regex, replacement) pair
+     * and the list is then replayed for every match, so the escape
+     * syntax is not re-parsed hundreds of thousands of times during a
+     * Replace-All.
+     */
+    struct ReplacementOp {
+        enum OpType {
+            Op_Literal,    // emit literal text
+            Op_Backref,    // emit the captured group backref
+            Op_LowerNext,  // \l
+            Op_Lower,      // \L
+            Op_UpperNext,  // \u
+            Op_Upper,      // \U
+            Op_CaseEnd     // \E
+        };
+        OpType type;
+        // literal text for Op_Literal, or the raw control text a bad
+        // backreference falls back to emitting
+        QString literal;
+        // resolved capture group number for Op_Backref
+        int backref;
+        ReplacementOp() : type(Op_Literal), backref(-1) {}
+    };
+
+    /**
+     * Fetch the op-list for this (regex, replacement) pair from the
+     * shared cache, compiling and caching it on first use.
+     */
+    static QSharedPointer<QList<ReplacementOp> > compiledOps(SPCRE &sre, const QString &replacement_pattern);
+
+    /**
+     * Parse the replacement pattern into an op-list.  Named back
+     * references are resolved to group numbers here using the regex.
+     */
+    static QList<ReplacementOp> *compileOps(SPCRE &sre, const QString &replacement_pattern);
+
     /**
      * Reset the state of the replacement process.
      */
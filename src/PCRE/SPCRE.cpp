@@ -20,6 +20,8 @@
 **
 *************************************************************************/
 
+#include <QtCore/QVarLengthArray>
+
 #include "PCRE/SPCRE.h"
 #include "PCRE/PCREReplaceTextBuilder.h"
 #include "sigil_constants.h"
@@ -27,21 +29,141 @@
 // The maximum number of catpures that we will allow.
 const int PCRE_MAX_CAPTURE_GROUPS = 30;
 
-SPCRE::SPCRE(const QString &patten)
-{
-    m_pattern = patten;
-    m_re = NULL;
-    m_study = NULL;
-
 #ifndef PCRE_NO_JIT
 
-    m_jitstack = NULL;
+// One JIT stack per matching thread, shared by every pattern that
+// thread executes.  SPCRE objects can be used from several threads at
+// once (they are handed out by the shared PCRECache), so a stack tied
+// to the pattern would be trampled by concurrent matches; a stack tied
+// to the thread is safe and is reused instead of being reallocated for
+// each compiled pattern.
+namespace {
+
+struct ThreadJitStack {
+    pcre16_jit_stack *stack;
+    ThreadJitStack() : stack(NULL) {}
+    ~ThreadJitStack() {
+        if (stack != NULL) {
+            pcre16_jit_stack_free(stack);
+        }
+    }
+};
+
+pcre16_jit_stack *thread_jit_stack_callback(void *)
+{
+    static thread_local ThreadJitStack holder;
+    if (holder.stack == NULL) {
+        holder.stack = pcre16_jit_stack_alloc(32*1024, 1024*1024);
+    }
+    // returning NULL here just makes the JIT use the machine stack
+    return holder.stack;
+}
+
+} // namespace
 
 #endif
 
+// Step just past a character class opened at p[open], or return -1
+// when it never closes.  Only used to skip content, so a conservative
+// misread upstream simply abandons literal extraction.
+static int SkipCharClass(const QString &p, int open)
+{
+    int i = open + 1;
+
+    if (i < p.length() && p.at(i) == QChar('^')) {
+        ++i;
+    }
+
+    // a leading ] is a literal member of the class
+    if (i < p.length() && p.at(i) == QChar(']')) {
+        ++i;
+    }
+
+    while (i < p.length()) {
+        QChar c = p.at(i);
+
+        if (c == QChar('\\')) {
+            i += 2;
+            continue;
+        }
+
+        if (c == QChar(']')) {
+            return i + 1;
+        }
+
+        ++i;
+    }
+    return -1;
+}
+
+// Step just past a group opened at p[open], respecting nesting,
+// escapes and classes, or return -1 when it never closes.
+static int SkipGroup(const QString &p, int open)
+{
+    int depth = 0;
+    int i = open;
+
+    while (i < p.length()) {
+        QChar c = p.at(i);
+
+        if (c == QChar('\\')) {
+            i += 2;
+            continue;
+        }
+
+        if (c == QChar('[')) {
+            i = SkipCharClass(p, i);
+
+            if (i < 0) {
+                return -1;
+            }
+            continue;
+        }
+
+        if (c == QChar('(')) {
+            depth++;
+        } else if (c == QChar(')')) {
+            depth--;
+
+            if (depth == 0) {
+                return i + 1;
+            }
+        }
+
+        ++i;
+    }
+    return -1;
+}
+
+// Whether the group body (between the parentheses) is a pure inline
+// option set like ?i or ?im-sx, which is zero-width and cannot affect
+// what text a match must contain.
+static bool IsOptionGroupBody(const QString &body)
+{
+    if (!body.startsWith(QChar('?'))) {
+        return false;
+    }
+
+    for (int i = 1; i < body.length(); ++i) {
+        QChar c = body.at(i);
+
+        if (!c.isLetter() && c != QChar('-')) {
+            return false;
+        }
+    }
+    return body.length() > 1;
+}
+
+SPCRE::SPCRE(const QString &patten)
+{
+    m_pattern = patten;
+    m_re = NULL;
+    m_study = NULL;
+    m_jit = false;
     m_captureSubpatternCount = 0;
     m_error = QString();
     m_errpos = -1;
+    m_literalCaseSensitivity = Qt::CaseSensitive;
     const char *error = NULL;
     int erroroffset = -1;
     m_re = pcre16_compile(m_pattern.utf16(), PCRE_UTF16 | PCRE_MULTILINE, &error, &erroroffset, NULL);
@@ -54,9 +176,13 @@ SPCRE::SPCRE(const QString &patten)
 #ifndef PCRE_NO_JIT
 
         m_study = pcre16_study(m_re, PCRE_STUDY_JIT_COMPILE, &error);
-        m_jitstack = pcre16_jit_stack_alloc(32*1024, 1024*1024);
-        if (m_jitstack != NULL) {
-            pcre16_assign_jit_stack(m_study, NULL, m_jitstack);
+        if (m_study != NULL) {
+            pcre16_assign_jit_stack(m_study, thread_jit_stack_callback, NULL);
+            // did the JIT actually compile this pattern, or will exec
+            // quietly fall back to the interpreter?
+            int jit = 0;
+            pcre16_fullinfo(m_re, m_study, PCRE_INFO_JIT, &jit);
+            m_jit = (jit != 0);
         }
 
 #else
@@ -68,11 +194,16 @@ SPCRE::SPCRE(const QString &patten)
         if (m_study) {
             // set recursion limit to prevent issues with stack overflow
             // if JIT is not used
-            m_study->flags = m_study->flags | PCRE_EXTRA_MATCH_LIMIT_RECURSION;
+            m_study->flags = m_study->flags | PCRE_EXTRA_MATCH_LIMIT_RECURSION | PCRE_EXTRA_MATCH_LIMIT;
             m_study->match_limit_recursion = 12000;
+            // bound total backtracking so a catastrophically backtracking
+            // pattern makes pcre16_exec fail with PCRE_ERROR_MATCHLIMIT
+            // instead of freezing the whole app
+            m_study->match_limit = 10000000;
         }
         // Store the number of capture subpatterns.
         pcre16_fullinfo(m_re, m_study, PCRE_INFO_CAPTURECOUNT, &m_captureSubpatternCount);
+        extractLiterals();
     }
     // Pattern is not valid.
     else {
@@ -90,18 +221,10 @@ SPCRE::~SPCRE()
     }
 
     if (m_study != NULL) {
-        pcre16_free(m_study);
+        // free_study also releases any JIT executable code the study holds
+        pcre16_free_study(m_study);
         m_study = NULL;
     }
-
-#ifndef PCRE_NO_JIT
-
-    if (m_jitstack != NULL) {
-        pcre16_jit_stack_free(m_jitstack);
-    }
-
-#endif
-
 }
 
 bool SPCRE::isValid()
@@ -134,6 +257,224 @@ pcre16_extra *SPCRE::getStudy()
     return m_study;
 }
 
+bool SPCRE::isJitCompiled()
+{
+    return m_jit;
+}
+
+QString SPCRE::requiredLiteral()
+{
+    return m_requiredLiteral;
+}
+
+QString SPCRE::prefixLiteral()
+{
+    return m_prefixLiteral;
+}
+
+Qt::CaseSensitivity SPCRE::literalCaseSensitivity()
+{
+    return m_literalCaseSensitivity;
+}
+
+void SPCRE::extractLiterals()
+{
+    // (?i) anywhere can make trailing literals match either case, so
+    // the moment it appears all literal scans go case-insensitive,
+    // which only ever widens the candidate set
+    if (m_pattern.contains("(?i")) {
+        m_literalCaseSensitivity = Qt::CaseInsensitive;
+    }
+
+    const QString &p = m_pattern;
+    QString current;        // run being accumulated
+    QString best;           // longest required run seen
+    QString prefix;         // run every match starts with, if any
+    bool at_match_start = true;     // nothing consuming seen yet
+    bool run_at_start = false;      // current run began at match start
+
+    // close the current run; drop_last removes the run's final char
+    // when a quantifier makes it optional or repeatable
+    auto closeRun = [&](bool drop_last) {
+        if (drop_last && !current.isEmpty()) {
+            current.chop(1);
+        }
+
+        if (!current.isEmpty()) {
+            if (current.length() > best.length()) {
+                best = current;
+            }
+
+            if (run_at_start && prefix.isEmpty()) {
+                prefix = current;
+            }
+        }
+        current.clear();
+    };
+
+    int i = 0;
+
+    while (i < p.length()) {
+        QChar c = p.at(i);
+
+        if (c == QChar('\\')) {
+            if (i + 1 >= p.length()) {
+                return;
+            }
+
+            QChar next = p.at(i + 1);
+
+            if (!next.isLetterOrNumber()) {
+                // escaped punctuation is plain text
+                if (current.isEmpty()) {
+                    run_at_start = at_match_start;
+                }
+                current.append(next);
+                at_match_start = false;
+                i += 2;
+                continue;
+            }
+
+            if (next == QChar('n') || next == QChar('t') || next == QChar('r')) {
+                if (current.isEmpty()) {
+                    run_at_start = at_match_start;
+                }
+                current.append(next == QChar('n') ? QChar('\n') :
+                               next == QChar('t') ? QChar('\t') : QChar('\r'));
+                at_match_start = false;
+                i += 2;
+                continue;
+            }
+
+            if (QString("bBAZzGK").contains(next)) {
+                // zero-width assertions break the run but consume nothing
+                closeRun(false);
+                i += 2;
+                continue;
+            }
+
+            if (next.isDigit() || QString("dDwWsShHvVRN").contains(next)) {
+                // classes and backreferences: one unknown element
+                closeRun(false);
+                at_match_start = false;
+                i += 2;
+                continue;
+            }
+
+            // \Q, \x{...}, \p{...} and friends - give up rather than
+            // risk claiming a literal the pattern does not require
+            best.clear();
+            prefix.clear();
+            return;
+        }
+
+        if (c == QChar('|')) {
+            // top-level alternation: nothing outside it is required
+            best.clear();
+            prefix.clear();
+            return;
+        }
+
+        if (c == QChar('(')) {
+            int end = SkipGroup(p, i);
+
+            if (end < 0) {
+                best.clear();
+                prefix.clear();
+                return;
+            }
+
+            QString body = p.mid(i + 1, end - i - 2);
+            closeRun(false);
+
+            if (!IsOptionGroupBody(body)) {
+                // the group may consume text; runs after it are still
+                // required but no longer sit at the match start
+                at_match_start = false;
+            }
+
+            i = end;
+            continue;
+        }
+
+        if (c == QChar('[')) {
+            int end = SkipCharClass(p, i);
+
+            if (end < 0) {
+                best.clear();
+                prefix.clear();
+                return;
+            }
+
+            closeRun(false);
+            at_match_start = false;
+            i = end;
+            continue;
+        }
+
+        if (c == QChar('^') || c == QChar('$')) {
+            closeRun(false);
+            ++i;
+            continue;
+        }
+
+        if (c == QChar('.')) {
+            closeRun(false);
+            at_match_start = false;
+            ++i;
+            continue;
+        }
+
+        if (c == QChar('?') || c == QChar('*')) {
+            // the previous element is optional or repeatable
+            closeRun(true);
+            ++i;
+            continue;
+        }
+
+        if (c == QChar('+')) {
+            // one occurrence stays required; repeats break the run
+            closeRun(false);
+            ++i;
+            continue;
+        }
+
+        if (c == QChar('{')) {
+            int close = p.indexOf(QChar('}'), i);
+
+            if (close < 0) {
+                best.clear();
+                prefix.clear();
+                return;
+            }
+
+            // treated as a counted quantifier; a minimum of zero makes
+            // dropping the quantified char the only safe reading
+            closeRun(true);
+            i = close + 1;
+            continue;
+        }
+
+        if (c == QChar(')') || c == QChar(']') || c == QChar('}')) {
+            // unbalanced structure; leave the pattern to the engine
+            best.clear();
+            prefix.clear();
+            return;
+        }
+
+        if (current.isEmpty()) {
+            run_at_start = at_match_start;
+        }
+        current.append(c);
+        at_match_start = false;
+        ++i;
+    }
+
+    closeRun(false);
+    m_requiredLiteral = best;
+    m_prefixLiteral = prefix;
+}
+
 int SPCRE::getCaptureSubpatternCount()
 {
     return m_captureSubpatternCount;
@@ -155,15 +496,32 @@ int SPCRE::getCaptureStringNumber(const QString &name)
 }
 
 QList<SPCRE::MatchInfo> SPCRE::getEveryMatchInfo(const QString &text)
+{
+    QList<SPCRE::MatchInfo> info;
+    forEachMatchInfo(text, [&info](const SPCRE::MatchInfo & mi) {
+        info.append(mi);
+        return true;
+    });
+    return info;
+}
+
+int SPCRE::forEachMatchInfo(const QString &text, const std::function<bool(const SPCRE::MatchInfo &)> &callback)
 {
     // This function is very similar to getNextMatchInfo but we don't
     // want to put a call to getNextMatchInfo in a loop because it allocates
     // a new ovector. We want to avoid this and only do one allocation so we
     // reuse the logic and put the call to generateMatchInfo in the loop.
-    QList<SPCRE::MatchInfo> info;
+    int count = 0;
 
     if (m_re == NULL || text.isEmpty()) {
-        return info;
+        return count;
+    }
+
+    // a required literal that never occurs means no matches at all,
+    // for the cost of one optimized substring scan
+    if (!m_requiredLiteral.isEmpty() &&
+        text.indexOf(m_requiredLiteral, 0, m_literalCaseSensitivity) < 0) {
+        return count;
     }
 
     int rc = 0;
@@ -178,12 +536,11 @@ QList<SPCRE::MatchInfo> SPCRE::getEveryMatchInfo(const QString &text)
     // The vector needs to be a multiple of 3 and have at least one location
     // for the full matched string.
     int ovector_size = (1 + ovector_count) * 3;
-    // Allocate only the amount of memory we need for the search pattern and
-    // the number of capture patterns it contains.
-    // Can't use dynamic array alloction (int ovector[ovector_size]) because
-    // MSVC doesn't support it.
-    int *ovector = new int[ovector_size];
-    memset(ovector, 0, sizeof(int)*ovector_size);
+    // The size is bounded by PCRE_MAX_CAPTURE_GROUPS so the storage can live
+    // on the stack; QVarLengthArray stands in for a VLA (int ovector[ovector_size])
+    // because MSVC doesn't support those.
+    QVarLengthArray<int, (1 + PCRE_MAX_CAPTURE_GROUPS) * 3> ovector(ovector_size);
+    memset(ovector.data(), 0, sizeof(int)*ovector_size);
     // We keep track of the last offsets as we move though the string matching
     // sub strings.
     int last_offset[2] = {0};
@@ -197,15 +554,37 @@ QList<SPCRE::MatchInfo> SPCRE::getEveryMatchInfo(const QString &text)
 
         // We only care about matches that have text in it.
         if (last_offset[0] != last_offset[1]) {
-            // Add the matched information to the list.
-            info.append(generateMatchInfo(ovector, ovector_count));
+            // Hand the matched information straight to the caller.
+            count++;
+            if (!callback(generateMatchInfo(ovector.data(), ovector_count))) {
+                break;
+            }
+        }
+
+        // When the pattern opens with a literal no match can start
+        // before its next occurrence, so hop there with a substring
+        // search instead of letting the engine crawl the gap.
+        int start_offset = last_offset[1];
+
+        if (m_prefixLiteral.length() >= 2) {
+            start_offset = text.indexOf(m_prefixLiteral, start_offset, m_literalCaseSensitivity);
+
+            if (start_offset < 0) {
+                break;
+            }
         }
 
-        rc = pcre16_exec(m_re, m_study, text.utf16(), text.length(), last_offset[1], 0, ovector, ovector_size);
+        rc = pcre16_exec(m_re, m_study, text.utf16(), text.length(), start_offset, 0, ovector.data(), ovector_size);
     } while (rc >= 0 && ovector[0] != ovector[1] && ovector[1] != last_offset[1] && ovector[0] < ovector[1]);
 
-    delete[] ovector;
-    return info;
+    return count;
+}
+
+int SPCRE::countMatches(const QString &text)
+{
+    return forEachMatchInfo(text, [](const SPCRE::MatchInfo &) {
+        return true;
+    });
 }
 
 SPCRE::MatchInfo SPCRE::getFirstMatchInfo(const QString &text)
@@ -216,6 +595,11 @@ SPCRE::MatchInfo SPCRE::getFirstMatchInfo(const QString &text)
         return match_info;
     }
 
+    if (!m_requiredLiteral.isEmpty() &&
+        text.indexOf(m_requiredLiteral, 0, m_literalCaseSensitivity) < 0) {
+        return match_info;
+    }
+
     int rc = 0;
     // Set the size of the array based on the number of capture subpatterns
     // if it does not exceed our maximum size.
@@ -228,19 +612,17 @@ SPCRE::MatchInfo SPCRE::getFirstMatchInfo(const QString &text)
     // The vector needs to be a multiple of 3 and have at least one location
     // for the full matched string.
     int ovector_size = (1 + ovector_count) * 3;
-    // Allocate only the amount of memory we need for the search pattern and
-    // the number of capture patterns it contains.
-    // Can't use dynamic array alloction (int ovector[ovector_size]) because
-    // MSVC doesn't support it.
-    int *ovector = new int[ovector_size];
-    memset(ovector, 0, sizeof(int)*ovector_size);
-    rc = pcre16_exec(m_re, m_study, text.utf16(), text.length(), 0, 0, ovector, ovector_size);
+    // The size is bounded by PCRE_MAX_CAPTURE_GROUPS so the storage can live
+    // on the stack; QVarLengthArray stands in for a VLA (int ovector[ovector_size])
+    // because MSVC doesn't support those.
+    QVarLengthArray<int, (1 + PCRE_MAX_CAPTURE_GROUPS) * 3> ovector(ovector_size);
+    memset(ovector.data(), 0, sizeof(int)*ovector_size);
+    rc = pcre16_exec(m_re, m_study, text.utf16(), text.length(), 0, 0, ovector.data(), ovector_size);
 
     if (rc >= 0 && ovector[0] != ovector[1]) {
-        match_info = generateMatchInfo(ovector, ovector_count);
+        match_info = generateMatchInfo(ovector.data(), ovector_count);
     }
 
-    delete[] ovector;
     return match_info;
 }
 
@@ -26,6 +26,7 @@
 #define SPCRE_H
 
 #include <pcre.h>
+#include <functional>
 #include <utility>
 
 #include <QtCore/QList>
@@ -122,6 +123,37 @@ public:
      */
     int getCaptureStringNumber(const QString &name);
 
+    /**
+     * Whether the study produced JIT compiled match code.  When false
+     * pcre16_exec silently falls back to the interpretive matcher.
+     *
+     * @return True if matching will use the JIT.
+     */
+    bool isJitCompiled();
+
+    /**
+     * A literal every match of this pattern must contain, derived
+     * conservatively from the pattern text at compile time.  Empty
+     * when no literal could be derived; extraction gives up rather
+     * than guess, so a non-empty result is always trustworthy.
+     */
+    QString requiredLiteral();
+
+    /**
+     * A literal every match must start with, when the pattern opens
+     * with plain text.  Lets a caller jump the match start offset
+     * between matches with a fast substring search.  Empty when the
+     * pattern does not open with a literal.
+     */
+    QString prefixLiteral();
+
+    /**
+     * The sensitivity literal scans must use: case-insensitive as soon
+     * as the pattern enables (?i) anywhere, which can only widen the
+     * candidate set, never lose a match.
+     */
+    Qt::CaseSensitivity literalCaseSensitivity();
+
     /**
      * Generate match information from a segment of text. Finds all matching
      * instances of pattern within the given text.
@@ -134,6 +166,25 @@ public:
     MatchInfo getFirstMatchInfo(const QString &text);
     MatchInfo getLastMatchInfo(const QString &text);
 
+    /**
+     * Stream every match in the text to a callback as it is found,
+     * without accumulating a list first.  Use this instead of
+     * getEveryMatchInfo when matches are consumed one at a time
+     * (counting, progress reporting) so peak memory stays flat no
+     * matter how many matches a large file produces.
+     *
+     * @param text The text to match against.
+     * @param callback Invoked once per match; return false to stop early.
+     *
+     * @return The number of matches delivered to the callback.
+     */
+    int forEachMatchInfo(const QString &text, const std::function<bool(const MatchInfo &)> &callback);
+
+    /**
+     * The number of matches in the text, streamed so nothing is retained.
+     */
+    int countMatches(const QString &text);
+
     /**
      * Replaces the given text using a replacement pattern. The matched text is
      * required because the replacement pattern can references the capture
@@ -153,6 +204,13 @@ public:
 private:
     MatchInfo generateMatchInfo(int ovector[], int ovector_count);
 
+    /**
+     * Walks the pattern text collecting runs of plain characters that
+     * every match must contain, bailing out entirely on anything it
+     * cannot reason about (top-level alternation, exotic escapes).
+     */
+    void extractLiterals();
+
     // Store if the pattern is valid.
     bool m_valid;
     // error message and offset if not valid 
@@ -166,13 +224,14 @@ private:
     pcre16_extra *m_study;
     // The number of capture subpatterns with the expression.
     int m_captureSubpatternCount;
-
-#ifndef PCRE_NO_JIT
-
-    pcre16_jit_stack* m_jitstack;
-
-#endif
-
+    // Whether the study produced JIT match code.
+    bool m_jit;
+    // Longest literal run every match must contain (may be empty).
+    QString m_requiredLiteral;
+    // Literal run every match must start with (may be empty).
+    QString m_prefixLiteral;
+    // Sensitivity literal scans against text must use.
+    Qt::CaseSensitivity m_literalCaseSensitivity;
 };
 
 #endif // SPCRE_H
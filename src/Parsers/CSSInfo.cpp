@@ -25,8 +25,12 @@
 #include "EmbedPython/EmbeddedPython.h"
 
 #include <QString>
+#include <QCryptographicHash>
 #include <QDebug>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QRegularExpression>
+#include <QtConcurrent/QtConcurrent>
 #include "Misc/Utility.h"
 #include "Parsers/CSSInfo.h"
 
@@ -34,6 +38,19 @@ const int TAB_SPACES_WIDTH = 4;
 const QString LINE_MARKER("[SIGIL_NEWLINE]");
 static const QString DELIMITERS = "}{;";
 
+// Running qCSSParser over the stylesheet is the expensive part of
+// building a CSSInfo, and the same text is parsed again and again by
+// independent consumers (class queries, reformatting, link updates,
+// the style usage reports).  The token streams are therefore memoized
+// per text revision; tokens are cached with no caller offset applied
+// so style-block extracts at different offsets can still share them.
+// The mutex is needed because parseBatch() runs constructors on the
+// global thread pool.
+static QHash<QByteArray, QVector<CSSParser::token>> css_token_cache;
+static QList<QByteArray> css_token_order;
+static QMutex css_token_mutex;
+static const int MAX_CACHED_TOKEN_STREAMS = 100;
+
 // Note: CSSProperties and CSSSelectors are simple struct that this code
 // created with new and so need to be manually cleaned up to prevent
 // large memory leaks
@@ -46,6 +63,19 @@ CSSInfo::CSSInfo(const QString &text, int offset)
 }
 
 
+static CSSInfo *ParseOneCSSText(const QString &text)
+{
+    return new CSSInfo(text);
+}
+
+
+// static
+QList<CSSInfo *> CSSInfo::parseBatch(const QList<QString> &texts)
+{
+    return QtConcurrent::blockingMapped(texts, ParseOneCSSText);
+}
+
+
 // Need to manually clean up the Selector List since allcated with new
 CSSInfo::~CSSInfo()
 {
@@ -68,15 +98,10 @@ QList<CSSInfo::CSSSelector *> CSSInfo::getAllSelectors()
 
 QList<CSSInfo::CSSSelector *> CSSInfo::getClassSelectors(const QString filterClassName)
 {
-    QList<CSSInfo::CSSSelector *> selectors;
-    foreach(CSSInfo::CSSSelector * cssSelector, m_CSSSelectors) {
-        if (!cssSelector->className.isEmpty()) {
-            if (filterClassName.isEmpty() || cssSelector->className == filterClassName) {
-                selectors.append(cssSelector);
-            }
-        }
+    if (filterClassName.isEmpty()) {
+        return m_classSelectors;
     }
-    return selectors;
+    return m_classIndex.value(filterClassName);
 }
 
 
@@ -104,10 +129,9 @@ CSSInfo::CSSSelector *CSSInfo::getCSSSelectorForElementClass(const QString &elem
         }
     } else {
         // try match on element name alone
-        foreach(CSSInfo::CSSSelector * cssSelector, m_CSSSelectors) {
-            if ((cssSelector->elementName == elementName) && (cssSelector->className.isEmpty())) {
-                return cssSelector;
-            }
+        QList<CSSInfo::CSSSelector *> element_selectors = m_elementIndex.value(elementName);
+        if (!element_selectors.isEmpty()) {
+            return element_selectors.first();
         }
     }
     return NULL;
@@ -135,11 +159,7 @@ QList<CSSInfo::CSSSelector *> CSSInfo::getAllCSSSelectorsForElementClass(const Q
         }
     } else {
         // try match on element name alone
-        foreach(CSSInfo::CSSSelector * cssSelector, m_CSSSelectors) {
-            if ((cssSelector->elementName == elementName) && (cssSelector->className.isEmpty())) {
-                matches.append(cssSelector);
-            }
-        }
+        matches = m_elementIndex.value(elementName);
     }
     return matches;
 }
@@ -300,34 +320,70 @@ QString CSSInfo::removeMatchingSelectors(QList<CSSSelector *> cssSelectors)
 
 void CSSInfo::parseStyles(const QString &text, int offset)
 {
-    CSSParser cp;
-    cp.set_level("CSS3.0"); // most permissive
-    cp.parse_css(text);
+    QCryptographicHash sum(QCryptographicHash::Sha1);
+    sum.addData(QByteArray::fromRawData(reinterpret_cast<const char *>(text.constData()),
+                                        text.size() * int(sizeof(QChar))));
+    QByteArray key = sum.result();
 
-    // report any parser errors (should we abort?)
-    QVector<QString> errors = cp.get_parse_errors();
-    for(int i = 0; i < errors.size(); i++) {
-        qDebug() << "  CSS Parser Error: " << errors[i] << "\n";
+    QVector<CSSParser::token> base_tokens;
+    bool found = false;
+    {
+        QMutexLocker locker(&css_token_mutex);
+        if (css_token_cache.contains(key)) {
+            css_token_order.removeOne(key);
+            css_token_order.append(key);
+            base_tokens = css_token_cache.value(key);
+            found = true;
+        }
     }
 
-    // now store the sequence of parsed tokens
-    CSSParser::token atoken = cp.get_next_token();
-    while(atoken.type != CSSParser::CSS_END)
-    {
+    if (!found) {
+        CSSParser cp;
+        cp.set_level("CSS3.0"); // most permissive
+        cp.parse_css(text);
+
+        // report any parser errors (should we abort?)
+        QVector<QString> errors = cp.get_parse_errors();
+        for(int i = 0; i < errors.size(); i++) {
+            qDebug() << "  CSS Parser Error: " << errors[i] << "\n";
+        }
+
+        // now store the sequence of parsed tokens
+        CSSParser::token atoken = cp.get_next_token();
+        while(atoken.type != CSSParser::CSS_END)
+        {
+            base_tokens.append(atoken);
+            atoken = cp.get_next_token();
+        }
         CSSParser::token temp;
-        temp.pos = atoken.pos + offset;
-        temp.line = atoken.line;
-        temp.type = atoken.type;
-        temp.data = atoken.data;
-        m_csstokens.append(temp);
-        atoken = cp.get_next_token();
+        temp.pos = -1;
+        temp.line = -1;
+        temp.type = CSSParser::CSS_END;
+        temp.data = "";
+        base_tokens.append(temp);  // end marker token
+
+        QMutexLocker locker(&css_token_mutex);
+        if (!css_token_cache.contains(key)) {
+            css_token_cache.insert(key, base_tokens);
+            css_token_order.append(key);
+            if (css_token_order.count() > MAX_CACHED_TOKEN_STREAMS) {
+                css_token_cache.remove(css_token_order.takeFirst());
+            }
+        }
+    }
+
+    if (offset == 0) {
+        // implicitly shared, no per-token copy needed
+        m_csstokens = base_tokens;
+    } else {
+        m_csstokens.reserve(base_tokens.size());
+        foreach(CSSParser::token atoken, base_tokens) {
+            if (atoken.type != CSSParser::CSS_END) {
+                atoken.pos += offset;
+            }
+            m_csstokens.append(atoken);
+        }
     }
-    CSSParser::token temp;
-    temp.pos = -1;
-    temp.line = -1;
-    temp.type = CSSParser::CSS_END;
-    temp.data = "";
-    m_csstokens.append(temp);  // end marker token
 
     generateSelectorsList();
 }
@@ -364,6 +420,14 @@ void CSSInfo::generateSelectorsList()
                     }
                 }
                 m_CSSSelectors.append(selector);
+
+                // keep the persistent lookup indexes in step
+                if (!selector->className.isEmpty()) {
+                    m_classSelectors.append(selector);
+                    m_classIndex[selector->className].append(selector);
+                } else if (!selector->elementName.isEmpty()) {
+                    m_elementIndex[selector->elementName].append(selector);
+                }
             }
         }
         i++;
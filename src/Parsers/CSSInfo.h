@@ -27,6 +27,7 @@
 #define CSSINFO_H
 
 #include <QObject>
+#include <QHash>
 #include <QStringList>
 #include "Parsers/qCSSParser.h"
 
@@ -44,6 +45,13 @@ public:
 
     ~CSSInfo();
 
+    /**
+     * Parse a batch of stylesheets across the global thread pool,
+     * returning one CSSInfo per text in input order.
+     * Caller takes ownership of the returned objects.
+     */
+    static QList<CSSInfo *> parseBatch(const QList<QString> &texts);
+
     struct CSSSelector {
         int pos;                    /* The position in the file of the full selector name          */
         QString text;               /* The text of this selector                  */
@@ -102,6 +110,13 @@ private:
     void generateSelectorsList();
 
     QList<CSSSelector *> m_CSSSelectors;
+
+    // persistent indexes built once per parse so class/element usage
+    // queries need not rescan the whole selector list every call
+    QHash<QString, QList<CSSSelector *> > m_classIndex;   // className -> selectors in document order
+    QHash<QString, QList<CSSSelector *> > m_elementIndex; // pure element selectors in document order
+    QList<CSSSelector *> m_classSelectors;                // every selector with a class, in document order
+
     QVector<CSSParser::token> m_csstokens;
 
     QString m_source;
@@ -21,14 +21,20 @@
 
 #include <QString>
 #include <QStringList>
+#include <cstring>
+
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
 #include <QDir>
 #include <QUrl>
 #include <QFileInfo>
+#include <QCryptographicHash>
+#include <QMutex>
+#include <QMutexLocker>
 // #include <QDebug>
 
 #include "Misc/Utility.h"
+#include "Misc/Tracer.h"
 #include "Query/CSelection.h"
 #include "Query/CNode.h"
 #include "Parsers/GumboInterface.h"
@@ -144,10 +150,58 @@ GumboInterface::GumboInterface(const QString &source, const QString &version, co
 }
 
 
+// In case we ever have to revert to earlier versions, please note the following
+// additional initialization is needed because Microsoft Visual Studio 2013 (and earlier?)
+// do not properly initialize myoptions from the static const kGumboDefaultOptions defined
+// in the gumbo library.  Instead whatever was in memory at the time is used causing random
+// issues later on so if reverting remember to keep these specific changes as the bug
+// they work around took a long long time to track down
+static GumboOptions sigil_gumbo_options()
+{
+    GumboOptions myoptions = kGumboDefaultOptions;
+    myoptions.tab_stop = 4;
+    myoptions.use_xhtml_rules = true;
+    myoptions.stop_on_first_error = false;
+    myoptions.max_tree_depth = 400;
+    myoptions.max_errors = 50;
+    return myoptions;
+}
+
+// remove any xml header line and any trailing whitespace
+static void strip_xml_header(std::string &utf8src)
+{
+    if (utf8src.compare(0,5,"<?xml") == 0) {
+        size_t end = utf8src.find_first_of('>', 5);
+        end = utf8src.find_first_not_of("\n\r\t\v\f ",end+1);
+        utf8src.erase(0,end);
+    }
+}
+
+// A cached parse keeps the output tree together with the utf8 source
+// buffer its internal pointers reference, destroying both as one unit
+// once the last sharing GumboInterface is gone
+struct GumboCacheEntry {
+    GumboOutput* output;
+    std::string  utf8src;
+    GumboCacheEntry() : output(NULL) {}
+    ~GumboCacheEntry() {
+        if (output != NULL) gumbo_destroy_output(output);
+    }
+};
+
+static const int MAX_CACHED_TREES = 8;
+static QMutex tree_cache_mutex;
+static QHash<QByteArray, QSharedPointer<GumboCacheEntry> > tree_cache;
+static QList<QByteArray> tree_cache_order; // most recently used last
+
+
 GumboInterface::~GumboInterface()
 {
     if (m_output != NULL) {
-        gumbo_destroy_output(m_output);
+        // a shared tree is owned by its cache entry, not by us
+        if (m_cache_entry.isNull()) {
+            gumbo_destroy_output(m_output);
+        }
         m_output = NULL;
         m_utf8src = "";
     }
@@ -156,28 +210,13 @@ GumboInterface::~GumboInterface()
 
 void GumboInterface::parse()
 {
+    SIGIL_TRACE_SCOPE("GumboInterface::parse");
     if (!m_source.isEmpty() && (m_output == NULL)) {
 
         m_utf8src = m_source.toStdString();
-        // remove any xml header line and any trailing whitespace
-        if (m_utf8src.compare(0,5,"<?xml") == 0) {
-            size_t end = m_utf8src.find_first_of('>', 5);
-            end = m_utf8src.find_first_not_of("\n\r\t\v\f ",end+1);
-            m_utf8src.erase(0,end);
-        }
+        strip_xml_header(m_utf8src);
 
-        // In case we ever have to revert to earlier versions, please note the following
-        // additional initialization is needed because Microsoft Visual Studio 2013 (and earlier?)
-        // do not properly initialize myoptions from the static const kGumboDefaultOptions defined
-        // in the gumbo library.  Instead whatever was in memory at the time is used causing random 
-        // issues later on so if reverting remember to keep these specific changes as the bug 
-        // they work around took a long long time to track down
-        GumboOptions myoptions = kGumboDefaultOptions;
-        myoptions.tab_stop = 4;
-        myoptions.use_xhtml_rules = true;
-        myoptions.stop_on_first_error = false;
-        myoptions.max_tree_depth = 400;
-        myoptions.max_errors = 50;
+        GumboOptions myoptions = sigil_gumbo_options();
 
         // GumboInterface::m_mutex.lock();
         m_output = gumbo_parse_with_options(&myoptions, m_utf8src.data(), m_utf8src.length());
@@ -186,22 +225,63 @@ void GumboInterface::parse()
 }
 
 
+void GumboInterface::parse_cached()
+{
+    if (m_source.isEmpty() || (m_output != NULL)) return;
+
+    QByteArray key = QCryptographicHash::hash(
+        QByteArray::fromRawData(reinterpret_cast<const char*>(m_source.constData()),
+                                m_source.size() * int(sizeof(QChar))),
+        QCryptographicHash::Sha1);
+    {
+        QMutexLocker locker(&tree_cache_mutex);
+        QSharedPointer<GumboCacheEntry> entry = tree_cache.value(key);
+        if (!entry.isNull()) {
+            tree_cache_order.removeOne(key);
+            tree_cache_order << key;
+            m_cache_entry = entry;
+            m_output = entry->output;
+            return;
+        }
+    }
+
+    // miss - parse into a fresh shareable entry
+    QSharedPointer<GumboCacheEntry> entry(new GumboCacheEntry());
+    entry->utf8src = m_source.toStdString();
+    strip_xml_header(entry->utf8src);
+
+    GumboOptions myoptions = sigil_gumbo_options();
+    entry->output = gumbo_parse_with_options(&myoptions, entry->utf8src.data(), entry->utf8src.length());
+    m_cache_entry = entry;
+    m_output = entry->output;
+
+    QMutexLocker locker(&tree_cache_mutex);
+    if (!tree_cache.contains(key)) {
+        tree_cache.insert(key, entry);
+        tree_cache_order << key;
+        while (tree_cache_order.size() > MAX_CACHED_TREES) {
+            tree_cache.remove(tree_cache_order.takeFirst());
+        }
+    }
+}
+
+
+void GumboInterface::tree_cache_stats(int &entries, qint64 &source_bytes)
+{
+    QMutexLocker locker(&tree_cache_mutex);
+    entries = tree_cache.size();
+    source_bytes = 0;
+    foreach(QSharedPointer<GumboCacheEntry> entry, tree_cache) {
+        source_bytes += qint64(entry->utf8src.size());
+    }
+}
+
+
 void GumboInterface::parse_fragment()
 {
     if (!m_source.isEmpty() && (m_output == NULL)) {
 
-        // In case we ever have to revert to earlier versions, please note the following
-        // additional initialization is needed because Microsoft Visual Studio 2013 (and earlier?)
-        // do not properly initialize myoptions from the static const kGumboDefaultOptions defined
-        // in the gumbo library.  Instead whatever was in memory at the time is used causing random
-        // issues later on so if reverting remember to keep these specific changes as the bug
-        // they work around took a long long time to track down
-        GumboOptions myoptions = kGumboDefaultOptions;
-        myoptions.tab_stop = 4;
-        myoptions.use_xhtml_rules = true;
-        myoptions.stop_on_first_error = false;
-        myoptions.max_tree_depth = 400;
-        myoptions.max_errors = 50;
+        GumboOptions myoptions = sigil_gumbo_options();
 
         m_utf8src = m_source.toStdString();
         m_output = gumbo_parse_fragment(&myoptions, m_utf8src.data(), m_utf8src.length(),
@@ -220,7 +300,8 @@ QString GumboInterface::repair()
         }
         std::string utf8out = serialize(m_output->document);
         rtrim(utf8out);
-        result =  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" + QString::fromStdString(utf8out);
+        utf8out.insert(0, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
+        result = QString::fromStdString(utf8out);
     }
     return result;
 }
@@ -250,7 +331,8 @@ QString GumboInterface::getxhtml()
         }
         std::string utf8out = serialize(m_output->document);
         rtrim(utf8out);
-        result =  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" + QString::fromStdString(utf8out);
+        utf8out.insert(0, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
+        result = QString::fromStdString(utf8out);
     }
     return result;
 }
@@ -262,9 +344,12 @@ QList<GumboNode *> GumboInterface::findnodes(const QString &aSelector)
         if (m_output == NULL) {
             parse();
         }
+        if (!m_index.built()) {
+            m_index.build(m_output->root);
+        }
         std::string as = aSelector.toStdString();
         CSelection sel(m_output->root);
-        CSelection res = sel.find(as);
+        CSelection res = sel.find(as, &m_index);
         for (unsigned int i=0; i < res.nodeNum(); i++) {
             nodes << res.nodeAt(i).raw();
         }
@@ -278,9 +363,14 @@ CSelection GumboInterface::find(const QString &aSelector)
         if (m_output == NULL) {
             parse();
         }
+        // built lazily on the first query and reused for every query
+        // against this parse, so repeated selectors cost O(candidates)
+        if (!m_index.built()) {
+            m_index.build(m_output->root);
+        }
         std::string as = aSelector.toStdString();
         CSelection sel(m_output->root);
-        return sel.find(as);
+        return sel.find(as, &m_index);
     }
     return CSelection(NULL);
 }
@@ -296,7 +386,8 @@ QString GumboInterface::prettyprint(QString indent_chars)
         std::string ind = indent_chars.toStdString();
         std::string utf8out = prettyprint(m_output->document, 0, ind);
         rtrim(utf8out);
-        result =  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" + QString::fromStdString(utf8out);
+        utf8out.insert(0, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
+        result = QString::fromStdString(utf8out);
     }
     return result;
 }
@@ -329,7 +420,8 @@ QString GumboInterface::perform_source_updates(const QString& my_current_book_re
         enum UpdateTypes doupdates = SourceUpdates;
         std::string utf8out = serialize(m_output->document, doupdates);
         rtrim(utf8out);
-        result =  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" + QString::fromStdString(utf8out);
+        utf8out.insert(0, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
+        result = QString::fromStdString(utf8out);
     }
     return result;
 }
@@ -350,12 +442,58 @@ QString GumboInterface::perform_style_updates(const QString& my_current_book_rel
         enum UpdateTypes doupdates = StyleUpdates;
         std::string utf8out = serialize(m_output->document, doupdates);
         rtrim(utf8out);
-        result =  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" + QString::fromStdString(utf8out);
+        utf8out.insert(0, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
+        result = QString::fromStdString(utf8out);
     }
     return result;
 }
 
 
+QString GumboInterface::perform_source_and_style_updates(const QString& my_current_book_relpath,
+                                                         const QString& newbookpath)
+{
+    m_currentbkpath = my_current_book_relpath;
+    m_currentdir = QFileInfo(m_currentbkpath).dir().path();
+    m_newbookpath = newbookpath;
+
+    QString result = "";
+    if (!m_source.isEmpty()) {
+        if (m_output == NULL) {
+            parse();
+        }
+        // the update types are flags, so both rewrites ride one walk
+        enum UpdateTypes doupdates = (enum UpdateTypes)(SourceUpdates | StyleUpdates);
+        std::string utf8out = serialize(m_output->document, doupdates);
+        rtrim(utf8out);
+        utf8out.insert(0, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
+        result = QString::fromStdString(utf8out);
+    }
+    return result;
+}
+
+
+QString GumboInterface::rewrite_href_src_value(const QString &attvalue,
+                                               const QString& my_current_book_relpath,
+                                               const QString& newbookpath)
+{
+    m_currentbkpath = my_current_book_relpath;
+    m_currentdir = QFileInfo(m_currentbkpath).dir().path();
+    m_newbookpath = newbookpath;
+    return QString::fromStdString(update_attribute_value(attvalue.toStdString()));
+}
+
+
+QString GumboInterface::rewrite_css_urls(const QString &css,
+                                         const QString& my_current_book_relpath,
+                                         const QString& newbookpath)
+{
+    m_currentbkpath = my_current_book_relpath;
+    m_currentdir = QFileInfo(m_currentbkpath).dir().path();
+    m_newbookpath = newbookpath;
+    return QString::fromStdString(update_style_urls(css.toStdString()));
+}
+
+
 QString GumboInterface::perform_link_updates(const QString& newcsslinks)
 {
     m_newcsslinks = newcsslinks.toStdString();
@@ -367,7 +505,8 @@ QString GumboInterface::perform_link_updates(const QString& newcsslinks)
         enum UpdateTypes doupdates = LinkUpdates;
         std::string utf8out = serialize(m_output->document, doupdates);
         rtrim(utf8out);
-        result =  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" + QString::fromStdString(utf8out);
+        utf8out.insert(0, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
+        result = QString::fromStdString(utf8out);
     }
     return result;
 }
@@ -384,7 +523,8 @@ QString GumboInterface::perform_javascript_updates(const QString& newjslinks)
         enum UpdateTypes doupdates = JavascriptUpdates;
         std::string utf8out = serialize(m_output->document, doupdates);
         rtrim(utf8out);
-        result =  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" + QString::fromStdString(utf8out);
+        utf8out.insert(0, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
+        result = QString::fromStdString(utf8out);
     }
     return result;
 }
@@ -609,7 +749,8 @@ QString GumboInterface::perform_body_updates(const QString & new_body)
     m_newbody = new_body.toStdString();
     enum UpdateTypes doupdates = BodyUpdates;
     std::string utf8out = serialize(m_output->document, doupdates);
-    result =  "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n" + QString::fromStdString(utf8out);
+    utf8out.insert(0, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n");
+    result = QString::fromStdString(utf8out);
     m_newbody= "";
     return result;
 }
@@ -752,6 +893,35 @@ QList<GumboNode*> GumboInterface::get_element_nodes_with_prefix(GumboNode * node
 }
 
 
+void GumboInterface::visit_all(const std::function<bool(GumboNode*)> &visitor)
+{
+    if (!m_source.isEmpty()) {
+        if (m_output == NULL) {
+            parse();
+        }
+        visit_from(m_output->document, visitor);
+    }
+}
+
+
+// static
+void GumboInterface::visit_from(GumboNode* node, const std::function<bool(GumboNode*)> &visitor)
+{
+    if (!visitor(node)) return;
+    const GumboVector* children = NULL;
+    if (node->type == GUMBO_NODE_DOCUMENT) {
+        children = &node->v.document.children;
+    } else if (node->type == GUMBO_NODE_ELEMENT) {
+        children = &node->v.element.children;
+    } else {
+        return;
+    }
+    for (unsigned int i = 0; i < children->length; ++i) {
+        visit_from(static_cast<GumboNode*>(children->data[i]), visitor);
+    }
+}
+
+
 QList<GumboNode*> GumboInterface::get_all_nodes_with_attribute(const QString& attname)
 {
     QList<GumboNode*> nodes;
@@ -767,18 +937,14 @@ QList<GumboNode*> GumboInterface::get_all_nodes_with_attribute(const QString& at
 
 QList<GumboNode*> GumboInterface::get_nodes_with_attribute(GumboNode* node, const char * attname)
 {
-  if (node->type != GUMBO_NODE_ELEMENT) {
-    return QList<GumboNode*>();
-  }
   QList<GumboNode*> nodes;
-  GumboAttribute* attr = gumbo_get_attribute(&node->v.element.attributes, attname);
-  if (attr) {
-      nodes.append(node);
-  }
-  GumboVector* children = &node->v.element.children;
-  for (unsigned int i = 0; i < children->length; ++i) {
-      nodes.append(get_nodes_with_attribute(static_cast<GumboNode*>(children->data[i]), attname));
-  }
+  visit_from(node, [&nodes, attname](GumboNode* n) {
+      if (n->type == GUMBO_NODE_ELEMENT) {
+          GumboAttribute* attr = gumbo_get_attribute(&n->v.element.attributes, attname);
+          if (attr) nodes.append(n);
+      }
+      return true;
+  });
   return nodes;
 }
 
@@ -796,20 +962,16 @@ QStringList GumboInterface::get_all_values_for_attribute(const QString& attname)
 }
 
 
-QStringList  GumboInterface::get_values_for_attr(GumboNode* node, const char* attr_name) 
+QStringList  GumboInterface::get_values_for_attr(GumboNode* node, const char* attr_name)
 {
-    if (node->type != GUMBO_NODE_ELEMENT) {
-        return QStringList();
-    }
     QStringList attr_vals;
-    GumboAttribute* attr = gumbo_get_attribute(&node->v.element.attributes, attr_name);
-    if (attr != NULL) {
-        attr_vals.append(QString::fromUtf8(attr->value));
-    }
-    GumboVector* children = &node->v.element.children;
-    for (unsigned int i = 0; i < children->length; ++i) {
-        attr_vals.append(get_values_for_attr(static_cast<GumboNode*>(children->data[i]), attr_name));
-    }
+    visit_from(node, [&attr_vals, attr_name](GumboNode* n) {
+        if (n->type == GUMBO_NODE_ELEMENT) {
+            GumboAttribute* attr = gumbo_get_attribute(&n->v.element.attributes, attr_name);
+            if (attr != NULL) attr_vals.append(QString::fromUtf8(attr->value));
+        }
+        return true;
+    });
     return attr_vals;
 }
 
@@ -886,20 +1048,15 @@ QList<GumboNode*> GumboInterface::get_all_nodes_with_tags(const QList<GumboTag>
 }
 
 
-QList<GumboNode*>  GumboInterface::get_nodes_with_tags(GumboNode* node, const QList<GumboTag> & tags) 
+QList<GumboNode*>  GumboInterface::get_nodes_with_tags(GumboNode* node, const QList<GumboTag> & tags)
 {
-    if (node->type != GUMBO_NODE_ELEMENT) {
-        return QList<GumboNode*>();
-    }
     QList<GumboNode*> nodes;
-    GumboTag tag = node ->v.element.tag;
-    if (tags.contains(tag)) {
-        nodes.append(node);
-    }
-    GumboVector* children = &node->v.element.children;
-    for (unsigned int i = 0; i < children->length; ++i) {
-        nodes.append(get_nodes_with_tags(static_cast<GumboNode*>(children->data[i]), tags));
-    }
+    visit_from(node, [&nodes, &tags](GumboNode* n) {
+        if (n->type == GUMBO_NODE_ELEMENT) {
+            if (tags.contains(n->v.element.tag)) nodes.append(n);
+        }
+        return true;
+    });
     return nodes;
 }
 
@@ -1218,8 +1375,42 @@ std::string GumboInterface::build_attributes(GumboAttribute * at, bool no_entiti
 // serialize children of a node
 // may be invoked recursively
 
+// Appends text to out with &, < and > replaced in a single pass, instead
+// of the repeated whole-string scans substitute_xml_entities_into_text makes.
+static void append_with_xml_entities(const char *text, std::string &out)
+{
+    for (const char *p = text; *p != '\0'; ++p) {
+        switch (*p) {
+            case '&': out.append("&amp;");  break;
+            case '<': out.append("&lt;");   break;
+            case '>': out.append("&gt;");   break;
+            default:  out.push_back(*p);    break;
+        }
+    }
+}
+
+
+// Trims trailing whitespace from out without reaching back before floor,
+// so a serializer working in a shared buffer only touches its own region.
+static void rtrim_region(std::string &out, size_t floor)
+{
+    size_t keep = out.find_last_not_of(" \n\r\t\v\f");
+    keep = (keep == std::string::npos) ? 0 : keep + 1;
+    if (keep < floor) keep = floor;
+    out.erase(keep);
+}
+
+
 std::string GumboInterface::serialize_contents(GumboNode* node, enum UpdateTypes doupdates) {
-    std::string contents        = "";
+    std::string contents;
+    contents.reserve(m_utf8src.length() + m_utf8src.length() / 8 + 64);
+    serialize_contents_to(node, doupdates, contents);
+    return contents;
+}
+
+
+void GumboInterface::serialize_contents_to(GumboNode* node, enum UpdateTypes doupdates, std::string &out) {
+    size_t region_start         = out.size();
     std::string tagname         = get_tag_name(node);
     bool no_entity_substitution = in_set(no_entity_sub, tagname);
     bool keep_whitespace        = in_set(preserve_whitespace, tagname);
@@ -1236,61 +1427,65 @@ std::string GumboInterface::serialize_contents(GumboNode* node, enum UpdateTypes
         GumboNode* child = static_cast<GumboNode*> (children->data[i]);
 
         if (child->type == GUMBO_NODE_TEXT) {
-            std::string text;
+            const char * text = child->v.text.text;
+            if (injected_newline && (text[0] == '\n')) text++;
+            injected_newline = false;
             if (no_entity_substitution) {
-                text = std::string(child->v.text.text);
+                out.append(text);
             } else {
-                text = substitute_xml_entities_into_text(std::string(child->v.text.text));
+                append_with_xml_entities(text, out);
             }
-            if (injected_newline && !text.empty() && (text.at(0) == '\n')) text.erase(0,1);
-            injected_newline = false;
-            contents.append(text);
 
         } else if (child->type == GUMBO_NODE_ELEMENT || child->type == GUMBO_NODE_TEMPLATE) {
-            std::string tagstring = serialize(child, doupdates);
-            // empty tagstring means this tag node is being removed
-            if (tagstring.empty()) {
+            size_t child_start = out.size();
+            serialize_to(child, doupdates, out);
+            // nothing appended means this tag node is being removed
+            if (out.size() == child_start) {
                 // strip off trailing whitespace from predecessor tag
-                rtrim(contents);
-                contents.append("\n"); 
+                rtrim_region(out, region_start);
+                out.append("\n");
                 // strip out any associated newline in trailing whitespace node
                 injected_newline = true;
             } else {
-                contents.append(tagstring);
                 injected_newline = false;
                 std::string childname = get_tag_name(child);
                 if (in_head_without_title && (childname == "title")) in_head_without_title = false;
                 if (!is_inline && !keep_whitespace && !in_set(nonbreaking_inline,childname) && is_structural) {
-                    contents.append("\n");
+                    out.append("\n");
                     injected_newline = true;
                 }
             }
 
         } else if (child->type == GUMBO_NODE_WHITESPACE) {
             // try to keep all whitespace to keep as close to original as possible
-            std::string wspace = std::string(child->v.text.text);
+            const char * wspace = child->v.text.text;
             if (injected_newline) {
-                newlinetrim(wspace);
+                // delete everything up to and including the newline
+                const char * nl = strchr(wspace, '\n');
+                if (nl != NULL) wspace = nl + 1;
                 injected_newline = false;
             }
-            contents.append(wspace);
+            out.append(wspace);
             injected_newline = false;
 
         } else if (child->type == GUMBO_NODE_CDATA) {
-            contents.append("<![CDATA[" + std::string(child->v.text.text) + "]]>");
+            out.append("<![CDATA[");
+            out.append(child->v.text.text);
+            out.append("]]>");
             injected_newline = false;
 
         } else if (child->type == GUMBO_NODE_COMMENT) {
-            contents.append("<!--" + std::string(child->v.text.text) + "-->");
- 
+            out.append("<!--");
+            out.append(child->v.text.text);
+            out.append("-->");
+
         } else {
-            fprintf(stderr, "unknown element of type: %d\n", child->type); 
+            fprintf(stderr, "unknown element of type: %d\n", child->type);
             injected_newline = false;
         }
 
     }
-    if (in_head_without_title) contents.append("<title></title>");
-    return contents;
+    if (in_head_without_title) out.append("<title></title>");
 }
 
 
@@ -1298,15 +1493,26 @@ std::string GumboInterface::serialize_contents(GumboNode* node, enum UpdateTypes
 // may be invoked recursively
 
 std::string GumboInterface::serialize(GumboNode* node, enum UpdateTypes doupdates) {
+    std::string results;
+    results.reserve(m_utf8src.length() + m_utf8src.length() / 8 + 64);
+    serialize_to(node, doupdates, results);
+    return results;
+}
+
+
+// Appends the serialization of node to out.  The whole document is built
+// in this one buffer: children append their output in place instead of
+// returning substrings that every ancestor re-copies.  A node that is
+// being removed by the requested updates appends nothing.
+
+void GumboInterface::serialize_to(GumboNode* node, enum UpdateTypes doupdates, std::string &out) {
     // special case the document node
     if (node->type == GUMBO_NODE_DOCUMENT) {
-        std::string results = build_doctype(node);
-        results.append(serialize_contents(node, doupdates));
-        return results;
+        out.append(build_doctype(node));
+        serialize_contents_to(node, doupdates, out);
+        return;
     }
 
-    std::string close = "";
-    std::string closeTag = "";
     std::string atts = "";
     std::string tagname            = get_tag_name(node);
     bool need_special_handling     = in_set(special_handling, tagname);
@@ -1319,7 +1525,7 @@ std::string GumboInterface::serialize(GumboNode* node, enum UpdateTypes doupdate
 
 
     // handle special case of stylesheet link missing type attribute
-    if ((tagname == "link") && (node->parent->type == GUMBO_NODE_ELEMENT) && 
+    if ((tagname == "link") && (node->parent->type == GUMBO_NODE_ELEMENT) &&
         (node->parent->v.element.tag == GUMBO_TAG_HEAD)) {
         const GumboVector * attribs = &node->v.element.attributes;
         GumboAttribute* relatt = gumbo_get_attribute(attribs, "rel");
@@ -1331,8 +1537,15 @@ std::string GumboInterface::serialize(GumboNode* node, enum UpdateTypes doupdate
             }
         }
     }
-    
-    // build attr string  
+
+    // a removed link appends nothing; known before any serialization work
+    if ((doupdates & LinkUpdates) && (tagname == "link") &&
+        (node->parent->type == GUMBO_NODE_ELEMENT) &&
+        (node->parent->v.element.tag == GUMBO_TAG_HEAD)) {
+        return;
+    }
+
+    // build attr string
     GumboVector * attribs = &node->v.element.attributes;
     for (unsigned int i=0; i< attribs->length; ++i) {
         GumboAttribute* at = static_cast<GumboAttribute*>(attribs->data[i]);
@@ -1340,7 +1553,7 @@ std::string GumboInterface::serialize(GumboNode* node, enum UpdateTypes doupdate
     }
 
     if (tagname == "script") {
-        if ((node->parent->type == GUMBO_NODE_ELEMENT) && 
+        if ((node->parent->type == GUMBO_NODE_ELEMENT) &&
             (node->parent->v.element.tag == GUMBO_TAG_HEAD)) {
             GumboAttribute* srcatt = gumbo_get_attribute(attribs, "src");
             GumboAttribute* typeatt = gumbo_get_attribute(attribs, "type");
@@ -1355,7 +1568,11 @@ std::string GumboInterface::serialize(GumboNode* node, enum UpdateTypes doupdate
             }
         }
     }
-    
+
+    if ((doupdates & JavascriptUpdates) && is_jslink) {
+        return;
+    }
+
     // Make sure that the xmlns attribute exists as an html tag attribute
     if (tagname == "html") {
         if (atts.find("xmlns=") == std::string::npos) {
@@ -1368,66 +1585,65 @@ std::string GumboInterface::serialize(GumboNode* node, enum UpdateTypes doupdate
         }
     }
 
-    // determine contents
-    std::string contents;
+    // write the open tag; a void tag self-closes right away, a foreign
+    // element with nothing but whitespace inside gets its "/" patched
+    // in below once its contents have been serialized
+    out.append("<");
+    out.append(tagname);
+    out.append(atts);
+    if (is_void_tag) out.append("/");
+    out.append(">");
+    if (need_special_handling) out.append("\n");
 
-    if ((tagname == "body") && (doupdates & BodyUpdates)) {
-        contents = m_newbody;
-    } else {
-        // serialize your contents
-        contents = serialize_contents(node, doupdates);
-    }
+    // serialize the contents straight into the shared buffer
+    size_t contents_start = out.size();
 
-    // determine closing tag type
-    std::string testcontents = contents;
-    ltrim(testcontents);
-    if (is_void_tag || (in_xml_ns && testcontents.empty())) {
-        close = "/";
+    if ((tagname == "body") && (doupdates & BodyUpdates)) {
+        out.append(m_newbody);
     } else {
-        closeTag = "</" + tagname + ">";
+        serialize_contents_to(node, doupdates, out);
     }
 
-    if ((doupdates & StyleUpdates) && (tagname == "style") && 
-        (node->parent->type == GUMBO_NODE_ELEMENT) && 
+    if ((doupdates & StyleUpdates) && (tagname == "style") &&
+        (node->parent->type == GUMBO_NODE_ELEMENT) &&
         (node->parent->v.element.tag == GUMBO_TAG_HEAD)) {
-        contents = update_style_urls(contents);
+        std::string contents = out.substr(contents_start);
+        out.erase(contents_start);
+        out.append(update_style_urls(contents));
     }
 
     if (need_special_handling) {
-        ltrimnewlines(contents);
-        rtrim(contents);
-        contents.append("\n");
+        size_t first = out.find_first_not_of("\n\r", contents_start);
+        out.erase(contents_start, ((first == std::string::npos) ? out.size() : first) - contents_start);
+        rtrim_region(out, contents_start);
+        out.append("\n");
     }
 
-    // build results
-    std::string results;
-
-    if ((doupdates & LinkUpdates) && (tagname == "link") && 
-        (node->parent->type == GUMBO_NODE_ELEMENT) && 
-        (node->parent->v.element.tag == GUMBO_TAG_HEAD)) {
-        return "";
+    if (is_void_tag) {
+        return;
     }
 
-    if ((doupdates & JavascriptUpdates) && is_jslink) {
-        return "";
+    // determine closing tag type
+    if (in_xml_ns &&
+        (out.find_first_not_of(" \n\r\t\v\f", contents_start) == std::string::npos)) {
+        // only this node's (whitespace) contents sit past the open tag,
+        // so patching the "/" in shifts almost nothing
+        out.insert(contents_start - 1, "/");
+        return;
     }
 
-    results.append("<"+tagname+atts+close+">");
-    
-    if (need_special_handling) results.append("\n");
-    results.append(contents);
-
     if ((doupdates & LinkUpdates) && (tagname == "head")) {
-        results.append(m_newcsslinks);
+        out.append(m_newcsslinks);
     }
 
     if ((doupdates & JavascriptUpdates) && (tagname == "head")) {
-        results.append(m_newjslinks);
+        out.append(m_newjslinks);
     }
 
-    results.append(closeTag);
-    if (need_special_handling) results.append("\n");
-    return results;
+    out.append("</");
+    out.append(tagname);
+    out.append(">");
+    if (need_special_handling) out.append("\n");
 }
 
 
@@ -24,17 +24,20 @@
 #define GUMBO_INTERFACE
 
 #include <stdlib.h>
+#include <functional>
 #include <string>
 #include <unordered_set>
 
 #include "gumbo.h"
 #include "gumbo_edit.h"
 
+#include "Query/CIndex.h"
 #include "Query/CSelection.h"
 
 #include <QString>
 #include <QList>
 #include <QHash>
+#include <QSharedPointer>
 
 class QString;
 
@@ -44,6 +47,10 @@ struct GumboWellFormedError {
   QString message;
 };
 
+// a shared parse tree together with the utf8 source buffer
+// the tree's internal pointers reference
+struct GumboCacheEntry;
+
 class GumboInterface
 {
 public:
@@ -54,7 +61,17 @@ public:
 
     void    parse();
     void    parse_fragment();
-    
+
+    // parse via a process wide cache of trees keyed by content hash;
+    // the resulting tree may be shared with other instances so the
+    // caller must treat it as strictly read-only (no gumbo_edit use)
+    void    parse_cached();
+
+    // current size of the shared tree cache: entry count and the total
+    // bytes of utf8 source the cached trees pin; used by the memory
+    // usage report
+    static void tree_cache_stats(int &entries, qint64 &source_bytes);
+
     QString repair();
     
     QString getxhtml();
@@ -89,11 +106,24 @@ public:
     // routines for updating while serializing (see SourceUpdates and AnchorUpdates
     QString perform_source_updates(const QString & my_current_book_relpath, const QString& newbookpath);
     QString perform_style_updates(const QString & my_current_book_relpath, const QString& newbookpath);
+    QString perform_source_and_style_updates(const QString & my_current_book_relpath, const QString& newbookpath);
+
+    // single value rewrites usable without a parse; used by the offset
+    // patch path in PerformHTMLUpdates to splice updated references
+    // into the original source instead of reserializing the tree
+    QString rewrite_href_src_value(const QString &attvalue, const QString& my_current_book_relpath, const QString& newbookpath);
+    QString rewrite_css_urls(const QString &css, const QString& my_current_book_relpath, const QString& newbookpath);
     QString perform_link_updates(const QString & newlinks);
     QString perform_javascript_updates(const QString & newjavascripts);
     QString get_body_contents();
     QString perform_body_updates(const QString & new_body);
 
+    // streaming document-order traversal that invokes the visitor on
+    // every node without materializing intermediate node lists;
+    // the visitor returns false to prune traversal below a node
+    void visit_all(const std::function<bool(GumboNode*)> &visitor);
+    static void visit_from(GumboNode* node, const std::function<bool(GumboNode*)> &visitor);
+
     // routines for working with nodes with specific attributes
     QList<GumboNode*> get_all_nodes_with_attribute(const QString & attname);
     QStringList get_all_values_for_attribute(const QString & attname);
@@ -140,6 +170,10 @@ private:
 
     std::string serialize_contents(GumboNode* node, enum UpdateTypes doupdates = NoUpdates);
 
+    void serialize_to(GumboNode* node, enum UpdateTypes doupdates, std::string &out);
+
+    void serialize_contents_to(GumboNode* node, enum UpdateTypes doupdates, std::string &out);
+
     std::string prettyprint(GumboNode* node, int lvl, const std::string indent_chars);
 
     std::string prettyprint_contents(GumboNode* node, int lvl, const std::string indent_chars);
@@ -176,7 +210,9 @@ private:
     // QString fix_self_closing_tags(const QString & source);
 
     QString                         m_source;
+    QSharedPointer<GumboCacheEntry> m_cache_entry; // set when m_output is shared
     GumboOutput*                    m_output;
+    CIndex                          m_index; // lazy per-parse element index for find/findnodes
     std::string                     m_utf8src;
     const QHash<QString, QString> & m_sourceupdates;
     std::string                     m_newcsslinks;
@@ -36,11 +36,24 @@ static const QString DELIMITERS = "}{;";
 HTMLStyleInfo::HTMLStyleInfo(const QString &text)
     : m_source(text)
 {
+    rescan();
+}
+
+
+// (re)extract all embedded style blocks from m_source from scratch
+void HTMLStyleInfo::rescan()
+{
+    foreach(CSSInfo * cp, m_styles) {
+        if (cp) delete cp;
+    }
+    m_styles.clear();
+    m_starts.clear();
+    m_lengths.clear();
     int searchoffset = 0;
     int style_start = -1;
     int style_end = -1;
-    while (findInlineStyleBlock(text, searchoffset, style_start, style_end)) {
-        CSSInfo* cp = new CSSInfo(text.mid(style_start, style_end - style_start), style_start);
+    while (findInlineStyleBlock(m_source, searchoffset, style_start, style_end)) {
+        CSSInfo* cp = new CSSInfo(m_source.mid(style_start, style_end - style_start), style_start);
         m_styles.append(cp);
         m_starts.append(style_start);
         m_lengths.append(style_end - style_start);
@@ -49,6 +62,57 @@ HTMLStyleInfo::HTMLStyleInfo(const QString &text)
 }
 
 
+void HTMLStyleInfo::updateRange(int pos, int charsRemoved, const QString &addedText)
+{
+    int charsAdded = addedText.length();
+    int delta = charsAdded - charsRemoved;
+    int oldend = pos + charsRemoved;
+
+    // look at the damaged neighbourhood in both the old and the new text
+    // (widened a bit so an edit can not split or join a marker unseen)
+    QRegularExpression style_marker("<\\s*/?\\s*style", QRegularExpression::CaseInsensitiveOption);
+    int wstart = qMax(0, pos - 8);
+    bool markup_touched = m_source.mid(wstart, (oldend - wstart) + 8).contains(style_marker);
+
+    // splice the stored source to match the editor's document
+    m_source = m_source.left(pos) + addedText + m_source.mid(oldend);
+    if (!markup_touched) {
+        markup_touched = m_source.mid(wstart, (pos + charsAdded - wstart) + 8).contains(style_marker);
+    }
+    if (markup_touched) {
+        rescan();
+        return;
+    }
+
+    // which css spans does the edit intersect?
+    int hit = -1;
+    for (int i = 0; i < m_starts.count(); i++) {
+        int cstart = m_starts.at(i);
+        int cend = cstart + m_lengths.at(i);
+        if ((pos < cend) && (oldend > cstart)) {
+            if ((pos < cstart) || (oldend > cend) || (hit != -1)) {
+                // straddles a block boundary - start over
+                rescan();
+                return;
+            }
+            hit = i;
+        }
+    }
+
+    // the edit fell wholly inside one block (or between blocks);
+    // shift every span at or after the edit and re-parse just the hit
+    for (int i = 0; i < m_starts.count(); i++) {
+        if (m_starts.at(i) >= oldend) m_starts[i] += delta;
+    }
+    if (hit != -1) {
+        m_lengths[hit] += delta;
+        int cstart = m_starts.at(hit);
+        delete m_styles.at(hit);
+        m_styles[hit] = new CSSInfo(m_source.mid(cstart, m_lengths.at(hit)), cstart);
+    }
+}
+
+
 // Need to manually clean up since allocated with new
 HTMLStyleInfo::~HTMLStyleInfo()
 {
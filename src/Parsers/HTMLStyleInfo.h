@@ -41,6 +41,15 @@ public:
 
     ~HTMLStyleInfo();
 
+    /**
+     * Incrementally update after an edit that replaced charsRemoved
+     * characters at pos with addedText.  Style blocks untouched by the
+     * edit are kept and shifted, a block whose css text contains the
+     * whole edit is re-parsed alone, and only edits that add or remove
+     * style markup force a full re-scan of the document text.
+     */
+    void updateRange(int pos, int charsRemoved, const QString &addedText);
+
     struct CSSProperty {
         QString name;
         QString value;
@@ -91,6 +100,7 @@ public:
 private:
     bool findInlineStyleBlock(const QString &text, int offset, int &styleStart, int &styleEnd);
     void generateSelectorsList();
+    void rescan();
 
     QList<CSSInfo *> m_styles;
     QList<int> m_starts;
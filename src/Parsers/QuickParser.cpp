@@ -26,6 +26,7 @@
 
 #include "Parsers/TagAtts.h"
 #include "Misc/Utility.h"
+#include "Parsers/SIMDScan.h"
 #include "Parsers/QuickParser.h"
 
 QuickParser::QuickParser(const QString &source, QString default_lang)
@@ -260,13 +261,16 @@ int QuickParser::findTarget(const QString &tgt, int p, bool after)
 
 int QuickParser::skipAnyBlanks(const QStringRef &tgt, int p)
 {
-    while((p < tgt.length()) && (tgt.at(p) == " ")) p++;
-    return p;
+    const ushort *data = reinterpret_cast<const ushort *>(tgt.unicode());
+    return SIMDScan::scanPast(data, tgt.length(), p, ushort(' '));
 }
 
 
 int QuickParser::stopWhenContains(const QStringRef &tgt, const QString& stopchars, int p)
 {
-    while((p < tgt.length()) && !stopchars.contains(tgt.at(p))) p++;
-    return p;
+    ushort stops[16];
+    int nstop = qMin(stopchars.length(), 16);
+    for (int i = 0; i < nstop; i++) stops[i] = stopchars.at(i).unicode();
+    const ushort *data = reinterpret_cast<const ushort *>(tgt.unicode());
+    return SIMDScan::scanForAny(data, tgt.length(), p, stops, nstop);
 }
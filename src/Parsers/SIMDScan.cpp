@@ -0,0 +1,145 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford Ontario
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#include "Parsers/SIMDScan.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMDSCAN_SSE2 1
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__)
+#define SIMDSCAN_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if defined(SIMDSCAN_SSE2)
+// index of lowest set bit in a non zero movemask result
+static inline int lowest_bit(unsigned int mask)
+{
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward(&idx, mask);
+    return int(idx);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+
+int SIMDScan::scanFor(const ushort *data, int len, int pos, ushort c)
+{
+#if defined(SIMDSCAN_SSE2)
+    const __m128i needle = _mm_set1_epi16(short(c));
+    while (pos + 8 <= len) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle));
+        if (mask != 0) {
+            // movemask yields two bits per utf16 character
+            return pos + (lowest_bit(mask) >> 1);
+        }
+        pos += 8;
+    }
+#elif defined(SIMDSCAN_NEON)
+    const uint16x8_t needle = vdupq_n_u16(c);
+    while (pos + 8 <= len) {
+        uint16x8_t eq = vceqq_u16(vld1q_u16(data + pos), needle);
+        // narrow each lane to a byte so the whole result fits in 64 bits
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(eq, 4)), 0);
+        if (mask != 0) {
+            return pos + (__builtin_ctzll(mask) >> 3);
+        }
+        pos += 8;
+    }
+#endif
+    while ((pos < len) && (data[pos] != c)) pos++;
+    return pos;
+}
+
+
+int SIMDScan::scanPast(const ushort *data, int len, int pos, ushort c)
+{
+#if defined(SIMDSCAN_SSE2)
+    const __m128i needle = _mm_set1_epi16(short(c));
+    while (pos + 8 <= len) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        int mask = 0xFFFF ^ _mm_movemask_epi8(_mm_cmpeq_epi16(chunk, needle));
+        if (mask != 0) {
+            return pos + (lowest_bit(mask) >> 1);
+        }
+        pos += 8;
+    }
+#elif defined(SIMDSCAN_NEON)
+    const uint16x8_t needle = vdupq_n_u16(c);
+    while (pos + 8 <= len) {
+        uint16x8_t ne = vmvnq_u16(vceqq_u16(vld1q_u16(data + pos), needle));
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(ne, 4)), 0);
+        if (mask != 0) {
+            return pos + (__builtin_ctzll(mask) >> 3);
+        }
+        pos += 8;
+    }
+#endif
+    while ((pos < len) && (data[pos] == c)) pos++;
+    return pos;
+}
+
+
+int SIMDScan::scanForAny(const ushort *data, int len, int pos, const ushort *stopchars, int nstop)
+{
+#if defined(SIMDSCAN_SSE2)
+    while (pos + 8 <= len) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+        __m128i hits = _mm_setzero_si128();
+        for (int i = 0; i < nstop; i++) {
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi16(chunk, _mm_set1_epi16(short(stopchars[i]))));
+        }
+        int mask = _mm_movemask_epi8(hits);
+        if (mask != 0) {
+            return pos + (lowest_bit(mask) >> 1);
+        }
+        pos += 8;
+    }
+#elif defined(SIMDSCAN_NEON)
+    while (pos + 8 <= len) {
+        uint16x8_t chunk = vld1q_u16(data + pos);
+        uint16x8_t hits = vdupq_n_u16(0);
+        for (int i = 0; i < nstop; i++) {
+            hits = vorrq_u16(hits, vceqq_u16(chunk, vdupq_n_u16(stopchars[i])));
+        }
+        uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(hits, 4)), 0);
+        if (mask != 0) {
+            return pos + (__builtin_ctzll(mask) >> 3);
+        }
+        pos += 8;
+    }
+#endif
+    while (pos < len) {
+        ushort c = data[pos];
+        for (int i = 0; i < nstop; i++) {
+            if (c == stopchars[i]) return pos;
+        }
+        pos++;
+    }
+    return pos;
+}
@@ -0,0 +1,44 @@
+/************************************************************************
+**
+**  Copyright (C) 2021 Kevin B. Hendricks, Stratford Ontario
+**
+**  This file is part of Sigil.
+**
+**  Sigil is free software: you can redistribute it and/or modify
+**  it under the terms of the GNU General Public License as published by
+**  the Free Software Foundation, either version 3 of the License, or
+**  (at your option) any later version.
+**
+**  Sigil is distributed in the hope that it will be useful,
+**  but WITHOUT ANY WARRANTY; without even the implied warranty of
+**  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**  GNU General Public License for more details.
+**
+**  You should have received a copy of the GNU General Public License
+**  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
+**
+*************************************************************************/
+
+#ifndef SIMD_SCAN_H
+#define SIMD_SCAN_H
+
+#include <QtGlobal>
+
+// Small vectorized scanning core for the utf16 delimiter-search inner
+// loops of the lightweight parsers.  Uses SSE2 or NEON when available
+// and falls back to a plain pointer scan otherwise.
+
+namespace SIMDScan
+{
+    // first index at or after pos where data[i] == c, or len if none
+    int scanFor(const ushort *data, int len, int pos, ushort c);
+
+    // first index at or after pos where data[i] != c, or len if none
+    int scanPast(const ushort *data, int len, int pos, ushort c);
+
+    // first index at or after pos where data[i] matches one of the
+    // nstop characters in stopchars, or len if none
+    int scanForAny(const ushort *data, int len, int pos, const ushort *stopchars, int nstop);
+};
+
+#endif
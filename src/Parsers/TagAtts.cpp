@@ -18,20 +18,26 @@
 **  along with Sigil.  If not, see <http://www.gnu.org/licenses/>.
 **
 *************************************************************************/
+#include <new>
 #include <QDebug>
 #include "Parsers/TagAtts.h"
 
+// arena active for TagAtts built on this thread, if any
+static thread_local TagAttsArena* current_arena = nullptr;
+
 TagAtts::TagAtts()
-    : m_n(0), m_mapping(QHash<QString, TagAtts::TAttribute*>()), m_anchor(new TagAtts::TAttribute("",""))
+    : m_n(0), m_mapping(QHash<QString, TagAtts::TAttribute*>()), m_arena(TagAttsArena::current())
 {
+    m_anchor = newNode("","");
     m_anchor->prev = m_anchor;
     m_anchor->next = m_anchor;
 }
 
 // copy constructor linear time
 TagAtts::TagAtts(const TagAtts &other)
-    : m_n(0), m_mapping(QHash<QString, TagAtts::TAttribute*>()), m_anchor(new TagAtts::TAttribute("",""))
+    : m_n(0), m_mapping(QHash<QString, TagAtts::TAttribute*>()), m_arena(TagAttsArena::current())
 {
+     m_anchor = newNode("","");
      m_anchor->prev = m_anchor;
      m_anchor->next = m_anchor;
      QList<std::pair<QString, QString> > pairlist = other.pairs();
@@ -48,7 +54,7 @@ TagAtts& TagAtts::operator=(const TagAtts &other)
         TagAtts::TAttribute * patt = m_anchor->next;
         while(patt && (patt != m_anchor)) {
             TagAtts::TAttribute * natt = patt->next;
-            delete patt;
+            freeNode(patt);
             patt = natt;
             m_n--;
         }
@@ -98,10 +104,10 @@ TagAtts::~TagAtts()
     TagAtts::TAttribute * patt = m_anchor->next;
     while(patt && (patt != m_anchor)) {
         TagAtts::TAttribute * natt = patt->next;
-        delete patt;
+        freeNode(patt);
         patt = natt;
     }
-    delete m_anchor;
+    freeNode(m_anchor);
     m_anchor = nullptr;
 }
 
@@ -111,7 +117,7 @@ void TagAtts::insert(const QString &key, const QString &value)
         TagAtts::TAttribute* patt = m_mapping[key];
         patt->value = value;
     } else {
-        TagAtts::TAttribute* patt = new TAttribute(key, value);
+        TagAtts::TAttribute* patt = newNode(key, value);
         // circular all prev and next values should exist
         // insert at end of list (just before anchor)
         TagAtts::TAttribute* last = m_anchor->prev;
@@ -134,7 +140,7 @@ void TagAtts::remove(const QString &key)
     pprev->next = pnext;
     pnext->prev = pprev;
     m_mapping.remove(key);
-    delete patt;
+    freeNode(patt);
     m_n--;
 }    
 
@@ -183,3 +189,60 @@ QList<std::pair<QString, QString> > TagAtts::pairs() const
     }
     return plist;
 }
+
+
+TagAtts::TAttribute* TagAtts::newNode(const QString &key, const QString &value)
+{
+    if (m_arena) return new (m_arena->allocate()) TAttribute(key, value);
+    return new TAttribute(key, value);
+}
+
+
+void TagAtts::freeNode(TagAtts::TAttribute* node)
+{
+    // arena nodes are destroyed en masse when the arena goes away
+    if (!m_arena) delete node;
+}
+
+
+TagAttsArena::TagAttsArena(int nodes_per_block)
+    : m_nodes_per_block(nodes_per_block),
+      m_used(nodes_per_block),
+      m_previous(current_arena)
+{
+    current_arena = this;
+}
+
+
+TagAttsArena::~TagAttsArena()
+{
+    current_arena = m_previous;
+    // run the node destructors then release each block as one unit
+    for (int b = 0; b < m_blocks.size(); b++) {
+        char * block = m_blocks.at(b);
+        int n = (b == m_blocks.size() - 1) ? m_used : m_nodes_per_block;
+        for (int i = 0; i < n; i++) {
+            reinterpret_cast<TagAtts::TAttribute *>(block + i * sizeof(TagAtts::TAttribute))->~TAttribute();
+        }
+        delete [] block;
+    }
+}
+
+
+void* TagAttsArena::allocate()
+{
+    if (m_used == m_nodes_per_block) {
+        m_blocks.append(new char[m_nodes_per_block * sizeof(TagAtts::TAttribute)]);
+        m_used = 0;
+    }
+    void * slot = m_blocks.last() + m_used * sizeof(TagAtts::TAttribute);
+    m_used++;
+    return slot;
+}
+
+
+// static
+TagAttsArena* TagAttsArena::current()
+{
+    return current_arena;
+}
@@ -26,9 +26,12 @@
 #include <QObject>
 #include <QString>
 #include <QHash>
+#include <QList>
+
+class TagAttsArena;
 
 // implement a very simple ordered hash for tag attributes by using a qhash to store
-// key to node mappings where each node (see struct TAttribute) is a key/value pair in 
+// key to node mappings where each node (see struct TAttribute) is a key/value pair in
 // a circular doubly-linked list.
 // both key and value are QStrings
 
@@ -71,10 +74,42 @@ public:
     QList< std::pair< QString,QString > > pairs() const;
 
 private:
+    TAttribute* newNode(const QString &key, const QString &value);
+    void freeNode(TAttribute* node);
+
     unsigned int m_n;
     QHash<QString, TAttribute*> m_mapping;
     // anchor for the circular doubly linked list
     TAttribute* m_anchor;
+    // arena active on this thread when we were built, if any
+    TagAttsArena* m_arena;
+};
+
+
+// Optional bump arena for TAttribute nodes.  Constructing one makes it
+// the active arena for the current thread, so every TagAtts node built
+// on that thread comes out of the arena's blocks instead of its own
+// heap allocation, and all of them are destroyed en masse when the
+// arena goes away.  Every TagAtts built while the arena was active must
+// itself be gone before the arena is destroyed.
+
+class TagAttsArena
+{
+public:
+    TagAttsArena(int nodes_per_block = 512);
+    ~TagAttsArena();
+
+    // one uninitialized TAttribute sized slot
+    void* allocate();
+
+    // the arena active for the current thread, if any
+    static TagAttsArena* current();
+
+private:
+    int m_nodes_per_block;
+    int m_used;               // slots used in the newest block
+    QList<char *> m_blocks;
+    TagAttsArena* m_previous; // restored on destruction
 };
 
 #endif // TAGATTS_H
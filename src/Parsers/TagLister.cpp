@@ -70,6 +70,110 @@ void TagLister::reloadLister(const QString& source)
     buildTagList();
 }
 
+// Incrementally update the tag list after an edit that replaced
+// charsRemoved characters at pos with charsAdded characters.
+// Only the damaged region is re-lexed.  Tags that end before the
+// damage are kept as is, and tags that follow it are shifted and
+// spliced back in once the lexer resynchronizes with the old list.
+// Falls back to a full reload whenever no safe splice point exists.
+void TagLister::updateRange(const QString &source, int pos, int charsRemoved, int charsAdded)
+{
+    int delta = charsAdded - charsRemoved;
+
+    // verify the edit actually maps the old source onto the new one
+    if (m_source.length() + delta != source.length()) {
+        reloadLister(source);
+        return;
+    }
+
+    // need at least one real tag besides the ending dummy record
+    if (m_Tags.size() < 2) {
+        reloadLister(source);
+        return;
+    }
+
+    // find the last tag that ends strictly before the damaged region,
+    // then back up one more tag since an edit at a tag boundary can
+    // change how the preceding markup lexes
+    int k = findLastTagOnOrBefore(pos - 1);
+    while ((k >= 0) && (m_Tags.at(k).pos + m_Tags.at(k).len > pos)) k--;
+    k--;
+    if (k < 0) {
+        reloadLister(source);
+        return;
+    }
+
+    // restore the lexer stack state as it was just after tag k
+    replayStackUpTo(k);
+    m_source = source;
+    m_next = m_Tags.at(k).pos + m_Tags.at(k).len;
+    m_pos = m_next;
+
+    // re-lex forward until we are past the damaged region and line
+    // back up with a surviving tag from the old list
+    QList<TagInfo> fresh;
+    int resync = -1; // index into the old list
+    int scan = k + 1;
+    TagLister::TagInfo mi = getNext();
+    while (mi.len != -1) {
+        if (mi.pos >= pos + charsAdded) {
+            while ((scan < m_Tags.size() - 1) && (m_Tags.at(scan).pos + delta < mi.pos)) scan++;
+            const TagInfo &oldtag = m_Tags.at(scan);
+            if ((oldtag.len != -1) && (oldtag.pos + delta == mi.pos) &&
+                (oldtag.pos >= pos + charsRemoved) && (oldtag.tpath == mi.tpath)) {
+                // the splice is only safe if every tag still open here
+                // was opened before the damage began
+                bool stack_ok = true;
+                for (int j = 1; j < m_TagPos.size(); j++) {
+                    if (m_TagPos.at(j) >= pos) {
+                        stack_ok = false;
+                        break;
+                    }
+                }
+                if (stack_ok) {
+                    resync = scan;
+                    break;
+                }
+            }
+        }
+        fresh << mi;
+        mi = getNext();
+    }
+
+    if (resync == -1) {
+        // never resynchronized so everything from the restart on was re-lexed
+        m_Tags = m_Tags.mid(0, k + 1) + fresh;
+        TagLister::TagInfo temp;
+        temp.pos = -1;
+        temp.len = -1;
+        temp.open_pos = -1;
+        temp.open_len = -1;
+        m_Tags << temp;
+        updateBodyInfo();
+        buildMatchTable();
+        return;
+    }
+
+    QList<TagInfo> updated = m_Tags.mid(0, k + 1) + fresh;
+    for (int j = resync; j < m_Tags.size(); j++) {
+        TagLister::TagInfo ti = m_Tags.at(j);
+        if (ti.len != -1) {
+            ti.pos += delta;
+            if (ti.open_pos >= pos + charsRemoved) {
+                ti.open_pos += delta;
+            } else if (ti.open_pos >= pos) {
+                // closes a tag that no longer exists in the new source
+                reloadLister(source);
+                return;
+            }
+        }
+        updated << ti;
+    }
+    m_Tags = updated;
+    updateBodyInfo();
+    buildMatchTable();
+}
+
 const TagLister::TagInfo& TagLister::at(int i)
 {
     if ((i < 0) || (i >= m_Tags.size())) {
@@ -126,27 +230,15 @@ bool TagLister::isPositionInCloseTag(int pos)
 int TagLister::findOpenTagForClose(int i)
 {
     if ((i < 0) || (i >= m_Tags.size())) return -1;
-    TagLister::TagInfo ti = m_Tags.at(i);
-    if (ti.ttype != "end") return -1;
-    int open_pos = ti.open_pos;
-    for (int j=i-1; j >= 0; j--) {
-        TagInfo tb = m_Tags.at(j);
-        if (tb.pos == open_pos) return j;
-    }
-    return -1;
+    if (m_Tags.at(i).ttype != "end") return -1;
+    return m_OpenForClose.at(i);
 }
 
 int TagLister::findCloseTagForOpen(int i)
 {
     if ((i < 0) || (i >= m_Tags.size())) return -1;
-    TagLister::TagInfo ti = m_Tags.at(i);
-    if (ti.ttype != "begin") return -1;
-    int open_pos = ti.pos;
-    for (int j=i+1; j < m_Tags.size(); j++) {
-        TagInfo te = m_Tags.at(j);
-        if (te.open_pos == open_pos) return j;
-    }
-    return -1;
+    if (m_Tags.at(i).ttype != "begin") return -1;
+    return m_CloseForOpen.at(i);
 }
 
 // There may not be one here if no tags exists because
@@ -154,29 +246,39 @@ int TagLister::findCloseTagForOpen(int i)
 // so this can return -1 meaning none exists
 int TagLister::findLastTagOnOrBefore(int pos)
 {
-    // find that tag that starts immediately **after** pos and then
-    // then use its predecessor 
-    int i = 0;
-    TagLister::TagInfo ti = at(i);
-    while((ti.pos <= pos) && (ti.len != -1)) {
-        i++;
-        ti = m_Tags.at(i);
+    // tags are sorted by position so binary search for the first
+    // tag that starts **after** pos and then use its predecessor
+    int lo = 0;
+    int hi = m_Tags.size() - 1; // the ending dummy record
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        const TagLister::TagInfo &ti = m_Tags.at(mid);
+        if ((ti.len != -1) && (ti.pos <= pos)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
     }
-    i--;
-    return i;
+    return lo - 1;
 }
 
 // m_Tags is padded with an ending dummy tag
 // So finding first tag on or after a pos will always work
 int TagLister::findFirstTagOnOrAfter(int pos)
 {
-    int i = 0;
-    TagLister::TagInfo ti = m_Tags.at(i);
-    while((ti.pos + ti.len <= pos) && (ti.len != -1)) {
-        i++;
-        ti = m_Tags.at(i);
+    // tags are sorted and non-overlapping so tag ends are sorted too
+    int lo = 0;
+    int hi = m_Tags.size() - 1; // the ending dummy record
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        const TagLister::TagInfo &ti = m_Tags.at(mid);
+        if ((ti.len != -1) && (ti.pos + ti.len <= pos)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
     }
-    return i;
+    return lo;
 }
 
 
@@ -195,9 +297,12 @@ QString TagLister::serializeAttribute(const QString& aname, const QString &avalu
 }
 
 // static
-void TagLister::parseAttribute(const QStringRef &tagstring, const QString &attribute_name, AttInfo &ainfo)
+// scans with string refs into the tag only, so nothing is allocated
+// for attributes other than the one requested, and with materialize
+// false only the offsets are filled in so callers that just need
+// spans into the source can skip the QString copies entirely
+void TagLister::parseAttribute(const QStringRef &tagstring, const QString &attribute_name, AttInfo &ainfo, bool materialize)
 {
-    int taglen = tagstring.length();
     QChar c = tagstring.at(1);
     int p = 0;
 
@@ -214,21 +319,19 @@ void TagLister::parseAttribute(const QStringRef &tagstring, const QString &attri
     // normal tag, skip over tag name
     p = skipAnyBlanks(tagstring, 1);
     if (tagstring.at(p) == "/") return; // end tag has no attributes
-    // int s = p;
     p = stopWhenContains(tagstring, ">/ \f\t\r\n", p);
-    // QString tagname = Utility::Substring(s, p, tagstring).trimmed();
 
     // handle the possibility of attributes (so begin or single tag type)
     while (tagstring.indexOf("=", p) != -1) {
         p = skipAnyBlanks(tagstring, p);
         int s = p;
         p = stopWhenContains(tagstring, "=", p);
-        QString aname = Utility::Substring(s, p, tagstring).trimmed();
-        if (aname == attribute_name) {
+        QStringRef aname = tagstring.mid(s, p - s).trimmed();
+        bool wanted = (aname == attribute_name);
+        if (wanted) {
             ainfo.pos = s;
-            ainfo.aname = aname;
+            if (materialize) ainfo.aname = aname.toString();
         }
-        QString avalue;
         p++;
         p = skipAnyBlanks(tagstring, p);
         if ((tagstring.at(p) == "'") || (tagstring.at(p) == "\"")) {
@@ -236,23 +339,21 @@ void TagLister::parseAttribute(const QStringRef &tagstring, const QString &attri
             p++;
             int b = p;
             p = stopWhenContains(tagstring, qc, p);
-            avalue = Utility::Substring(b, p, tagstring);
-            if (aname == attribute_name) {
-                ainfo.avalue = avalue;
+            if (wanted) {
                 ainfo.len = p - s + 1;
                 ainfo.vpos = b;
                 ainfo.vlen = p - b;
+                if (materialize) ainfo.avalue = tagstring.mid(b, p - b).toString();
             }
             p++;
         } else {
             int b = p;
             p = stopWhenContains(tagstring, ">/ ", p);
-            avalue = Utility::Substring(b, p, tagstring);
-            if (aname == attribute_name) {
-                ainfo.avalue = avalue;
+            if (wanted) {
                 ainfo.len = p - s;
                 ainfo.vpos = b;
                 ainfo.vlen = p - b;
+                if (materialize) ainfo.avalue = tagstring.mid(b, p - b).toString();
             }
         }
     }
@@ -262,17 +363,24 @@ void TagLister::parseAttribute(const QStringRef &tagstring, const QString &attri
 //static
 // extracts a copy of all attributes if any exist o.w. returns empty string
 QString TagLister::extractAllAttributes(const QStringRef &tagstring)
+{
+    return extractAllAttributesRef(tagstring).toString();
+}
+
+//static
+// ref into the tag covering all attributes if any exist o.w. a null ref
+QStringRef TagLister::extractAllAttributesRef(const QStringRef &tagstring)
 {
     int taglen = tagstring.length();
     QChar c = tagstring.at(1);
     int p = 0;
 
     // ignore comments, doctypes, cdata, pi, and xmlheaders
-    if ((c == '?') || (c == '!')) return QString();
+    if ((c == '?') || (c == '!')) return QStringRef();
     // normal tag, skip over any blanks before tag name
     p = skipAnyBlanks(tagstring, 1);
 
-    if (tagstring.at(p) == "/") return QString(); // end tag has no attributes
+    if (tagstring.at(p) == "/") return QStringRef(); // end tag has no attributes
 
     // skip over tag name itself
     p = stopWhenContains(tagstring, ">/ \f\t\r\n", p);
@@ -282,9 +390,9 @@ QString TagLister::extractAllAttributes(const QStringRef &tagstring)
 
     // if any attributes exist
     // Note: xml/xhtml does not support boolean attribute values without =)
-    if (tagstring.indexOf("=", p) == -1) return QString();
+    if (tagstring.indexOf("=", p) == -1) return QStringRef();
     // properly handle both begin and single tags
-    QString res = tagstring.mid(p, taglen - 1 - p).toString(); // skip ending '>'
+    QStringRef res = tagstring.mid(p, taglen - 1 - p); // skip ending '>'
     res = res.trimmed();
     if (res.endsWith("/")) res = res.mid(0, res.length() - 1);
     res = res.trimmed();
@@ -443,6 +551,77 @@ int TagLister::stopWhenContains(const QStringRef &tgt, const QString& stopchars,
     return p;
 }
 
+// build the open/close match tables so matching tag lookups
+// become simple table reads instead of linear scans
+void TagLister::buildMatchTable()
+{
+    int n = m_Tags.size();
+    m_OpenForClose = QList<int>();
+    m_CloseForOpen = QList<int>();
+    m_OpenForClose.reserve(n);
+    m_CloseForOpen.reserve(n);
+    for (int i = 0; i < n; i++) {
+        m_OpenForClose << -1;
+        m_CloseForOpen << -1;
+    }
+    QList<int> opens; // indices of currently open begin tags
+    for (int i = 0; i < n; i++) {
+        const TagLister::TagInfo &ti = m_Tags.at(i);
+        if (ti.len == -1) continue;
+        if (ti.ttype == "begin") {
+            opens << i;
+        } else if ((ti.ttype == "end") && (ti.open_pos != -1)) {
+            // mirrors the pop performed by getNext on a matched close
+            if (!opens.isEmpty()) {
+                int j = opens.takeLast();
+                m_OpenForClose[i] = j;
+                m_CloseForOpen[j] = i;
+            }
+        }
+    }
+}
+
+// rebuild the open tag stacks to the state they held
+// just after tag k was processed by getNext
+void TagLister::replayStackUpTo(int k)
+{
+    m_TagPath = QStringList() << "root";
+    m_TagPos = QList<int>() << -1;
+    m_TagLen = QList<int>() << 0;
+    for (int j = 0; j <= k; j++) {
+        const TagLister::TagInfo &ti = m_Tags.at(j);
+        if (ti.ttype == "begin") {
+            m_TagPath << ti.tname;
+            m_TagPos << ti.pos;
+            m_TagLen << ti.len;
+        } else if ((ti.ttype == "end") && (ti.open_pos != -1)) {
+            m_TagPath.removeLast();
+            m_TagPos.removeLast();
+            m_TagLen.removeLast();
+        }
+    }
+}
+
+// recompute the body markers from the current tag records
+void TagLister::updateBodyInfo()
+{
+    m_bodyStartPos = -1;
+    m_bodyEndPos = -1;
+    m_bodyOpenTag = -1;
+    m_bodyCloseTag = -1;
+    for (int i = 0; i < m_Tags.size(); i++) {
+        const TagLister::TagInfo &ti = m_Tags.at(i);
+        if ((ti.tname == "body") && (ti.ttype == "begin")) {
+            m_bodyStartPos = ti.pos + ti.len;
+            m_bodyOpenTag = i;
+        }
+        if ((ti.tname == "body") && (ti.ttype == "end")) {
+            m_bodyEndPos = ti.pos - 1;
+            m_bodyCloseTag = i;
+        }
+    }
+}
+
 void TagLister::buildTagList()
 {
         m_Tags.clear();
@@ -473,4 +652,5 @@ void TagLister::buildTagList()
         temp.open_pos = -1;
         temp.open_len = -1;
         m_Tags << temp;
+        buildMatchTable();
 }
@@ -58,6 +58,7 @@ public:
     ~TagLister() {};
 
     void reloadLister(const QString &source);
+    void updateRange(const QString &source, int pos, int charsRemoved, int charsAdded);
 
     const TagInfo& at(int i);
     size_t size();
@@ -76,13 +77,20 @@ public:
 
     const QString& getSource();
 
-    static void parseAttribute(const QStringRef &tagstring, const QString &attribute_name, AttInfo& ainfo);
+    // with materialize false only the span offsets in AttInfo are set,
+    // deferring any QString creation to callers that actually need one
+    static void parseAttribute(const QStringRef &tagstring, const QString &attribute_name,
+                               AttInfo& ainfo, bool materialize = true);
     static QString serializeAttribute(const QString &aname, const QString &avalue);
     static QString extractAllAttributes(const QStringRef &tagstring);
+    static QStringRef extractAllAttributesRef(const QStringRef &tagstring);
     
 private:
     TagInfo getNext();
     void  buildTagList();
+    void  replayStackUpTo(int k);
+    void  updateBodyInfo();
+    void  buildMatchTable();
 
     QStringRef parseML();
 
@@ -99,6 +107,8 @@ private:
     QList<int>     m_TagPos;
     QList<int>     m_TagLen;
     QList<TagInfo> m_Tags;
+    QList<int>     m_OpenForClose; // tag index of matching open for each end tag
+    QList<int>     m_CloseForOpen; // tag index of matching close for each begin tag
     int            m_bodyStartPos;
     int            m_bodyEndPos;
     int            m_bodyOpenTag;
@@ -41,6 +41,7 @@
 #include <QChar>
 #include <QString>
 #include <QTextStream>
+#include <QtConcurrent/QtConcurrent>
 #include "Parsers/qCSSProperties.h"
 #include "Parsers/qCSSUtils.h"
 #include "Parsers/qCSSParser.h"
@@ -827,6 +828,21 @@ void CSSParser::parseInString(QString& css_input, int& i, parse_status& astatus,
 }
 
 
+static QSharedPointer<CSSParser> ParseOneStylesheet(const QString &css_input)
+{
+    QSharedPointer<CSSParser> parser(new CSSParser());
+    parser->parse_css(css_input);
+    return parser;
+}
+
+
+// static
+QVector<QSharedPointer<CSSParser> > CSSParser::parse_css_batch(const QVector<QString> &css_inputs)
+{
+    return QtConcurrent::blockingMapped(css_inputs, ParseOneStylesheet);
+}
+
+
 void CSSParser::parse_css(QString css_input)
 {
     reset_parser();
@@ -46,6 +46,7 @@
 #include <QString>
 #include <QVector>
 #include <QMap>
+#include <QSharedPointer>
 
 class CSSParser 
 { 
@@ -88,6 +89,10 @@ public:
 
     void parse_css(QString css_input);
 
+    // parse a batch of stylesheets across the global thread pool
+    // returning one fully parsed parser per input in input order
+    static QVector<QSharedPointer<CSSParser> > parse_css_batch(const QVector<QString> &css_inputs);
+
     void reset_parser();        
 
     // serialize the current list of csstokens back to css
@@ -63,9 +63,14 @@ CSelection CDocument::find(const std::string& aSelector)
         if (mpOutput == NULL) {
             parse();
         }
+        // built lazily on the first query and reused for every query
+        // against this parse, so repeated selectors cost O(candidates)
+        if (!mIndex.built()) {
+            mIndex.build(mpOutput->root);
+        }
         std::string as = aSelector;
         CSelection sel(mpOutput->root);
-        return sel.find(as);
+        return sel.find(as, &mIndex);
     }
     return CSelection(NULL);
 }
@@ -77,4 +82,6 @@ void CDocument::reset()
         gumbo_destroy_output(mpOutput);
         mpOutput = NULL;
     }
+    // the index holds bare pointers into the destroyed tree
+    mIndex = CIndex();
 }
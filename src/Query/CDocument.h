@@ -41,6 +41,7 @@
 #include "gumbo_edit.h"
 
 #include <string>
+#include "Query/CIndex.h"
 #include "Query/CObject.h"
 #include "Query/CSelection.h"
 
@@ -65,6 +66,7 @@ class CDocument: public CObject
 
     GumboOutput* mpOutput;
     std::string mSource;
+    CIndex mIndex; // lazy per-parse element index, see find()
 };
 
 #endif /* CDOCUMENT_H_ */
@@ -0,0 +1,142 @@
+/**********************************************************************************
+ **
+ **  SigilQuery for Gumbo
+ **
+ **  A C++ library that provides jQuery-like selectors for Google's Gumbo-Parser.
+ **  Selector engine is an implementation based on cascadia.
+ **
+ **  Based on: "gumbo-query" https://github.com/lazytiger/gumbo-query
+ **  With bug fixes, extensions and improvements
+ **
+ **  The MIT License (MIT)
+ **  Copyright (c) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+ **  Copyright (c) 2015 baimashi.com.
+ **  Copyright (c) 2011 Andy Balholm. All rights reserved.
+ **
+ **
+ **  Permission is hereby granted, free of charge, to any person obtaining a copy
+ **  of this software and associated documentation files (the "Software"), to deal
+ **  in the Software without restriction, including without limitation the rights
+ **  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ **  copies of the Software, and to permit persons to whom the Software is
+ **  furnished to do so, subject to the following conditions:
+ **
+ **  The above copyright notice and this permission notice shall be included in
+ **  all copies or substantial portions of the Software.
+ **
+ **  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ **  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ **  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ **  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ **  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ **  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ **  THE SOFTWARE.
+ **
+ **********************************************************************************/
+
+#include "Query/CIndex.h"
+
+static const std::vector<GumboNode*> NO_NODES;
+
+CIndex::CIndex()
+{
+    mBuilt = false;
+    mpRoot = NULL;
+}
+
+void CIndex::build(GumboNode* apRoot)
+{
+    mTagNodes.clear();
+    mClassNodes.clear();
+    mIdNodes.clear();
+    mpRoot = apRoot;
+    if (apRoot != NULL)
+    {
+        indexInto(apRoot);
+    }
+    mBuilt = true;
+}
+
+bool CIndex::built() const
+{
+    return mBuilt;
+}
+
+GumboNode* CIndex::root() const
+{
+    return mpRoot;
+}
+
+const std::vector<GumboNode*>& CIndex::tagNodes(GumboTag aTag) const
+{
+    std::map<int, std::vector<GumboNode*> >::const_iterator it = mTagNodes.find(aTag);
+    if (it == mTagNodes.end())
+    {
+        return NO_NODES;
+    }
+    return it->second;
+}
+
+const std::vector<GumboNode*>& CIndex::classNodes(const std::string& aClass) const
+{
+    std::map<std::string, std::vector<GumboNode*> >::const_iterator it = mClassNodes.find(aClass);
+    if (it == mClassNodes.end())
+    {
+        return NO_NODES;
+    }
+    return it->second;
+}
+
+const std::vector<GumboNode*>& CIndex::idNodes(const std::string& aId) const
+{
+    std::map<std::string, std::vector<GumboNode*> >::const_iterator it = mIdNodes.find(aId);
+    if (it == mIdNodes.end())
+    {
+        return NO_NODES;
+    }
+    return it->second;
+}
+
+void CIndex::indexInto(GumboNode* apNode)
+{
+    if (apNode->type == GUMBO_NODE_ELEMENT)
+    {
+        mTagNodes[apNode->v.element.tag].push_back(apNode);
+
+        GumboAttribute* id = gumbo_get_attribute(&apNode->v.element.attributes, "id");
+        if (id != NULL)
+        {
+            mIdNodes[id->value].push_back(apNode);
+        }
+
+        GumboAttribute* clazz = gumbo_get_attribute(&apNode->v.element.attributes, "class");
+        if (clazz != NULL)
+        {
+            // split on the same whitespace characters CAttributeSelector
+            // EIncludes matching uses, so the candidate lists are exact
+            std::string value = clazz->value;
+            size_t j = 0;
+            for (size_t i = 0; i < value.size(); i++)
+            {
+                char c = value[i];
+                if (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f')
+                {
+                    if (i > j)
+                    {
+                        mClassNodes[value.substr(j, i - j)].push_back(apNode);
+                    }
+                    j = i + 1;
+                }
+            }
+            if (j < value.size())
+            {
+                mClassNodes[value.substr(j)].push_back(apNode);
+            }
+        }
+
+        for (unsigned int i = 0; i < apNode->v.element.children.length; i++)
+        {
+            indexInto((GumboNode*) apNode->v.element.children.data[i]);
+        }
+    }
+}
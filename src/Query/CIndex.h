@@ -0,0 +1,93 @@
+/**********************************************************************************
+ **
+ **  SigilQuery for Gumbo
+ **
+ **  A C++ library that provides jQuery-like selectors for Google's Gumbo-Parser.
+ **  Selector engine is an implementation based on cascadia.
+ **
+ **  Based on: "gumbo-query" https://github.com/lazytiger/gumbo-query
+ **  With bug fixes, extensions and improvements
+ **
+ **  The MIT License (MIT)
+ **  Copyright (c) 2021 Kevin B. Hendricks, Stratford, Ontario Canada
+ **  Copyright (c) 2015 baimashi.com.
+ **  Copyright (c) 2011 Andy Balholm. All rights reserved.
+ **
+ **
+ **  Permission is hereby granted, free of charge, to any person obtaining a copy
+ **  of this software and associated documentation files (the "Software"), to deal
+ **  in the Software without restriction, including without limitation the rights
+ **  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ **  copies of the Software, and to permit persons to whom the Software is
+ **  furnished to do so, subject to the following conditions:
+ **
+ **  The above copyright notice and this permission notice shall be included in
+ **  all copies or substantial portions of the Software.
+ **
+ **  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ **  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ **  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ **  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ **  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ **  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ **  THE SOFTWARE.
+ **
+ **********************************************************************************/
+
+#ifndef CINDEX_H_
+#define CINDEX_H_
+
+#include "gumbo.h"
+#include "gumbo_edit.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+// A per-document element index: tag -> nodes, class -> nodes and
+// id -> nodes, filled by one traversal of the tree.  Selectors whose
+// rightmost simple part is a tag, class or id selector can then match
+// against the (usually tiny) candidate list instead of walking the
+// whole tree again on every query.  The candidate lists are built in
+// document order, so filtering them returns nodes in the same order a
+// traversal would.  The index holds bare node pointers and must not
+// outlive the parse it was built from.
+class CIndex
+{
+
+ public:
+
+    CIndex();
+
+    void build(GumboNode* apRoot);
+
+    bool built() const;
+
+    // the root the index was built from; an index only answers
+    // queries rooted at that node
+    GumboNode* root() const;
+
+    const std::vector<GumboNode*>& tagNodes(GumboTag aTag) const;
+
+    const std::vector<GumboNode*>& classNodes(const std::string& aClass) const;
+
+    const std::vector<GumboNode*>& idNodes(const std::string& aId) const;
+
+ private:
+
+    void indexInto(GumboNode* apNode);
+
+ private:
+
+    bool mBuilt;
+
+    GumboNode* mpRoot;
+
+    std::map<int, std::vector<GumboNode*> > mTagNodes;
+
+    std::map<std::string, std::vector<GumboNode*> > mClassNodes;
+
+    std::map<std::string, std::vector<GumboNode*> > mIdNodes;
+};
+
+#endif /* CINDEX_H_ */
@@ -61,14 +61,12 @@ void CObject::release()
         // throw "something wrong, reference count is negative";
     }
 
-    if (mReferences == 1)
+    // decrement atomically and delete on the last reference so
+    // concurrent retain/release pairs on a shared selector are safe
+    if (mReferences.fetch_sub(1) == 1)
     {
         delete this;
     }
-    else
-    {
-        mReferences--;
-    }
 }
 
 unsigned int CObject::references()
@@ -37,6 +37,8 @@
 #ifndef COBJECT_H_
 #define COBJECT_H_
 
+#include <atomic>
+
 class CObject
 {
 
@@ -56,7 +58,9 @@ class CObject
 
  private:
 
-    int mReferences;
+    // atomic so selectors shared through the CParser compiled
+    // selector cache can be retained and released from any thread
+    std::atomic<int> mReferences;
 };
 
 #endif /* COBJECT_H_ */
@@ -36,6 +36,8 @@
 
 #include <exception>
 #include <stdexcept>
+#include <map>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -81,10 +83,43 @@ CParser::~CParser()
 {
 }
 
+// The same handful of selector strings get applied over hundreds of
+// documents per session, so compiled selector trees are kept in a
+// process wide cache keyed by selector text.  A compiled selector is
+// immutable - matching never mutates it - so one tree can be shared
+// by every caller; the cache is simply capped, not evicted, since a
+// refill is cheap and the working set is a handful of selectors.
+static const size_t MAX_CACHED_SELECTORS = 200;
+static std::map<std::string, CSelector*> selector_cache;
+static std::mutex selector_cache_mutex;
+
 CSelector* CParser::create(std::string aInput)
 {
+    std::lock_guard<std::mutex> lock(selector_cache_mutex);
+    std::map<std::string, CSelector*>::iterator it = selector_cache.find(aInput);
+    if (it != selector_cache.end())
+    {
+        it->second->retain();
+        return it->second;
+    }
+
+    // can throw QueryParserException, in which case nothing is cached
     CParser parser(aInput);
-    return parser.parseSelectorGroup();
+    CSelector* sel = parser.parseSelectorGroup();
+
+    if (selector_cache.size() >= MAX_CACHED_SELECTORS)
+    {
+        for (it = selector_cache.begin(); it != selector_cache.end(); it++)
+        {
+            it->second->release();
+        }
+        selector_cache.clear();
+    }
+
+    // one reference belongs to the cache, one to the caller
+    sel->retain();
+    selector_cache[aInput] = sel;
+    return sel;
 }
 
 CSelector* CParser::parseSelectorGroup()
@@ -55,6 +55,9 @@ class CParser
 
  public:
 
+    // returns the compiled selector for aInput, reusing a process wide
+    // cache of compiled selector trees; the returned selector is
+    // retained for the caller, who release()s it exactly as before
     static CSelector* create(std::string aInput);
 
  private:
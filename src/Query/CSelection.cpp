@@ -60,16 +60,21 @@ CSelection::~CSelection()
 }
 
 CSelection CSelection::find(std::string aSelector)
+{
+    return find(aSelector, NULL);
+}
+
+CSelection CSelection::find(std::string aSelector, CIndex* apIndex)
 {
     // parsing the any selector can throw exceptions
-    // try to fail gracefully 
+    // try to fail gracefully
     try {
         CSelector* sel = CParser::create(aSelector);
         std::vector<GumboNode*> ret;
         for (std::vector<GumboNode*>::iterator it = mNodes.begin(); it != mNodes.end(); it++)
         {
             GumboNode* pNode = *it;
-            std::vector<GumboNode*> matched = sel->matchAll(pNode);
+            std::vector<GumboNode*> matched = sel->matchAll(pNode, apIndex);
             ret = CQueryUtil::unionNodes(ret, matched);
         }
         sel->release();
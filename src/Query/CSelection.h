@@ -43,6 +43,7 @@
 #include "gumbo.h"
 #include "gumbo_edit.h"
 
+class CIndex;
 class CNode;
 
 class CSelection: public CObject
@@ -60,6 +61,10 @@ class CSelection: public CObject
 
     CSelection find(std::string aSelector);
 
+    // like find, but consults a prebuilt per-document index so
+    // selectors it can answer match candidates instead of the tree
+    CSelection find(std::string aSelector, CIndex* apIndex);
+
     CNode nodeAt(size_t i);
 
     size_t nodeNum();
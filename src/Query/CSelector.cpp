@@ -37,6 +37,7 @@
 #include <iostream>
 
 #include "Query/CSelector.h"
+#include "Query/CIndex.h"
 #include "Query/CQueryUtil.h"
 #include "Query/CNode.h"
 
@@ -223,6 +224,32 @@ std::vector<GumboNode*> CSelector::matchAll(GumboNode* apNode)
     return ret;
 }
 
+std::vector<GumboNode*> CSelector::matchAll(GumboNode* apNode, CIndex* apIndex)
+{
+    // an index only answers queries rooted at the node it indexed;
+    // candidate lists are in document order, so filtering them yields
+    // the same nodes in the same order a traversal would
+    if (apIndex != NULL && apIndex->built() && apIndex->root() == apNode)
+    {
+        std::vector<GumboNode*> candidates;
+        if (indexCandidates(apIndex, candidates))
+        {
+            return filter(candidates);
+        }
+    }
+    return matchAll(apNode);
+}
+
+bool CSelector::indexCandidates(CIndex* apIndex, std::vector<GumboNode*>& aCandidates)
+{
+    if (mOp == ETag)
+    {
+        aCandidates = apIndex->tagNodes(mTag);
+        return true;
+    }
+    return false;
+}
+
 void CSelector::matchAllInto(GumboNode* apNode, std::vector<GumboNode*>& nodes)
 {
     if (match(apNode))
@@ -277,6 +304,28 @@ CBinarySelector::CBinarySelector(CSelector* apS1, CSelector* apS2, bool aAdjacen
     mAdjacent = aAdjacent;
 }
 
+bool CBinarySelector::indexCandidates(CIndex* apIndex, std::vector<GumboNode*>& aCandidates)
+{
+    switch (mOp)
+    {
+        case EIntersection:
+            // either side's candidates are a superset of the
+            // intersection; prefer the right (more specific) side
+            return mpS2->indexCandidates(apIndex, aCandidates)
+                || mpS1->indexCandidates(apIndex, aCandidates);
+        case EChild:
+        case EDescendant:
+        case ESibling:
+            // match() checks the left side through parent/sibling
+            // links, so the right side's candidates suffice
+            return mpS2->indexCandidates(apIndex, aCandidates);
+        default:
+            // a union's results could not keep document order when
+            // merged from two candidate lists, so it walks the tree
+            return false;
+    }
+}
+
 bool CBinarySelector::match(GumboNode* apNode)
 {
     switch (mOp)
@@ -360,6 +409,21 @@ CAttributeSelector::CAttributeSelector(TOperator aOp, std::string aKey, std::str
     mOp = aOp;
 }
 
+bool CAttributeSelector::indexCandidates(CIndex* apIndex, std::vector<GumboNode*>& aCandidates)
+{
+    if (mKey == "id" && mOp == EEquals)
+    {
+        aCandidates = apIndex->idNodes(mValue);
+        return true;
+    }
+    if (mKey == "class" && mOp == EIncludes)
+    {
+        aCandidates = apIndex->classNodes(mValue);
+        return true;
+    }
+    return false;
+}
+
 bool CAttributeSelector::match(GumboNode* apNode)
 {
     if (apNode->type != GUMBO_NODE_ELEMENT)
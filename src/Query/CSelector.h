@@ -44,6 +44,8 @@
 #include <vector>
 #include "Query/CObject.h"
 
+class CIndex;
+
 class CSelector: public CObject
 {
 
@@ -118,6 +120,16 @@ class CSelector: public CObject
 
     std::vector<GumboNode*> matchAll(GumboNode* apNode);
 
+    // like matchAll, but when the index was built for apNode and can
+    // supply candidates for this selector, only the candidates are
+    // match()ed instead of walking the whole tree
+    std::vector<GumboNode*> matchAll(GumboNode* apNode, CIndex* apIndex);
+
+    // fills aCandidates from the index and returns true when this
+    // selector's matches are a subset of an indexed candidate list
+    // (its rightmost simple part is a tag, class or id selector)
+    virtual bool indexCandidates(CIndex* apIndex, std::vector<GumboNode*>& aCandidates);
+
  private:
 
     void init()
@@ -221,6 +233,8 @@ class CBinarySelector: public CSelector
 
     virtual bool match(GumboNode* apNode);
 
+    virtual bool indexCandidates(CIndex* apIndex, std::vector<GumboNode*>& aCandidates);
+
  private:
 
     CSelector* mpS1;
@@ -264,6 +278,8 @@ class CAttributeSelector: public CSelector
 
     virtual bool match(GumboNode* apNode);
 
+    virtual bool indexCandidates(CIndex* apIndex, std::vector<GumboNode*>& aCandidates);
+
  private:
 
      std::string mKey;
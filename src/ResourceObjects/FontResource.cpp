@@ -22,16 +22,76 @@
 
 #include <QRawFont>
 #include <QFont>
+#include <QDateTime>
+#include <QFileInfo>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QMutexLocker>
 
 #include "Misc/Utility.h"
 #include "ResourceObjects/FontResource.h"
 
+// Parsed font properties kept per file path and revalidated against the
+// file's modification time and size, so clicking through a long list of
+// fonts in BookBrowser parses each file once, not once per visit.  The
+// mutex is needed because FontView parses fonts on a pool thread.
+struct CachedFontDetails {
+    QDateTime modified;
+    qint64    size;
+    FontResource::FontDetails details;
+};
+
+static QHash<QString, CachedFontDetails> font_details_cache;
+static QList<QString> font_details_order;
+static QMutex font_details_mutex;
+static const int MAX_CACHED_FONT_DETAILS = 300;
+
 FontResource::FontResource(const QString &mainfolder, const QString &fullfilepath, QObject *parent)
     : Resource(mainfolder, fullfilepath, parent)
 {
 }
 
 
+// static
+FontResource::FontDetails FontResource::GetFontDetails(const QString &path)
+{
+    QFileInfo fi(path);
+    {
+        QMutexLocker locker(&font_details_mutex);
+        if (font_details_cache.contains(path)) {
+            const CachedFontDetails &entry = font_details_cache[path];
+            if ((entry.modified == fi.lastModified()) && (entry.size == fi.size())) {
+                font_details_order.removeOne(path);
+                font_details_order.append(path);
+                return entry.details;
+            }
+        }
+    }
+
+    QRawFont rawfont(path, 16.0);
+    FontDetails details;
+    details.family = rawfont.familyName();
+    details.weight = rawfont.weight();
+    details.style = rawfont.style();
+
+    QMutexLocker locker(&font_details_mutex);
+    if (font_details_cache.contains(path)) {
+        font_details_order.removeOne(path);
+    }
+    CachedFontDetails entry;
+    entry.modified = fi.lastModified();
+    entry.size = fi.size();
+    entry.details = details;
+    font_details_cache.insert(path, entry);
+    font_details_order.append(path);
+    if (font_details_order.count() > MAX_CACHED_FONT_DETAILS) {
+        font_details_cache.remove(font_details_order.takeFirst());
+    }
+    return details;
+}
+
+
 Resource::ResourceType FontResource::Type() const
 {
     return Resource::FontResourceType;
@@ -45,26 +105,26 @@ QString FontResource::GetObfuscationAlgorithm() const
 
 QString FontResource::GetDescription() const
 {
-    QRawFont rawfont(GetFullPath(), 16.0);
-    QString desc = rawfont.familyName();
+    FontDetails font = GetFontDetails(GetFullPath());
+    QString desc = font.family;
     QString weight_name;
     QString style_name;
-    if (rawfont.weight() <  QFont::ExtraLight)      weight_name = " Thin";
-    else if (rawfont.weight() <  QFont::Light)      weight_name = " ExtraLight";
-    else if (rawfont.weight() <  QFont::Normal)     weight_name = " Light";
-    else if (rawfont.weight() <  QFont::Medium)     weight_name = " Normal";
-    else if (rawfont.weight() <  QFont::DemiBold)   weight_name = " Medium";
-    else if (rawfont.weight() <  QFont::Bold)       weight_name = " DemiBold";
-    else if (rawfont.weight() <  QFont::ExtraBold)  weight_name = " Bold";
-    else if (rawfont.weight() <  QFont::Black)      weight_name = " ExtraBold";
-    else if (rawfont.weight() >= QFont::Black)      weight_name = " Black";
+    if (font.weight <  QFont::ExtraLight)      weight_name = " Thin";
+    else if (font.weight <  QFont::Light)      weight_name = " ExtraLight";
+    else if (font.weight <  QFont::Normal)     weight_name = " Light";
+    else if (font.weight <  QFont::Medium)     weight_name = " Normal";
+    else if (font.weight <  QFont::DemiBold)   weight_name = " Medium";
+    else if (font.weight <  QFont::Bold)       weight_name = " DemiBold";
+    else if (font.weight <  QFont::ExtraBold)  weight_name = " Bold";
+    else if (font.weight <  QFont::Black)      weight_name = " ExtraBold";
+    else if (font.weight >= QFont::Black)      weight_name = " Black";
     if (desc != "") {
         if (desc.contains(weight_name)) weight_name = "";
         desc = desc + weight_name;
     }
 
-    if (rawfont.style()      == QFont::StyleItalic)  style_name = " Italic";
-    else if (rawfont.style() == QFont::StyleOblique) style_name = " Oblique";
+    if (font.style      == QFont::StyleItalic)  style_name = " Italic";
+    else if (font.style == QFont::StyleOblique) style_name = " Oblique";
 
     if (desc != "") desc = desc + style_name;
     else desc = tr("No reliable font data");
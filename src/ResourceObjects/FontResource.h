@@ -44,6 +44,25 @@ public:
      */
     FontResource(const QString &mainfolder, const QString &fullfilepath, QObject *parent = NULL);
 
+    /**
+     * The font properties read out of the font file itself.
+     * weight and style hold QFont::Weight and QFont::Style values.
+     */
+    struct FontDetails {
+        QString family;
+        int weight;
+        int style;
+    };
+
+    /**
+     * Parses the font file for its family, weight, and style.
+     * Results are cached per file (revalidated against the file's
+     * modification time and size) because parsing the font is the
+     * slow part of showing a font tab, and safe to call from a
+     * worker thread.
+     */
+    static FontDetails GetFontDetails(const QString &path);
+
     // inherited
     virtual ResourceType Type() const;
 
@@ -21,6 +21,7 @@
 *************************************************************************/
 
 #include <QtCore/QBuffer>
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QDir>
 #include <QtCore/QFileInfo>
 #include <QtCore/QObject>
@@ -124,22 +125,38 @@ bool NCXResource::GenerateNCXFromBookContents(const Book *book)
 {
     bool is_changed = false;
     QByteArray raw_ncx;
+    // The regenerated ncx is about the size of the one it replaces, so
+    // the existing text makes a good sizing hint for the write buffer.
+    raw_ncx.reserve(qMax(GetText().size(), 1024));
     QBuffer buffer(&raw_ncx);
     buffer.open(QIODevice::WriteOnly);
     NCXWriter ncx(book, buffer);
     ncx.WriteXMLFromHeadings();
     buffer.close();
+
+    // The pretty print below runs in embedded Python and dominates
+    // this path.  If the writer emitted the same ncx as last time and
+    // our text has not been edited since, nothing can change - skip it.
+    QByteArray raw_hash = QCryptographicHash::hash(raw_ncx, QCryptographicHash::Md5);
+    QByteArray existing_text_hash = QCryptographicHash::hash(GetText().toUtf8(), QCryptographicHash::Md5);
+
+    if ((raw_hash == m_LastRawNCXHash) && (existing_text_hash == m_LastGeneratedTextHash)) {
+        return false;
+    }
+
     QString new_text = CleanSource::ProcessXML(QString::fromUtf8(raw_ncx.constData(), raw_ncx.size()),"application/x-dtbncx+xml");
     QString existing_text = GetText();
 
     // Only update the resource if have changed. Note that this is_changed trick will not
     // work after first loading an EPUB, because the metadata elements have their attributes
-    // in swapped in a different order from the xhtml processing. 
+    // in swapped in a different order from the xhtml processing.
     if (new_text != existing_text) {
         SetText(new_text);
         is_changed = true;
     }
 
+    m_LastRawNCXHash = raw_hash;
+    m_LastGeneratedTextHash = QCryptographicHash::hash(new_text.toUtf8(), QCryptographicHash::Md5);
     return is_changed;
 }
 
@@ -152,6 +169,7 @@ void NCXResource::GenerateNCXFromTOCContents(const Book *book, TOCModel *toc_mod
 void NCXResource::GenerateNCXFromTOCEntries(const Book *book, TOCModel::TOCEntry toc_root_entry)
 {
     QByteArray raw_ncx;
+    raw_ncx.reserve(qMax(GetText().size(), 1024));
     QBuffer buffer(&raw_ncx);
     buffer.open(QIODevice::WriteOnly);
     NCXWriter ncx(book, buffer, toc_root_entry);
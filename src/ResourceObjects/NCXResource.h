@@ -62,6 +62,17 @@ public:
     void GenerateNCXFromTOCEntries(const Book *book, TOCModel::TOCEntry toc_root_entry);
     void FillWithDefaultText(const QString &version, const QString &default_text_folder);
     void FillWithDefaultTextToBookPath(const QString &version, const QString &start_bookpath);
+
+private:
+
+    /**
+     * Hashes of the raw ncx written on the last regeneration and of
+     * the processed text it produced.  When the writer emits the same
+     * ncx again and our text has not been edited since, the expensive
+     * pretty print and update can be skipped entirely.
+     */
+    QByteArray m_LastRawNCXHash;
+    QByteArray m_LastGeneratedTextHash;
 };
 
 #endif // NCXRESOURCE_H
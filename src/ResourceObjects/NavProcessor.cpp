@@ -23,7 +23,10 @@
 #include <QStringList>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
+#include <QCryptographicHash>
 #include <QDir>
+#include <QMutex>
+#include <QMutexLocker>
 #include <QUrl>
 #include <QFileInfo>
 
@@ -38,6 +41,19 @@ static const QString NAV_PAGELIST_PATTERN = "\\s*<!--\\s*SIGIL_REPLACE_PAGELIST_
 static const QString NAV_LANDMARKS_PATTERN = "\\s*<!--\\s*SIGIL_REPLACE_LANDMARKS_HERE\\s*-->\\s*";
 static const QString NAV_TOC_PATTERN = "\\s*<!--\\s*SIGIL_REPLACE_TOC_HERE\\s*-->\\s*";
 
+// NavProcessors are created ad hoc all over the place, and refresh
+// flows (TableOfContents, EditTOC, export) ask for the toc, landmark
+// and page-list entries several times in a row while the nav has not
+// changed.  The extracted entries are therefore cached against an md5
+// of the nav source; any edit changes the hash and simply misses.
+static QMutex nav_cache_mutex;
+static QHash<QByteArray, QList<NavTOCEntry>> nav_toc_cache;
+static QHash<QByteArray, QList<NavLandmarkEntry>> nav_landmark_cache;
+static QHash<QByteArray, QList<NavPageListEntry>> nav_pagelist_cache;
+
+// one nav per book, so a handful of entries covers every open book
+static const int MAX_NAV_CACHE_ENTRIES = 8;
+
 NavProcessor::NavProcessor(HTMLResource * nav_resource)
   : m_NavResource(nav_resource)
 {
@@ -102,6 +118,14 @@ QList<NavLandmarkEntry> NavProcessor::GetLandmarks()
     QReadLocker locker(&m_NavResource->GetLock());
     QString source = m_NavResource->GetText();
 
+    QByteArray nav_hash = QCryptographicHash::hash(source.toUtf8(), QCryptographicHash::Md5);
+    {
+        QMutexLocker cache_locker(&nav_cache_mutex);
+        if (nav_landmark_cache.contains(nav_hash)) {
+            return nav_landmark_cache.value(nav_hash);
+        }
+    }
+
     // user may leave nav in unparseable state so use
     // regular expressions to try and extract just the landmarks code only from main nav
 
@@ -136,6 +160,13 @@ QList<NavLandmarkEntry> NavProcessor::GetLandmarks()
             break;
         }
     }
+    {
+        QMutexLocker cache_locker(&nav_cache_mutex);
+        if (nav_landmark_cache.size() >= MAX_NAV_CACHE_ENTRIES) {
+            nav_landmark_cache.clear();
+        }
+        nav_landmark_cache[nav_hash] = landlist;
+    }
     return landlist;
 }
 
@@ -148,6 +179,14 @@ QList<NavPageListEntry> NavProcessor::GetPageList()
     QReadLocker locker(&m_NavResource->GetLock());
     QString source = m_NavResource->GetText();
 
+    QByteArray nav_hash = QCryptographicHash::hash(source.toUtf8(), QCryptographicHash::Md5);
+    {
+        QMutexLocker cache_locker(&nav_cache_mutex);
+        if (nav_pagelist_cache.contains(nav_hash)) {
+            return nav_pagelist_cache.value(nav_hash);
+        }
+    }
+
     // user may leave nav in unparseable state so use
     // regular expressions to try and extract just the page-list code only from main nav
 
@@ -180,6 +219,13 @@ QList<NavPageListEntry> NavProcessor::GetPageList()
             break;
         }
     }
+    {
+        QMutexLocker cache_locker(&nav_cache_mutex);
+        if (nav_pagelist_cache.size() >= MAX_NAV_CACHE_ENTRIES) {
+            nav_pagelist_cache.clear();
+        }
+        nav_pagelist_cache[nav_hash] = pagelist;
+    }
     return pagelist;
 }
 
@@ -192,6 +238,14 @@ QList<NavTOCEntry> NavProcessor::GetTOC()
     QReadLocker locker(&m_NavResource->GetLock());
     QString source = m_NavResource->GetText();
 
+    QByteArray nav_hash = QCryptographicHash::hash(source.toUtf8(), QCryptographicHash::Md5);
+    {
+        QMutexLocker cache_locker(&nav_cache_mutex);
+        if (nav_toc_cache.contains(nav_hash)) {
+            return nav_toc_cache.value(nav_hash);
+        }
+    }
+
     // user may leave nav in unparseable state so use
     // regular expressions to try and extract just the toc code only from main nav
 
@@ -218,8 +272,15 @@ QList<NavTOCEntry> NavProcessor::GetTOC()
                 toclist.append(GetNodeTOC(gi, olnode, 1));
                 break;
             }
-            break;              
+            break;
+        }
+    }
+    {
+        QMutexLocker cache_locker(&nav_cache_mutex);
+        if (nav_toc_cache.size() >= MAX_NAV_CACHE_ENTRIES) {
+            nav_toc_cache.clear();
         }
+        nav_toc_cache[nav_hash] = toclist;
     }
     return toclist;
 }
@@ -20,6 +20,10 @@
 **
 *************************************************************************/
 
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+
 #include "EmbedPython/EmbeddedPython.h"
 #include "Misc/Utility.h"
 #include "ResourceObjects/OPFParser.h"
@@ -29,6 +33,34 @@
 // as decoding urls before splitting into component parts can lead
 // to data loss (paths can legally contain url delimiters when decoded - such as #)
 
+// Values coming back from the python opf parser repeat heavily both
+// inside one parse (media types, attribute names, spine idrefs that
+// mirror manifest ids) and across parses of the same book.  Handing
+// every entry the same shared QString instead of a fresh allocation
+// keeps a 1000 item manifest from holding 1000 copies of
+// "application/xhtml+xml" and makes the idref == id comparisons in
+// OPFResource cheap.
+static QMutex intern_pool_mutex;
+static QSet<QString> intern_pool;
+
+static const int MAX_INTERN_POOL_SIZE = 4096;
+
+static QString Interned(const QString &value)
+{
+    QMutexLocker locker(&intern_pool_mutex);
+    QSet<QString>::const_iterator it = intern_pool.constFind(value);
+    if (it != intern_pool.constEnd()) {
+        return *it;
+    }
+    // the pool holds ids too, so cap it in case many
+    // large books pass through one session
+    if (intern_pool.size() >= MAX_INTERN_POOL_SIZE) {
+        intern_pool.clear();
+    }
+    intern_pool.insert(value);
+    return value;
+}
+
 /**
  * Package tag
  */
@@ -58,7 +90,7 @@ PackageEntry::PackageEntry(const QVariant& qv)
         int n = keylist.size();
         if (n == vallist.size()) {
             for (int i=0; i < n; i++) {
-                m_atts[keylist.at(i)] = vallist.at(i);
+                m_atts[Interned(keylist.at(i))] = vallist.at(i);
             }
         }
     }
@@ -103,7 +135,7 @@ MetaNSEntry::MetaNSEntry(const QVariant& qv)
         int n = keylist.size();
         if (n == vallist.size()) {
             for (int i=0; i < n; i++) {
-                m_atts[keylist.at(i)] = vallist.at(i);
+                m_atts[Interned(keylist.at(i))] = vallist.at(i);
             }
         }
     }
@@ -144,14 +176,14 @@ MetaEntry::MetaEntry(const QVariant& qv)
     // tuple: (tagname, content, keylist, vallist)
     QList<QVariant> tup = qv.toList();
     if (tup.size() == 4) {
-        m_name = tup.at(0).toString();
+        m_name = Interned(tup.at(0).toString());
         m_content = tup.at(1).toString();
         QStringList keylist = tup.at(2).toStringList();
         QStringList vallist = tup.at(3).toStringList();
         int n = keylist.size();
         if (n == vallist.size()) {
             for (int i=0; i < n; i++) {
-                m_atts[keylist.at(i)] = vallist.at(i);
+                m_atts[Interned(keylist.at(i))] = vallist.at(i);
             }
         }
     }
@@ -197,15 +229,15 @@ ManifestEntry::ManifestEntry(const QVariant& qv)
     QList<QVariant> tup = qv.toList();
     // tuple (id, href, media-type, keylist, vallist)
     if (tup.size() == 5) {
-        m_id    = tup.at(0).toString();
+        m_id    = Interned(tup.at(0).toString());
         m_href  = tup.at(1).toString();
-        m_mtype = tup.at(2).toString();
+        m_mtype = Interned(tup.at(2).toString());
         QStringList keylist = tup.at(3).toStringList();
         QStringList vallist = tup.at(4).toStringList();
         int n = keylist.size();
         if (n == vallist.size()) {
             for (int i=0; i < n; i++) {
-                m_atts[keylist.at(i)] = vallist.at(i);
+                m_atts[Interned(keylist.at(i))] = vallist.at(i);
             }
         }
     }
@@ -250,7 +282,7 @@ SpineAttrEntry::SpineAttrEntry(const QVariant& qv)
         int n = keylist.size();
         if (n == vallist.size()) {
             for (int i=0; i < n; i++) {
-                m_atts[keylist.at(i)] = vallist.at(i);
+                m_atts[Interned(keylist.at(i))] = vallist.at(i);
             }
         }
     }
@@ -290,13 +322,13 @@ SpineEntry::SpineEntry(const QVariant& qv)
     QList<QVariant> tup = qv.toList();
     // tuple (idref, keylist, vallist)
     if (tup.size() == 3) {
-        m_idref = tup.at(0).toString();
+        m_idref = Interned(tup.at(0).toString());
         QStringList keylist = tup.at(1).toStringList();
         QStringList vallist = tup.at(2).toStringList();
         int n = keylist.size();
         if (n == vallist.size()) {
             for (int i=0; i < n; i++) {
-                m_atts[keylist.at(i)] = vallist.at(i);
+                m_atts[Interned(keylist.at(i))] = vallist.at(i);
             }
         }
     }
@@ -330,7 +362,7 @@ GuideEntry::GuideEntry(const QVariant& qv)
     // tuple (type, title, href)
     QList<QVariant> tup = qv.toList();
     if (tup.size() == 3) {
-        m_type  = tup.at(0).toString();
+        m_type  = Interned(tup.at(0).toString());
         m_title = tup.at(1).toString();
         m_href  = tup.at(2).toString();
     }
@@ -361,7 +393,7 @@ BindingsEntry::BindingsEntry(const QVariant& qv)
     // tuple (media-type, handler)
     QList<QVariant> tup = qv.toList();
     if (tup.size() == 2) {
-        m_mtype   = tup.at(0).toString();
+        m_mtype   = Interned(tup.at(0).toString());
         m_handler = tup.at(1).toString();
     }
 }
@@ -126,7 +126,11 @@ OPFResource::OPFResource(const QString &mainfolder,
              QObject *parent)
   : XMLResource(mainfolder, fullfilepath, parent),
     m_NavResource(NULL),
-    m_WarnedAboutVersion(false)
+    m_WarnedAboutVersion(false),
+    m_ParsedModelValid(false),
+    m_SpineIndexValid(false),
+    m_ModelUpdatesSuspended(false),
+    m_DeferredModelDirty(false)
 {
     FillWithDefaultText(version);
     // Make sure the file exists on disk.
@@ -198,9 +202,8 @@ bool OPFResource::LoadFromDisk()
 QList<Resource*> OPFResource::GetSpineOrderResources( const QList<Resource *> &resources)
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     const QHash<QString, Resource*> id_mapping = GetManifestIDResourceMapping(resources, p);
     QList<Resource *> spine_order;
     for (int i = 0; i < p.m_spine.count(); ++i) {
@@ -215,17 +218,12 @@ QList<Resource*> OPFResource::GetSpineOrderResources( const QList<Resource *> &r
 QHash <Resource *, int>  OPFResource::GetReadingOrderAll( const QList <Resource *> resources)
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QHash <Resource *, int> reading_order;
-    QHash<QString, int> id_order;
-    for (int i = 0; i < p.m_spine.count(); ++i) {
-        id_order[p.m_spine.at(i).m_idref] = i;
-    }
-    QHash<Resource *, QString> id_mapping = GetResourceManifestIDMapping(resources, p);
+    const QHash<QString, int> spine_index = GetSpineIndexMap(p);
     foreach(Resource *resource, resources) {
-        reading_order[resource] = id_order[id_mapping[resource]];
+        reading_order[resource] = spine_index.value(resource->GetRelativePath(), 0);
     }
     return reading_order;
 }
@@ -234,26 +232,26 @@ QHash <Resource *, int>  OPFResource::GetReadingOrderAll( const QList <Resource
 int OPFResource::GetReadingOrder(const HTMLResource *html_resource) const
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     const Resource *resource = static_cast<const Resource *>(html_resource);
-    QString resource_id = GetResourceManifestID(resource, p);
-    for (int i = 0; i < p.m_spine.count(); ++i) {
-        QString idref = p.m_spine.at(i).m_idref;
-        if (resource_id == idref) {
-            return i;
-        }
-    }
-    return -1;
+    return GetSpineIndexMap(p).value(resource->GetRelativePath(), -1);
+}
+
+
+int OPFResource::GetSpineIndexByBookPath(const QString &bookpath) const
+{
+    QReadLocker locker(&GetLock());
+    OPFParser p;
+    GetParsedModel(p);
+    return GetSpineIndexMap(p).value(bookpath, -1);
 }
 
 QString OPFResource::GetMainIdentifierValue() const
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     int i = GetMainIdentifier(p);
     if (i > -1) {
         return QString(p.m_metadata.at(i).m_content);
@@ -299,9 +297,8 @@ QString OPFResource::GetUUIDIdentifierValue()
 {
     EnsureUUIDIdentifierPresent();
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     for (int i=0; i < p.m_metadata.count(); ++i) {
         MetaEntry me = p.m_metadata.at(i);
         if(me.m_name.startsWith("dc:identifier")) {
@@ -321,9 +318,8 @@ QString OPFResource::GetUUIDIdentifierValue()
 void OPFResource::EnsureUUIDIdentifierPresent()
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     for (int i=0; i < p.m_metadata.count(); ++i) {
         MetaEntry me = p.m_metadata.at(i);
         if(me.m_name.startsWith("dc:identifier")) {
@@ -347,9 +343,8 @@ void OPFResource::EnsureUUIDIdentifierPresent()
 QString OPFResource::AddNCXItem(const QString &ncx_path, QString id)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QString ncx_bkpath = ncx_path.right(ncx_path.length() - GetFullPathToBookFolder().length() - 1);
     QString ncx_rel_path = Utility::buildRelativePath(GetRelativePath(), ncx_bkpath);
     int n = p.m_manifest.count();
@@ -368,9 +363,8 @@ QString OPFResource::AddNCXItem(const QString &ncx_path, QString id)
 void OPFResource::UpdateNCXOnSpine(const QString &new_ncx_id)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QString ncx_id = p.m_spineattr.m_atts.value(QString("toc"),"");
     if (new_ncx_id != ncx_id) {
         p.m_spineattr.m_atts[QString("toc")] = new_ncx_id;
@@ -381,9 +375,8 @@ void OPFResource::UpdateNCXOnSpine(const QString &new_ncx_id)
 void OPFResource::RemoveNCXOnSpine()
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     p.m_spineattr.m_atts.remove("toc");
     UpdateText(p);
 }
@@ -392,9 +385,8 @@ void OPFResource::RemoveNCXOnSpine()
 void OPFResource::UpdateNCXLocationInManifest(const NCXResource *ncx)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QString ncx_id = p.m_spineattr.m_atts.value(QString("toc"), "");
     int pos = p.m_idpos.value(ncx_id, -1);
     if (pos > -1) {
@@ -413,9 +405,8 @@ void OPFResource::UpdateNCXLocationInManifest(const NCXResource *ncx)
 void OPFResource::AddSigilVersionMeta()
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     for (int i=0; i < p.m_metadata.count(); ++i) {
         MetaEntry me = p.m_metadata.at(i);
         if ((me.m_name == "meta") && (me.m_atts.contains("name"))) {  
@@ -440,9 +431,8 @@ void OPFResource::AddSigilVersionMeta()
 bool OPFResource::IsCoverImage(const ImageResource *image_resource) const
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QString resource_id = GetResourceManifestID(image_resource, p);
     return IsCoverImageCheck(resource_id, p);
 }
@@ -462,9 +452,8 @@ bool OPFResource::IsCoverImageCheck(QString resource_id, const OPFParser & p) co
 bool OPFResource::CoverImageExists() const
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     return GetCoverMeta(p) > -1;
 }
 
@@ -480,9 +469,8 @@ void OPFResource::AutoFixWellFormedErrors()
 QStringList OPFResource::GetSpineOrderBookPaths() const
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QStringList book_paths_in_reading_order;
     for (int i=0; i < p.m_spine.count(); ++i) {
         SpineEntry sp = p.m_spine.at(i);
@@ -520,9 +508,8 @@ QString OPFResource::GetPrimaryBookLanguage() const
 QList<MetaEntry> OPFResource::GetDCMetadata() const
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QList<MetaEntry> metadata;
     for (int i=0; i < p.m_metadata.count(); ++i) {
         if (p.m_metadata.at(i).m_name.startsWith("dc:")) {
@@ -549,9 +536,8 @@ QStringList OPFResource::GetDCMetadataValues(QString text) const
 void OPFResource::SetDCMetadata(const QList<MetaEntry> &metadata)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     // this will not work with refines so it needs to be fixed
     RemoveDCElements(p);
     foreach(MetaEntry book_meta, metadata) {
@@ -566,9 +552,8 @@ void OPFResource::SetDCMetadata(const QList<MetaEntry> &metadata)
 void OPFResource::AddResource(const Resource *resource)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     ManifestEntry me;
     me.m_id = GetUniqueID(GetValidID(resource->Filename()),p);
     me.m_href = Utility::URLEncodePath(GetRelativePathToResource(resource));
@@ -596,6 +581,32 @@ void OPFResource::AddResource(const Resource *resource)
     UpdateText(p);
 }
 
+void OPFResource::BulkAddResources(const QList<const Resource *> resources)
+{
+    if (resources.isEmpty()) return;
+    QWriteLocker locker(&GetLock());
+    qDebug() << "OPF Bulk Add Resources";
+    OPFParser p;
+    GetParsedModel(p);
+    foreach(const Resource * resource, resources) {
+        ManifestEntry me;
+        me.m_id = GetUniqueID(GetValidID(resource->Filename()),p);
+        me.m_href = Utility::URLEncodePath(GetRelativePathToResource(resource));
+        me.m_mtype = GetResourceMimetype(resource);
+        int n = p.m_manifest.count();
+        p.m_manifest.append(me);
+        p.m_idpos[me.m_id] = n;
+        p.m_hrefpos[me.m_href] = n;
+        if (resource->Type() == Resource::HTMLResourceType) {
+            SpineEntry se;
+            se.m_idref = me.m_id;
+            p.m_spine.append(se);
+        }
+    }
+    UpdateText(p);
+}
+
+
 void OPFResource::RemoveCoverImageProperty(QString& resource_id, OPFParser& p)
 {
     // remove the cover image property from manifest with resource_id
@@ -675,9 +686,8 @@ void OPFResource::BulkRemoveResources(const QList<Resource *>resources)
 {
     QWriteLocker locker(&GetLock());
     qDebug() << "OPF Bulk Remove Resource";
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     if (p.m_manifest.isEmpty()) return;
 
     foreach(Resource * resource, resources) {
@@ -726,9 +736,8 @@ void OPFResource::RemoveResource(const Resource *resource)
 {
     QWriteLocker locker(&GetLock());
     qDebug() << "OPF Remove Resource";
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     if (p.m_manifest.isEmpty()) return;
     QString href = Utility::URLEncodePath(GetRelativePathToResource(resource));
     int pos = p.m_hrefpos.value(href, -1);
@@ -773,9 +782,8 @@ void OPFResource::RemoveResource(const Resource *resource)
 void OPFResource::ClearSemanticCodesInGuide()
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     foreach(GuideEntry ge, p.m_guide) {
         p.m_guide.removeAt(0);
     }
@@ -788,9 +796,8 @@ void OPFResource::AddGuideSemanticCode(HTMLResource *html_resource, QString new_
     //first get primary book language
     QString lang = GetPrimaryBookLanguage();
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QString current_code = GetGuideSemanticCodeForResource(html_resource, p);
 
     if ((current_code != new_code) || !toggle) {
@@ -868,9 +875,8 @@ void OPFResource::RemoveGuideReferenceForResource(const Resource *resource, OPFP
 void OPFResource::UpdateGuideFragments(QHash<QString,QString> &idupdates)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     for(int c=0; c < p.m_guide.size(); c++) {
         GuideEntry ge = p.m_guide.at(c);
         QString href = ge.m_href;
@@ -903,9 +909,8 @@ void OPFResource::UpdateGuideAfterMerge(QList<Resource*> &merged_resources, QHas
         merged_bookpaths << res->GetRelativePath();
     }
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     for(int c=0; c < p.m_guide.size(); c++) {
         GuideEntry ge = p.m_guide.at(c);
         QString href = ge.m_href;
@@ -952,9 +957,8 @@ void OPFResource::SetGuideSemanticCodeForResource(QString code, const Resource *
 QString OPFResource::GetGuideSemanticCodeForResource(const Resource *resource) const
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     return GetGuideSemanticCodeForResource(resource, p);
 }
 
@@ -968,9 +972,8 @@ QString OPFResource::GetGuideSemanticNameForResource(Resource *resource)
 QHash <QString, QString>  OPFResource::GetSemanticCodeForPaths()
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
 
     QHash <QString, QString> semantic_types;
     foreach(GuideEntry ge, p.m_guide) {
@@ -988,9 +991,8 @@ QHash <QString, QString>  OPFResource::GetSemanticCodeForPaths()
 QHash <QString, QString>  OPFResource::GetGuideSemanticNameForPaths()
 {
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
 
     QHash <QString, QString> semantic_types;
     foreach(GuideEntry ge, p.m_guide) {
@@ -1019,9 +1021,8 @@ QHash <QString, QString>  OPFResource::GetGuideSemanticNameForPaths()
 void OPFResource::SetResourceAsCoverImage(ImageResource *image_resource)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QString resource_id = GetResourceManifestID(image_resource, p);
 
     // First deal with any previous covers by removing 
@@ -1056,9 +1057,8 @@ void OPFResource::SetResourceAsCoverImage(ImageResource *image_resource)
 void OPFResource::UpdateSpineOrder(const QList<::HTMLResource *> html_files)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QList<SpineEntry> new_spine;
     foreach(HTMLResource * html_resource, html_files) {
         const Resource *resource = static_cast<const Resource *>(html_resource);
@@ -1088,9 +1088,8 @@ void OPFResource::UpdateSpineOrder(const QList<::HTMLResource *> html_files)
 void OPFResource::ResourceRenamed(const Resource *resource, QString old_full_path)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     // first convert old_full_path to old_bkpath
     QString old_bkpath = old_full_path.right(old_full_path.length() - GetFullPathToBookFolder().length() - 1);
     QString old_href = Utility::URLEncodePath(Utility::buildRelativePath(GetRelativePath(), old_bkpath));
@@ -1146,9 +1145,8 @@ void OPFResource::ResourceRenamed(const Resource *resource, QString old_full_pat
 void OPFResource::ResourceMoved(const Resource *resource, QString old_full_path)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     // first convert old_full_path to old_bkpath
     QString old_bkpath = old_full_path.right(old_full_path.length() - GetFullPathToBookFolder().length() - 1);
     QString old_href = Utility::URLEncodePath(Utility::buildRelativePath(GetRelativePath(), old_bkpath));
@@ -1313,9 +1311,8 @@ QString OPFResource::AddModificationDateMeta()
     datetime = local.toString(Qt::ISODate);
 
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
 
     QString epubversion = GetEpubVersion();
     if (epubversion.startsWith('3')) {
@@ -1430,9 +1427,115 @@ QString OPFResource::GetFileMimetype(const QString &filepath) const
 }
 
 
+void OPFResource::GetParsedModel(OPFParser &p) const
+{
+    QMutexLocker locker(&m_ParsedModelMutex);
+
+    // With model updates suspended the parked model is ahead of the
+    // text, so it is the only truthful source.
+    if (m_DeferredModelDirty) {
+        p = m_ParsedModel;
+        return;
+    }
+
+    QString text = GetText();
+
+    if (m_ParsedModelValid && (text == m_ParsedModelSource)) {
+        p = m_ParsedModel;
+        return;
+    }
+
+    // The text has changed behind our back (code view edits, load from
+    // disk, ...) so take the slow safe path through the embedded python
+    // xml processor before parsing.
+    QString source = CleanSource::ProcessXML(text,"application/oebps-package+xml");
+    p.parse(source);
+    m_ParsedModel = p;
+    m_ParsedModelSource = text;
+    m_ParsedModelValid = true;
+}
+
+
+QHash<QString, int> OPFResource::GetSpineIndexMap(const OPFParser &p) const
+{
+    QMutexLocker locker(&m_ParsedModelMutex);
+
+    // With model updates suspended the spine can move ahead of the text,
+    // so build fresh from p and leave the cache alone until then.
+    if (!m_DeferredModelDirty &&
+        m_SpineIndexValid && (m_SpineIndexSource == m_ParsedModelSource)) {
+        return m_SpineIndexCache;
+    }
+
+    QHash<QString, int> spine_index;
+    for (int i = 0; i < p.m_spine.count(); ++i) {
+        int pos = p.m_idpos.value(p.m_spine.at(i).m_idref, -1);
+        if (pos > -1) {
+            QString apath = Utility::URLDecodePath(p.m_manifest.at(pos).m_href);
+            spine_index.insert(Utility::buildBookPath(apath, GetFolder()), i);
+        }
+    }
+
+    if (!m_DeferredModelDirty) {
+        m_SpineIndexCache = spine_index;
+        m_SpineIndexSource = m_ParsedModelSource;
+        m_SpineIndexValid = true;
+    }
+    return spine_index;
+}
+
+
 void OPFResource::UpdateText(const OPFParser &p)
 {
-    TextResource::SetText(p.convert_to_xml());
+    {
+        QMutexLocker locker(&m_ParsedModelMutex);
+
+        // During a rename or move loop only the final model matters;
+        // park it and let ResumeModelUpdates() serialize once.
+        if (m_ModelUpdatesSuspended) {
+            m_ParsedModel = p;
+            m_DeferredModelDirty = true;
+            return;
+        }
+    }
+    QString text = p.convert_to_xml();
+    TextResource::SetText(text);
+    // The new text was serialized from p, so the next GetParsedModel
+    // can hand back p instead of re-parsing.  Repeated manifest/spine
+    // mutations (spine drag re-orders, bulk adds) stay incremental.
+    QMutexLocker locker(&m_ParsedModelMutex);
+    m_ParsedModel = p;
+    m_ParsedModelSource = text;
+    m_ParsedModelValid = true;
+}
+
+
+void OPFResource::SuspendModelUpdates()
+{
+    QMutexLocker locker(&m_ParsedModelMutex);
+    m_ModelUpdatesSuspended = true;
+    m_DeferredModelDirty = false;
+}
+
+
+void OPFResource::ResumeModelUpdates()
+{
+    OPFParser p;
+    bool dirty;
+    {
+        QMutexLocker locker(&m_ParsedModelMutex);
+        m_ModelUpdatesSuspended = false;
+        dirty = m_DeferredModelDirty;
+        m_DeferredModelDirty = false;
+
+        if (dirty) {
+            p = m_ParsedModel;
+        }
+    }
+
+    if (dirty) {
+        UpdateText(p);
+    }
 }
 
 
@@ -1460,9 +1563,8 @@ QString OPFResource::ValidatePackageVersion(const QString& source)
 void OPFResource::UpdateManifestProperties(const QList<Resource*> resources)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     if (p.m_package.m_version != "3.0") {
         return;
     }
@@ -1507,9 +1609,8 @@ QString OPFResource::GetManifestPropertiesForResource(const Resource * resource)
     QString properties;
     if (!resource) return properties;
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     if (!p.m_package.m_version.startsWith("3")) {
         return properties;
     }
@@ -1531,9 +1632,8 @@ QHash <QString, QString>  OPFResource::GetManifestPropertiesForPaths()
         return manifest_properties_all;
     }
     QReadLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     foreach(ManifestEntry me, p.m_manifest) {
         QString apath = Utility::URLDecodePath(me.m_href);
         if (me.m_atts.contains("properties")){
@@ -1558,9 +1658,8 @@ void OPFResource::SetNavResource(HTMLResource * nav_resource)
     // Make sure the proper nav property is set in the opf manifest
     if (m_NavResource) { 
         QWriteLocker locker(&GetLock());
-        QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
         OPFParser p;
-        p.parse(source);
+        GetParsedModel(p);
         QString href = Utility::URLEncodePath(GetRelativePathToResource(m_NavResource));
         int pos = p.m_hrefpos.value(href, -1);
         if ((pos >= 0) && (pos < p.m_manifest.count())) {
@@ -1576,9 +1675,8 @@ void OPFResource::SetNavResource(HTMLResource * nav_resource)
 void OPFResource::SetItemRefLinear(Resource * resource, bool linear)
 {
     QWriteLocker locker(&GetLock());
-    QString source = CleanSource::ProcessXML(GetText(),"application/oebps-package+xml");
     OPFParser p;
-    p.parse(source);
+    GetParsedModel(p);
     QString resource_href_path = Utility::URLEncodePath(GetRelativePathToResource(resource));
     int pos = p.m_hrefpos.value(resource_href_path, -1);
     QString item_id = "";
@@ -26,6 +26,7 @@
 #define OPFRESOURCE_H
 
 #include <memory>
+#include <QtCore/QMutex>
 #include "Misc/GuideItems.h"
 #include "ResourceObjects/XMLResource.h"
 #include "ResourceObjects/OPFParser.h"
@@ -105,6 +106,14 @@ public:
 
     QStringList GetSpineOrderBookPaths() const;
 
+    /**
+     * Returns the spine position of the manifest item with this
+     * bookpath, or -1 when it is not on the spine.  Served from a
+     * cached map so per-shortcut next/previous-file queries do not
+     * rescan the spine.
+     */
+    int GetSpineIndexByBookPath(const QString &bookpath) const;
+
     void SetItemRefLinear(Resource * resource, bool linear);
 
     /**
@@ -142,6 +151,16 @@ public:
     void UpdateGuideAfterMerge(QList<Resource*> &merged_resources, QHash<QString,QString> &section_id_map);
     void UpdateGuideFragments(QHash<QString,QString> &idupdates);
 
+    /**
+     * Defers serializing model edits back to the OPF text.
+     * Rename and move loops drive one ResourceRenamed()/ResourceMoved()
+     * per file through the FolderKeeper; between Suspend and Resume
+     * those edits accumulate in the parsed model and the text is
+     * rewritten once on Resume instead of once per file.
+     */
+    void SuspendModelUpdates();
+    void ResumeModelUpdates();
+
  signals:
     void TextChanging();
     void LoadedFromDisk();
@@ -157,6 +176,7 @@ public slots:
     void SetDCMetadata(const QList<MetaEntry>  &metadata);
 
     void AddResource(const Resource *resource);
+    void BulkAddResources(const QList<const Resource *> resources);
 
     void RemoveResource(const Resource *resource);
     void BulkRemoveResources(const QList<Resource *>resources);
@@ -256,6 +276,20 @@ private:
 
     QString GetFileMimetype(const QString &filepath) const;
 
+    /**
+     * Fills p with the parsed model of the current OPF text.
+     * The model built by the last parse (or the last UpdateText)
+     * is reused when the text has not changed since, so runs of
+     * manifest/spine mutations do not re-parse the whole OPF each time.
+     */
+    void GetParsedModel(OPFParser &p) const;
+
+    /**
+     * Returns the bookpath to spine position map for p, reusing the
+     * cached map while the OPF text is unchanged. @see GetSpineIndexByBookPath().
+     */
+    QHash<QString, int> GetSpineIndexMap(const OPFParser &p) const;
+
     void UpdateText(const OPFParser &p);
 
     QString ValidatePackageVersion(const QString &source);
@@ -266,6 +300,31 @@ private:
 
     HTMLResource * m_NavResource;
     bool m_WarnedAboutVersion;
+
+    /**
+     * The parsed model of m_ParsedModelSource. @see GetParsedModel().
+     */
+    mutable OPFParser m_ParsedModel;
+    mutable QString m_ParsedModelSource;
+    mutable bool m_ParsedModelValid;
+    mutable QMutex m_ParsedModelMutex;
+
+    /**
+     * Bookpath to spine position lookup derived from the parsed model.
+     * Validated against m_ParsedModelSource, so any spine (or other OPF)
+     * mutation rebuilds it on the next query. @see GetSpineIndexMap().
+     */
+    mutable QHash<QString, int> m_SpineIndexCache;
+    mutable QString m_SpineIndexSource;
+    mutable bool m_SpineIndexValid;
+
+    /**
+     * While model updates are suspended, UpdateText() parks its model
+     * in m_ParsedModel and sets the dirty flag instead of serializing.
+     * @see SuspendModelUpdates().
+     */
+    bool m_ModelUpdatesSuspended;
+    bool m_DeferredModelDirty;
 };
 
 #endif // OPFRESOURCE_H
@@ -20,8 +20,10 @@
 **
 *************************************************************************/
 
+#include <QtCore/QCryptographicHash>
 #include <QtCore/QDir>
 #include <QtCore/QDateTime>
+#include <QtCore/QFile>
 #include <QtCore/QFileInfo>
 #include <QtCore/QString>
 #include <QtCore/QTimer>
@@ -44,8 +46,13 @@ Resource::Resource(const QString &mainfolder, const QString &fullfilepath, QObje
     m_CurrentBookRelPath(""),
     m_EpubVersion("2.0"),
     m_MediaType(""),
-    m_ReadWriteLock(QReadWriteLock::Recursive)
+    m_ReadWriteLock(QReadWriteLock::Recursive),
+    m_ContentRevision(0),
+    m_ContentHashRevision(-1),
+    m_ContentHashDiskTime(0)
 {
+    connect(this, SIGNAL(Modified()),                        this, SLOT(BumpContentRevision()));
+    connect(this, SIGNAL(ResourceUpdatedFromDisk(Resource *)), this, SLOT(BumpContentRevision()));
 }
 
 bool Resource::operator< (const Resource &other)
@@ -266,6 +273,53 @@ void Resource::SaveToDisk(bool book_wide_save)
     }
 }
 
+int Resource::GetContentRevision() const
+{
+    QMutexLocker locker(&m_ContentHashMutex);
+    return m_ContentRevision;
+}
+
+
+void Resource::BumpContentRevision()
+{
+    QMutexLocker locker(&m_ContentHashMutex);
+    m_ContentRevision++;
+}
+
+
+QByteArray Resource::GetContentHash() const
+{
+    // Media resources only ever change via the disk, so the memo is
+    // additionally keyed on the file's modification time.
+    const QDateTime disk_date = QFileInfo(m_FullFilePath).lastModified();
+    qint64 disk_time = disk_date.isValid() ? disk_date.toMSecsSinceEpoch() : 0;
+    {
+        QMutexLocker locker(&m_ContentHashMutex);
+
+        if ((m_ContentHashRevision == m_ContentRevision) &&
+            (m_ContentHashDiskTime == disk_time) &&
+            !m_ContentHash.isEmpty()) {
+            return m_ContentHash;
+        }
+    }
+    int revision = GetContentRevision();
+    QByteArray data;
+    QFile file(m_FullFilePath);
+
+    if (file.open(QIODevice::ReadOnly)) {
+        data = file.readAll();
+        file.close();
+    }
+
+    QByteArray hash = QCryptographicHash::hash(data, QCryptographicHash::Md5);
+    QMutexLocker locker(&m_ContentHashMutex);
+    m_ContentHash = hash;
+    m_ContentHashRevision = revision;
+    m_ContentHashDiskTime = disk_time;
+    return hash;
+}
+
+
 void Resource::FileChangedOnDisk()
 {
     QFileInfo latestFileInfo(m_FullFilePath);
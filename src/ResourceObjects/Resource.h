@@ -24,6 +24,8 @@
 #ifndef RESOURCE_H
 #define RESOURCE_H
 
+#include <QtCore/QByteArray>
+#include <QtCore/QMutex>
 #include <QtCore/QObject>
 #include <QtCore/QReadWriteLock>
 #include <QtCore/QUrl>
@@ -224,6 +226,22 @@ public:
      */
     void FileChangedOnDisk();
 
+    /**
+     * A monotonically increasing counter bumped every time the resource
+     * reports itself Modified or is refreshed from disk.  Caching layers
+     * (parse trees, well-formed verdicts, match counts) can compare it
+     * to learn "unchanged since last time" without touching the content.
+     */
+    int GetContentRevision() const;
+
+    /**
+     * Md5 hash of the resource's current content, memoized against the
+     * content revision so repeated calls between two edits hash nothing.
+     * The base implementation hashes the bytes on disk; TextResource
+     * hashes its in-memory text instead.
+     */
+    virtual QByteArray GetContentHash() const;
+
 signals:
 
     /**
@@ -284,6 +302,13 @@ private slots:
      */
     void ResourceFileModified();
 
+    /**
+     * Advances the content revision counter. Connected to Modified()
+     * and ResourceUpdatedFromDisk() so every content change path,
+     * including external edits, moves the revision forward.
+     */
+    void BumpContentRevision();
+
 private:
 
     /**
@@ -313,6 +338,17 @@ private:
      */
     qint64 m_LastWrittenSize;
 
+    /**
+     * The content revision counter and the memoized content hash,
+     * with the revision (and for disk backed resources the file
+     * mtime) the hash was computed at.
+     */
+    int m_ContentRevision;
+    mutable QByteArray m_ContentHash;
+    mutable int m_ContentHashRevision;
+    mutable qint64 m_ContentHashDiskTime;
+    mutable QMutex m_ContentHashMutex;
+
     /**
      * The original path to this resource from its imported epub
      */
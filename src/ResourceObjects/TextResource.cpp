@@ -20,7 +20,10 @@
 **
 *************************************************************************/
 
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QDateTime>
 #include <QtCore/QFile>
+#include <QtCore/QFileInfo>
 #include <QtCore/QString>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
@@ -35,7 +38,15 @@ TextResource::TextResource(const QString &mainfolder, const QString &fullfilepat
     :
     Resource(mainfolder, fullfilepath, parent),
     m_CacheInUse(false),
+    m_TextUnloaded(false),
+    m_LastAccessed(0),
+    m_DocumentRequested(false),
     m_TextDocument(new TextDocument(this)),
+    m_TextSnapshotRevision(-1),
+    m_ContentHashSnapshotRevision(-1),
+    m_UTF8SnapshotRevision(-1),
+    m_LastSavedDiskTime(0),
+    m_LastSavedRevision(-1),
     m_IsLoaded(false)
 {
     m_TextDocument->setDocumentLayout(new QPlainTextDocumentLayout(m_TextDocument));
@@ -46,12 +57,37 @@ TextResource::TextResource(const QString &mainfolder, const QString &fullfilepat
 QString TextResource::GetText() const
 {
     QMutexLocker locker(&m_CacheAccessMutex);
+    m_LastAccessed = QDateTime::currentMSecsSinceEpoch();
 
     if (m_CacheInUse) {
         return m_Cache;
     }
 
-    return m_TextDocument->toText();
+    // Text that UnloadText() pushed back to disk is reloaded here
+    // transparently, so callers never see the lazy state.
+    if (m_TextUnloaded) {
+        try {
+            m_Cache = Utility::ReadUnicodeTextFile(GetFullPath());
+        } catch (CannotOpenFile&) {
+            m_Cache = QString();
+        }
+
+        m_CacheInUse = true;
+        m_TextUnloaded = false;
+        return m_Cache;
+    }
+
+    // Serialize the document only when it has actually changed; the
+    // returned QString shares the snapshot's buffer, so concurrent
+    // readers (search, reports, updates) all see one copy of the text.
+    int revision = m_TextDocument->revision();
+
+    if (revision != m_TextSnapshotRevision) {
+        m_TextSnapshot = m_TextDocument->toText();
+        m_TextSnapshotRevision = revision;
+    }
+
+    return m_TextSnapshot;
 }
 
 
@@ -67,17 +103,37 @@ void TextResource::SetText(const QString &text)
     //   So we cache the text update into m_Cache and update the QTextDocument
     // when we return to the GUI thread. The single-shot timer makes sure
     // of that.
-    if (QThread::currentThread() == QApplication::instance()->thread()) {
+    //   Until a tab has asked for the document there is nothing attached
+    // to it, so the text just stays in the cache; building the block
+    // structure for hundreds of never-viewed files is what made large
+    // books slow to open.
+    QMutexLocker locker(&m_CacheAccessMutex);
+    m_LastAccessed = QDateTime::currentMSecsSinceEpoch();
+    m_TextUnloaded = false;
+
+    if (m_DocumentRequested &&
+        (QThread::currentThread() == QApplication::instance()->thread())) {
         SetTextInternal(text);
-    } else {
-        QMutexLocker locker(&m_CacheAccessMutex);
-        m_Cache = text;
+        return;
+    }
+
+    // QString is implicitly shared, so this keeps a reference to the
+    // caller's buffer rather than copying it - update pipelines that are
+    // done with their string hand over ownership for free.
+    m_Cache = text;
+    // Our resource has now been loaded with some text
+    m_IsLoaded = true;
 
+    if (m_DocumentRequested) {
         // We want to make sure we schedule only one delayed update
         if (!m_CacheInUse) {
             m_CacheInUse = true;
             QTimer::singleShot(0, this, SLOT(DelayedUpdateToTextDocument()));
         }
+    } else {
+        m_CacheInUse = true;
+        // The document will not fire contentsChanged for us
+        emit Modified();
     }
 }
 
@@ -85,6 +141,27 @@ void TextResource::SetText(const QString &text)
 TextDocument& TextResource::GetTextDocumentForWriting()
 {
     Q_ASSERT(m_TextDocument);
+    QMutexLocker locker(&m_CacheAccessMutex);
+    m_LastAccessed = QDateTime::currentMSecsSinceEpoch();
+    m_DocumentRequested = true;
+
+    // Unloaded text has to come back off the disk before a tab sees it
+    if (m_TextUnloaded) {
+        try {
+            m_Cache = Utility::ReadUnicodeTextFile(GetFullPath());
+            m_CacheInUse = true;
+        } catch (CannotOpenFile&) {
+            // nothing to show
+        }
+
+        m_TextUnloaded = false;
+    }
+
+    // Push any text that arrived while no tab wanted the document
+    if (m_CacheInUse) {
+        SetTextInternal(m_Cache);
+    }
+
     return *m_TextDocument;
 }
 
@@ -105,11 +182,50 @@ void TextResource::SaveToDisk(bool book_wide_save)
 
         // But we always want to save the most up to date version
 
-        if (m_CacheInUse) {
-            Utility::WriteUnicodeTextFile(m_Cache, GetFullPath());
-        } else {
-            Utility::WriteUnicodeTextFile(GetText(), GetFullPath());
+        //   Cheapest check first: if no edit has bumped the content
+        // revision since our last write and the file on disk still
+        // carries that write's timestamp, there is nothing to encode,
+        // hash or write.  This is what keeps the book wide flush before
+        // every plugin run from touching the whole book.
+        const int revision = GetContentRevision();
+        const QDateTime current_date = QFileInfo(GetFullPath()).lastModified();
+        qint64 current_time = current_date.isValid() ? current_date.toMSecsSinceEpoch() : 0;
+        if ((revision == m_LastSavedRevision) &&
+            (current_time != 0) &&
+            (current_time == m_LastSavedDiskTime)) {
+            locker.unlock();
+            if (!book_wide_save) {
+                emit ResourceUpdatedOnDisk();
+            }
+            m_TextDocument->setModified(false);
+            Resource::SaveToDisk(book_wide_save);
+            return;
+        }
+
+        //   The utf-8 bytes are memoized against the content revision,
+        // so a save landing right after an update or export round reuses
+        // the encoding that round already produced instead of encoding
+        // the text a second time.
+        QByteArray utf8_text = GetUTF8Text();
+
+        //   Rapid successive saves (tab switches, book wide saves after
+        // small edits) often carry exactly the text we last wrote.  Skip
+        // the write when the content hash matches and nothing has touched
+        // the file on disk since our last write, so those saves coalesce
+        // into one.
+        QByteArray text_hash = QCryptographicHash::hash(utf8_text, QCryptographicHash::Md5);
+        qint64 disk_time = current_time;
+        bool unchanged = (disk_time != 0) &&
+                         (text_hash == m_LastSavedTextHash) &&
+                         (disk_time == m_LastSavedDiskTime);
+
+        if (!unchanged) {
+            Utility::WriteUTF8TextFile(utf8_text, GetFullPath());
+            m_LastSavedTextHash = text_hash;
+            const QDateTime written_date = QFileInfo(GetFullPath()).lastModified();
+            m_LastSavedDiskTime = written_date.isValid() ? written_date.toMSecsSinceEpoch() : 0;
         }
+        m_LastSavedRevision = revision;
     }
 
     if (!book_wide_save) {
@@ -146,7 +262,9 @@ void TextResource::InitialLoad()
     QWriteLocker locker(&GetLock());
     Q_ASSERT(m_TextDocument);
 
-    if (m_TextDocument->isEmpty() && QFile::exists(GetFullPath())) {
+    // The document stays empty until a tab asks for it, so an empty
+    // document no longer means the resource holds no text.
+    if (!m_IsLoaded && m_TextDocument->isEmpty() && QFile::exists(GetFullPath())) {
         SetText(Utility::ReadUnicodeTextFile(GetFullPath()));
     }
 }
@@ -157,17 +275,69 @@ Resource::ResourceType TextResource::Type() const
     return Resource::TextResourceType;
 }
 
+
+QByteArray TextResource::GetContentHash() const
+{
+    // Read the revision before the text; if an edit slips in between,
+    // the stored memo just looks stale on the next call and is redone.
+    int revision = GetContentRevision();
+    {
+        QMutexLocker locker(&m_CacheAccessMutex);
+
+        if (revision == m_ContentHashSnapshotRevision) {
+            return m_ContentHashSnapshot;
+        }
+    }
+    QByteArray hash = QCryptographicHash::hash(GetUTF8Text(), QCryptographicHash::Md5);
+    QMutexLocker locker(&m_CacheAccessMutex);
+    m_ContentHashSnapshot = hash;
+    m_ContentHashSnapshotRevision = revision;
+    return hash;
+}
+
+
+QByteArray TextResource::GetUTF8Text() const
+{
+    // Same memo discipline as GetContentHash(): a revision read that
+    // races an edit just means the encoding is redone on the next call.
+    int revision = GetContentRevision();
+    {
+        QMutexLocker locker(&m_CacheAccessMutex);
+
+        if (revision == m_UTF8SnapshotRevision) {
+            return m_UTF8Snapshot;
+        }
+    }
+    QByteArray utf8text = GetText().toUtf8();
+    QMutexLocker locker(&m_CacheAccessMutex);
+    m_UTF8Snapshot = utf8text;
+    m_UTF8SnapshotRevision = revision;
+    return utf8text;
+}
+
 bool TextResource::LoadFromDisk()
 {
     try {
         const QString &text = Utility::ReadUnicodeTextFile(GetFullPath());
+
+        // An identical re-save (or an mtime only touch) by an external
+        // tool should not invalidate the loaded document or mark the
+        // book as modified, so unchanged content is not a reload.
+        if (QCryptographicHash::hash(text.toUtf8(), QCryptographicHash::Md5) == GetContentHash()) {
+            return false;
+        }
+
         QMutexLocker locker(&m_CacheAccessMutex);
         m_Cache = text;
+        m_TextUnloaded = false;
 
         // We want to make sure we schedule only one delayed update
         if (!m_CacheInUse) {
             m_CacheInUse = true;
-            QTimer::singleShot(0, this, SLOT(DelayedUpdateToTextDocument()));
+
+            if (m_DocumentRequested) {
+                QTimer::singleShot(0, this, SLOT(DelayedUpdateToTextDocument()));
+            }
         }
 
         return true;
@@ -206,3 +376,50 @@ bool TextResource::IsLoaded()
 {
     return m_IsLoaded;
 }
+
+
+qint64 TextResource::ResidentTextSize() const
+{
+    QMutexLocker locker(&m_CacheAccessMutex);
+    return qint64(m_Cache.capacity() + m_TextSnapshot.capacity()) * sizeof(QChar) +
+           m_UTF8Snapshot.capacity();
+}
+
+
+qint64 TextResource::LastAccessTime() const
+{
+    QMutexLocker locker(&m_CacheAccessMutex);
+    return m_LastAccessed;
+}
+
+
+bool TextResource::UnloadText()
+{
+    QMutexLocker locker(&m_CacheAccessMutex);
+
+    // A tab owns the document; its contents are the live text
+    if (m_DocumentRequested) {
+        return false;
+    }
+
+    if (!m_CacheInUse || !m_IsLoaded) {
+        return false;
+    }
+
+    // Only drop text we know is byte for byte on disk; anything not
+    // written by our own SaveToDisk this session stays resident.
+    QByteArray text_hash = QCryptographicHash::hash(m_Cache.toUtf8(), QCryptographicHash::Md5);
+
+    if (text_hash != m_LastSavedTextHash) {
+        return false;
+    }
+
+    m_Cache = QString();
+    m_CacheInUse = false;
+    m_TextUnloaded = true;
+    m_TextSnapshot = QString();
+    m_TextSnapshotRevision = -1;
+    m_UTF8Snapshot = QByteArray();
+    m_UTF8SnapshotRevision = -1;
+    return true;
+}
@@ -87,6 +87,39 @@ public:
     // inherited
     virtual ResourceType Type() const;
 
+    /**
+     * Hashes the in-memory text rather than the bytes on disk,
+     * memoized against the content revision.
+     */
+    virtual QByteArray GetContentHash() const;
+
+    /**
+     * The text encoded as utf-8, memoized against the content
+     * revision.  Saves, exports, and the content hash all need the
+     * same bytes, so consecutive rounds reuse one encoding.
+     */
+    QByteArray GetUTF8Text() const;
+
+    /**
+     * Approximate bytes of text this resource keeps resident.
+     */
+    qint64 ResidentTextSize() const;
+
+    /**
+     * When the resource's text was last read or written, in msecs
+     * since the epoch; 0 if never touched. Used to pick cold
+     * resources for unloading.
+     */
+    qint64 LastAccessTime() const;
+
+    /**
+     * Drops the cached text of a cold, clean resource back to its
+     * disk backed lazy state. Refuses (returning \c false) if a tab
+     * owns the document or if the text is not known to be byte for
+     * byte on disk. The next GetText() transparently reloads.
+     */
+    bool UnloadText();
+
 protected:
     virtual bool LoadFromDisk();
 
@@ -114,13 +147,34 @@ private:
 
     /**
      * If \c true, then the m_Cache var is holding cached text.
+     * Mutable so GetText() can transparently reload after UnloadText().
      */
-    bool m_CacheInUse;
+    mutable bool m_CacheInUse;
 
     /**
      * The cached text used when threads are in use. @see SetText() internals.
+     * Mutable so GetText() can transparently reload after UnloadText().
      */
-    QString m_Cache;
+    mutable QString m_Cache;
+
+    /**
+     * If \c true, UnloadText() dropped the cached text and the next
+     * GetText() must read it back from disk.
+     */
+    mutable bool m_TextUnloaded;
+
+    /**
+     * When the text was last read or written. @see LastAccessTime().
+     */
+    mutable qint64 m_LastAccessed;
+
+    /**
+     * If \c true, a tab has asked for m_TextDocument. Until then SetText()
+     * keeps the text in m_Cache only, since building the document's block
+     * structure for every file in a book is what makes large books slow
+     * to open. GetTextDocumentForWriting() sets this and fills the document.
+     */
+    bool m_DocumentRequested;
 
     /**
      * The access mutex for the cache.
@@ -132,6 +186,45 @@ private:
      */
     TextDocument *m_TextDocument;
 
+    /**
+     * The text of m_TextDocument as of m_TextSnapshotRevision.
+     * Serializing the document is expensive and QStrings share their
+     * buffer on copy, so every GetText() reader between two edits
+     * gets the same snapshot instead of a fresh serialization.
+     */
+    mutable QString m_TextSnapshot;
+    mutable int m_TextSnapshotRevision;
+
+    /**
+     * The memoized content hash and the content revision it was
+     * computed at.  @see GetContentHash().
+     */
+    mutable QByteArray m_ContentHashSnapshot;
+    mutable int m_ContentHashSnapshotRevision;
+
+    /**
+     * The memoized utf-8 encoding of the text and the content
+     * revision it was computed at.  @see GetUTF8Text().
+     */
+    mutable QByteArray m_UTF8Snapshot;
+    mutable int m_UTF8SnapshotRevision;
+
+    /**
+     * Hash of the text last written by SaveToDisk and the file's
+     * modification time right after that write.  When both still match,
+     * a save has nothing new to say and the write is skipped.
+     */
+    QByteArray m_LastSavedTextHash;
+    qint64 m_LastSavedDiskTime;
+
+    /**
+     * The content revision SaveToDisk last wrote (or verified) at.
+     * When the revision has not moved and the file on disk has not
+     * either, a book wide flush skips this resource without even
+     * re-encoding or re-hashing its text.
+     */
+    int m_LastSavedRevision;
+
     bool m_IsLoaded;
 };
 
@@ -1,24 +1,66 @@
-var startNode = document.getSelection().anchorNode;
-if ( typeof startNode !== 'undefined'  && startNode !== null) {
-    // create a reverse function for jQuery
-    $.fn.reverse = [].reverse;
+// Installed once per page load.  Maintains the caret element hierarchy
+// in window.SigilCaretPath, recomputed when selectionchange events say
+// it moved, so readers get the current path back with one cheap call
+// instead of paying for a full DOM walk on every query.
+if (typeof window.SigilGetCaretPath === 'undefined') {
 
-    var hierarchy = $( startNode ).parents().reverse().add( $( startNode ) ) ;
+    window.SigilCaretPath = "";
+    window.SigilCaretPathDirty = true;
+    window.SigilCaretPathPending = false;
 
-    var hierarchy_string = hierarchy.map(function () 
-        { 
-         if ( undefined != $( this ).parent().get( 0 ).tagName ) {
+    window.SigilComputeCaretPath = function () {
+        var startNode = document.getSelection().anchorNode;
+        var hierarchy_string = "";
+        if ( typeof startNode !== 'undefined'  && startNode !== null) {
+            // create a reverse function for jQuery
+            $.fn.reverse = [].reverse;
 
-             var first_part = $( this ).parent().get( 0 ).tagName + " ";
+            var hierarchy = $( startNode ).parents().reverse().add( $( startNode ) ) ;
 
-             // Webkit and QDomDocument count text nodes differently for some reason,
-             // so we count non-text children until we reach the caret text node
-             if ( this.nodeName != "#text"  )
-                 return first_part + $( this ).parent().children().index( this ); 
-             else
-                 return first_part + jQuery.inArray( this, $( this ).parent().contents() );
+            hierarchy_string = hierarchy.map(function ()
+                {
+                 if ( undefined != $( this ).parent().get( 0 ).tagName ) {
 
-         }}).get().join(",");
+                     var first_part = $( this ).parent().get( 0 ).tagName + " ";
 
-    hierarchy_string += "," + startNode.nodeName + " -1" ;
+                     // Webkit and QDomDocument count text nodes differently for some reason,
+                     // so we count non-text children until we reach the caret text node
+                     if ( this.nodeName != "#text"  )
+                         return first_part + $( this ).parent().children().index( this );
+                     else
+                         return first_part + jQuery.inArray( this, $( this ).parent().contents() );
+
+                 }}).get().join(",");
+
+            hierarchy_string += "," + startNode.nodeName + " -1" ;
+        }
+        window.SigilCaretPath = hierarchy_string;
+        window.SigilCaretPathDirty = false;
+        return hierarchy_string;
+    };
+
+    window.SigilGetCaretPath = function () {
+        // covers a read landing before the deferred recompute has run
+        if (window.SigilCaretPathDirty) {
+            window.SigilComputeCaretPath();
+        }
+        return window.SigilCaretPath;
+    };
+
+    document.addEventListener('selectionchange', function () {
+        window.SigilCaretPathDirty = true;
+        // a selection drag fires these in bursts, so coalesce them into
+        // one recompute once the event loop settles down again
+        if (!window.SigilCaretPathPending) {
+            window.SigilCaretPathPending = true;
+            window.setTimeout(function () {
+                window.SigilCaretPathPending = false;
+                if (window.SigilCaretPathDirty) {
+                    window.SigilComputeCaretPath();
+                }
+            }, 0);
+        }
+    });
+
+    window.SigilComputeCaretPath();
 }
@@ -320,6 +320,25 @@ class BookContainer(object):
                 id = self._w.bookpath_to_id[book_href]
             yield id_type, id
 
+    def manifest_filter_iter(self, predicate):
+        # yields manifest id, href, and mimetype for each entry the predicate accepts
+        # the predicate is called as predicate(id, href, mime) and file contents are
+        # never read, so narrowing a large book to a few files touches no data files
+        for id in sorted(self._w.id_to_mime):
+            mime = self._w.id_to_mime[id]
+            href = self._w.id_to_href[id]
+            if predicate(id, href, mime):
+                yield id, href, mime
+
+    def content_iter(self, ids=None):
+        # yields manifest id and file contents, reading each file only when its
+        # turn comes so a plugin that stops iterating early never loads the rest
+        # ids is any iterable of manifest ids and defaults to the whole manifest
+        if ids is None:
+            ids = sorted(self._w.id_to_mime)
+        for id in ids:
+            yield id, self._w.readfile(id)
+
 
     # miscellaneous routines
 
@@ -29,7 +29,7 @@ import time
 import io
 from io import BytesIO
 from io import StringIO
-import filecmp
+from concurrent.futures import ThreadPoolExecutor
 
 from diffstat import diffstat
 from sdifflibparser import DiffCode, DifflibParser
@@ -178,6 +178,31 @@ def copy_book_contents_to_destination(book_home, filepaths, destdir):
     copied.append("mimetype")
     return copied
 
+
+def copy_changed_book_contents_to_destination(book_home, filepaths, destdir):
+    # copy only files whose contents differ from the copy already in
+    # the destination, so unmodified resources (large binaries
+    # especially) are neither rewritten nor later rehashed by dulwich
+    # and checkpoint I/O scales with the change set, not the book size
+    copied = []
+    for apath in filepaths:
+        src = os.path.join(book_home, apath)
+        dest = os.path.join(destdir, apath)
+        if os.path.isfile(dest) and contents_match(src, dest):
+            continue
+        # and make sure destination directory exists
+        base = os.path.dirname(dest)
+        if not os.path.exists(base):
+            os.makedirs(base)
+        data = b''
+        with open(src, 'rb') as f:
+            data = f.read()
+        with open(dest,'wb') as fp:
+            fp.write(data)
+        copied.append(apath)
+    return copied
+
+
 def add_gitignore(repo_path):
     ignoredata = []
     ignoredata.append(".DS_Store")
@@ -509,8 +534,8 @@ def performCommit(localRepo, bookid, bookinfo, bookroot, bookfiles):
                     files_to_delete.append(afile)
         if len(files_to_delete) > 0:
             porcelain.rm(repo='.',paths=files_to_delete)
-        # copy over current files
-        copy_book_contents_to_destination(book_home, filepaths, repo_path)
+        # copy over just the files that actually changed
+        copy_changed_book_contents_to_destination(book_home, filepaths, repo_path)
         (staged, unstaged, untracked) = porcelain.status(repo='.')
         files_to_update = []
         for afile in unstaged:
@@ -523,6 +548,11 @@ def performCommit(localRepo, bookid, bookinfo, bookroot, bookfiles):
         commit_sha1 = porcelain.commit(repo='.',message=message, author=_SIGIL, committer=_SIGIL)
         # create annotated tags so we can get a date history
         tag = porcelain.tag_create(repo='.', tag=tagname, message=tagmessage, annotated=True, author=_SIGIL)
+        # every tenth checkpoint repack the loose objects into a delta
+        # compressed pack so lightly edited files are stored as deltas
+        # against their earlier revisions instead of as full copies
+        if ((len(tags) + 1) % 10 == 0) and hasattr(porcelain, "repack"):
+            porcelain.repack(repo='.')
         os.chdir(cdir)
         add_bookinfo(repo_path, bookinfo, bookid, unicode_str(tagname))
     else:
@@ -629,6 +659,14 @@ def generate_parsed_ndiff(path1, path2):
     return results
 
 
+def generate_parsed_ndiffs(leftpaths, rightpaths):
+    # diff a whole changed set in one embedded interpreter call
+    results = []
+    for path1, path2 in zip(leftpaths, rightpaths):
+        results.append(generate_parsed_ndiff(path1, path2))
+    return results
+
+
 def generate_unified_diff(path1, path2):
     path1 = pathof(path1)
     path2 = pathof(path2)
@@ -684,6 +722,25 @@ def copy_tag_to_destdir(localRepo, bookid, tagname, destdir):
     return "\n".join(copied)
 
 
+def contents_match(leftpath, rightpath):
+    # a size mismatch answers the question without reading either body;
+    # equal sizes fall back to a chunked compare that stops at the first
+    # differing block, returns None if either file cannot be read
+    try:
+        if os.path.getsize(leftpath) != os.path.getsize(rightpath):
+            return False
+        with open(leftpath, 'rb') as f1, open(rightpath, 'rb') as f2:
+            while True:
+                b1 = f1.read(65536)
+                b2 = f2.read(65536)
+                if b1 != b2:
+                    return False
+                if not b1:
+                    return True
+    except OSError:
+        return None
+
+
 def get_current_status_vs_destdir(bookroot, bookfiles, destdir):
     # convert posix paths to os specific paths
     book_home = pathof(bookroot).replace("/", os.sep);
@@ -704,8 +761,24 @@ def get_current_status_vs_destdir(bookroot, bookfiles, destdir):
             deleted.append(fpath)
     if "mimetype" in deleted:
         deleted.remove("mimetype")
-    # now use pythons built in filecmp to determine added and modified
-    (unchanged, modified, added) = filecmp.cmpfiles(dest_path, book_home, filepaths, shallow=False)
+    # split off files missing on either side, then compare the common
+    # files in parallel threads since the reads release the GIL
+    added = []
+    common = []
+    for fpath in filepaths:
+        if os.path.isfile(os.path.join(dest_path, fpath)) and os.path.isfile(os.path.join(book_home, fpath)):
+            common.append(fpath)
+        else:
+            added.append(fpath)
+    modified = []
+    with ThreadPoolExecutor() as executor:
+        results = executor.map(lambda fpath: contents_match(os.path.join(dest_path, fpath),
+                                                            os.path.join(book_home, fpath)), common)
+        for fpath, same in zip(common, results):
+            if same is None:
+                added.append(fpath)
+            elif not same:
+                modified.append(fpath)
     # convert everything back to posix style bookpaths
     for i in range(len(deleted)):
         deleted[i] = deleted[i].replace(os.sep,"/")
@@ -37,6 +37,7 @@
 #include "ResourceObjects/NCXResource.h"
 #include "sigil_constants.h"
 #include "SourceUpdates/AnchorUpdates.h"
+#include "SourceUpdates/UniversalUpdates.h"
 
 #define DBG if(0)
 
@@ -44,16 +45,18 @@ void AnchorUpdates::UpdateAllAnchorsWithIDs(const QList<HTMLResource *> &html_re
 {
     const QHash<QString, QString> &ID_locations = GetIDLocations(html_resources);
     // The first file in the list is the orginating resource of the split
-    QtConcurrent::blockingMap(html_resources, std::bind(UpdateAnchorsInOneFile, 
-                                                        std::placeholders::_1, 
-                                                        ID_locations));
+    QList<HTMLResource *> sorted_resources = UniversalUpdates::SortLargestFirst(html_resources);
+    QtConcurrent::blockingMap(sorted_resources, std::bind(UpdateAnchorsInOneFile,
+                                                          std::placeholders::_1,
+                                                          ID_locations));
 }
 
 
 void AnchorUpdates::UpdateExternalAnchors(const QList<HTMLResource *> &html_resources, const QString &originating_bookpath, const QList<HTMLResource *> new_files)
 {
     const QHash<QString, QString> &ID_locations = GetIDLocations(new_files);
-    QtConcurrent::blockingMap(html_resources, std::bind(UpdateExternalAnchorsInOneFile, std::placeholders::_1, originating_bookpath, ID_locations));
+    QList<HTMLResource *> sorted_resources = UniversalUpdates::SortLargestFirst(html_resources);
+    QtConcurrent::blockingMap(sorted_resources, std::bind(UpdateExternalAnchorsInOneFile, std::placeholders::_1, originating_bookpath, ID_locations));
 }
 
 
@@ -66,11 +69,12 @@ void AnchorUpdates::UpdateAllAnchors(const QList<HTMLResource *> &html_resources
     QList<HTMLResource *> new_files;
     new_files.append(sink_res);
     QString sink_bookpath = sink_res->GetRelativePath();
-    QtConcurrent::blockingMap(html_resources, std::bind(UpdateAllAnchorsInOneFile, 
-                                                        std::placeholders::_1,
-                                                        originating_bookpaths,
-                                                        sink_bookpath,
-                                                        section_id_map));
+    QList<HTMLResource *> sorted_resources = UniversalUpdates::SortLargestFirst(html_resources);
+    QtConcurrent::blockingMap(sorted_resources, std::bind(UpdateAllAnchorsInOneFile,
+                                                          std::placeholders::_1,
+                                                          originating_bookpaths,
+                                                          sink_bookpath,
+                                                          section_id_map));
 }
 
 
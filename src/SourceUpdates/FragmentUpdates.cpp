@@ -32,6 +32,7 @@
 #include "BookManipulation/CleanSource.h"
 #include "ResourceObjects/HTMLResource.h"
 #include "SourceUpdates/FragmentUpdates.h"
+#include "SourceUpdates/UniversalUpdates.h"
 
 #define DBG if(0)
 
@@ -42,9 +43,10 @@
 void FragmentUpdates::UpdateFragments(const QList<HTMLResource*> &html_resources, 
                                       const QHash<QString, QString> &updates)
 {
-    QtConcurrent::blockingMap(html_resources, std::bind(UpdateFragmentsInOneFile, 
-                                                        std::placeholders::_1,
-                                                        updates));
+    QList<HTMLResource *> sorted_resources = UniversalUpdates::SortLargestFirst(html_resources);
+    QtConcurrent::blockingMap(sorted_resources, std::bind(UpdateFragmentsInOneFile,
+                                                          std::placeholders::_1,
+                                                          updates));
 }
 
 
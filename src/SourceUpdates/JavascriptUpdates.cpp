@@ -31,10 +31,14 @@
 #include "BookManipulation/CleanSource.h"
 #include "sigil_constants.h"
 #include "SourceUpdates/JavascriptUpdates.h"
+#include "SourceUpdates/UniversalUpdates.h"
 
 void JavascriptUpdates::UpdateJavascriptsInAllFiles(const QList<HTMLResource *> &html_resources, const QList<QString> new_javascripts)
 {
-    QtConcurrent::blockingMap(html_resources, std::bind(UpdateJavascriptsInOneFile, std::placeholders::_1, new_javascripts));
+    // Hand the biggest files out first so a large chapter started last
+    // can not leave the whole pool waiting on one thread at the end.
+    QList<HTMLResource *> sorted_resources = UniversalUpdates::SortLargestFirst(html_resources);
+    QtConcurrent::blockingMap(sorted_resources, std::bind(UpdateJavascriptsInOneFile, std::placeholders::_1, new_javascripts));
 }
 
 void JavascriptUpdates::UpdateJavascriptsInOneFile(HTMLResource *html_resource, QList<QString> new_javascripts)
@@ -50,6 +54,13 @@ void JavascriptUpdates::UpdateJavascriptsInOneFile(HTMLResource *html_resource,
     }
     QWriteLocker locker(&html_resource->GetLock());
     QString newsource = html_resource->GetText();
+
+    // With no links to add, only files that actually carry script tags
+    // need the parse and reserialization; everybody else is untouched.
+    if (newjslinks.isEmpty() && !newsource.contains("<script", Qt::CaseInsensitive)) {
+        return;
+    }
+
     QString version = html_resource->GetEpubVersion();
     GumboInterface gi = GumboInterface(newsource, version);
     gi.parse();
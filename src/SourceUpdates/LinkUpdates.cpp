@@ -33,10 +33,12 @@
 #include "BookManipulation/CleanSource.h"
 #include "sigil_constants.h"
 #include "SourceUpdates/LinkUpdates.h"
+#include "SourceUpdates/UniversalUpdates.h"
 
 void LinkUpdates::UpdateLinksInAllFiles(const QList<HTMLResource *> &html_resources, const QList<QString> new_stylesheets)
 {
-    QtConcurrent::blockingMap(html_resources, std::bind(UpdateLinksInOneFile, std::placeholders::_1, new_stylesheets));
+    QList<HTMLResource *> sorted_resources = UniversalUpdates::SortLargestFirst(html_resources);
+    QtConcurrent::blockingMap(sorted_resources, std::bind(UpdateLinksInOneFile, std::placeholders::_1, new_stylesheets));
 }
 
 void LinkUpdates::UpdateLinksInOneFile(HTMLResource *html_resource, QList<QString> new_stylesheets)
@@ -45,8 +47,10 @@ void LinkUpdates::UpdateLinksInOneFile(HTMLResource *html_resource, QList<QStrin
 
     QString newcsslinks;
     // build the new stylesheet links new_stylesheets is a list of stylesheet bookpaths
+    // split the starting directory once and reuse it per stylesheet
+    QStringList start_segments = Utility::startingDirSegments(html_resource->GetRelativePath());
     foreach(QString stylesheet, new_stylesheets) {
-        QString ahref = Utility::buildRelativePath(html_resource->GetRelativePath(), stylesheet);
+        QString ahref = Utility::relativePath(stylesheet, start_segments);
         ahref = Utility::URLEncodePath(ahref);
         newcsslinks += "  <link href=\"" + ahref + "\" type=\"text/css\" rel=\"stylesheet\"/>\n";
     }
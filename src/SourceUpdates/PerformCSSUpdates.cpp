@@ -39,6 +39,29 @@
 
 static const QChar FORWARD_SLASH = QChar::fromLatin1('/');
 
+// Compiled once per process; a mass rename invokes PerformCSSUpdates
+// for every stylesheet and recompiling these per call was pure waste.
+static const QRegularExpression REFERENCE_MATCHER(
+    "(?:(?:src|background|background-image|block|border|border-image|border-image-source|"
+    "content|cursor|list-style|list-style-image|mask|mask-image|(?:-webkit-)?shape-outside)\\s*:|"
+    "@import)\\s*"
+    "("
+    "[^;\\}]*"
+    ")"
+    "(?:;|\\})");
+
+static const QRegularExpression URL_MATCHER(
+    "(?:"
+    "url\\([\"']?([^\\(\\)\"']*)[\"']?\\)"
+    ")");
+
+static const QRegularExpression IMPORT_URL_MATCHER(
+    "(?:"
+    "url\\([\"']?([^\\(\\)\"']*)[\"']?\\)"
+    "|"
+    "[\"']([^\\(\\)\"']*)[\"']"
+    ")");
+
 PerformCSSUpdates::PerformCSSUpdates(const QString &source, 
                      const QString& newbookpath, 
                      const QHash<QString, QString> &css_updates, 
@@ -61,27 +84,19 @@ QString PerformCSSUpdates::operator()()
     int num_keys = keys.count();
     if (num_keys == 0) return result;
 
-    // Now parse the text once looking for keys and replacing them where needed
-    QRegularExpression reference(
-        "(?:(?:src|background|background-image|block|border|border-image|border-image-source|"
-        "content|cursor|list-style|list-style-image|mask|mask-image|(?:-webkit-)?shape-outside)\\s*:|"
-        "@import)\\s*"
-        "("
-        "[^;\\}]*"
-        ")"
-        "(?:;|\\})");
-
-    QRegularExpression urls(
-        "(?:"
-        "url\\([\"']?([^\\(\\)\"']*)[\"']?\\)"
-        ")");
+    // Only url() values and @import lines can carry references, so a
+    // stylesheet with neither needs no regular expression work at all
+    if (!result.contains("url(", Qt::CaseInsensitive) &&
+        !result.contains("@import", Qt::CaseInsensitive)) {
+        return result;
+    }
 
-    QRegularExpression importurls(
-        "(?:"
-        "url\\([\"']?([^\\(\\)\"']*)[\"']?\\)"
-        "|"
-        "[\"']([^\\(\\)\"']*)[\"']"
-        ")");
+    // Now parse the text once looking for keys and replacing them where needed.
+    // The shared matchers are implicitly shared, so the local copies
+    // (urls gets swapped for the @import form below) cost nothing.
+    const QRegularExpression &reference = REFERENCE_MATCHER;
+    QRegularExpression urls = URL_MATCHER;
+    QRegularExpression importurls = IMPORT_URL_MATCHER;
 
     int start_index = 0;
     int start_index_correction = 0;
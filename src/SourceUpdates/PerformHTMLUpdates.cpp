@@ -20,11 +20,29 @@
 **
 *************************************************************************/
 
+#include <QSet>
+#include <QStringList>
+
 #include "Parsers/GumboInterface.h"
+#include "Parsers/TagLister.h"
 #include "BookManipulation/CleanSource.h"
 #include "SourceUpdates/PerformCSSUpdates.h"
 #include "SourceUpdates/PerformHTMLUpdates.h"
 
+// mirrors href_src_tags in GumboInterface.cpp
+static const QSet<QString> PATCH_HREF_SRC_TAGS = QSet<QString>() << "a" << "area" << "audio" << "base"
+        << "embed" << "font-face-uri" << "frame" << "iframe" << "image" << "img" << "input"
+        << "link" << "object" << "script" << "source" << "track" << "video";
+
+static const QStringList PATCH_REF_ATTRIBUTES = QStringList() << "href" << "xlink:href"
+        << "src" << "poster" << "data";
+
+struct OffsetPatch {
+    int pos;
+    int len;
+    QString value;
+};
+
 PerformHTMLUpdates::PerformHTMLUpdates(const QString &source,
                                        const QString &newbookpath,
                                        const QHash<QString, QString> &html_updates,
@@ -44,17 +62,136 @@ PerformHTMLUpdates::PerformHTMLUpdates(const QString &source,
 
 QString PerformHTMLUpdates::operator()()
 {
-    QString newsource = CleanSource::PreprocessSpecialCases(m_source);
-    { 
-        GumboInterface gi = GumboInterface(newsource, m_version, m_HTMLUpdates);
-        gi.parse();
-        newsource = gi.perform_source_updates(m_CurrentPath, m_newbookpath);
+    // Both the attribute and the style url rewrites key off the same
+    // old bookpath to new bookpath map, so they can ride a single
+    // parse and a single serialization of the document instead of two.
+    QHash<QString, QString> combined_updates = m_HTMLUpdates;
+    foreach(QString key, m_CSSUpdates.keys()) {
+        if (!combined_updates.contains(key)) {
+            combined_updates[key] = m_CSSUpdates.value(key);
+        }
     }
-    if (!m_CSSUpdates.isEmpty()) {
-        GumboInterface gi = GumboInterface(newsource, m_version, m_CSSUpdates);
-        gi.parse();
-        newsource = gi.perform_style_updates(m_CurrentPath, m_newbookpath);
+
+    // Splicing just the changed reference values into the original
+    // source preserves every untouched byte, so a rename no longer
+    // rewrites the formatting of whole files.
+    QString patched;
+    if (TryOffsetPatchUpdates(combined_updates, patched)) {
+        return patched;
     }
+
+    QString newsource = CleanSource::PreprocessSpecialCases(m_source);
+    GumboInterface gi = GumboInterface(newsource, m_version, combined_updates);
+    gi.parse();
+    newsource = gi.perform_source_and_style_updates(m_CurrentPath, m_newbookpath);
     return CleanSource::CharToEntity(newsource, m_version);
 }
 
+
+bool PerformHTMLUpdates::TryOffsetPatchUpdates(const QHash<QString, QString> &combined_updates, QString &result)
+{
+    // prefixed svg tags only parse after PreprocessSpecialCases has
+    // rewritten them, so those files take the full pipeline
+    if (m_source.contains("<svg:")) {
+        return false;
+    }
+
+    // an empty source keeps the rewriter from ever parsing anything;
+    // it is only used for its value rewrite helpers
+    GumboInterface rewriter = GumboInterface(QString(), m_version, combined_updates);
+    TagLister lister(m_source);
+    QList<OffsetPatch> patches;
+
+    for (int i = 0; i < (int)lister.size(); i++) {
+        TagLister::TagInfo tag = lister.at(i);
+
+        if ((tag.ttype != "begin") && (tag.ttype != "single")) {
+            continue;
+        }
+
+        QStringRef tagstring = m_source.midRef(tag.pos, tag.len);
+
+        if (PATCH_HREF_SRC_TAGS.contains(tag.tname)) {
+            foreach(const QString &attribute_name, PATCH_REF_ATTRIBUTES) {
+                TagLister::AttInfo ainfo;
+                TagLister::parseAttribute(tagstring, attribute_name, ainfo, true);
+
+                if (ainfo.vpos < 0) {
+                    continue;
+                }
+
+                // entities in the value would not round trip through a
+                // splice the way they do through gumbo's decode
+                if (ainfo.avalue.contains('&')) {
+                    return false;
+                }
+
+                QString newvalue = rewriter.rewrite_href_src_value(ainfo.avalue, m_CurrentPath, m_newbookpath);
+
+                if (newvalue != ainfo.avalue) {
+                    OffsetPatch patch;
+                    patch.pos = tag.pos + ainfo.vpos;
+                    patch.len = ainfo.vlen;
+                    patch.value = newvalue;
+                    patches.append(patch);
+                }
+            }
+        }
+
+        // style attributes can carry url() references on any tag
+        TagLister::AttInfo sinfo;
+        TagLister::parseAttribute(tagstring, "style", sinfo, true);
+
+        if ((sinfo.vpos >= 0) && !sinfo.avalue.isEmpty()) {
+            if (sinfo.avalue.contains('&')) {
+                return false;
+            }
+
+            QString newvalue = rewriter.rewrite_css_urls(sinfo.avalue, m_CurrentPath, m_newbookpath);
+
+            if (newvalue != sinfo.avalue) {
+                OffsetPatch patch;
+                patch.pos = tag.pos + sinfo.vpos;
+                patch.len = sinfo.vlen;
+                patch.value = newvalue;
+                patches.append(patch);
+            }
+        }
+
+        // stylesheets embedded in the head
+        if ((tag.tname == "style") && (tag.ttype == "begin") && tag.tpath.endsWith("head")) {
+            int ci = lister.findCloseTagForOpen(i);
+
+            if (ci <= i) {
+                return false;
+            }
+
+            int contents_pos = tag.pos + tag.len;
+            int contents_len = lister.at(ci).pos - contents_pos;
+
+            if (contents_len > 0) {
+                QString contents = m_source.mid(contents_pos, contents_len);
+                QString newcontents = rewriter.rewrite_css_urls(contents, m_CurrentPath, m_newbookpath);
+
+                if (newcontents != contents) {
+                    OffsetPatch patch;
+                    patch.pos = contents_pos;
+                    patch.len = contents_len;
+                    patch.value = newcontents;
+                    patches.append(patch);
+                }
+            }
+        }
+    }
+
+    result = m_source;
+
+    // splice from the back so the earlier offsets stay valid
+    for (int i = patches.count() - 1; i >= 0; i--) {
+        const OffsetPatch &patch = patches.at(i);
+        result.replace(patch.pos, patch.len, patch.value);
+    }
+
+    return true;
+}
+
@@ -41,6 +41,15 @@ public:
 
 private:
 
+    /**
+     * Splices just the changed reference values into the original
+     * source using TagLister offsets, preserving every untouched
+     * byte.  Returns \c false when the file has a construct the
+     * splice can not handle faithfully, in which case the caller
+     * falls back to the full parse and reserialize pipeline.
+     */
+    bool TryOffsetPatchUpdates(const QHash<QString, QString> &combined_updates, QString &result);
+
     ///////////////////////////////
     // PRIVATE MEMBER VARIABLES
     ///////////////////////////////
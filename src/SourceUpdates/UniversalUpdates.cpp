@@ -24,14 +24,17 @@
 #include <functional>
 
 #include <QtCore/QtCore>
-#include <QtCore/QFutureSynchronizer>
 #include <QtConcurrent/QtConcurrent>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QProgressDialog>
 #include <QRegularExpression>
 
 #include "BookManipulation/CleanSource.h"
 #include "BookManipulation/XhtmlDoc.h"
+#include "Misc/FutureWaiter.h"
 #include "Misc/HTMLEncodingResolver.h"
 #include "Misc/SettingsStore.h"
+#include "Misc/Tracer.h"
 #include "Misc/Utility.h"
 #include "ResourceObjects/OPFResource.h"
 #include "ResourceObjects/NCXResource.h"
@@ -55,6 +58,7 @@ QStringList UniversalUpdates::PerformUniversalUpdates(bool resources_already_loa
         const QHash<QString, QString> &updates,
         const QList<XMLResource *> &non_well_formed)
 {
+    SIGIL_TRACE_SCOPE("UniversalUpdates::PerformUniversalUpdates");
     QStringList updatekeys = updates.keys();
     QHash<QString, QString> html_updates;
     QHash<QString, QString> css_updates;
@@ -83,21 +87,21 @@ QStringList UniversalUpdates::PerformUniversalUpdates(bool resources_already_loa
         }
     }
 
-    QFutureSynchronizer<void> sync;
+    // Largest first, so the big chapters do not end up as stragglers
+    html_resources = SortLargestFirst(html_resources);
+
     QFuture<QString> html_future;
     QFuture<void> css_future;
 
     if (resources_already_loaded) {
-        html_future = QtConcurrent::mapped(html_resources, std::bind(UpdateOneHTMLFile, std::placeholders::_1, html_updates, css_updates));
-        css_future = QtConcurrent::map(css_resources,  std::bind(UpdateOneCSSFile,  std::placeholders::_1, css_updates));
+        QStringList target_filenames = UpdateTargetFilenames(updates);
+        html_future = QtConcurrent::mapped(html_resources, std::bind(UpdateOneHTMLFile, std::placeholders::_1, html_updates, css_updates, target_filenames));
+        css_future = QtConcurrent::map(css_resources,  std::bind(UpdateOneCSSFile,  std::placeholders::_1, css_updates, target_filenames));
     } else {
         html_future = QtConcurrent::mapped(html_resources, std::bind(LoadAndUpdateOneHTMLFile, std::placeholders::_1, html_updates, css_updates, non_well_formed));
         css_future = QtConcurrent::map(css_resources,  std::bind(LoadAndUpdateOneCSSFile,  std::placeholders::_1, css_updates));
     }
 
-    sync.addFuture(html_future);
-    sync.addFuture(css_future);
-
     // We can't schedule these with QtConcurrent because they
     // will (indirectly) call QTextDocument::setPlainText, and if
     // a tab is open for the ncx/opf, then an event needs to be sent
@@ -120,7 +124,16 @@ QStringList UniversalUpdates::PerformUniversalUpdates(bool resources_already_loa
         xml_resource->SaveToDisk();
     }
 
-    sync.waitForFinished();
+    //   The per-resource read/write locks isolate the worker threads,
+    // so while they grind through a mass rename the GUI can keep
+    // painting instead of freezing for the whole batch.  User input
+    // stays excluded: the workers hold the resource write locks and
+    // edits from open tabs would race the results being merged back.
+    int total_count = html_resources.count() + css_resources.count();
+    QProgressDialog progress(QObject::tr("Updating files.."), 0, 0, total_count, Utility::GetMainWindow());
+    progress.setMinimumDuration(PROGRESS_BAR_MINIMUM_DURATION);
+
+    FutureWaiter::Wait(QList<QFuture<void>>() << html_future << css_future, progress);
 
     // Now assemble our list of errors if any.
     QStringList load_update_errors;
@@ -145,6 +158,24 @@ QStringList UniversalUpdates::PerformUniversalUpdates(bool resources_already_loa
 }
 
 
+static bool LargerOnDisk(HTMLResource *resource1, HTMLResource *resource2)
+{
+    return QFileInfo(resource1->GetFullPath()).size() > QFileInfo(resource2->GetFullPath()).size();
+}
+
+
+QList<HTMLResource *> UniversalUpdates::SortLargestFirst(const QList<HTMLResource *> &html_resources)
+{
+    // QtConcurrent's pool steals work fine, but it hands files out in
+    // list order; dispatching by descending size keeps every core busy
+    // until the end of the batch.  The size on disk is close enough to
+    // the in-memory text size for scheduling purposes.
+    QList<HTMLResource *> sorted_resources = html_resources;
+    std::sort(sorted_resources.begin(), sorted_resources.end(), LargerOnDisk);
+    return sorted_resources;
+}
+
+
 std::tuple <QHash<QString, QString>,
       QHash<QString, QString>,
       QHash<QString, QString>>
@@ -184,9 +215,46 @@ std::tuple <QHash<QString, QString>,
 }
 
 
+QStringList UniversalUpdates::UpdateTargetFilenames(const QHash<QString, QString> &updates)
+{
+    QSet<QString> target_filenames;
+    foreach(QString key, updates.keys()) {
+        QString filename = key.split('/').last();
+        target_filenames.insert(filename);
+        target_filenames.insert(Utility::URLEncodePath(filename));
+    }
+    return target_filenames.toList();
+}
+
+
+bool UniversalUpdates::SourceReferencesAnyTarget(const QString &source, const QStringList &target_filenames)
+{
+    foreach(const QString &target_filename, target_filenames) {
+        if (source.contains(target_filename)) {
+            return true;
+        }
+    }
+
+    // References written by other tools may percent encode more
+    // characters than Sigil itself does, so scan a decoded copy
+    // before declaring the file untouched.
+    if (source.contains('%')) {
+        QString decoded = Utility::URLDecodePath(source);
+        foreach(const QString &target_filename, target_filenames) {
+            if (decoded.contains(target_filename)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+
 QString UniversalUpdates::UpdateOneHTMLFile(HTMLResource *html_resource,
         const QHash<QString, QString> &html_updates,
-        const QHash<QString, QString> &css_updates)
+        const QHash<QString, QString> &css_updates,
+        const QStringList &target_filenames)
 {
     if (!html_resource) {
         return QString();
@@ -199,6 +267,18 @@ QString UniversalUpdates::UpdateOneHTMLFile(HTMLResource *html_resource,
         QString source = html_resource->GetText();
         QString newsource = source;
         QString newbookpath = html_resource->GetRelativePath();
+
+        // A file that did not itself move is only affected when it
+        // references a renamed target, and any relative reference has
+        // to contain the target's filename.  Skip the parse and the
+        // reserialization for everything else; on a single rename in
+        // a large book that is nearly every file.
+        if ((currentpath == newbookpath) &&
+            !SourceReferencesAnyTarget(source, target_filenames)) {
+            html_resource->SetCurrentBookRelPath("");
+            return QString();
+        }
+
         newsource = PerformHTMLUpdates(newsource, newbookpath, html_updates, css_updates, currentpath, version)();
         html_resource->SetText(newsource);
         html_resource->SetCurrentBookRelPath("");
@@ -213,7 +293,8 @@ QString UniversalUpdates::UpdateOneHTMLFile(HTMLResource *html_resource,
 
 
 void UniversalUpdates::UpdateOneCSSFile(CSSResource *css_resource,
-                                        const QHash<QString, QString> &css_updates)
+                                        const QHash<QString, QString> &css_updates,
+                                        const QStringList &target_filenames)
 {
     if (!css_resource) {
         return;
@@ -222,6 +303,15 @@ void UniversalUpdates::UpdateOneCSSFile(CSSResource *css_resource,
     QString currentpath = css_resource->GetCurrentBookRelPath();
     const QString source = css_resource->GetText();
     const QString newbookpath = css_resource->GetRelativePath();
+
+    // Same scoping as UpdateOneHTMLFile: an unmoved stylesheet with no
+    // reference to any renamed target has nothing to rewrite.
+    if ((currentpath == newbookpath) &&
+        !SourceReferencesAnyTarget(source, target_filenames)) {
+        css_resource->SetCurrentBookRelPath("");
+        return;
+    }
+
     css_resource->SetText(PerformCSSUpdates(source, newbookpath, css_updates, currentpath)());
     css_resource->SaveToDisk();
     css_resource->SetCurrentBookRelPath("");
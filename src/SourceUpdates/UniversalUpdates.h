@@ -50,14 +50,31 @@ public:
     static void LoadAndUpdateOneCSSFile(CSSResource *css_resource,
                                         const QHash<QString, QString> &css_updates);
 
+    // Orders resources by their size on disk, largest first, so the
+    // QtConcurrent passes dispatch the big chapters before the small
+    // ones instead of possibly leaving a 5 MB straggler for the end
+    // of the batch.  Used by the AnchorUpdates/LinkUpdates/
+    // FragmentUpdates passes as well.
+    static QList<HTMLResource *> SortLargestFirst(const QList<HTMLResource *> &html_resources);
+
 private:
 
+    // Returns the filenames (raw and url encoded) of every update
+    // target; any relative reference to a target has to contain one
+    // of them, so they let the per-file updaters skip files that can
+    // not be affected by the rename at all.
+    static QStringList UpdateTargetFilenames(const QHash<QString, QString> &updates);
+
+    static bool SourceReferencesAnyTarget(const QString &source, const QStringList &target_filenames);
+
     static QString UpdateOneHTMLFile(HTMLResource *html_resource,
                                      const QHash<QString, QString> &html_updates,
-                                     const QHash<QString, QString> &css_updates);
+                                     const QHash<QString, QString> &css_updates,
+                                     const QStringList &target_filenames);
 
     static void UpdateOneCSSFile(CSSResource *css_resource,
-                                 const QHash<QString, QString> &css_updates);
+                                 const QHash<QString, QString> &css_updates,
+                                 const QStringList &target_filenames);
 
     static QString LoadAndUpdateOneHTMLFile(HTMLResource *html_resource,
                                             const QHash<QString, QString> &html_updates,
@@ -25,18 +25,38 @@
 #include <QtCore/QtCore>
 #include <QtCore/QString>
 #include <QtConcurrent/QtConcurrent>
+#include <QtWidgets/QApplication>
+#include <QtWidgets/QProgressDialog>
 #include <QDebug>
 
 #include "Misc/HTMLSpellCheckML.h"
+#include "Misc/Utility.h"
 #include "ResourceObjects/HTMLResource.h"
 #include "SourceUpdates/WordUpdates.h"
+#include "sigil_constants.h"
 
 void WordUpdates::UpdateWordInAllFiles(const QList<HTMLResource *> &html_resources,
                                        const QString& default_lang,
                                        const QString& old_word,
                                        const QString& new_word)
 {
-    QtConcurrent::blockingMap(html_resources, std::bind(UpdateWordsInOneFile, std::placeholders::_1, default_lang, old_word, new_word));
+    // The replacement still runs through the pool, but the GUI keeps
+    // painting and a progress dialog streams per-file progress instead
+    // of the application freezing for the whole batch.  User input
+    // stays excluded while it runs: the workers hold the resource
+    // write locks and edits would race them.
+    QProgressDialog progress(QObject::tr("Updating word.."), 0, 0, html_resources.count(), Utility::GetMainWindow());
+    progress.setMinimumDuration(PROGRESS_BAR_MINIMUM_DURATION);
+    QFuture<void> future = QtConcurrent::map(html_resources,
+                           std::bind(UpdateWordsInOneFile, std::placeholders::_1, default_lang, old_word, new_word));
+
+    while (future.isRunning()) {
+        progress.setValue(future.progressValue());
+        qApp->processEvents(QEventLoop::ExcludeUserInputEvents, 100);
+    }
+
+    future.waitForFinished();
+    progress.setValue(html_resources.count());
 }
 
 void WordUpdates::UpdateWordsInOneFile(HTMLResource *html_resource,
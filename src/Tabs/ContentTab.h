@@ -380,6 +380,12 @@ signals:
      */
     void ContentChanged();
 
+    /**
+     * Emitted with the raw edit delta of a text change so listeners
+     * can rebase stored offsets (bookmarks) instead of rescanning.
+     */
+    void SourceDeltaReceived(int position, int charsRemoved, int charsAdded);
+
     /**
      * Emitted when tab header text has been changed.
      *
@@ -25,10 +25,12 @@
 
 #include <QtCore/QTimer>
 #include <QtCore/QUrl>
+#include <QtConcurrent>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QAction>
 #include <QtWidgets/QDialog>
 #include <QtWidgets/QLayout>
+#include <QTextDocument>
 #include <QtPrintSupport/QPrinter>
 #include <QtPrintSupport/QPrintDialog>
 #include <QtPrintSupport/QPrintPreviewDialog>
@@ -65,15 +67,25 @@ FlowTab::FlowTab(HTMLResource *resource,
     m_wCodeView(NULL),
     m_WellFormedCheckComponent(new WellFormedCheckComponent(this, parent)),
     m_safeToLoad(false),
+    m_WellFormedErrorRevision(-1),
+    m_WellFormedCheckWatcher(new QFutureWatcher<XhtmlDoc::WellFormedError>(this)),
+    m_WellFormedCheckPendingRevision(-1),
     m_initialLoad(true),
     m_grabFocus(grab_focus),
     m_suspendTabReloading(false),
     m_defaultCaretLocationToTop(false),
-    m_LastPosition(-1)
+    m_LastPosition(-1),
+    m_DeferredLoad(false)
 {
     // Loading a flow tab can take a while. We set the wait
     // cursor and clear it at the end of the delayed initialization.
     QApplication::setOverrideCursor(Qt::WaitCursor);
+
+    m_WellFormedCheckTimer.setSingleShot(true);
+    m_WellFormedCheckTimer.setInterval(1000);
+    connect(&m_WellFormedCheckTimer, SIGNAL(timeout()), this, SLOT(StartBackgroundWellFormedCheck()));
+    connect(m_WellFormedCheckWatcher, SIGNAL(finished()), this, SLOT(BackgroundWellFormedCheckDone()));
+
     CreateCodeViewIfRequired(false);
     m_Layout->addWidget(m_wCodeView);
     LoadSettings();
@@ -112,7 +124,7 @@ FlowTab::~FlowTab()
     m_WellFormedCheckComponent->deleteLater();
 
     if (m_wCodeView) {
-        delete m_wCodeView;
+        CodeViewEditor::ReleaseToPool(m_wCodeView);
         m_wCodeView = 0;
     }
 
@@ -127,7 +139,7 @@ void FlowTab::CreateCodeViewIfRequired(bool is_delayed_load)
     }
 
     QApplication::setOverrideCursor(Qt::WaitCursor);
-    m_wCodeView = new CodeViewEditor(CodeViewEditor::Highlight_XHTML, true, this);
+    m_wCodeView = CodeViewEditor::AcquireFromPool(CodeViewEditor::Highlight_XHTML, true, this);
     m_wCodeView->SetReformatHTMLEnabled(true);
     // m_views->addWidget(m_wCodeView);
 
@@ -146,6 +158,15 @@ void FlowTab::CreateCodeViewIfRequired(bool is_delayed_load)
 
 void FlowTab::DelayedInitialization()
 {
+    // Tabs opened in the background (restored sessions, preceding tabs
+    // from splits) defer loading their document until first activation,
+    // so opening many tabs does not highlight them all up front.
+    if (!isVisible()) {
+        m_DeferredLoad = true;
+        QApplication::restoreOverrideCursor();
+        return;
+    }
+
     if (m_wCodeView) {
         m_wCodeView->CustomSetDocument(m_HTMLResource->GetTextDocumentForWriting());
         // Zoom factor for CodeView can only be set when document has been loaded.
@@ -174,6 +195,18 @@ void FlowTab::DelayedInitialization()
     QApplication::restoreOverrideCursor();
 }
 
+void FlowTab::showEvent(QShowEvent *event)
+{
+    ContentTab::showEvent(event);
+
+    // first activation of a tab whose load was deferred
+    if (m_DeferredLoad) {
+        m_DeferredLoad = false;
+        QApplication::setOverrideCursor(Qt::WaitCursor);
+        DelayedInitialization();
+    }
+}
+
 bool FlowTab::IsLoadingFinished()
 {
     bool is_finished = false;
@@ -328,10 +361,42 @@ void FlowTab::UpdateDisplay()
 void FlowTab::EmitContentChanged()
 {
     m_safeToLoad = false;
+    // restart the debounce so the well-formed verdict gets recomputed
+    // in the background once this burst of edits settles
+    m_WellFormedCheckTimer.start();
     DBG qDebug() << "FlowTab emiting Content Changed";
     emit ContentChanged();
 }
 
+void FlowTab::StartBackgroundWellFormedCheck()
+{
+    if (!m_wCodeView || !IsLoadingFinished()) {
+        return;
+    }
+    if (m_WellFormedCheckWatcher->isRunning()) {
+        // a parse of an older revision is still underway, try again later
+        m_WellFormedCheckTimer.start();
+        return;
+    }
+    int revision = m_wCodeView->document()->revision();
+    if (revision == m_WellFormedErrorRevision) {
+        return;
+    }
+    m_WellFormedCheckPendingRevision = revision;
+    m_WellFormedCheckWatcher->setFuture(QtConcurrent::run(XhtmlDoc::WellFormedErrorForSource,
+                                                          m_wCodeView->toPlainText(),
+                                                          m_HTMLResource->GetEpubVersion()));
+}
+
+void FlowTab::BackgroundWellFormedCheckDone()
+{
+    // The verdict belongs to the revision the parse was started for.
+    // If more edits arrived in the meantime the revisions differ and
+    // the next IsDataWellFormed() simply misses the memo as before.
+    m_WellFormedError = m_WellFormedCheckWatcher->result();
+    m_WellFormedErrorRevision = m_WellFormedCheckPendingRevision;
+}
+
 void FlowTab::EmitUpdatePreview()
 {
     if (IsLoadingFinished()) {
@@ -634,12 +699,20 @@ bool FlowTab::IsDataWellFormed()
     QString version = m_HTMLResource->GetEpubVersion();
 
     // So lets play safe and have a fallback to use the resource text if CV is not loaded yet.
-    XhtmlDoc::WellFormedError error = (m_wCodeView != NULL)
-        ? XhtmlDoc::WellFormedErrorForSource(m_wCodeView->toPlainText(),version)
-        : XhtmlDoc::WellFormedErrorForSource(m_HTMLResource->GetText(),version);
-    m_safeToLoad = error.line == -1;
+    if (m_wCodeView != NULL) {
+        // reuse the last verdict when the document has not changed since it was computed,
+        // so checking every open tab on Save only reparses the edited ones
+        if (m_wCodeView->document()->revision() != m_WellFormedErrorRevision) {
+            m_WellFormedError = XhtmlDoc::WellFormedErrorForSource(m_wCodeView->toPlainText(), version);
+            m_WellFormedErrorRevision = m_wCodeView->document()->revision();
+        }
+    } else {
+        m_WellFormedError = XhtmlDoc::WellFormedErrorForSource(m_HTMLResource->GetText(), version);
+        m_WellFormedErrorRevision = -1;
+    }
+    m_safeToLoad = m_WellFormedError.line == -1;
     if (!m_safeToLoad) {
-          m_WellFormedCheckComponent->DemandAttentionIfAllowed(error);
+          m_WellFormedCheckComponent->DemandAttentionIfAllowed(m_WellFormedError);
     }
     return m_safeToLoad;
 }
@@ -1180,6 +1253,7 @@ void FlowTab::ConnectCodeViewSignalsToSlots()
     connect(m_wCodeView, SIGNAL(SpellingHighlightRefreshRequest()), this, SIGNAL(SpellingHighlightRefreshRequest()));
     connect(m_wCodeView, SIGNAL(ShowStatusMessageRequest(const QString &)), this, SIGNAL(ShowStatusMessageRequest(const QString &)));
     connect(m_wCodeView, SIGNAL(FilteredTextChanged()), this, SLOT(EmitContentChanged()));
+    connect(m_wCodeView, SIGNAL(SourceDelta(int,int,int)), this, SIGNAL(SourceDeltaReceived(int,int,int)));
     //  This is needed to capture scroll from arrow keys and the like
     connect(m_wCodeView, SIGNAL(FilteredCursorMoved()), this, SLOT(EmitScrollPreviewImmediately()));
     connect(m_wCodeView, SIGNAL(PageUpdated()), this, SLOT(EmitUpdatePreview()));
@@ -27,8 +27,11 @@
 #ifndef FLOWTAB_H
 #define FLOWTAB_H
 
+#include <QtCore/QTimer>
 #include <QtCore/QUrl>
+#include <QtCore/QFutureWatcher>
 
+#include "BookManipulation/XhtmlDoc.h"
 #include "MainUI/MainWindow.h"
 #include "Misc/Utility.h"
 #include "MiscEditors/ClipEditorModel.h"
@@ -37,6 +40,7 @@
 #include "Tabs/WellFormedContent.h"
 
 class QUrl;
+class QShowEvent;
 class CodeViewEditor;
 class HTMLResource;
 class Resource;
@@ -302,6 +306,16 @@ public slots:
     void EmitUpdatePreviewImmediately();
     void EmitScrollPreviewImmediately();
 
+protected:
+
+    /**
+     * A custom show handler that performs the deferred load of a
+     * tab opened in the background when it is first activated.
+     *
+     * @param event The underlying QShowEvent.
+     */
+    virtual void showEvent(QShowEvent *event);
+
 private slots:
 
     /**
@@ -346,6 +360,19 @@ private slots:
     // Store our caret location as required.
     void ResourceTextChanging();
 
+    /**
+     * Launches a well-formed check of the current text in the
+     * background once edits have settled, so the gates that consult
+     * IsDataWellFormed() later find the verdict already memoized.
+     */
+    void StartBackgroundWellFormedCheck();
+
+    /**
+     * Stores the background verdict against the revision it was
+     * computed for.
+     */
+    void BackgroundWellFormedCheckDone();
+
 private:
     void CreateCodeViewIfRequired(bool is_delayed_load = true);
 
@@ -398,6 +425,25 @@ private:
      */
     bool m_safeToLoad;
 
+    /**
+     * The verdict of the last well-formedness check and the document
+     * revision it was computed for, so tab switches and saves do not
+     * reparse a document that has not changed since the last check.
+     */
+    XhtmlDoc::WellFormedError m_WellFormedError;
+
+    int m_WellFormedErrorRevision;
+
+    /**
+     * Debounces edits and then runs the well-formed check off the
+     * GUI thread to keep the verdict memo warm.
+     */
+    QTimer m_WellFormedCheckTimer;
+
+    QFutureWatcher<XhtmlDoc::WellFormedError> *m_WellFormedCheckWatcher;
+
+    int m_WellFormedCheckPendingRevision;
+
     bool m_initialLoad;
 
     bool m_grabFocus;
@@ -407,6 +453,12 @@ private:
     bool m_defaultCaretLocationToTop;
 
     int m_LastPosition;
+
+    /**
+     * Set when the tab was opened in the background and its document
+     * load is deferred until the tab is first shown.
+     */
+    bool m_DeferredLoad;
 };
 
 #endif // FLOWTAB_H
@@ -36,7 +36,7 @@ TextTab::TextTab(TextResource *resource,
                  QWidget *parent)
     :
     ContentTab(resource, parent),
-    m_wCodeView(new CodeViewEditor(type, false, this)),
+    m_wCodeView(CodeViewEditor::AcquireFromPool(type, false, this)),
     m_TextResource(resource),
     m_LineToScrollTo(line_to_scroll_to),
     m_PositionToScrollTo(position_to_scroll_to)
@@ -55,7 +55,7 @@ TextTab::TextTab(TextResource *resource,
 TextTab::~TextTab()
 {
     if (m_wCodeView) {
-        delete m_wCodeView;
+        CodeViewEditor::ReleaseToPool(m_wCodeView);
         m_wCodeView = 0;
     }
 }
@@ -291,6 +291,7 @@ void TextTab::ConnectSignalsToSlots()
     connect(m_wCodeView, SIGNAL(FocusGained(QWidget *)),    this, SLOT(LoadTabContent(QWidget *)));
     connect(m_wCodeView, SIGNAL(FocusLost(QWidget *)),      this, SLOT(SaveTabContent(QWidget *)));
     connect(m_wCodeView, SIGNAL(FilteredTextChanged()),      this, SIGNAL(ContentChanged()));
+    connect(m_wCodeView, SIGNAL(SourceDelta(int,int,int)), this, SIGNAL(SourceDeltaReceived(int,int,int)));
     connect(m_wCodeView, SIGNAL(cursorPositionChanged()),     this, SLOT(EmitUpdateCursorPosition()));
     connect(m_wCodeView, SIGNAL(ZoomFactorChanged(float)), this, SIGNAL(ZoomFactorChanged(float)));
     connect(m_wCodeView, SIGNAL(selectionChanged()),         this, SIGNAL(SelectionChanged()));
@@ -29,12 +29,12 @@
 #include <QtCore/QFileInfo>
 #include <QtGui/QContextMenuEvent>
 #include <QtCore/QSignalMapper>
+#include <QtCore/QTimer>
 #include <QtWidgets/QAction>
 #include <QtWidgets/QMenu>
 #include <QtGui/QPainter>
 #include <QtWidgets/QScrollBar>
 #include <QtWidgets/QShortcut>
-#include <QtCore/QXmlStreamReader>
 #include <QRegularExpression>
 #include <QRegularExpressionMatch>
 #include <QRegularExpressionMatchIterator>
@@ -50,6 +50,7 @@
 #include "Misc/XHTMLHighlighter2.h"
 #include "Dialogs/ClipEditor.h"
 #include "Misc/CSSHighlighter.h"
+#include "Misc/LargeBookPolicy.h"
 #include "Misc/SettingsStore.h"
 #include "Misc/SpellCheck.h"
 #include "Misc/HTMLSpellCheck.h"
@@ -66,7 +67,6 @@ const QString BREAK_TAG_INSERT    = "<hr class=\"sigil_split_marker\" />";
 static const int TAB_SPACES_WIDTH        = 4;
 static const int LINE_NUMBER_MARGIN      = 5;
 
-static const QString XML_OPENING_TAG        = "(<[^>/][^>]*[^>/]>|<[^>/]>)";
 static const QString NEXT_CLOSE_TAG_LOCATION = "</\\s*[^>]+>";
 static const QString NEXT_TAG_LOCATION      = "<[^!>]+>";
 static const QString TAG_NAME_SEARCH        = "<\\s*([^\\s>]+)";
@@ -79,6 +79,10 @@ static const QString STARTING_INDENT_USED = "(^\\s*)[^\\s]";
 
 static const int MAX_SPELLING_SUGGESTIONS = 10;
 
+// parked editors awaiting reuse by the next tab of the same flavor
+static const int MAX_POOLED_EDITORS = 4;
+static QList<CodeViewEditor *> s_EditorPool;
+
 
 CodeViewEditor::CodeViewEditor(HighlighterType high_type, bool check_spelling, QWidget *parent)
     :
@@ -93,6 +97,8 @@ CodeViewEditor::CodeViewEditor(HighlighterType high_type, bool check_spelling, Q
     m_DelayedCursorScreenCenteringRequired(false),
     m_CaretUpdate(QList<ElementIndex>()),
     m_checkSpelling(check_spelling),
+    m_highlighterType(high_type),
+    m_ParkedDocument(NULL),
     m_reformatCSSEnabled(false),
     m_reformatHTMLEnabled(false),
     m_lastFindRegex(QString()),
@@ -104,7 +110,14 @@ CodeViewEditor::CodeViewEditor(HighlighterType high_type, bool check_spelling, Q
     m_MarkedTextStart(-1),
     m_MarkedTextEnd(-1),
     m_ReplacingInMarkedText(false),
-    m_regen_taglist(true)
+    m_regen_taglist(true),
+    m_damageStart(-1),
+    m_damageEnd(-1),
+    m_damageDelta(0),
+    m_StyleInfo(NULL),
+    m_MatchCacheRevision(-1),
+    m_RehighlightNextBlock(0),
+    m_RehighlightPending(false)
 {
     if (high_type == CodeViewEditor::Highlight_XHTML) {
         // m_Highlighter = new XHTMLHighlighter(check_spelling, this);
@@ -124,6 +137,68 @@ CodeViewEditor::~CodeViewEditor()
 {
     m_ScrollOneLineUp->deleteLater();
     m_ScrollOneLineDown->deleteLater();
+    if (m_StyleInfo) {
+        delete m_StyleInfo;
+        m_StyleInfo = NULL;
+    }
+}
+
+CodeViewEditor *CodeViewEditor::AcquireFromPool(HighlighterType high_type, bool check_spelling, QWidget *parent)
+{
+    for (int i = 0; i < s_EditorPool.count(); i++) {
+        CodeViewEditor *editor = s_EditorPool.at(i);
+        if ((editor->m_highlighterType == high_type) && (editor->m_checkSpelling == check_spelling)) {
+            s_EditorPool.removeAt(i);
+            editor->setParent(parent);
+            // pick up any appearance or zoom changes made while parked
+            editor->SetAppearance();
+            return editor;
+        }
+    }
+    return new CodeViewEditor(high_type, check_spelling, parent);
+}
+
+void CodeViewEditor::ReleaseToPool(CodeViewEditor *editor)
+{
+    if (!editor) {
+        return;
+    }
+    if (s_EditorPool.count() >= MAX_POOLED_EDITORS) {
+        delete editor;
+        return;
+    }
+    editor->hide();
+    editor->setParent(NULL);
+    editor->DetachDocument();
+    s_EditorPool.append(editor);
+}
+
+void CodeViewEditor::DetachDocument()
+{
+    // the closing tab's document belongs to its resource and must not
+    // receive damage reports or highlighting from a parked editor
+    disconnect(document(), 0, this, 0);
+    if (!m_ParkedDocument) {
+        m_ParkedDocument = new TextDocument(this);
+    }
+    setDocument(m_ParkedDocument);
+    if (m_Highlighter) {
+        m_Highlighter->setDocument(m_ParkedDocument);
+    }
+    m_isLoadFinished = false;
+    m_CaretUpdate.clear();
+    m_MarkedTextStart = -1;
+    m_MarkedTextEnd = -1;
+    m_regen_taglist = true;
+    m_damageStart = -1;
+    if (m_StyleInfo) {
+        delete m_StyleInfo;
+        m_StyleInfo = NULL;
+    }
+    m_MatchCachePattern.clear();
+    m_MatchCacheRevision = -1;
+    m_MatchCache.clear();
+    m_TagList.reloadLister("");
 }
 
 void CodeViewEditor::SetAppearance()
@@ -171,6 +246,19 @@ void CodeViewEditor::CustomSetDocument(TextDocument &ndocument)
     ResetFont();
     m_isLoadFinished = true;
     m_regen_taglist = true;
+    m_damageStart = -1;
+    // the old style model belongs to the previous document
+    if (m_StyleInfo) {
+        delete m_StyleInfo;
+        m_StyleInfo = NULL;
+    }
+    // so do any memoized matches
+    m_MatchCachePattern.clear();
+    m_MatchCacheRevision = -1;
+    m_MatchCache.clear();
+    // the damage reports come from the document itself so the
+    // connection must be remade whenever the document is replaced
+    connect(document(), SIGNAL(contentsChange(int,int,int)), this, SLOT(SourceChangedFilter(int,int,int)), Qt::UniqueConnection);
     emit DocumentSet();
 }
 
@@ -535,27 +623,32 @@ void CodeViewEditor::LineNumberAreaPaintEvent(QPaintEvent *event)
     // but we count lines of text from one
     int blockNumber  = block.blockNumber() + 1;
 
+    //   Anchor the geometry once at the first visible block and then
+    // walk it forward by each block's own height, the same incremental
+    // walk QPlainTextEdit's paintEvent uses.  Asking the layout for
+    // every block's document-wide rect made fast scrolls through very
+    // long files stutter in the gutter.
+    qreal topY = blockBoundingGeometry(block).translated(contentOffset()).top();
+    int bottom = event->rect().bottom();
+    int number_height = fontMetrics().height();
+    int number_width = m_LineNumberArea->width();
+    painter.setPen(m_codeViewAppearance.line_number_foreground_color);
+
     // We loop through all the visible and
     // unobscured blocks and paint line numbers for each
-    while (block.isValid()) {
-        // Getting the Y coordinates for the top of a block.
-        int topY = (int) blockBoundingGeometry(block).translated(contentOffset()).top();
-
-        // Ignore blocks that are not visible.
-        if (!block.isVisible() || (topY > event->rect().bottom())) {
-            break;
+    while (block.isValid() && topY <= bottom) {
+        if (block.isVisible()) {
+            // Draw the number in the line number area.
+            painter.drawText(- LINE_NUMBER_MARGIN,
+                             (int) topY,
+                             number_width,
+                             number_height,
+                             Qt::AlignRight,
+                             QString::number(blockNumber)
+                            );
+            topY += blockBoundingRect(block).height();
         }
 
-        // Draw the number in the line number area.
-        painter.setPen(m_codeViewAppearance.line_number_foreground_color);
-        QString number_to_paint = QString::number(blockNumber);
-        painter.drawText(- LINE_NUMBER_MARGIN,
-                         topY,
-                         m_LineNumberArea->width(),
-                         fontMetrics().height(),
-                         Qt::AlignRight,
-                         number_to_paint
-                        );
         // Move to the next block and block number.
         block = block.next();
         blockNumber++;
@@ -826,6 +919,59 @@ SPCRE::MatchInfo CodeViewEditor::GetMisspelledWord(const QString &text, int star
     return match_info;
 }
 
+// The memoized match lists are in document order and non-overlapping,
+// so stepping through them is a binary search on the offsets.
+static SPCRE::MatchInfo FirstMatchStartingAtOrAfter(const QList<SPCRE::MatchInfo> &matches, int pos)
+{
+    int lo = 0;
+    int hi = matches.count();
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (matches.at(mid).offset.first < pos) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < matches.count()) {
+        return matches.at(lo);
+    }
+    return SPCRE::MatchInfo();
+}
+
+static SPCRE::MatchInfo LastMatchEndingAtOrBefore(const QList<SPCRE::MatchInfo> &matches, int start, int pos)
+{
+    int lo = 0;
+    int hi = matches.count();
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (matches.at(mid).offset.second <= pos) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    // lo is the first match ending past pos, so the candidate is just before it
+    if ((lo > 0) && (matches.at(lo - 1).offset.first >= start)) {
+        return matches.at(lo - 1);
+    }
+    return SPCRE::MatchInfo();
+}
+
+
+const QList<SPCRE::MatchInfo> &CodeViewEditor::GetMatchCache(const QString &search_regex, const QString &text)
+{
+    int revision = document()->revision();
+    if ((search_regex != m_MatchCachePattern) || (revision != m_MatchCacheRevision)) {
+        QSharedPointer<SPCRE> spcre = PCRECache::instance()->getObject(search_regex);
+        m_MatchCache = spcre->getEveryMatchInfo(text);
+        m_MatchCachePattern = search_regex;
+        m_MatchCacheRevision = revision;
+    }
+    return m_MatchCache;
+}
+
+
 bool CodeViewEditor::FindNext(const QString &search_regex,
                               Searchable::Direction search_direction,
                               bool misspelled_words,
@@ -833,18 +979,15 @@ bool CodeViewEditor::FindNext(const QString &search_regex,
                               bool wrap,
                               bool marked_text)
 {
-    SPCRE *spcre = PCRECache::instance()->getObject(search_regex);
     SPCRE::MatchInfo match_info;
     QString txt = toPlainText();
     int start_offset = 0;
     int start = 0;
-    int end = txt.length();
     if (marked_text) {
         if (!MoveToMarkedText(search_direction, wrap)) {
             return false;
         }
         start = m_MarkedTextStart;
-        end = m_MarkedTextEnd;
         start_offset = m_MarkedTextStart;
     }
     int selection_offset = GetSelectionOffset(search_direction, ignore_selection_offset, marked_text);
@@ -853,16 +996,19 @@ bool CodeViewEditor::FindNext(const QString &search_regex,
         if (misspelled_words) {
             match_info = GetMisspelledWord(txt, 0, selection_offset, search_regex, search_direction);
         } else {
-            match_info = spcre->getLastMatchInfo(Utility::Substring(start, selection_offset, txt));
+            // served from the memoized match list with absolute offsets
+            match_info = LastMatchEndingAtOrBefore(GetMatchCache(search_regex, txt), start, selection_offset);
+            start_offset = 0;
         }
     } else {
         if (misspelled_words) {
             match_info = GetMisspelledWord(txt, selection_offset, txt.count(), search_regex, search_direction);
+            start_offset = selection_offset;
         } else {
-            match_info = spcre->getFirstMatchInfo(Utility::Substring(selection_offset, end, txt));
+            // served from the memoized match list with absolute offsets
+            match_info = FirstMatchStartingAtOrAfter(GetMatchCache(search_regex, txt), selection_offset);
+            start_offset = 0;
         }
-
-        start_offset = selection_offset;
     }
 
     if (marked_text) {
@@ -897,7 +1043,7 @@ bool CodeViewEditor::FindNext(const QString &search_regex,
 
 int CodeViewEditor::Count(const QString &search_regex, Searchable::Direction direction, bool wrap, bool marked_text)
 {
-    SPCRE *spcre = PCRECache::instance()->getObject(search_regex);
+    QSharedPointer<SPCRE> spcre = PCRECache::instance()->getObject(search_regex);
     QString text= toPlainText();
     int start = 0;
     int end = text.length();
@@ -918,13 +1064,13 @@ int CodeViewEditor::Count(const QString &search_regex, Searchable::Direction dir
     } else if (marked_text) {
         text = Utility::Substring(start, end, text);
     }
-    return spcre->getEveryMatchInfo(text).count();
+    return spcre->countMatches(text);
 }
 
 
 bool CodeViewEditor::ReplaceSelected(const QString &search_regex, const QString &replacement, Searchable::Direction direction, bool replace_current)
 {
-    SPCRE *spcre = PCRECache::instance()->getObject(search_regex);
+    QSharedPointer<SPCRE> spcre = PCRECache::instance()->getObject(search_regex);
     int selection_start = textCursor().selectionStart();
     int selection_end = textCursor().selectionEnd();
 
@@ -1012,14 +1158,25 @@ int CodeViewEditor::ReplaceAll(const QString &search_regex,
         text = Utility::Substring(m_MarkedTextStart, m_MarkedTextEnd, text);
         position = original_position - m_MarkedTextStart;
     }
-    int marked_text_length = text.length();
+    // Offsets below are relative to the searched text, which starts at
+    // the marker when replacing in marked text only.
+    int text_start = marked_text ? m_MarkedTextStart : 0;
 
-    SPCRE *spcre = PCRECache::instance()->getObject(search_regex);
+    QSharedPointer<SPCRE> spcre = PCRECache::instance()->getObject(search_regex);
     QList<SPCRE::MatchInfo> match_info = spcre->getEveryMatchInfo(text);
 
-    // Run though all match offsets making the replacement in reverse order.
-    // This way changes in text length won't change the offsets as we make
-    // our changes.
+    QTextCursor cursor = textCursor();
+    // Store the cursor position
+    int cursor_position = cursor.selectionStart();
+    int length_delta = 0;
+    cursor.beginEditBlock();
+
+    // Run though all match offsets making each replacement as its own
+    // cursor edit, in reverse order so earlier offsets stay valid as the
+    // text length changes.  The edit block keeps it one undo step, and
+    // the undo stack then records just the replaced spans instead of a
+    // full copy of the document per Replace All - which is what made
+    // undo history balloon after a few Replace Alls on big chapters.
     for (int i = match_info.count() - 1; i >= 0; i--) {
         QString replaced_text;
         if (!wrap) {
@@ -1027,7 +1184,7 @@ int CodeViewEditor::ReplaceAll(const QString &search_regex,
                 if (match_info.at(i).offset.first > position) {
                     break;
                 }
-            } else { 
+            } else {
                 if (match_info.at(i).offset.second < position) {
                     break;
                 }
@@ -1038,28 +1195,20 @@ int CodeViewEditor::ReplaceAll(const QString &search_regex,
 
         if (replacement_made) {
             // Replace the text.
-            text = text.replace(match_info.at(i).offset.first, match_info.at(i).offset.second - match_info.at(i).offset.first, replaced_text);
+            cursor.setPosition(text_start + match_info.at(i).offset.first);
+            cursor.setPosition(text_start + match_info.at(i).offset.second, QTextCursor::KeepAnchor);
+            cursor.insertText(replaced_text);
+            length_delta += replaced_text.length() - (match_info.at(i).offset.second - match_info.at(i).offset.first);
             count++;
         }
     }
+    cursor.endEditBlock();
+
     if (marked_text) {
-        // Merge the replaced marked text into the original text and adjust the marker.
-        QString replaced_text = toPlainText();
-        replaced_text.replace(m_MarkedTextStart, m_MarkedTextEnd - m_MarkedTextStart, text);
-        m_MarkedTextEnd += text.length() - marked_text_length;
-        text = replaced_text;
+        // Adjust the marker for the change in length of its contents.
+        m_MarkedTextEnd += length_delta;
     }
 
-    QTextCursor cursor = textCursor();
-    // Store the cursor position
-    int cursor_position = cursor.selectionStart();
-    cursor.beginEditBlock();
-    // Replace all text in the document with the new text.
-    cursor.setPosition(cursor_position);
-    cursor.select(QTextCursor::Document);
-    cursor.insertText(text);
-    cursor.endEditBlock();
-
     // Restore the cursor position
     cursor.setPosition(cursor_position);
     setTextCursor(cursor);
@@ -1743,8 +1892,8 @@ void CodeViewEditor::GoToStyleDefinition()
         return;
     }
 
-    HTMLStyleInfo htmlcss_info(toPlainText());
-    CSSInfo::CSSSelector *selector = htmlcss_info.getCSSSelectorForElementClass(element.name, element.classStyle);
+    HTMLStyleInfo *htmlcss_info = GetStyleInfo();
+    CSSInfo::CSSSelector *selector = htmlcss_info->getCSSSelectorForElementClass(element.name, element.classStyle);
 
     if (!selector) {
         // We didn't find the style - escalate as an event to look in linked stylesheets
@@ -2043,11 +2192,72 @@ void CodeViewEditor::RehighlightDocument()
         CSSHighlighter* chl = qobject_cast<CSSHighlighter*>(m_Highlighter);
         document()->blockSignals(true);
         if (xhl) {
-            xhl->do_rehighlight();
+            //   The syntax state machine is cheap; spell checking every
+            // block of a multi-megabyte chapter through hunspell is what
+            // made opening it crawl.  Run the full pass with spelling
+            // deferred, give the blocks in the viewport their underlines
+            // immediately, and let RehighlightNextChunk() work through
+            // the offscreen blocks from the event loop.
+            xhl->SetRules();
+            xhl->SetSpellingDeferred(true);
+            xhl->rehighlight();
+            xhl->SetSpellingDeferred(false);
+
+            if (m_checkSpelling && SettingsStore::hotSettings().spell_check) {
+                QTextBlock block = firstVisibleBlock();
+                int viewport_bottom = viewport()->rect().bottom();
+
+                while (block.isValid() &&
+                       blockBoundingGeometry(block).translated(contentOffset()).top() <= viewport_bottom) {
+                    xhl->rehighlightBlock(block);
+                    block = block.next();
+                }
+            }
         } else if (chl) {
             chl->do_rehighlight();
         }
         document()->blockSignals(false);
+
+        if (xhl && m_checkSpelling && SettingsStore::hotSettings().spell_check) {
+            m_RehighlightNextBlock = 0;
+
+            if (!m_RehighlightPending) {
+                m_RehighlightPending = true;
+                QTimer::singleShot(0, this, SLOT(RehighlightNextChunk()));
+            }
+        }
+    }
+}
+
+
+void CodeViewEditor::RehighlightNextChunk()
+{
+    // A modest run of blocks per event loop pass; everything the user
+    // does gets serviced between chunks.
+    static const int REHIGHLIGHT_CHUNK_BLOCKS = 128;
+
+    if (!m_Highlighter) {
+        m_RehighlightPending = false;
+        return;
+    }
+
+    document()->blockSignals(true);
+    QTextBlock block = document()->findBlockByNumber(m_RehighlightNextBlock);
+    int done = 0;
+
+    while (block.isValid() && done < REHIGHLIGHT_CHUNK_BLOCKS) {
+        m_Highlighter->rehighlightBlock(block);
+        block = block.next();
+        ++done;
+    }
+
+    document()->blockSignals(false);
+    m_RehighlightNextBlock += done;
+
+    if (block.isValid()) {
+        QTimer::singleShot(0, this, SLOT(RehighlightNextChunk()));
+    } else {
+        m_RehighlightPending = false;
     }
 }
 
@@ -2087,19 +2297,86 @@ void CodeViewEditor::MaybeRegenerateTagList()
     // if (!m_isLoadFinished) return;
     
     if (m_regen_taglist) {
-        qDebug() << "regenerating tag list";
-        m_TagList.reloadLister(toPlainText());
+        if (m_damageStart >= 0) {
+            // only the damaged region needs to be re-lexed
+            int added = m_damageEnd - m_damageStart;
+            int removed = added - m_damageDelta;
+            m_TagList.updateRange(toPlainText(), m_damageStart, removed, added);
+        } else {
+            qDebug() << "regenerating tag list";
+            m_TagList.reloadLister(toPlainText());
+        }
+        m_damageStart = -1;
+        m_damageEnd = -1;
+        m_damageDelta = 0;
         m_regen_taglist = false;
     }
 }
 
 
+HTMLStyleInfo *CodeViewEditor::GetStyleInfo()
+{
+    // built from the full text once, then kept current by
+    // SourceChangedFilter feeding it every edit delta
+    if (!m_StyleInfo) {
+        m_StyleInfo = new HTMLStyleInfo(toPlainText());
+    }
+    return m_StyleInfo;
+}
+
+
+void CodeViewEditor::SourceChangedFilter(int position, int charsRemoved, int charsAdded)
+{
+    if ((charsRemoved == 0) && (charsAdded == 0)) {
+        return;
+    }
+
+    emit SourceDelta(position, charsRemoved, charsAdded);
+
+    // keep any existing style model warm instead of letting it go stale
+    if (m_StyleInfo) {
+        QTextCursor tc(document());
+        tc.setPosition(position);
+        tc.setPosition(position + charsAdded, QTextCursor::KeepAnchor);
+        QString added = tc.selectedText();
+        // selectedText uses U+2029 for paragraph breaks, toPlainText does not
+        added.replace(QChar(0x2029), QChar('\n'));
+        m_StyleInfo->updateRange(position, charsRemoved, added);
+    }
+
+    // a full regeneration is already pending and subsumes this change
+    if (m_regen_taglist && (m_damageStart < 0)) {
+        return;
+    }
+
+    if (m_damageStart < 0) {
+        m_damageStart = position;
+        m_damageEnd = position + charsAdded;
+        m_damageDelta = charsAdded - charsRemoved;
+    } else {
+        // coalesce with the damage already being tracked
+        if (position < m_damageStart) {
+            m_damageStart = position;
+        }
+        int dend = m_damageEnd;
+        if (position + charsRemoved > dend) {
+            dend = position + charsRemoved;
+        }
+        dend = dend + charsAdded - charsRemoved;
+        if (dend < position + charsAdded) {
+            dend = position + charsAdded;
+        }
+        m_damageEnd = dend;
+        m_damageDelta = m_damageDelta + charsAdded - charsRemoved;
+    }
+    m_regen_taglist = true;
+}
+
+
 void CodeViewEditor::HighlightCurrentLine(bool highlight_tags)
 {
     QList<QTextEdit::ExtraSelection> extraSelections;
 
-    SettingsStore settings;
-
     // Draw the full width line color.
     QTextEdit::ExtraSelection selection_line;
     if (hasFocus()) {
@@ -2112,7 +2389,10 @@ void CodeViewEditor::HighlightCurrentLine(bool highlight_tags)
     selection_line.cursor.clearSelection();
     extraSelections.append(selection_line);
 
-    if (highlight_tags && settings.highlightOpenCloseTags()) {
+    // runs on every cursor move, so read the cached settings snapshot
+    // (and the large-book policy, which may turn this off wholesale)
+    if (highlight_tags && SettingsStore::hotSettings().highlight_open_close_tags &&
+        !LargeBookPolicy::instance()->SuppressTagHighlighting()) {
 
         // If and only if cursor is inside a tag, highlight open and matching close
         // current cursor position is just before this char at position pos in text
@@ -2444,23 +2724,20 @@ QList<ElementIndex> CodeViewEditor::GetCaretLocation()
     // We search for the first opening tag *behind* the caret.
     // This specifies the element the caret is located in.
     int pos = textCursor().position();
-    int offset = 0;
-    int len = 0;
-    QRegularExpression tag(XML_OPENING_TAG);
-    QRegularExpressionMatchIterator i = tag.globalMatch(toPlainText());
-    // There is no way to search for the last match (str.lastIndexOf) in a string and also have
-    // the matched text length. So we search forward for every match (QRegularExpression doesn't
-    // have a way to search backwards) and only use the last match's info.
-    while (i.hasNext()) {
-        QRegularExpressionMatch mo = i.next();
-        int start = mo.capturedStart();
-        if (start > pos) {
-            break;
-        }
-        offset = start;
-        len = mo.capturedLength();
+    MaybeRegenerateTagList();
+
+    // Find the last element start tag at or before the caret in the
+    // incrementally maintained tag index, skipping over end tags,
+    // comments and the like.  This used to be a regex scan over the
+    // whole document followed by a full QXmlStreamReader reparse on
+    // every Preview sync.
+    int target = m_TagList.findLastTagOnOrBefore(pos);
+    while ((target >= 0) &&
+           (m_TagList.at(target).ttype != "begin") &&
+           (m_TagList.at(target).ttype != "single")) {
+        target--;
     }
-    QList<ElementIndex> hierarchy = ConvertStackToHierarchy(GetCaretLocationStack(offset + len));
+    QList<ElementIndex> hierarchy = ConvertStackToHierarchy(GetCaretLocationStack(target));
 
     // determine last block element containing caret
     QString element_name;
@@ -2481,16 +2758,17 @@ void CodeViewEditor::StoreCaretLocationUpdate(const QList<ElementIndex> &hierarc
 }
 
 
-QStack<CodeViewEditor::StackElement> CodeViewEditor::GetCaretLocationStack(int offset) const
+QStack<CodeViewEditor::StackElement> CodeViewEditor::GetCaretLocationStack(int target)
 {
-    QString source = toPlainText();
-    QXmlStreamReader reader(source);
     QStack<StackElement> stack;
+    if (target < 0) {
+        return stack;
+    }
 
-    while (!reader.atEnd()) {
-        reader.readNext();
+    for (int i = 0; i <= target; i++) {
+        const TagLister::TagInfo &ti = m_TagList.at(i);
 
-        if (reader.isStartElement()) {
+        if ((ti.ttype == "begin") || (ti.ttype == "single")) {
             // If we detected the start of a new element, then
             // the element currently on the top of the stack
             // has one more child element
@@ -2499,29 +2777,27 @@ QStack<CodeViewEditor::StackElement> CodeViewEditor::GetCaretLocationStack(int o
             }
 
             StackElement new_element;
-            new_element.name         = reader.name().toString();
+            new_element.name         = ti.tname;
             new_element.num_children = 0;
             stack.push(new_element);
 
-            // Check if this is the element start tag
-            // we are looking for
-            if (reader.characterOffset() == offset) {
-                break;
+            // A self-closed element only stays on the stack when it
+            // is the element the caret is located in
+            if ((ti.ttype == "single") && (i != target)) {
+                stack.pop();
             }
         }
         // If we detect the end tag of an element,
         // we remove it from the top of the stack
-        else if (reader.isEndElement()) {
+        else if (ti.ttype == "end") {
+            if (stack.isEmpty()) {
+                // Mismatched end tag - just return an empty location.
+                return QStack<StackElement>();
+            }
             stack.pop();
         }
     }
 
-    if (reader.hasError()) {
-        // Just return an empty location.
-        // Maybe we could return the stack we currently have?
-        return QStack<StackElement>();
-    }
-
     return stack;
 }
 
@@ -2550,8 +2826,98 @@ QList<ElementIndex> CodeViewEditor::ConvertStackToHierarchy(const QStack<StackEl
 }
 
 
-std::tuple<int, int> CodeViewEditor::ConvertHierarchyToCaretMove(const QList<ElementIndex> &hierarchy) const
+int CodeViewEditor::ResolveHierarchyOffset(const QList<ElementIndex> &hierarchy)
+{
+    if (hierarchy.isEmpty()) {
+        return -1;
+    }
+    MaybeRegenerateTagList();
+
+    // the root element is the first begin tag, anything
+    // before it is the xml header, doctype or comments
+    int cur = -1;
+    for (int i = 0; i < (int)m_TagList.size(); i++) {
+        const QString &ttype = m_TagList.at(i).ttype;
+        if ((ttype == "begin") || (ttype == "single")) {
+            cur = i;
+            break;
+        }
+    }
+    if (cur < 0) {
+        return -1;
+    }
+
+    // each entry's index selects which element child of the current
+    // element to descend into, the last entry's index is unused
+    for (int d = 0; d < hierarchy.count() - 1; d++) {
+        if (hierarchy.at(d + 1).name == "#text") {
+            // a text child carries a raw node index the tag index
+            // cannot see - the first one starts right at the content
+            if (hierarchy.at(d).index == 0) {
+                const TagLister::TagInfo &ti = m_TagList.at(cur);
+                return ti.pos + ti.len;
+            }
+            return -1;
+        }
+        if (m_TagList.at(cur).ttype == "single") {
+            // nothing to descend into
+            break;
+        }
+        int want = hierarchy.at(d).index;
+        int depth = 0;
+        int elnum = -1;
+        int child = -1;
+        for (int j = cur + 1; j < (int)m_TagList.size(); j++) {
+            const TagLister::TagInfo &ti = m_TagList.at(j);
+            if (ti.ttype == "begin") {
+                if (depth == 0) {
+                    elnum++;
+                    if (elnum == want) {
+                        child = j;
+                        break;
+                    }
+                }
+                depth++;
+            } else if (ti.ttype == "single") {
+                if (depth == 0) {
+                    elnum++;
+                    if (elnum == want) {
+                        child = j;
+                        break;
+                    }
+                }
+            } else if (ti.ttype == "end") {
+                if (depth == 0) {
+                    break;
+                }
+                depth--;
+            }
+        }
+        if (child < 0) {
+            // no such child, stay on the last element reached
+            break;
+        }
+        cur = child;
+    }
+    return m_TagList.at(cur).pos;
+}
+
+
+std::tuple<int, int> CodeViewEditor::ConvertHierarchyToCaretMove(const QList<ElementIndex> &hierarchy)
 {
+    // Resolve the path against the tag index first - it is kept
+    // current incrementally and shared with GetCaretLocation, so the
+    // common round trip needs no parse at all.
+    int pos = ResolveHierarchyOffset(hierarchy);
+    if (pos >= 0) {
+        QTextBlock block = document()->findBlock(pos);
+        if (block.isValid()) {
+            return std::make_tuple(block.blockNumber() + 1, pos - block.position() + 1);
+        }
+    }
+
+    // fall back to a full gumbo parse for the paths the tag index
+    // cannot resolve (interior text nodes of mixed content)
     QString source = toPlainText();
     QString version = "any_version";
     GumboInterface gi = GumboInterface(source, version);
@@ -3743,6 +4109,7 @@ void CodeViewEditor::ConnectSignalsToSlots()
     connect(this, SIGNAL(cursorPositionChanged()), this, SLOT(EmitFilteredCursorMoved()));
     connect(this, SIGNAL(textChanged()), this, SIGNAL(PageUpdated()));
     connect(this, SIGNAL(textChanged()), this, SLOT(TextChangedFilter()));
+    connect(document(), SIGNAL(contentsChange(int,int,int)), this, SLOT(SourceChangedFilter(int,int,int)), Qt::UniqueConnection);
     connect(this, SIGNAL(undoAvailable(bool)), this, SLOT(UpdateUndoAvailable(bool)));
     connect(this, SIGNAL(selectionChanged()), this, SLOT(ResetLastFindMatch()));
     connect(m_ScrollOneLineUp,   SIGNAL(activated()), this, SLOT(ScrollOneLineUp()));
@@ -80,6 +80,28 @@ public:
     CodeViewEditor(HighlighterType highlighter_type, bool check_spelling = false, QWidget *parent = 0);
     ~CodeViewEditor();
 
+    /**
+     * Returns a recycled editor of the requested flavor from the pool,
+     * or constructs a new one when none is parked.  Editors cycle
+     * through dozens of chapters per session and construction of the
+     * widget, highlighter and shortcuts is not free.
+     *
+     * @param highlighter_type Which syntax highlighter to use.
+     * @param check_spelling Whether spell checking is wanted.
+     * @param parent The new parent of the editor.
+     * @return A ready-to-use editor awaiting CustomSetDocument().
+     */
+    static CodeViewEditor *AcquireFromPool(HighlighterType highlighter_type, bool check_spelling, QWidget *parent);
+
+    /**
+     * Parks an editor for later reuse instead of destroying it.
+     * The editor is detached from its document and its per-document
+     * state is cleared; excess editors beyond the pool cap are deleted.
+     *
+     * @param editor The editor being released by a closing tab.
+     */
+    static void ReleaseToPool(CodeViewEditor *editor);
+
     void SetAppearance();
 
     QSize sizeHint() const;
@@ -415,6 +437,12 @@ signals:
      */
     void FilteredTextChanged();
 
+    /**
+     * The raw edit delta of every document change, re-emitted from
+     * contentsChange so offsets held outside the editor can be rebased.
+     */
+    void SourceDelta(int position, int charsRemoved, int charsAdded);
+
     void OpenClipEditorRequest(ClipEditorModel::clipEntry *);
 
     void OpenIndexEditorRequest(IndexEditorModel::indexEntry *);
@@ -520,8 +548,22 @@ private slots:
      */
     void TextChangedFilter();
 
+    /**
+     * Tracks the damaged region reported by the document so the
+     * tag list can be updated incrementally instead of re-parsed.
+     */
+    void SourceChangedFilter(int position, int charsRemoved, int charsAdded);
+
     void PasteClipEntryFromName(const QString &name);
 
+    /**
+     * Spell checks the next run of blocks left deferred by
+     * RehighlightDocument() and reschedules itself until the whole
+     * document has been covered.  Running from the event loop keeps
+     * typing and scrolling responsive while a big file catches up.
+     */
+    void RehighlightNextChunk();
+
     /**
      * Used solely to update the m_isUndoAvailable variable
      * on undo availability change.
@@ -582,6 +624,12 @@ private:
 
     void MaybeRegenerateTagList();
 
+    /**
+     * Points the editor at its own blank document and clears all
+     * per-document state, in preparation for parking in the pool.
+     */
+    void DetachDocument();
+
     QString RemoveFirstTag(const QString &text, const QString &tagname);
     QString RemoveLastTag(const QString &text, const QString &tagname);
 
@@ -672,12 +720,14 @@ private:
     /**
      * Returns a stack of elements representing the
      * current location of the caret in the document.
+     * Built by replaying the tag list up to the target tag,
+     * so no reparse of the document source is needed.
      *
-     * @param offset The number of characters from document start to the end of
-     *               the start tag of the element the caret is residing in.
+     * @param target The index in m_TagList of the start tag of
+     *               the element the caret is residing in.
      * @return The element location stack.
      */
-    QStack<StackElement> GetCaretLocationStack(int offset) const;
+    QStack<StackElement> GetCaretLocationStack(int target);
 
     /**
      * Takes the stack provided by GetCaretLocationStack()
@@ -700,7 +750,18 @@ private:
      * @param hierarchy The caret location as ElementIndex hierarchy.
      * @return The info needed to move the caret to the new location.
      */
-    std::tuple<int, int> ConvertHierarchyToCaretMove(const QList<ElementIndex> &hierarchy) const;
+    std::tuple<int, int> ConvertHierarchyToCaretMove(const QList<ElementIndex> &hierarchy);
+
+    /**
+     * Resolves a ViewEditor element hierarchy to a source offset using
+     * the tag index, so both sync directions share the same TagLister
+     * offsets instead of reparsing the document.
+     *
+     * @param hierarchy The caret location as ElementIndex hierarchy.
+     * @return The offset of the addressed tag, or -1 if the path needs
+     *         a full parse to resolve (see ConvertHierarchyToCaretMove).
+     */
+    int ResolveHierarchyOffset(const QList<ElementIndex> &hierarchy);
 
     /**
      * Insert HTML tags around the current selection.
@@ -761,6 +822,19 @@ private:
 
     void SelectAndScrollIntoView(int start_position, int end_position, Searchable::Direction direction, bool wrapped);
 
+    /**
+     * The persistent style model for the current document text,
+     * built on first use and updated in place as the user edits.
+     */
+    HTMLStyleInfo *GetStyleInfo();
+
+    /**
+     * All matches of the regex in the document, memoized against the
+     * document revision so stepping through matches (Find Next on an
+     * unchanged document) does not re-scan the whole text.
+     */
+    const QList<SPCRE::MatchInfo> &GetMatchCache(const QString &search_regex, const QString &text);
+
     ///////////////////////////////
     // PRIVATE MEMBER VARIABLES
     ///////////////////////////////
@@ -833,6 +907,19 @@ private:
      */
     bool m_checkSpelling;
 
+    /**
+     * Which syntax highlighter this view was built with, so the
+     * editor pool only hands it back out for the same flavor of tab.
+     */
+    HighlighterType m_highlighterType;
+
+    /**
+     * A blank stand-in document owned by the editor that it is
+     * pointed at while parked in the pool, so a recycled editor
+     * holds no reference into a closed tab's resource.
+     */
+    TextDocument *m_ParkedDocument;
+
     /**
      * Whether reformat CSS context menu option is enabled on this view.
      */
@@ -880,6 +967,26 @@ private:
 
     TagLister m_TagList;
     bool m_regen_taglist;
+
+    // damaged region pending for the tag list, -1 start means a
+    // full regeneration is needed instead of an incremental update
+    int m_damageStart;
+    int m_damageEnd;
+    int m_damageDelta;
+
+    // lazily built style model for the current document, kept warm
+    // across edits via HTMLStyleInfo::updateRange
+    HTMLStyleInfo *m_StyleInfo;
+
+    // memoized whole-document match list for stepping through matches
+    QString m_MatchCachePattern;
+    int m_MatchCacheRevision;
+    QList<SPCRE::MatchInfo> m_MatchCache;
+
+    // next block number the chunked spell check pass will visit,
+    // and whether such a pass is currently scheduled
+    int m_RehighlightNextBlock;
+    bool m_RehighlightPending;
 };
 
 #endif // CODEVIEWEDITOR_H
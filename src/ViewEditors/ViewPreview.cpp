@@ -58,6 +58,11 @@ const QString SET_PREVIEW_COLORS =
     "document.body.style.backgroundColor=\"%1\"; "
     "document.body.style.color=\"%2\";";
 
+// reads the caret path the page-side tracker maintains; the guard
+// returns an empty path if the installer has not run on this page yet
+const QString GET_CARET_PATH_JS =
+    "typeof window.SigilGetCaretPath !== 'undefined' ? window.SigilGetCaretPath() : ''";
+
 
 struct JSResult {
   QVariant res;
@@ -78,14 +83,25 @@ struct SetJavascriptResultFunctor {
     }
 };
 
+struct SetCaretPathResultFunctor {
+    ViewPreview * view;
+    int epoch;
+    SetCaretPathResultFunctor(ViewPreview * view, int epoch) : view(view), epoch(epoch) {}
+    void operator()(const QVariant &result) {
+        view->CaretPathQueryDone(epoch, result.toString());
+    }
+};
+
 ViewPreview::ViewPreview(QWidget *parent)
     : QWebEngineView(parent),
       m_isLoadFinished(false),
-      m_ViewWebPage(new WebEngPage(this)),
+      m_ViewWebPage(WebEngPage::GetWarmPage(this)),
       c_jQuery(Utility::ReadUnicodeTextFile(":/javascript/jquery-2.2.4.min.js")),
       c_jQueryScrollTo(Utility::ReadUnicodeTextFile(":/javascript/jquery.scrollTo-2.1.2-min.js")),
-      c_GetCaretLocation(Utility::ReadUnicodeTextFile(":/javascript/book_view_current_location.js")),
+      c_InstallCaretPath(Utility::ReadUnicodeTextFile(":/javascript/book_view_current_location.js")),
       m_CaretLocationUpdate(QString()),
+      m_CaretPathValid(false),
+      m_CaretPathEpoch(0),
       m_CustomSetDocumentInProgress(false),
       m_pendingScrollToFragment(QString()),
       m_LoadOkay(false),
@@ -275,6 +291,10 @@ void ViewPreview::LoadingStarted()
     DBG qDebug() << "Loading a page started";
     m_isLoadFinished = false;
     m_LoadOkay = false;
+    // A new page invalidates the cached caret location; bumping the
+    // epoch drops any query result still in flight for the old page.
+    m_CaretPathValid = false;
+    m_CaretPathEpoch++;
 }
 
 
@@ -379,6 +399,8 @@ void ViewPreview::WebPageJavascriptOnLoad()
     DBG qDebug() << "WebPageJavascriptOnLoad start";
     page()->runJavaScript(c_jQuery, QWebEngineScript::ApplicationWorld);
     page()->runJavaScript(c_jQueryScrollTo, QWebEngineScript::ApplicationWorld);
+    // the tracker needs jQuery, so it installs right after it
+    page()->runJavaScript(c_InstallCaretPath, QWebEngineScript::ApplicationWorld);
     DBG qDebug() << "WebPageJavascriptOnLoad end";
     DBG qDebug() << "WebPageJavascriptOnLoad with m_CustomSetDocumentInProgress: " << m_CustomSetDocumentInProgress;
     m_isLoadFinished = true;
@@ -430,12 +452,46 @@ QString ViewPreview::GetElementSelectingJS_NoTextNodes(const QList<ElementIndex>
 
 QList<ElementIndex> ViewPreview::GetCaretLocation()
 {
-    // The location element hierarchy encoded in a string
-    QString location_string = EvaluateJavascript(c_GetCaretLocation).toString();
+    // The background query keyed on the page's selection usually has
+    // the answer already, sparing the blocking round trip below.
+    if (m_CaretPathValid) {
+        DBG qDebug() << "GetCaretLocation from cache: " << m_CachedCaretPath;
+        return ConvertQWebPathToHierarchy(m_CachedCaretPath);
+    }
+
+    // The page-side tracker keeps the path current from selectionchange
+    // events, so even this blocking fallback is one cheap read rather
+    // than a DOM walk.
+    QString location_string = EvaluateJavascript(GET_CARET_PATH_JS).toString();
     DBG qDebug() << "GetCaretLocation: " << location_string;
+    m_CachedCaretPath = location_string;
+    m_CaretPathValid = true;
     return ConvertQWebPathToHierarchy(location_string);
 }
 
+void ViewPreview::RefreshCaretPathCache()
+{
+    m_CaretPathValid = false;
+    m_CaretPathEpoch++;
+
+    if (!m_isLoadFinished) {
+        return;
+    }
+
+    page()->runJavaScript(GET_CARET_PATH_JS, QWebEngineScript::ApplicationWorld,
+                          SetCaretPathResultFunctor(this, m_CaretPathEpoch));
+}
+
+void ViewPreview::CaretPathQueryDone(int epoch, const QString &path)
+{
+    if (epoch != m_CaretPathEpoch) {
+        return;
+    }
+
+    m_CachedCaretPath = path;
+    m_CaretPathValid = true;
+}
+
 QList<ElementIndex> ViewPreview::ConvertQWebPathToHierarchy(const QString & webpath) const
 {
     // The location element hierarchy encoded in a string
@@ -531,4 +587,8 @@ void ViewPreview::ConnectSignalsToSlots()
     connect(page(), SIGNAL(LinkClicked(const QUrl &)), this, SIGNAL(LinkClicked(const QUrl &)));
     connect(page(), SIGNAL(loadProgress(int)), this, SLOT(LoadingProgress(int)));
     connect(page(), SIGNAL(linkHovered(const QString &)), this, SLOT(LinkHovered(const QString &)));
+    // The caret location query only depends on the selection and the
+    // loaded page, so it is re-run in the background whenever the
+    // selection moves and served from the cache when next asked for.
+    connect(page(), SIGNAL(selectionChanged()), this, SLOT(RefreshCaretPathCache()));
 }
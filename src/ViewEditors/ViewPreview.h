@@ -107,6 +107,13 @@ public:
 
     void StoreCurrentCaretLocation();
 
+    /**
+     * Called by the background caret location query with its result.
+     * Results from a stale epoch (the page or selection has changed
+     * since the query was issued) are dropped.
+     */
+    void CaretPathQueryDone(int epoch, const QString &path);
+
 
 public slots:
 
@@ -169,6 +176,13 @@ private slots:
         ExecuteCaretUpdate();
     }
 
+    /**
+     * Invalidates the cached caret location and issues a background
+     * query for the new one, so the next GetCaretLocation() can skip
+     * the blocking round trip into the web page.
+     */
+    void RefreshCaretPathCache();
+
 private:
 
     /**
@@ -219,11 +233,13 @@ private:
     const QString c_jQueryScrollTo;
 
     /**
-     * The JavaScript source code used
-     * to get a hierarchy of elements from
-     * the caret element to the top of the document.
+     * The JavaScript source code that installs the page-side caret
+     * path tracker.  It keeps the hierarchy of elements from the caret
+     * element to the top of the document in a page variable, updated
+     * from selectionchange events, so queries are a cheap read instead
+     * of a DOM walk.
      */
-    const QString c_GetCaretLocation;
+    const QString c_InstallCaretPath;
 
     /**
      * Stores the JavaScript source code for the
@@ -231,6 +247,21 @@ private:
      */
     QString m_CaretLocationUpdate;
 
+    /**
+     * The caret location query result maintained in the background.
+     * The query is a pure function of the page's selection and DOM,
+     * so the cache stays valid until the selection changes or a new
+     * page loads.  @see RefreshCaretPathCache().
+     */
+    QString m_CachedCaretPath;
+    bool m_CaretPathValid;
+
+    /**
+     * Bumped on every invalidation so a background query result that
+     * arrives late for an old page or selection is simply dropped.
+     */
+    int m_CaretPathEpoch;
+
     bool  m_CustomSetDocumentInProgress;
     QString m_pendingScrollToFragment;
 
@@ -19,6 +19,7 @@
 **
 *************************************************************************/
 #include <QTimer>
+#include <QApplication>
 #include <QtWebEngineWidgets/QWebEnginePage>
 #include <QUrl>
 #include <QDebug>
@@ -26,7 +27,13 @@
 #include "ViewEditors/WebEngPage.h"
 
 #define DBG if(0)
- 
+
+// Delay before warming a replacement spare page so the work lands after
+// the window construction that consumed the old one has settled.
+static const int WARM_PAGE_DELAY_MS = 1000;
+
+WebEngPage *WebEngPage::m_WarmPage = nullptr;
+
 WebEngPage::WebEngPage(QObject *parent)
     : QWebEnginePage(parent)
 {
@@ -34,6 +41,32 @@ WebEngPage::WebEngPage(QObject *parent)
     setUrl(QUrl("about:blank"));
 }
 
+void WebEngPage::WarmUpPage()
+{
+    if (m_WarmPage) return;
+    // parent the spare to the application so it is cleaned up at exit
+    // if it is never handed out
+    m_WarmPage = new WebEngPage(qApp);
+    DBG qDebug() << "warmed a spare WebEngPage";
+}
+
+WebEngPage *WebEngPage::GetWarmPage(QObject *parent)
+{
+    WebEngPage *apage = m_WarmPage;
+    m_WarmPage = nullptr;
+    if (apage) {
+        DBG qDebug() << "handing out the warm WebEngPage";
+        apage->setParent(parent);
+        // the load of about:blank done at warm-up is long finished, so
+        // reset the background colour in case the palette changed since
+        apage->setBackgroundColor(Utility::WebViewBackgroundColor(true));
+    } else {
+        apage = new WebEngPage(parent);
+    }
+    QTimer::singleShot(WARM_PAGE_DELAY_MS, WebEngPage::WarmUpPage);
+    return apage;
+}
+
 // Because you can not delegate all links in QtWebEngine we must override here and generate
 // our own link requests
 
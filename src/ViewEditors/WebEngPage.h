@@ -34,6 +34,16 @@ class WebEngPage : public QWebEnginePage
 public:
     WebEngPage(QObject *parent = 0);
 
+    // Returns the pre-warmed spare page if one is ready (re-parented to
+    // the caller), otherwise constructs a page on the spot.  Either way
+    // a replacement spare is warmed once the event loop goes idle, so
+    // the next Preview view pays no QtWebEngine spin-up.
+    static WebEngPage *GetWarmPage(QObject *parent);
+
+    // Constructs the spare page ahead of need; simply loading
+    // about:blank in the constructor is what starts the render process.
+    static void WarmUpPage();
+
     bool acceptNavigationRequest(const QUrl & url, QWebEnginePage::NavigationType ntype, bool isMainFrame);
     void javaScriptConsoleMessage(QWebEnginePage::JavaScriptConsoleMessageLevel level, 
                                   const QString & message, int lineNumber, const QString & sourceID);
@@ -46,6 +56,10 @@ private slots:
 
 private:
     QUrl m_url;
+
+    // The single spare page kept warm for the next ViewPreview; only
+    // one Preview view exists per main window so one spare suffices.
+    static WebEngPage *m_WarmPage;
 };
 
 #endif // WEBENGPAGE_H
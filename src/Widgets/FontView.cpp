@@ -30,7 +30,8 @@
 #include <QGuiApplication>
 #include <QApplication>
 #include <QFont>
-#include <QRawFont>
+#include <QFutureWatcher>
+#include <QtConcurrent/QtConcurrent>
 #include <QDebug>
 
 #include "ViewEditors/SimplePage.h"
@@ -72,7 +73,8 @@ static const QString FONT_HTML_BASE =
 FontView::FontView(QWidget *parent)
     : QWidget(parent),
       m_WebView(new QWebEngineView(this)),
-      m_layout(new QVBoxLayout(this))
+      m_layout(new QVBoxLayout(this)),
+      m_DetailsWatcher(new QFutureWatcher<FontResource::FontDetails>(this))
 {
     m_WebView->setPage(new SimplePage(m_WebView));
     m_WebView->setContextMenuPolicy(Qt::NoContextMenu);
@@ -80,6 +82,7 @@ FontView::FontView(QWidget *parent)
     m_WebView->setAcceptDrops(false);
     m_WebView->setUrl(QUrl("about:blank"));
     m_layout->addWidget(m_WebView);
+    connect(m_DetailsWatcher, SIGNAL(finished()), this, SLOT(DisplayFontDetails()));
 }
 
 FontView::~FontView()
@@ -90,31 +93,40 @@ void FontView::ShowFont(QString path)
 {
     m_path = path;
     m_WebView->page()->profile()->clearHttpCache();
+    // Parsing the font file is the slow part of opening a font tab, so
+    // it runs on a pool thread; setFuture() drops any earlier parse
+    // still in flight, so only the last requested font is displayed.
+    m_DetailsWatcher->setFuture(QtConcurrent::run(&FontResource::GetFontDetails, path));
+}
+
+void FontView::DisplayFontDetails()
+{
+    QString path = m_path;
+    FontResource::FontDetails font = m_DetailsWatcher->result();
     QFileInfo fi(path);
     QString file_name = fi.fileName();
     int file_size = fi.size();
     QString font_name = fi.baseName();
-    QRawFont rawfont(path, 16.0);
-    QString family_name = rawfont.familyName();
+    QString family_name = font.family;
     QString desc = family_name;
     QString weight_name;
     QString style_name;
-    if (rawfont.weight() <  QFont::ExtraLight)      weight_name = "Thin";
-    else if (rawfont.weight() <  QFont::Light)      weight_name = "ExtraLight";
-    else if (rawfont.weight() <  QFont::Normal)     weight_name = "Light";
-    else if (rawfont.weight() <  QFont::Medium)     weight_name = "Normal";
-    else if (rawfont.weight() <  QFont::DemiBold)   weight_name = "Medium";
-    else if (rawfont.weight() <  QFont::Bold)       weight_name = "DemiBold";
-    else if (rawfont.weight() <  QFont::ExtraBold)  weight_name = "Bold";
-    else if (rawfont.weight() <  QFont::Black)      weight_name = "ExtraBold";
-    else if (rawfont.weight() >= QFont::Black)      weight_name = "Black";
+    if (font.weight <  QFont::ExtraLight)      weight_name = "Thin";
+    else if (font.weight <  QFont::Light)      weight_name = "ExtraLight";
+    else if (font.weight <  QFont::Normal)     weight_name = "Light";
+    else if (font.weight <  QFont::Medium)     weight_name = "Normal";
+    else if (font.weight <  QFont::DemiBold)   weight_name = "Medium";
+    else if (font.weight <  QFont::Bold)       weight_name = "DemiBold";
+    else if (font.weight <  QFont::ExtraBold)  weight_name = "Bold";
+    else if (font.weight <  QFont::Black)      weight_name = "ExtraBold";
+    else if (font.weight >= QFont::Black)      weight_name = "Black";
     if (!desc.isEmpty()) {
         if (desc.contains(weight_name)) weight_name = "";
         if (!weight_name.isEmpty()) desc = desc + " " + weight_name;
     }
 
-    if (rawfont.style()      == QFont::StyleItalic)  style_name = "Italic";
-    else if (rawfont.style() == QFont::StyleOblique) style_name = "Oblique";
+    if (font.style      == QFont::StyleItalic)  style_name = "Italic";
+    else if (font.style == QFont::StyleOblique) style_name = "Oblique";
 
     if (!desc.isEmpty()) {
         if (!style_name.isEmpty()) desc = desc + " " + style_name;
@@ -25,6 +25,9 @@
 
 #include <QString>
 #include <QWidget>
+#include <QFutureWatcher>
+
+#include "ResourceObjects/FontResource.h"
 
 class QVBoxLayout;
 class QWebEngineView;
@@ -41,10 +44,16 @@ class FontView : public QWidget
     void ShowFont(QString path);
     void ReloadViewer();
 
+ private slots:
+    // builds and loads the preview html once the worker parsing
+    // the font file has delivered its properties
+    void DisplayFontDetails();
+
  private:
     QString m_path;
     QWebEngineView *m_WebView;
     QVBoxLayout* m_layout;
+    QFutureWatcher<FontResource::FontDetails> *m_DetailsWatcher;
 };
 
 #endif // FONTVIEW_H
@@ -22,17 +22,21 @@
 
 #include <QString>
 #include <QImage>
+#include <QImageReader>
 #include <QFileInfo>
 #include <QVBoxLayout>
 #include <QApplication>
 #include <QGuiApplication>
 #include <QPrinter>
 #include <QtWidgets/QLayout>
+#include <QtConcurrent/QtConcurrent>
 #include <QtWebEngineWidgets/QWebEngineView>
+#include <QtWebEngineWidgets/QWebEngineScript>
 #include <QtWebEngineWidgets/QWebEngineSettings>
 #include <QtWebEngineWidgets/QWebEngineProfile>
 
 #include "ViewEditors/SimplePage.h"
+#include "Misc/ImageCache.h"
 #include "Misc/Utility.h"
 #include "Widgets/ImageView.h"
 
@@ -49,7 +53,7 @@ static const QString IMAGE_HTML_BASE =
     "<body>"
     "<p><img src=\"%1\" /></p>"
     "<hr />"
-    "<div>%2&times;%3px | %4 KB | %5%6</div>"
+    "<div id=\"sigil_image_info\">%2&times;%3px | %4 KB | %5%6</div>"
     "</body>"
     "</html>";
 
@@ -58,7 +62,8 @@ ImageView::ImageView(QWidget *parent)
     :
     QWidget(parent),
     m_WebView(new QWebEngineView(this)),
-    m_layout(new QVBoxLayout(this))
+    m_layout(new QVBoxLayout(this)),
+    m_InfoWatcher(new QFutureWatcher<ColorInfo>(this))
 {
     m_WebView->setPage(new SimplePage(m_WebView));
     m_WebView->setContextMenuPolicy(Qt::NoContextMenu);
@@ -66,40 +71,98 @@ ImageView::ImageView(QWidget *parent)
     m_WebView->setAcceptDrops(false);
     m_WebView->setUrl(QUrl("about:blank"));
     m_layout->addWidget(m_WebView);
+    connect(m_InfoWatcher, SIGNAL(finished()), this, SLOT(DisplayColorInfo()));
+    // covers the decode finishing before the page has loaded
+    connect(m_WebView, SIGNAL(loadFinished(bool)), this, SLOT(UpdateInfoLine()));
 }
 
 ImageView::~ImageView()
 {
 }
 
+// static
+ImageView::ColorInfo ImageView::GetColorInfo(const QString &path)
+{
+    // the shared cache means the report and insert dialogs reuse this
+    // decode (and vice versa) instead of each decoding the file again
+    const QImage img = ImageCache::instance()->GetImage(path);
+    ColorInfo info;
+    info.width = img.width();
+    info.height = img.height();
+    info.depth = img.depth();
+    info.bitPlaneCount = img.bitPlaneCount();
+    info.colorCount = img.colorCount();
+    info.grayscale = img.isGrayscale();
+    return info;
+}
+
 void ImageView::ShowImage(QString path)
 {
     m_path = path;
+    m_InfoLine = QString();
     m_WebView->page()->profile()->clearHttpCache();
     const QFileInfo fileInfo = QFileInfo(path);
     const double ffsize = fileInfo.size() / 1024.0;
     const QString fsize = QLocale().toString(ffsize, 'f', 2);
-    const QImage img(path);
     const QUrl imgUrl = QUrl::fromLocalFile(path);
-    QString colors_shades = img.isGrayscale() ? tr("shades") : tr("colors");
-    QString grayscale_color = img.isGrayscale() ? tr("Grayscale") : tr("Color");
-    QString colorsInfo = "";
-    if (img.depth() == 32) {
-        colorsInfo = QString(" %1bpp").arg(img.bitPlaneCount());
-    } else if (img.depth() > 0) {
-        colorsInfo = QString(" %1bpp (%2 %3)").arg(img.bitPlaneCount()).arg(img.colorCount()).arg(colors_shades);
-    }
+    // The render process decodes the image itself off the GUI thread,
+    // so the page goes up immediately; only the dimensions are needed
+    // here and QImageReader reads them from the file header without
+    // decoding any pixels.  The color properties do need a full decode
+    // and arrive from a pool thread once it is done.
+    QImageReader reader(path);
+    const QSize img_size = reader.size();
     QString html = IMAGE_HTML_BASE.arg(imgUrl.toString())
-                              .arg(img.width())
-                              .arg(img.height())
+                              .arg(img_size.isValid() ? img_size.width() : 0)
+                              .arg(img_size.isValid() ? img_size.height() : 0)
                               .arg(fsize)
-                              .arg(grayscale_color)
-                              .arg(colorsInfo);
+                              .arg("")
+                              .arg("");
     if (Utility::IsDarkMode()) {
         html = Utility::AddDarkCSS(html);
     }
     m_WebView->page()->setBackgroundColor(Utility::WebViewBackgroundColor());
     m_WebView->setHtml(html, imgUrl);
+    // setFuture() drops any earlier decode still in flight, so only the
+    // last requested image gets its info line filled in
+    m_InfoWatcher->setFuture(QtConcurrent::run(&ImageView::GetColorInfo, path));
+}
+
+void ImageView::DisplayColorInfo()
+{
+    ColorInfo img = m_InfoWatcher->result();
+    const QFileInfo fileInfo = QFileInfo(m_path);
+    const double ffsize = fileInfo.size() / 1024.0;
+    const QString fsize = QLocale().toString(ffsize, 'f', 2);
+    QString colors_shades = img.grayscale ? tr("shades") : tr("colors");
+    QString grayscale_color = img.grayscale ? tr("Grayscale") : tr("Color");
+    QString colorsInfo = "";
+    if (img.depth == 32) {
+        colorsInfo = QString(" %1bpp").arg(img.bitPlaneCount);
+    } else if (img.depth > 0) {
+        colorsInfo = QString(" %1bpp (%2 %3)").arg(img.bitPlaneCount).arg(img.colorCount).arg(colors_shades);
+    }
+    m_InfoLine = QString("%1×%2px | %3 KB | %4%5")
+                     .arg(img.width)
+                     .arg(img.height)
+                     .arg(fsize)
+                     .arg(grayscale_color)
+                     .arg(colorsInfo);
+    UpdateInfoLine();
+}
+
+void ImageView::UpdateInfoLine()
+{
+    if (m_InfoLine.isEmpty()) {
+        return;
+    }
+    // the element lookup makes this a no-op if the page is still
+    // loading; the loadFinished connection re-applies it afterwards
+    QString info = m_InfoLine;
+    info.replace("\\", "\\\\").replace("'", "\\'");
+    m_WebView->page()->runJavaScript(
+        QString("var e = document.getElementById('sigil_image_info'); if (e) { e.textContent = '%1'; }").arg(info),
+        QWebEngineScript::ApplicationWorld);
 }
 
 void ImageView::ReloadViewer()
@@ -24,6 +24,8 @@
 #ifndef IMAGEVIEW_H
 #define IMAGEVIEW_H
 
+#include <QFutureWatcher>
+#include <QString>
 #include <QWidget>
 
 class QVBoxLayout;
@@ -38,14 +40,39 @@ public:
     ImageView(QWidget *parent = 0);
     ~ImageView();
 
+    /**
+     * The properties of an image that need a full pixel decode.
+     * The dimensions also travel here so the info line reflects the
+     * decoded image, not just the file header.
+     */
+    struct ColorInfo {
+        int width;
+        int height;
+        int depth;
+        int bitPlaneCount;
+        int colorCount;
+        bool grayscale;
+    };
+
 public slots:
     void ShowImage(QString path);
     void ReloadViewer();
 
+private slots:
+    // fills in the decode-dependent parts of the info line once the
+    // worker decoding the image has delivered its properties
+    void DisplayColorInfo();
+    void UpdateInfoLine();
+
 private:
+    // runs on a pool thread; decodes through the shared ImageCache
+    static ColorInfo GetColorInfo(const QString &path);
+
     QString m_path;
+    QString m_InfoLine;
     QWebEngineView *m_WebView;
     QVBoxLayout* m_layout;
+    QFutureWatcher<ColorInfo> *m_InfoWatcher;
 };
 
 #endif // IMAGEVIEW_H
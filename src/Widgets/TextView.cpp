@@ -63,6 +63,9 @@ TextView::TextView(QWidget *parent)
 {
     UpdateLineNumberAreaMargin();
     setReadOnly(true);
+    // viewers never edit, so do not let the document build an undo
+    // stack - on a large diff that stack duplicates the whole text
+    setUndoRedoEnabled(false);
     setTextInteractionFlags(textInteractionFlags() | Qt::TextSelectableByKeyboard);
     setLineWrapMode(QPlainTextEdit::WidgetWidth);
     QFont cf = font();
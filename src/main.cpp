@@ -29,6 +29,7 @@
 #include <QtCore/QLibraryInfo>
 #include <QStyleFactory>
 #include <QtCore/QTextCodec>
+#include <QtCore/QThread>
 #include <QtCore/QThreadPool>
 #include <QtCore/QTranslator>
 #include <QtCore/QStandardPaths>
@@ -51,6 +52,7 @@
 #include "MainUI/MainApplication.h"
 #include "MainUI/MainWindow.h"
 #include "Misc/AppEventFilter.h"
+#include "Misc/HeadlessBench.h"
 #include "Misc/SigilDarkStyle.h"
 #include "Misc/SettingsStore.h"
 #include "Misc/TempFolder.h"
@@ -357,6 +359,11 @@ int main(int argc, char *argv[])
     // that way, we always have a steady number of threads ready to do work.
     // QThreadPool::globalInstance()->setExpiryTimeout(-1);
 
+    // Every parallel pass - imports, saves, spell scans, searches -
+    // shares the global pool.  Leave one core free so the GUI thread
+    // keeps painting and typing stays smooth while a batch grinds away.
+    QThreadPool::globalInstance()->setMaxThreadCount(qMax(1, QThread::idealThreadCount() - 1));
+
     // QtWebEngine may need this
     QCoreApplication::setAttribute(Qt::AA_ShareOpenGLContexts);
 
@@ -386,6 +393,10 @@ int main(int argc, char *argv[])
     EmbeddedPython* epython = EmbeddedPython::instance();
     epython->addToPythonSysPath(epython->embeddedRoot());
     epython->addToPythonSysPath(PluginDB::launcherRoot() + "/python");
+    // Warm the modules the book open/save paths always hit so their
+    // first use does not pay the import cost
+    epython->preloadModules(QStringList() << "xmlprocessor" << "opf_newparser"
+                                          << "metaproc2" << "metaproc3");
 
     try {
 
@@ -623,6 +634,20 @@ int main(int argc, char *argv[])
         if (arguments.contains("-t")) {
             std::cout  << TempFolder::GetPathToSigilScratchpad().toStdString() << std::endl;
             return 1;
+        } else if (arguments.contains("--bench")) {
+            // headless benchmark of import -> mend -> export over a
+            // corpus directory; no windows are ever shown
+            int idx = arguments.indexOf("--bench");
+            QString corpusdir  = arguments.value(idx + 1);
+            QString reportpath = arguments.value(idx + 2);
+            return HeadlessBench::Run(corpusdir, reportpath);
+        } else if (arguments.contains("--bench-micro")) {
+            // micro benchmarks of the parser and search primitives
+            // over a folder tree of xhtml and css files
+            int idx = arguments.indexOf("--bench-micro");
+            QString corpusdir  = arguments.value(idx + 1);
+            QString reportpath = arguments.value(idx + 2);
+            return HeadlessBench::RunMicro(corpusdir, reportpath);
         } else {
             // Normal startup
 